@@ -363,6 +363,15 @@
 
   \snippet cs_user_parameters-linear_solvers.c sles_user_1
 
+  \subsection cs_user_parameters_h_sles_ilu0_1 Example: ILU(0) preconditioning
+
+  The following example shows how to use a BiCGStab solver with
+  ILU(0) preconditioning for the velocity. ILU(0) and symmetric
+  Gauss-Seidel preconditioners are process-local, and their triangular
+  solves are threaded using level scheduling.
+
+  \snippet cs_user_parameters-linear_solvers.c sles_ilu0_1
+
   \subsection cs_user_parameters_h_sles_verbosity_1 Changing the verbosity
 
   By default, a linear solver uses the same verbosity as its matching variable,
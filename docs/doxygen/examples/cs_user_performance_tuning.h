@@ -38,6 +38,11 @@
 
   \snippet cs_user_performance_tuning-numbering.c performance_tuning_numbering
 
+  Alternatively, the cells and interior faces numbering algorithms may be
+  selected automatically, based on measured performance:
+
+  \snippet cs_user_performance_tuning-numbering.c performance_tuning_numbering_autotune
+
   \section cs_user_performance_tuning_h_cs_user_performance_tuning_partition  Advanced partitioning
 
   \subsection cs_user_performance_tuning_h_cs_user_performance_tuning_partition_1 Example 1
@@ -709,6 +709,8 @@ _create_coeff_native(void)
   mc->_da = NULL;
   mc->_xa = NULL;
 
+  mc->conv_diff = NULL;
+
   return mc;
 }
 
@@ -732,11 +734,39 @@ _destroy_coeff_native(cs_matrix_coeff_native_t **coeff)
     if (mc->_da != NULL)
       BFT_FREE(mc->_da);
 
+    BFT_FREE(mc->conv_diff);
+
     BFT_FREE(*coeff);
 
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Remove matrix-free convection-diffusion definition of native matrix
+ * extra-diagonal terms, restoring the matrix.vector product functions.
+ *
+ * parameters:
+ *   matrix <-- pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_release_conv_diff_native(cs_matrix_t  *matrix)
+{
+  cs_matrix_coeff_native_t  *mc = matrix->coeffs;
+
+  if (mc == NULL || mc->conv_diff == NULL)
+    return;
+
+  for (int i = 0; i < 2; i++) {
+    cs_matrix_fill_type_t ft
+      = (i == 0) ? CS_MATRIX_SCALAR : CS_MATRIX_SCALAR_SYM;
+    for (int j = 0; j < 2; j++)
+      matrix->vector_multiply[ft][j] = mc->conv_diff->vector_multiply[i][j];
+  }
+
+  BFT_FREE(mc->conv_diff);
+}
+
 /*----------------------------------------------------------------------------
  * Set Native matrix coefficients.
  *
@@ -769,6 +799,8 @@ _set_coeffs_native(cs_matrix_t        *matrix,
   const cs_matrix_struct_native_t  *ms = matrix->structure;
   mc->symmetric = symmetric;
 
+  _release_conv_diff_native(matrix);
+
   /* Map or copy values */
 
   if (da != NULL) {
@@ -778,7 +810,11 @@ _set_coeffs_native(cs_matrix_t        *matrix,
         BFT_REALLOC(mc->_da, matrix->db_size[3]*ms->n_rows, cs_real_t);
         mc->max_db_size = matrix->db_size[3];
       }
-      memcpy(mc->_da, da, matrix->db_size[3]*sizeof(cs_real_t) * ms->n_rows);
+      cs_numbering_first_touch(NULL,
+                               ms->n_rows,
+                               matrix->db_size[3]*sizeof(cs_real_t),
+                               da,
+                               mc->_da);
       mc->da = mc->_da;
     }
     else
@@ -800,7 +836,14 @@ _set_coeffs_native(cs_matrix_t        *matrix,
         BFT_MALLOC(mc->_xa, matrix->eb_size[3]*xa_n_vals, cs_real_t);
         mc->max_eb_size = matrix->eb_size[3];
       }
-      memcpy(mc->_xa, xa, matrix->eb_size[3]*xa_n_vals*sizeof(cs_real_t));
+      /* Copy using the thread partition of edges, so that pages
+         are placed close to the threads using them */
+      cs_numbering_first_touch(matrix->numbering,
+                               ms->n_edges,
+                               matrix->eb_size[3]*(symmetric ? 1 : 2)
+                                                 *sizeof(cs_real_t),
+                               xa,
+                               mc->_xa);
       mc->xa = mc->_xa;
     }
     else
@@ -823,6 +866,7 @@ _release_coeffs_native(cs_matrix_t  *matrix)
   if (mc != NULL) {
     mc->da = NULL;
     mc->xa = NULL;
+    _release_conv_diff_native(matrix);
   }
 }
 
@@ -951,6 +995,101 @@ _mat_vec_p_l_native(bool                exclude_diag,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with native matrix, with
+ * extra-diagonal terms computed on the fly from a matrix-free
+ * convection-diffusion definition.
+ *
+ * Extra-diagonal terms are the same as those built by cs_matrix_scalar,
+ * and are accumulated in the same order, so results are identical.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_native_conv_diff(bool                exclude_diag,
+                              const cs_matrix_t  *matrix,
+                              const cs_real_t     x[restrict],
+                              cs_real_t           y[restrict])
+{
+  const cs_matrix_struct_native_t  *ms = matrix->structure;
+  const cs_matrix_coeff_native_t  *mc = matrix->coeffs;
+  const cs_matrix_coeff_conv_diff_t  *cd = mc->conv_diff;
+
+  const double thetap = cd->thetap;
+  const int iconvp = cd->iconvp;
+  const int idiffp = cd->idiffp;
+  const cs_real_t  *restrict i_massflux = cd->i_massflux;
+  const cs_real_t  *restrict i_visc = cd->i_visc;
+  const cs_real_t  *restrict xcpp = cd->xcpp;
+
+  const cs_lnum_2_t *restrict face_cel_p = ms->edges;
+
+  /* Use thread groups for face loops when available */
+
+  int n_threads = 1, n_groups = 1;
+  cs_lnum_t _group_index[2] = {0, ms->n_edges};
+  const cs_lnum_t *group_index = _group_index;
+
+#if defined(HAVE_OPENMP)
+  if (matrix->numbering != NULL) {
+    if (matrix->numbering->type == CS_NUMBERING_THREADS) {
+      n_threads = matrix->numbering->n_threads;
+      n_groups = matrix->numbering->n_groups;
+      group_index = matrix->numbering->group_index;
+    }
+  }
+#endif
+
+  /* Diagonal part of matrix.vector product */
+
+  if (! exclude_diag) {
+    _diag_vec_p_l(mc->da, x, y, ms->n_rows);
+    _zero_range(y, ms->n_rows, ms->n_cols_ext);
+  }
+  else
+    _zero_range(y, 0, ms->n_cols_ext);
+
+  /* non-diagonal terms */
+
+  for (int g_id = 0; g_id < n_groups; g_id++) {
+
+#   pragma omp parallel for if(n_threads > 1)
+    for (int t_id = 0; t_id < n_threads; t_id++) {
+
+      for (cs_lnum_t face_id = group_index[(t_id*n_groups + g_id)*2];
+           face_id < group_index[(t_id*n_groups + g_id)*2 + 1];
+           face_id++) {
+
+        cs_lnum_t ii = face_cel_p[face_id][0];
+        cs_lnum_t jj = face_cel_p[face_id][1];
+
+        double flui = 0.5*(i_massflux[face_id] - fabs(i_massflux[face_id]));
+        double fluj =-0.5*(i_massflux[face_id] + fabs(i_massflux[face_id]));
+
+        cs_real_t xa_ij, xa_ji;
+
+        if (xcpp == NULL) {
+          xa_ij = thetap*(iconvp*flui - idiffp*i_visc[face_id]);
+          xa_ji = thetap*(iconvp*fluj - idiffp*i_visc[face_id]);
+        }
+        else {
+          xa_ij = thetap*(iconvp*xcpp[ii]*flui - idiffp*i_visc[face_id]);
+          xa_ji = thetap*(iconvp*xcpp[jj]*fluj - idiffp*i_visc[face_id]);
+        }
+
+        y[ii] += xa_ij * x[jj];
+        y[jj] += xa_ji * x[ii];
+
+      }
+    }
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Local matrix.vector product y = A.x with native matrix.
  *
@@ -2267,13 +2406,18 @@ _set_coeffs_csr(cs_matrix_t      *matrix,
 
   const cs_matrix_struct_csr_t  *ms = matrix->structure;
 
-  if (mc->_val == NULL)
+  bool first_touch = false;
+  if (mc->_val == NULL) {
     BFT_MALLOC(mc->_val, ms->row_index[ms->n_rows], cs_real_t);
+    first_touch = true;
+  }
   mc->val = mc->_val;
 
-  /* Initialize coefficients to zero if assembly is incremental */
+  /* Initialize coefficients to zero if assembly is incremental
+     (or on allocation, so that pages are first touched by the
+     threads operating on matching rows) */
 
-  if (ms->direct_assembly == false)
+  if (ms->direct_assembly == false || first_touch)
     _zero_coeffs_csr(matrix);
 
   /* Copy diagonal values */
@@ -3617,14 +3761,22 @@ _set_coeffs_msr(cs_matrix_t         *matrix,
 
   /* Extradiagonal values */
 
-  if (mc->_x_val == NULL)
+  bool first_touch = false;
+  if (mc->_x_val == NULL) {
     BFT_MALLOC(mc->_x_val, ms->row_index[ms->n_rows], cs_real_t);
+    first_touch = true;
+  }
   mc->x_val = mc->_x_val;
 
-  /* Copy extra-diagonal values if assembly is direct */
+  /* Copy extra-diagonal values if assembly is direct
+     (zeroing on allocation so that pages are first touched by the
+     threads operating on matching rows) */
 
-  if (ms->direct_assembly)
+  if (ms->direct_assembly) {
+    if (first_touch)
+      _zero_x_coeffs_msr(matrix);
     _set_xa_coeffs_msr_direct(matrix, symmetric, n_edges, edges, xa);
+  }
 
   /* Initialize coefficients to zero if assembly is incremental */
 
@@ -5965,6 +6117,94 @@ cs_matrix_transfer_coefficients_msr(cs_matrix_t         *matrix,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set matrix-free convection-diffusion coefficients of a native
+ *        scalar matrix.
+ *
+ * The diagonal is mapped, and extra-diagonal terms are not stored, but
+ * computed on the fly from interior face mass flux and viscosity values
+ * when computing matrix.vector products, using the same definition
+ * (upwind convection, diffusion without reconstruction) as
+ * \ref cs_matrix_scalar.
+ *
+ * This avoids building the extra-diagonal coefficients when only a few
+ * matrix.vector products are needed, for example with Jacobi or Krylov
+ * solvers. Extra-diagonal values are not available through queries
+ * (such as \ref cs_matrix_get_extra_diagonal), so such a matrix may not
+ * be used with multigrid or Gauss-Seidel type solvers.
+ *
+ * Mapped arrays must remain valid until coefficients are released;
+ * the matrix.vector product functions of the matrix are replaced until
+ * then, so a private matrix (see \ref cs_matrix_create_by_copy) should
+ * be used rather than one shared by other systems.
+ *
+ * \param[in, out]  matrix      pointer to matrix structure
+ * \param[in]       thetap      weighting coefficient for the theta-scheme
+ * \param[in]       iconvp      1 for convection, 0 otherwise
+ * \param[in]       idiffp      1 for diffusion, 0 otherwise
+ * \param[in]       da          diagonal values
+ * \param[in]       i_massflux  mass flux at interior faces
+ * \param[in]       i_visc      viscosity at interior faces for the matrix
+ * \param[in]       xcpp        convection multiplier (Cp) per cell,
+ *                              with ghost values, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_coefficients_conv_diff(cs_matrix_t      *matrix,
+                                     double            thetap,
+                                     int               iconvp,
+                                     int               idiffp,
+                                     const cs_real_t  *da,
+                                     const cs_real_t  *i_massflux,
+                                     const cs_real_t  *i_visc,
+                                     const cs_real_t  *xcpp)
+{
+  if (matrix == NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("The matrix is not defined."));
+
+  if (matrix->type != CS_MATRIX_NATIVE)
+    bft_error
+      (__FILE__, __LINE__, 0,
+       _("Matrix-free convection-diffusion coefficients require\n"
+         "a matrix in %s format, not %s."),
+       _(cs_matrix_type_name[CS_MATRIX_NATIVE]),
+       _(cs_matrix_type_name[matrix->type]));
+
+  bool symmetric = (iconvp == 0) ? true : false;
+
+  _set_fill_info(matrix, symmetric, NULL, NULL);
+
+  matrix->xa = NULL;
+  _set_coeffs_native(matrix, symmetric, false, 0, NULL, da, NULL);
+
+  cs_matrix_coeff_native_t  *mc = matrix->coeffs;
+  mc->xa = NULL;
+
+  cs_matrix_coeff_conv_diff_t  *cd;
+  BFT_MALLOC(cd, 1, cs_matrix_coeff_conv_diff_t);
+
+  cd->thetap = thetap;
+  cd->iconvp = iconvp;
+  cd->idiffp = idiffp;
+  cd->i_massflux = i_massflux;
+  cd->i_visc = i_visc;
+  cd->xcpp = xcpp;
+
+  for (int i = 0; i < 2; i++) {
+    cs_matrix_fill_type_t ft
+      = (i == 0) ? CS_MATRIX_SCALAR : CS_MATRIX_SCALAR_SYM;
+    for (int j = 0; j < 2; j++) {
+      cd->vector_multiply[i][j] = matrix->vector_multiply[ft][j];
+      matrix->vector_multiply[ft][j] = _mat_vec_p_l_native_conv_diff;
+    }
+  }
+
+  mc->conv_diff = cd;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Release shared matrix coefficients.
@@ -568,6 +568,43 @@ cs_matrix_transfer_coefficients_msr(cs_matrix_t         *matrix,
                                     cs_real_t          **d_val,
                                     cs_real_t          **x_val);
 
+/*----------------------------------------------------------------------------
+ * Set matrix-free convection-diffusion coefficients of a native
+ * scalar matrix.
+ *
+ * The diagonal is mapped, and extra-diagonal terms are not stored, but
+ * computed on the fly from interior face mass flux and viscosity values
+ * when computing matrix.vector products, using the same definition
+ * (upwind convection, diffusion without reconstruction) as
+ * cs_matrix_scalar.
+ *
+ * Extra-diagonal values are not available through queries, so such a
+ * matrix may not be used with multigrid or Gauss-Seidel type solvers.
+ * Mapped arrays must remain valid until coefficients are released, and
+ * a private matrix (see cs_matrix_create_by_copy) should be used.
+ *
+ * parameters:
+ *   matrix     <-> pointer to matrix structure
+ *   thetap     <-- weighting coefficient for the theta-scheme
+ *   iconvp     <-- 1 for convection, 0 otherwise
+ *   idiffp     <-- 1 for diffusion, 0 otherwise
+ *   da         <-- diagonal values
+ *   i_massflux <-- mass flux at interior faces
+ *   i_visc     <-- viscosity at interior faces for the matrix
+ *   xcpp       <-- convection multiplier (Cp) per cell, with ghost
+ *                  values, or NULL
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_coefficients_conv_diff(cs_matrix_t      *matrix,
+                                     double            thetap,
+                                     int               iconvp,
+                                     int               idiffp,
+                                     const cs_real_t  *da,
+                                     const cs_real_t  *i_massflux,
+                                     const cs_real_t  *i_visc,
+                                     const cs_real_t  *xcpp);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Create and initialize a CSR matrix assembler values structure.
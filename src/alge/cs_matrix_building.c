@@ -96,6 +96,226 @@ BEGIN_C_DECLS
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Penalize the diagonal of a scalar matrix if it is not invertible.
+ *
+ * If no Dirichlet condition is present, the diagonal is slightly increased
+ * in order to shift the eigenvalue spectrum, and if a whole line of the
+ * matrix is 0 (disabled cells), the diagonal is set to 1.
+ *
+ * parameters:
+ *   ndircp <-- number of Dirichlet-type boundary conditions
+ *   da     <-> diagonal part of the matrix
+ *----------------------------------------------------------------------------*/
+
+static void
+_penalize_diag_scalar(int         ndircp,
+                      cs_real_t   da[])
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+  const cs_lnum_t n_cells = m->n_cells;
+
+  /* If no Dirichlet condition, the diagonal is slightly increased in order
+     to shift the eigenvalues spectrum (if IDIRCL=0, we force NDIRCP to be at
+     least 1 in order not to shift the diagonal). */
+
+  if (ndircp <= 0) {
+    const double epsi = 1.e-7;
+
+#   pragma omp parallel for
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+      da[cell_id] = (1.+epsi)*da[cell_id];
+    }
+  }
+
+  /* If a whole line of the matrix is 0, the diagonal is set to 1 */
+  if (mq->has_disable_flag == 1) {
+# pragma omp parallel for
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+      da[cell_id] += mq->c_disable_flag[cell_id];
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Build the diagonal of the advection/diffusion matrix for a scalar field.
+ *
+ * Values are the same as those computed by cs_sym_matrix_scalar
+ * (isym = 1) or cs_matrix_scalar (isym = 2), but extra-diagonal terms
+ * are only computed locally.
+ *
+ * parameters:
+ *   m          <-- pointer to mesh structure
+ *   isym       <-- 1 for symmetric (diffusion only), 2 otherwise
+ *   iconvp     <-- 1 for advection, 0 otherwise
+ *   idiffp     <-- 1 for diffusion, 0 otherwise
+ *   thetap     <-- weighting coefficient for the theta-scheme
+ *   imucpp     <-- 1 to multiply the convective term by Cp, 0 otherwise
+ *   coefbp     <-- boundary condition array for the variable
+ *                  (implicit part)
+ *   cofbfp     <-- boundary condition array for the variable flux
+ *                  (implicit part)
+ *   rovsdt     <-- working array
+ *   i_massflux <-- mass flux at interior faces
+ *   b_massflux <-- mass flux at boundary faces
+ *   i_visc     <-- viscosity at interior faces for the matrix
+ *   b_visc     <-- viscosity at boundary faces for the matrix
+ *   xcpp       <-- array of specific heat (Cp)
+ *   da         --> diagonal part of the matrix
+ *----------------------------------------------------------------------------*/
+
+static void
+_matrix_scalar_diag(const cs_mesh_t          *m,
+                    int                       isym,
+                    int                       iconvp,
+                    int                       idiffp,
+                    double                    thetap,
+                    int                       imucpp,
+                    const cs_real_t           coefbp[],
+                    const cs_real_t           cofbfp[],
+                    const cs_real_t           rovsdt[],
+                    const cs_real_t           i_massflux[],
+                    const cs_real_t           b_massflux[],
+                    const cs_real_t           i_visc[],
+                    const cs_real_t           b_visc[],
+                    const cs_real_t           xcpp[],
+                    cs_real_t       *restrict da)
+{
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const int n_i_groups = m->i_face_numbering->n_groups;
+  const int n_i_threads = m->i_face_numbering->n_threads;
+  const int n_b_groups = m->b_face_numbering->n_groups;
+  const int n_b_threads = m->b_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
+  const cs_lnum_t *restrict b_group_index = m->b_face_numbering->group_index;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_lnum_t *restrict b_face_cells
+    = (const cs_lnum_t *restrict)m->b_face_cells;
+
+  /* Initialization */
+
+# pragma omp parallel for
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+    da[cell_id] = rovsdt[cell_id];
+  }
+  if (n_cells_ext > n_cells) {
+#   pragma omp parallel for if (n_cells_ext - n_cells > CS_THR_MIN)
+    for (cs_lnum_t cell_id = n_cells; cell_id < n_cells_ext; cell_id++) {
+      da[cell_id] = 0.;
+    }
+  }
+
+  /* Symmetric (diffusion) matrix */
+
+  if (isym == 1) {
+
+    if (! idiffp)
+      return;
+
+    for (int g_id = 0; g_id < n_i_groups; g_id++) {
+#     pragma omp parallel for firstprivate(thetap)
+      for (int t_id = 0; t_id < n_i_threads; t_id++) {
+        for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+             face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+             face_id++) {
+
+          cs_lnum_t ii = i_face_cells[face_id][0];
+          cs_lnum_t jj = i_face_cells[face_id][1];
+
+          cs_real_t aij = -thetap*i_visc[face_id];
+
+          da[ii] -= aij;
+          da[jj] -= aij;
+
+        }
+      }
+    }
+
+    for (int g_id = 0; g_id < n_b_groups; g_id++) {
+#     pragma omp parallel for firstprivate(thetap) \
+                          if(m->n_b_faces > CS_THR_MIN)
+      for (int t_id = 0; t_id < n_b_threads; t_id++) {
+        for (cs_lnum_t face_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+             face_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+             face_id++) {
+
+          cs_lnum_t ii = b_face_cells[face_id];
+
+          da[ii] += thetap*b_visc[face_id]*cofbfp[face_id];
+
+        }
+      }
+    }
+
+    return;
+  }
+
+  /* Non-symmetric matrix: contribution of the extra-diagonal terms
+     (see cs_matrix_scalar) to the diagonal */
+
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+#   pragma omp parallel for firstprivate(thetap, iconvp, idiffp)
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+      for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           face_id++) {
+
+        cs_lnum_t ii = i_face_cells[face_id][0];
+        cs_lnum_t jj = i_face_cells[face_id][1];
+
+        double flui = 0.5*(i_massflux[face_id] -fabs(i_massflux[face_id]));
+        double fluj =-0.5*(i_massflux[face_id] +fabs(i_massflux[face_id]));
+
+        if (imucpp == 0) {
+          cs_real_t xa_ij = thetap*(iconvp*flui -idiffp*i_visc[face_id]);
+          cs_real_t xa_ji = thetap*(iconvp*fluj -idiffp*i_visc[face_id]);
+          da[ii] -= xa_ij + iconvp*(1. - thetap)*i_massflux[face_id];
+          da[jj] -= xa_ji - iconvp*(1. - thetap)*i_massflux[face_id];
+        }
+        else {
+          cs_real_t xa_ij = thetap*( iconvp*xcpp[ii]*flui
+                                    -idiffp*i_visc[face_id]);
+          cs_real_t xa_ji = thetap*( iconvp*xcpp[jj]*fluj
+                                    -idiffp*i_visc[face_id]);
+          da[ii] -= xa_ij + iconvp*(1. - thetap)*xcpp[ii]*i_massflux[face_id];
+          da[jj] -= xa_ji - iconvp*(1. - thetap)*xcpp[jj]*i_massflux[face_id];
+        }
+
+      }
+    }
+  }
+
+  /* Contribution of border faces to the diagonal */
+
+  for (int g_id = 0; g_id < n_b_groups; g_id++) {
+#   pragma omp parallel for firstprivate(thetap, iconvp, idiffp) \
+                        if(m->n_b_faces > CS_THR_MIN)
+    for (int t_id = 0; t_id < n_b_threads; t_id++) {
+      for (cs_lnum_t face_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+           face_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+           face_id++) {
+
+        cs_lnum_t ii = b_face_cells[face_id];
+
+        double flui = 0.5*(b_massflux[face_id] - fabs(b_massflux[face_id]));
+
+        if (imucpp == 0)
+          da[ii] += iconvp*(flui*thetap*(coefbp[face_id]-1.)
+                           -(1.-thetap)*b_massflux[face_id])
+                  + idiffp*thetap*b_visc[face_id]*cofbfp[face_id];
+        else
+          da[ii] += iconvp*xcpp[ii]*(flui*thetap*(coefbp[face_id]-1.)
+                                    -(1.-thetap)*b_massflux[face_id])
+                  + idiffp*thetap*b_visc[face_id]*cofbfp[face_id];
+      }
+    }
+  }
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -206,8 +426,6 @@ cs_matrix_wrapper_scalar(int               iconvp,
                          cs_real_t         xa[])
 {
   const cs_mesh_t *m = cs_glob_mesh;
-  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
-  const cs_lnum_t n_cells = m->n_cells;
 
   if (isym != 1 && isym != 2) {
     bft_error(__FILE__, __LINE__, 0,
@@ -248,27 +466,56 @@ cs_matrix_wrapper_scalar(int               iconvp,
 
   /* Penalization if non invertible matrix */
 
-  /* If no Dirichlet condition, the diagonal is slightly increased in order
-     to shift the eigenvalues spectrum (if IDIRCL=0, we force NDIRCP to be at
-     least 1 in order not to shift the diagonal). */
+  _penalize_diag_scalar(ndircp, da);
+}
 
-  if (ndircp <= 0) {
-    const double epsi = 1.e-7;
+/*----------------------------------------------------------------------------
+ * Build only the diagonal of the matrix built by cs_matrix_wrapper_scalar,
+ * for use with matrix-free extra-diagonal terms
+ * (see cs_matrix_set_coefficients_conv_diff).
+ *----------------------------------------------------------------------------*/
 
-#   pragma omp parallel for
-    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
-      da[cell_id] = (1.+epsi)*da[cell_id];
-    }
+void
+cs_matrix_wrapper_scalar_diag(int               iconvp,
+                              int               idiffp,
+                              int               ndircp,
+                              int               isym,
+                              double            thetap,
+                              int               imucpp,
+                              const cs_real_t   coefbp[],
+                              const cs_real_t   cofbfp[],
+                              const cs_real_t   rovsdt[],
+                              const cs_real_t   i_massflux[],
+                              const cs_real_t   b_massflux[],
+                              const cs_real_t   i_visc[],
+                              const cs_real_t   b_visc[],
+                              const cs_real_t   xcpp[],
+                              cs_real_t         da[])
+{
+  if (isym != 1 && isym != 2) {
+    bft_error(__FILE__, __LINE__, 0,
+              _("invalid value of isym"));
   }
 
-  /* If a whole line of the matrix is 0, the diagonal is set to 1 */
-  if (mq->has_disable_flag == 1) {
-# pragma omp parallel for
-    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
-      da[cell_id] += mq->c_disable_flag[cell_id];
-    }
-  }
+  _matrix_scalar_diag(cs_glob_mesh,
+                      isym,
+                      iconvp,
+                      idiffp,
+                      thetap,
+                      imucpp,
+                      coefbp,
+                      cofbfp,
+                      rovsdt,
+                      i_massflux,
+                      b_massflux,
+                      i_visc,
+                      b_visc,
+                      xcpp,
+                      da);
+
+  /* Penalization if non invertible matrix */
 
+  _penalize_diag_scalar(ndircp, da);
 }
 
 /*----------------------------------------------------------------------------
@@ -124,6 +124,29 @@ cs_matrix_wrapper_scalar(int               iconvp,
                          cs_real_t         da[],
                          cs_real_t         xa[]);
 
+/*----------------------------------------------------------------------------
+ * Build only the diagonal of the matrix built by cs_matrix_wrapper_scalar,
+ * for use with matrix-free extra-diagonal terms
+ * (see cs_matrix_set_coefficients_conv_diff).
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_wrapper_scalar_diag(int               iconvp,
+                              int               idiffp,
+                              int               ndircp,
+                              int               isym,
+                              double            thetap,
+                              int               imucpp,
+                              const cs_real_t   coefbp[],
+                              const cs_real_t   cofbfp[],
+                              const cs_real_t   rovsdt[],
+                              const cs_real_t   i_massflux[],
+                              const cs_real_t   b_massflux[],
+                              const cs_real_t   i_visc[],
+                              const cs_real_t   b_visc[],
+                              const cs_real_t   xcpp[],
+                              cs_real_t         da[]);
+
 /*----------------------------------------------------------------------------
  * Wrapper to cs_matrix_scalar for convection/diffusion multigrid
  *----------------------------------------------------------------------------*/
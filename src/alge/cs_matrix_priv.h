@@ -109,6 +109,31 @@ typedef struct _cs_matrix_struct_native_t {
 
 } cs_matrix_struct_native_t;
 
+/* Matrix-free convection-diffusion extra-diagonal terms, computed on
+   the fly from interior face values (upwind convection, diffusion
+   without reconstruction), for native matrices */
+/*-------------------------------------------------------------------*/
+
+typedef struct _cs_matrix_coeff_conv_diff_t {
+
+  double             thetap;         /* Theta-scheme coefficient */
+  int                iconvp;         /* 1 if convection is active */
+  int                idiffp;         /* 1 if diffusion is active */
+
+  /* Pointers to shared arrays */
+
+  const cs_real_t   *i_massflux;     /* Mass flux at interior faces */
+  const cs_real_t   *i_visc;         /* Viscosity at interior faces */
+  const cs_real_t   *xcpp;           /* Convection multiplier per cell
+                                        (with ghosts), or NULL */
+
+  /* Replaced matrix.vector product functions (scalar fill types),
+     restored when coefficients are released */
+
+  cs_matrix_vector_product_t  *vector_multiply[2][2];
+
+} cs_matrix_coeff_conv_diff_t;
+
 /* Native matrix coefficients */
 /*----------------------------*/
 
@@ -128,6 +153,10 @@ typedef struct _cs_matrix_coeff_native_t {
   cs_real_t         *_da;           /* Diagonal terms */
   cs_real_t         *_xa;           /* Extra-diagonal terms */
 
+  /* Matrix-free extra-diagonal terms definition (NULL if unused) */
+
+  cs_matrix_coeff_conv_diff_t  *conv_diff;
+
 } cs_matrix_coeff_native_t;
 
 /* CSR (Compressed Sparse Row) matrix structure representation */
@@ -103,6 +103,31 @@ static const int _n_max_iter_default = 10000;
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check if an iterative solver type is a Gauss-Seidel variant
+ *        (which requires an MSR matrix).
+ *
+ * \param[in]  s_type  iterative solver type
+ *
+ * \return  true for Gauss-Seidel variants, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+static bool
+_is_gauss_seidel(cs_sles_it_type_t  s_type)
+{
+  bool retval = false;
+
+  if (   s_type == CS_SLES_P_GAUSS_SEIDEL
+      || s_type == CS_SLES_P_SYM_GAUSS_SEIDEL
+      || s_type == CS_SLES_TS_F_GAUSS_SEIDEL
+      || s_type == CS_SLES_TS_B_GAUSS_SEIDEL)
+    retval = true;
+
+  return retval;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Default definition of a sparse linear equation solver
@@ -625,6 +650,117 @@ cs_sles_setup_native_coupling(int               f_id,
   cs_sles_setup(sc, a);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate if an already defined sparse linear equation solver
+ *        may be used with a matrix-free native operator.
+ *
+ * Only iterative solvers and preconditioners requiring only matrix-vector
+ * products and the matrix diagonal are compatible (i.e. not Gauss-Seidel
+ * variants, nor ILU(0), symmetric Gauss-Seidel or multigrid preconditioners,
+ * which need assembled coefficients). If the solver context has not been
+ * defined yet, false is returned, so the first solve uses an assembled
+ * matrix.
+ *
+ * \param[in]  f_id  associated field id, or < 0
+ * \param[in]  name  associated name if f_id < 0, or NULL
+ *
+ * \return  true if a matrix-free operator may be used, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_sles_native_matrix_free_compatible(int          f_id,
+                                      const char  *name)
+{
+  bool retval = false;
+
+  cs_sles_t *sc = cs_sles_find(f_id, name);
+
+  if (sc == NULL)
+    return retval;
+  if (cs_sles_get_context(sc) == NULL)
+    return retval;
+
+  if (strcmp(cs_sles_get_type(sc), "cs_sles_it_t") == 0) {
+    cs_sles_it_t *c = cs_sles_get_context(sc);
+    cs_sles_it_type_t s_type = cs_sles_it_get_type(c);
+    if (!_is_gauss_seidel(s_type)) {
+      cs_sles_pc_t *pc = cs_sles_it_get_pc(c);
+      retval = true;
+      if (pc != NULL) {
+        const char *pc_type = cs_sles_pc_get_type(pc);
+        if (   strcmp(pc_type, "multigrid") == 0
+            || strcmp(pc_type, "ilu0") == 0
+            || strcmp(pc_type, "symmetric_gauss_seidel") == 0)
+          retval = false;
+      }
+    }
+  }
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Call sparse linear equation solver setup using a matrix-free
+ *        native operator.
+ *
+ * The matrix is registered so that following calls to
+ * \ref cs_sles_solve_native use it, and is destroyed by
+ * \ref cs_sles_free_native.
+ *
+ * \param[in]  f_id  associated field id, or < 0
+ * \param[in]  name  associated name if f_id < 0, or NULL
+ * \param[in]  a     matrix with coefficients set using
+ *                   \ref cs_matrix_set_coefficients_conv_diff
+ *                   (ownership transferred)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_setup_native_matrix_free(int           f_id,
+                                 const char   *name,
+                                 cs_matrix_t  *a)
+{
+  cs_sles_t *sc = cs_sles_find_or_add(f_id, name);
+
+  int setup_id = 0;
+  while (setup_id < _n_setups) {
+    if (_sles_setup[setup_id] == sc)
+      break;
+    else
+      setup_id++;
+  }
+
+  if (setup_id < _n_setups)
+    bft_error
+      (__FILE__, __LINE__, 0,
+       "%s: system \"%s\" already set up;\n"
+       "  cs_sles_free_native must be called first.",
+       __func__, cs_sles_get_name(sc));
+
+  _n_setups += 1;
+
+  if (_n_setups > CS_SLES_DEFAULT_N_SETUPS)
+    bft_error
+      (__FILE__, __LINE__, 0,
+       "Too many linear systems solved without calling cs_sles_free_native\n"
+       "  maximum number of systems: %d\n"
+       "If this is not an error, increase CS_SLES_DEFAULT_N_SETUPS\n"
+       "  in file %s.", CS_SLES_DEFAULT_N_SETUPS, __FILE__);
+
+  _sles_setup[setup_id] = sc;
+  _matrix_setup[setup_id][0] = a;
+  _matrix_setup[setup_id][1] = a; /* so it is freed later */
+  _matrix_setup[setup_id][2] = NULL;
+
+  /* Do not call cs_matrix_default_set_tuned here, as it would
+     replace the matrix-free product functions. */
+
+  cs_sles_setup(sc, a);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Call sparse linear equation solver using native matrix arrays.
@@ -741,8 +877,7 @@ cs_sles_solve_native(int                  f_id,
     if (strcmp(cs_sles_get_type(sc), "cs_sles_it_t") == 0) {
       cs_sles_it_t *c = cs_sles_get_context(sc);
       cs_sles_it_type_t s_type = cs_sles_it_get_type(c);
-      if (   s_type >= CS_SLES_P_GAUSS_SEIDEL
-          && s_type <= CS_SLES_TS_B_GAUSS_SEIDEL)
+      if (_is_gauss_seidel(s_type))
         need_msr = true;
       else {
         pc = cs_sles_it_get_pc(c);
@@ -757,8 +892,7 @@ cs_sles_solve_native(int                  f_id,
 
     if (mg != NULL) {
       cs_sles_it_type_t fs_type = cs_multigrid_get_fine_solver_type(mg);
-      if (   fs_type >= CS_SLES_P_GAUSS_SEIDEL
-          && fs_type <= CS_SLES_TS_B_GAUSS_SEIDEL)
+      if (_is_gauss_seidel(fs_type))
         need_msr = true;
     }
 
@@ -136,6 +136,42 @@ cs_sles_setup_native_coupling(int               f_id,
                               const cs_real_t  *da,
                               const cs_real_t  *xa);
 
+/*----------------------------------------------------------------------------
+ * Indicate if an already defined sparse linear equation solver
+ * may be used with a matrix-free native operator.
+ *
+ * If the solver context has not been defined yet, false is returned.
+ *
+ * parameters:
+ *   f_id  associated field id, or < 0
+ *   name  associated name if f_id < 0, or NULL
+ *
+ * returns:
+ *   true if a matrix-free operator may be used, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_sles_native_matrix_free_compatible(int          f_id,
+                                      const char  *name);
+
+/*----------------------------------------------------------------------------
+ * Call sparse linear equation solver setup using a matrix-free
+ * native operator.
+ *
+ * The matrix is destroyed by cs_sles_free_native.
+ *
+ * parameters:
+ *   f_id  associated field id, or < 0
+ *   name  associated name if f_id < 0, or NULL
+ *   a     matrix with coefficients set using
+ *         cs_matrix_set_coefficients_conv_diff (ownership transferred)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_sles_setup_native_matrix_free(int           f_id,
+                                 const char   *name,
+                                 cs_matrix_t  *a);
+
 /*----------------------------------------------------------------------------
  * Call sparse linear equation solver setup for convection-diffusion
  * systems
@@ -104,6 +104,10 @@ BEGIN_C_DECLS
 
 #define CS_SIMD_SIZE(s) (((s-1)/16+1)*16)
 
+/* Maximum number of steps per block for communication-avoiding solvers */
+
+#define CS_SLES_IT_CA_S_MAX 8
+
 /*=============================================================================
  * Local Structure Definitions
  *============================================================================*/
@@ -118,6 +122,10 @@ static int _thread_debug = 0;
 
 static cs_lnum_t _pcg_sr_threshold = 512;
 
+/* Number of steps per block reduction for communication-avoiding solvers */
+
+static int _ca_s_step = 3;
+
 /* Sparse linear equation solver type names */
 
 const char *cs_sles_it_type_name[]
@@ -131,6 +139,8 @@ const char *cs_sles_it_type_name[]
      N_("Gauss-Seidel"),
      N_("Symmetric Gauss-Seidel"),
      N_("3-layer conjugate residual"),
+     N_("Communication-avoiding GMRES"),
+     N_("Communication-avoiding BiCGstab"),
      N_("None"), /* Smoothers beyond this */
      N_("Truncated forward Gauss-Seidel"),
      N_("Truncated backwards Gauss-Seidel"),
@@ -2823,6 +2833,808 @@ _gmres(cs_sles_it_t              *c,
   return cvg;
 }
 
+/*----------------------------------------------------------------------------
+ * Compute a block of dot products x_i.y_j with a single global reduction.
+ *
+ * Vectors of each set are stored with a constant stride. When both sets
+ * start at the same address, the result is symmetric over the common
+ * range, and only its upper part is computed locally.
+ *
+ * parameters:
+ *   c      <-- pointer to solver context info
+ *   stride <-- stride between successive vectors of each set
+ *   n_x    <-- number of vectors in first set
+ *   x      <-- first set of vectors
+ *   n_y    <-- number of vectors in second set
+ *   y      <-- second set of vectors
+ *   g      --> dot products: g[i*n_y + j] = x_i.y_j
+ *----------------------------------------------------------------------------*/
+
+static void
+_block_dot_products(const cs_sles_it_t  *c,
+                    size_t               stride,
+                    int                  n_x,
+                    const cs_real_t     *x,
+                    int                  n_y,
+                    const cs_real_t     *y,
+                    double              *g)
+{
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+  const int n_threads = cs_glob_n_threads;
+  const int n_g = n_x*n_y;
+  const bool sym = (x == y) ? true : false;
+
+  const cs_lnum_t block_size = 256;
+  const cs_lnum_t n_blocks = (n_rows + block_size - 1) / block_size;
+
+  double *t_g;
+  BFT_MALLOC(t_g, n_threads*n_g, double);
+
+  for (int i = 0; i < n_threads*n_g; i++)
+    t_g[i] = 0.;
+
+# pragma omp parallel if(n_rows > CS_THR_MIN)
+  {
+    int t_id = 0;
+#if defined(HAVE_OPENMP)
+    t_id = omp_get_thread_num();
+#endif
+    double *restrict _g = t_g + t_id*n_g;
+
+#   pragma omp for
+    for (cs_lnum_t b_id = 0; b_id < n_blocks; b_id++) {
+      const cs_lnum_t s_id = b_id*block_size;
+      const cs_lnum_t e_id = CS_MIN(s_id + block_size, n_rows);
+      for (int i = 0; i < n_x; i++) {
+        const cs_real_t *restrict _x = x + i*stride;
+        for (int j = (sym && i < n_y) ? i : 0; j < n_y; j++) {
+          const cs_real_t *restrict _y = y + j*stride;
+          double s = 0.;
+          for (cs_lnum_t ii = s_id; ii < e_id; ii++)
+            s += _x[ii]*_y[ii];
+          _g[i*n_y + j] += s;
+        }
+      }
+    }
+  }
+
+  for (int i = 0; i < n_g; i++)
+    g[i] = t_g[i];
+  for (int t_id = 1; t_id < n_threads; t_id++) {
+    for (int i = 0; i < n_g; i++)
+      g[i] += t_g[t_id*n_g + i];
+  }
+
+  BFT_FREE(t_g);
+
+#if defined(HAVE_MPI)
+
+  if (c->comm != MPI_COMM_NULL) {
+    double *_g;
+    BFT_MALLOC(_g, n_g, double);
+    MPI_Allreduce(g, _g, n_g, MPI_DOUBLE, MPI_SUM, c->comm);
+    for (int i = 0; i < n_g; i++)
+      g[i] = _g[i];
+    BFT_FREE(_g);
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  if (sym) {
+    for (int i = 1; i < n_x; i++) {
+      for (int j = 0; j < CS_MIN(i, n_y); j++)
+        g[i*n_y + j] = g[j*n_y + i];
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Block Gram-Schmidt step of communication-avoiding GMRES.
+ *
+ * Given the dot products of the orthonormal basis vectors Q_0..Q_k and of
+ * the new vectors W_1..W_s with W, the projection coefficients R_a = Q^T.W
+ * are the first k+1 rows of g, and the coefficients R_b of the new
+ * orthonormal vectors are obtained from the Cholesky factorization of
+ * W^T.W - R_a^T.R_a (Pythagorean variant of CholQR), after diagonal
+ * equilibration.
+ *
+ * parameters:
+ *   k      <-- index of last orthonormal vector
+ *   s      <-- number of new vectors
+ *   g      <-- dot products [Q, W]^T.W (size: (k+1+s)*s)
+ *   rb     --> upper triangular coefficients (size: s*s)
+ *
+ * returns:
+ *   0 in case of success, 1 if the new vectors are numerically
+ *   dependent on the current basis.
+ *----------------------------------------------------------------------------*/
+
+static int
+_ca_gmres_chol_qr(int            k,
+                  int            s,
+                  const double  *g,
+                  double        *rb)
+{
+  const double *ra = g;
+  const double *wtw = g + (k+1)*s;
+
+  double d[CS_SLES_IT_CA_S_MAX];
+
+  /* S = W^T.W - R_a^T.R_a, stored in rb */
+
+  for (int i = 0; i < s; i++) {
+    for (int j = i; j < s; j++) {
+      double v = wtw[i*s + j];
+      for (int l = 0; l <= k; l++)
+        v -= ra[l*s + i]*ra[l*s + j];
+      rb[i*s + j] = v;
+    }
+    if (rb[i*s + i] <= 1e-12*wtw[i*s + i])
+      return 1;
+    d[i] = sqrt(rb[i*s + i]);
+  }
+
+  /* Cholesky factorization of the equilibrated matrix, rescaled */
+
+  for (int i = 0; i < s; i++) {
+    for (int j = i; j < s; j++) {
+      double v = rb[i*s + j]/(d[i]*d[j]);
+      for (int l = 0; l < i; l++)
+        v -= rb[l*s + i]*rb[l*s + j];
+      if (j == i) {
+        if (v < 1e-10)
+          return 1;
+        rb[i*s + i] = sqrt(v);
+      }
+      else
+        rb[i*s + j] = v / rb[i*s + i];
+    }
+    for (int l = 0; l < i; l++)
+      rb[i*s + l] = 0.;
+  }
+
+  for (int i = 0; i < s; i++) {
+    for (int j = i; j < s; j++)
+      rb[i*s + j] *= d[j];
+  }
+
+  return 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute Hessenberg matrix columns of communication-avoiding GMRES.
+ *
+ * With W_i = (A.M)^i.Q_k = [Q_0..Q_{k+s}].R[:, i], the Arnoldi relation
+ * yields H[:, k:k+s] = (R.B - [H[:, 0:k].C ; 0]).T^-1, where B is the
+ * shift matrix, C the rows 0..k-1 of R and T its rows k..k+s-1.
+ *
+ * parameters:
+ *   k      <-- index of first new Hessenberg column
+ *   s      <-- number of new columns
+ *   ld     <-- leading dimension of h (column j, row i at h[j*ld + i])
+ *   ra     <-- projection coefficients (size: (k+1)*s)
+ *   rb     <-- upper triangular coefficients (size: s*s)
+ *   h      <-> Hessenberg matrix
+ *   w      --- work array (size: (k+s+1)*s)
+ *----------------------------------------------------------------------------*/
+
+static void
+_ca_gmres_hessenberg(int            k,
+                     int            s,
+                     int            ld,
+                     const double  *ra,
+                     const double  *rb,
+                     cs_real_t     *h,
+                     double        *w)
+{
+  const int n_r = k + s + 1;
+
+  /* w = R.B - [H.C ; 0] */
+
+  for (int i = 0; i < s; i++) {
+    for (int r = 0; r <= k; r++) {
+      double v = ra[r*s + i];
+      if (i > 0) {
+        for (int l = 0; l < k; l++)
+          v -= h[l*ld + r]*ra[l*s + i-1];
+      }
+      w[r*s + i] = v;
+    }
+    for (int r = k+1; r < n_r; r++)
+      w[r*s + i] = (r-k-1 <= i) ? rb[(r-k-1)*s + i] : 0.;
+  }
+
+  /* Solve X.T = w, T[0][0] = 1, T[0][i] = R_a[k][i-1],
+     T[r][i] = R_b[r-1][i-1] otherwise */
+
+  for (int i = 0; i < s; i++) {
+    const double t_ii = (i == 0) ? 1. : rb[(i-1)*s + i-1];
+    for (int r = 0; r < n_r; r++) {
+      double v = w[r*s + i];
+      for (int l = 0; l < i; l++) {
+        const double t_li = (l == 0) ? ra[k*s + i-1] : rb[(l-1)*s + i-1];
+        v -= w[r*s + l]*t_li;
+      }
+      w[r*s + i] = v / t_ii;
+    }
+    for (int r = 0; r < ld; r++)
+      h[(k+i)*ld + r] = (r <= k+i+1) ? w[r*s + i] : 0.;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using communication-avoiding (s-step) GMRES.
+ *
+ * Krylov vectors are generated by blocks of s using a monomial basis,
+ * then orthonormalized against the current basis and each other using
+ * a single global reduction per block (block classical Gram-Schmidt
+ * combined with CholQR). The preconditioner is applied on the right.
+ *
+ * If the new block is numerically dependent, the block size is halved;
+ * in the single vector case, this corresponds to a (happy) breakdown,
+ * and the current restart cycle is ended.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- matrix
+ *   diag_block_size <-- diagonal block size
+ *   rotation_mode   <-- halo update option for rotational periodicity
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (allocation otherwise)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_ca_gmres(cs_sles_it_t              *c,
+          const cs_matrix_t         *a,
+          cs_lnum_t                  diag_block_size,
+          cs_halo_rotation_t         rotation_mode,
+          cs_sles_it_convergence_t  *convergence,
+          const cs_real_t           *rhs,
+          cs_real_t                 *restrict vx,
+          size_t                     aux_size,
+          void                      *aux_vectors)
+{
+  cs_sles_convergence_state_t cvg = CS_SLES_ITERATING;
+  double  residue;
+  cs_real_t  *_aux_vectors;
+  cs_real_t *restrict q, *restrict zk, *restrict fk;
+
+  cs_lnum_t krylov_size_max = 40;
+  unsigned n_iter = 0;
+
+  /* Allocate or map work arrays */
+  /*-----------------------------*/
+
+  assert(c->setup_data != NULL);
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+
+  int krylov_size = sqrt(n_rows*diag_block_size)*1.5 + 1;
+  if (krylov_size > krylov_size_max)
+    krylov_size = krylov_size_max;
+
+#if defined(HAVE_MPI)
+  if (c->comm != MPI_COMM_NULL) {
+    int _krylov_size = krylov_size;
+    MPI_Allreduce(&_krylov_size,
+                  &krylov_size,
+                  1,
+                  MPI_INT,
+                  MPI_MIN,
+                  c->comm);
+  }
+#endif
+
+  /* Restart size is a multiple of the block size */
+
+  const int s_step = CS_MIN(_ca_s_step, krylov_size);
+  const int m = (krylov_size / s_step) * s_step;
+  const int ld = m + 1;
+
+  size_t wa_size;
+
+  {
+    const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
+
+    size_t  n_wa = ld + 2;
+    wa_size = CS_SIMD_SIZE(n_cols);
+
+    if (aux_vectors == NULL || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
+      BFT_MALLOC(_aux_vectors, wa_size * n_wa, cs_real_t);
+    else
+      _aux_vectors = aux_vectors;
+
+    q = _aux_vectors;
+    zk = _aux_vectors + ld*wa_size;
+    fk = _aux_vectors + (ld+1)*wa_size;
+  }
+
+  /* Small dense arrays: Hessenberg matrix (raw and rotated),
+     rotated residual, Givens coefficients, and block coefficients */
+
+  cs_real_t *h, *hg, *gv, *givens, *yk;
+  double *g, *rb, *w;
+
+  BFT_MALLOC(h, ld*m, cs_real_t);
+  BFT_MALLOC(hg, ld*m, cs_real_t);
+  BFT_MALLOC(gv, ld, cs_real_t);
+  BFT_MALLOC(givens, 2*ld, cs_real_t);
+  BFT_MALLOC(yk, ld, cs_real_t);
+  BFT_MALLOC(g, ld*s_step, double);
+  BFT_MALLOC(rb, s_step*s_step, double);
+  BFT_MALLOC(w, ld*s_step, double);
+
+  while (cvg == CS_SLES_ITERATING) {
+
+    /* Residual at restart: q_0 = rhs - A.vx */
+
+    cs_matrix_vector_multiply(rotation_mode, a, vx, q);
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      q[ii] = rhs[ii] - q[ii];
+
+    residue = sqrt(_dot_product_xx(c, q));
+
+    if (n_iter == 0)
+      c->setup_data->initial_residue = residue;
+
+    cvg = _convergence_test(c, n_iter, residue, convergence);
+    if (cvg != CS_SLES_ITERATING)
+      break;
+
+    {
+      const cs_real_t d_res = 1. / residue;
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+        q[ii] *= d_res;
+    }
+
+    gv[0] = residue;
+    for (int i = 1; i < ld; i++)
+      gv[i] = 0.;
+
+    /* Block size reductions due to loss of rank only apply to the
+       current restart cycle */
+
+    int s_cycle = s_step;
+    int k = 0;
+    bool end_cycle = false;
+
+    while (k < m && end_cycle == false) {
+
+      int s_cur = CS_MIN(s_cycle, m - k);
+
+      /* Monomial basis: q_{k+i} = (A.M)^i q_k */
+
+      for (int i = 1; i <= s_cur; i++) {
+        c->setup_data->pc_apply(c->setup_data->pc_context,
+                                rotation_mode,
+                                q + (k+i-1)*wa_size,
+                                zk);
+        cs_matrix_vector_multiply(rotation_mode, a, zk, q + (k+i)*wa_size);
+      }
+
+      /* Block orthogonalization (single reduction); reduce block
+         size in case of loss of rank */
+
+      while (true) {
+        _block_dot_products(c, wa_size,
+                            k+1+s_cur, q,
+                            s_cur, q + (k+1)*wa_size,
+                            g);
+        if (_ca_gmres_chol_qr(k, s_cur, g, rb) == 0)
+          break;
+        else if (s_cur > 1) {
+          s_cur /= 2;
+          s_cycle = s_cur;
+        }
+        else {
+          rb[0] = 0.;
+          end_cycle = true;
+          break;
+        }
+      }
+
+      /* New orthonormal vectors: Q_new = (W - Q.R_a).R_b^-1 */
+
+      if (end_cycle == false) {
+#       pragma omp parallel for if(n_rows > CS_THR_MIN)
+        for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+          cs_real_t _w[CS_SLES_IT_CA_S_MAX];
+          for (int i = 0; i < s_cur; i++) {
+            cs_real_t v = q[(k+1+i)*wa_size + ii];
+            for (int l = 0; l <= k; l++)
+              v -= q[l*wa_size + ii]*g[l*s_cur + i];
+            for (int l = 0; l < i; l++)
+              v -= _w[l]*rb[l*s_cur + i];
+            _w[i] = v / rb[i*s_cur + i];
+            q[(k+1+i)*wa_size + ii] = _w[i];
+          }
+        }
+      }
+
+      /* Hessenberg matrix columns and their Givens rotation */
+
+      _ca_gmres_hessenberg(k, s_cur, ld, g, rb, h, w);
+
+      for (int i = 0; i < s_cur; i++) {
+        for (int r = 0; r < ld; r++)
+          hg[(k+i)*ld + r] = h[(k+i)*ld + r];
+      }
+
+      _givens_rot_update(hg, ld, gv, givens, k, k + s_cur);
+
+      k += s_cur;
+      n_iter += s_cur;
+
+      if (   fabs(gv[k]) < convergence->precision*convergence->r_norm
+          || n_iter >= convergence->n_iterations_max)
+        end_cycle = true;
+
+    }
+
+    /* Update solution: vx <- vx + M.(Q.y) */
+
+    _solve_diag_sup_halo(hg, k, ld, gv, yk);
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      fk[ii] = 0.0;
+      for (int l = 0; l < k; l++)
+        fk[ii] += q[l*wa_size + ii] * yk[l];
+    }
+
+    c->setup_data->pc_apply(c->setup_data->pc_context,
+                            rotation_mode,
+                            fk,
+                            zk);
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      vx[ii] += zk[ii];
+
+  }
+
+  BFT_FREE(h);
+  BFT_FREE(hg);
+  BFT_FREE(gv);
+  BFT_FREE(givens);
+  BFT_FREE(yk);
+  BFT_FREE(g);
+  BFT_FREE(rb);
+  BFT_FREE(w);
+
+  if (_aux_vectors != aux_vectors)
+    BFT_FREE(_aux_vectors);
+
+  return cvg;
+}
+
+/*----------------------------------------------------------------------------
+ * Apply the shift operator of communication-avoiding BiCGstab to
+ * coordinates relative to the [P, R] basis.
+ *
+ * With P_i = (A.M)^i.p (0 <= i <= 2s) and R_i = (A.M)^i.r (0 <= i < 2s),
+ * multiplication by A.M of a combination of P_0..P_{2s-1} and
+ * R_0..R_{2s-2} amounts to shifting coordinates in each block.
+ *
+ * parameters:
+ *   s  <-- number of steps per block
+ *   x  <-- input coordinates (size: 4s+1)
+ *   y  --> output coordinates (size: 4s+1)
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_ca_bicgstab_shift(int            s,
+                   const double  *x,
+                   double        *y)
+{
+  const int r_s_id = 2*s + 1;
+  const int n_y = 4*s + 1;
+
+  y[0] = 0.;
+  for (int i = 1; i < r_s_id; i++)
+    y[i] = x[i-1];
+  y[r_s_id] = 0.;
+  for (int i = r_s_id + 1; i < n_y; i++)
+    y[i] = x[i-1];
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using communication-avoiding (s-step) BiCGstab.
+ *
+ * Every outer iteration computes monomial bases of the search direction
+ * and residual Krylov spaces, and the associated Gram matrix (and shadow
+ * residual products) with a single global reduction. The following s
+ * BiCGstab iterations are then done on basis coordinates only, without
+ * communication. The preconditioner is applied on the right, and the
+ * residual is recomputed from the solution after each block.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- matrix
+ *   diag_block_size <-- diagonal block size
+ *   rotation_mode   <-- halo update option for rotational periodicity
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (allocation otherwise)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_ca_bi_cgstab(cs_sles_it_t              *c,
+              const cs_matrix_t         *a,
+              int                        diag_block_size,
+              cs_halo_rotation_t         rotation_mode,
+              cs_sles_it_convergence_t  *convergence,
+              const cs_real_t           *rhs,
+              cs_real_t                 *restrict vx,
+              size_t                     aux_size,
+              void                      *aux_vectors)
+{
+  cs_sles_convergence_state_t cvg = CS_SLES_ITERATING;
+  double  residue = 0.;
+  double  _epzero = 1.e-30; /* smaller than epzero */
+  cs_real_t  *_aux_vectors;
+  cs_real_t *restrict yk, *restrict rtk;
+  cs_real_t *restrict zk, *restrict fk, *restrict tk;
+
+  unsigned n_iter = 0;
+
+  /* Allocate or map work arrays */
+  /*-----------------------------*/
+
+  assert(c->setup_data != NULL);
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+
+  const int s = CS_MIN(_ca_s_step, CS_SLES_IT_CA_S_MAX);
+  const int r_s_id = 2*s + 1;  /* Start of residual basis */
+  const int n_y = 4*s + 1;     /* Basis size */
+
+  size_t wa_size;
+
+  {
+    const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
+
+    size_t  n_wa = n_y + 4;
+    wa_size = CS_SIMD_SIZE(n_cols);
+
+    if (aux_vectors == NULL || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
+      BFT_MALLOC(_aux_vectors, wa_size * n_wa, cs_real_t);
+    else
+      _aux_vectors = aux_vectors;
+
+    yk = _aux_vectors;
+    rtk = _aux_vectors + n_y*wa_size;
+    zk = _aux_vectors + (n_y+1)*wa_size;
+    fk = _aux_vectors + (n_y+2)*wa_size;
+    tk = _aux_vectors + (n_y+3)*wa_size;
+  }
+
+  cs_real_t *restrict pk = yk;
+  cs_real_t *restrict rk = yk + r_s_id*wa_size;
+
+  /* Gram matrix (with shadow residual products as last column),
+     and coordinates relative to the basis */
+
+  double *g, *pc, *rc, *xc, *qc, *tp, *tq, *gq;
+
+  BFT_MALLOC(g, n_y*(n_y+1), double);
+  BFT_MALLOC(pc, 7*n_y, double);
+  rc = pc + n_y;
+  xc = pc + 2*n_y;
+  qc = pc + 3*n_y;
+  tp = pc + 4*n_y;
+  tq = pc + 5*n_y;
+  gq = pc + 6*n_y;
+
+  /* Initialize residual, shadow residual, and direction */
+
+  cs_matrix_vector_multiply(rotation_mode, a, vx, rk);
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    rk[ii] = rhs[ii] - rk[ii];
+    rtk[ii] = rk[ii];
+    pk[ii] = rk[ii];
+  }
+
+  bool res_tested = false;
+
+  /* Current block of iterations */
+  /*-----------------------------*/
+
+  while (cvg == CS_SLES_ITERATING) {
+
+    /* Monomial bases for p and r */
+
+    for (int i = 1; i < n_y; i++) {
+      if (i == r_s_id)
+        continue;
+      c->setup_data->pc_apply(c->setup_data->pc_context,
+                              rotation_mode,
+                              yk + (i-1)*wa_size,
+                              zk);
+      cs_matrix_vector_multiply(rotation_mode, a, zk, yk + i*wa_size);
+    }
+
+    /* Gram matrix and shadow residual products: single reduction */
+
+    _block_dot_products(c, wa_size, n_y, yk, n_y+1, yk, g);
+
+    const double *g_rt = g + n_y; /* stride n_y+1 */
+
+    if (res_tested == false) {
+      residue = sqrt(g[r_s_id*(n_y+1) + r_s_id]);
+      if (n_iter == 0)
+        c->setup_data->initial_residue = residue;
+      cvg = _convergence_test(c, n_iter, residue, convergence);
+      if (cvg != CS_SLES_ITERATING)
+        break;
+    }
+    res_tested = false;
+
+    /* s iterations on coordinates */
+
+    for (int i = 0; i < n_y; i++) {
+      pc[i] = 0.;
+      rc[i] = 0.;
+      xc[i] = 0.;
+    }
+    pc[0] = 1.;
+    rc[r_s_id] = 1.;
+
+    bool est_converged = false;
+
+    for (int j = 0; j < s; j++) {
+
+      double ro_0 = 0., rt_ap = 0.;
+
+      _ca_bicgstab_shift(s, pc, tp);
+
+      for (int i = 0; i < n_y; i++) {
+        ro_0 += g_rt[i*(n_y+1)]*rc[i];
+        rt_ap += g_rt[i*(n_y+1)]*tp[i];
+      }
+
+      if (_breakdown(c, convergence, "rho", ro_0, _epzero,
+                     residue, n_iter, &cvg))
+        break;
+
+      if (_breakdown(c, convergence, "alpha", rt_ap, _epzero,
+                     residue, n_iter, &cvg))
+        break;
+
+      double alpha = ro_0 / rt_ap;
+
+      for (int i = 0; i < n_y; i++)
+        qc[i] = rc[i] - alpha*tp[i];
+
+      _ca_bicgstab_shift(s, qc, tq);
+
+      double ro_1 = 0., ro_2 = 0.;
+
+      for (int i = 0; i < n_y; i++) {
+        double v = 0.;
+        for (int l = 0; l < n_y; l++)
+          v += g[i*(n_y+1) + l]*tq[l];
+        gq[i] = v;
+      }
+      for (int i = 0; i < n_y; i++) {
+        ro_1 += qc[i]*gq[i];
+        ro_2 += tq[i]*gq[i];
+      }
+
+      if (_breakdown(c, convergence, "omega", ro_2, _epzero,
+                     residue, n_iter, &cvg))
+        break;
+
+      double omega = ro_1 / ro_2;
+
+      if (_breakdown(c, convergence, "omega", omega, _epzero,
+                     residue, n_iter, &cvg))
+        break;
+
+      double ro_3 = 0.;
+
+      for (int i = 0; i < n_y; i++) {
+        xc[i] += alpha*pc[i] + omega*qc[i];
+        rc[i] = qc[i] - omega*tq[i];
+        ro_3 += g_rt[i*(n_y+1)]*rc[i];
+      }
+
+      double beta = (ro_3 / ro_0) * (alpha / omega);
+
+      for (int i = 0; i < n_y; i++)
+        pc[i] = rc[i] + beta*(pc[i] - omega*tp[i]);
+
+      n_iter += 1;
+
+      /* Residual estimate from coordinates */
+
+      double res2 = 0.;
+      for (int i = 0; i < n_y; i++) {
+        double v = 0.;
+        for (int l = 0; l < n_y; l++)
+          v += g[i*(n_y+1) + l]*rc[l];
+        res2 += rc[i]*v;
+      }
+
+      if (   sqrt(CS_ABS(res2)) < convergence->precision*convergence->r_norm
+          || n_iter >= convergence->n_iterations_max) {
+        est_converged = true;
+        break;
+      }
+
+    }
+
+    /* Update solution, direction and residual:
+       vx <- vx + M.(Y.x'), p <- Y.p', r <- rhs - A.vx */
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      cs_real_t _f = 0., _t = 0.;
+      for (int i = 0; i < n_y; i++) {
+        _f += yk[i*wa_size + ii]*xc[i];
+        _t += yk[i*wa_size + ii]*pc[i];
+      }
+      fk[ii] = _f;
+      tk[ii] = _t;
+    }
+
+    c->setup_data->pc_apply(c->setup_data->pc_context,
+                            rotation_mode,
+                            fk,
+                            zk);
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      vx[ii] += zk[ii];
+      pk[ii] = tk[ii];
+    }
+
+    cs_matrix_vector_multiply(rotation_mode, a, vx, rk);
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      rk[ii] = rhs[ii] - rk[ii];
+
+    /* Check true residual only when the estimate indicates convergence,
+       as it is otherwise obtained with the next Gram matrix */
+
+    if (cvg == CS_SLES_ITERATING && est_converged) {
+      residue = sqrt(_dot_product_xx(c, rk));
+      cvg = _convergence_test(c, n_iter, residue, convergence);
+      res_tested = true;
+    }
+
+  }
+
+  BFT_FREE(g);
+  BFT_FREE(pc);
+
+  if (_aux_vectors != aux_vectors)
+    BFT_FREE(_aux_vectors);
+
+  return cvg;
+}
+
 /*----------------------------------------------------------------------------
  * Solution of A.vx = Rhs using Process-local Gauss-Seidel.
  *
@@ -3713,6 +4525,8 @@ cs_sles_it_create(cs_sles_it_type_t   solver_type,
   case CS_SLES_BICGSTAB:
   case CS_SLES_BICGSTAB2:
   case CS_SLES_PCR3:
+  case CS_SLES_CA_GMRES:
+  case CS_SLES_CA_BICGSTAB:
     c->fallback_cvg = CS_SLES_BREAKDOWN;
     break;
   default:
@@ -4013,6 +4827,13 @@ cs_sles_it_setup(void               *context,
     c->solve = _gmres;
     break;
 
+  case CS_SLES_CA_GMRES:
+    c->solve = _ca_gmres;
+    break;
+  case CS_SLES_CA_BICGSTAB:
+    c->solve = _ca_bi_cgstab;
+    break;
+
   case CS_SLES_P_GAUSS_SEIDEL:
     c->solve = _p_gauss_seidel;
     break;
@@ -4596,6 +5417,40 @@ cs_sles_it_set_pcg_single_reduction(cs_lnum_t  threshold)
 #endif
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Query number of Krylov vectors generated per block reduction by
+ *        communication-avoiding (s-step) solvers.
+ *
+ * \returns  number of steps per block (s)
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_sles_it_get_ca_s_step(void)
+{
+  return _ca_s_step;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set number of Krylov vectors generated per block reduction by
+ *        communication-avoiding (s-step) solvers.
+ *
+ * Higher values reduce the number of global reductions, but the monomial
+ * basis used becomes ill-conditioned, so values above 5 are rarely useful;
+ * the value is clipped to the [1, 8] range.
+ *
+ * \param[in]  s_step  number of steps per block (s)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_it_set_ca_s_step(int  s_step)
+{
+  _ca_s_step = CS_MAX(1, CS_MIN(s_step, CS_SLES_IT_CA_S_MAX));
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Log the current global settings relative to parallelism.
@@ -4610,8 +5465,9 @@ cs_sles_it_log_parallel_options(void)
     cs_log_printf(CS_LOG_SETUP,
                   _("\n"
                     "Iterative linear solvers parallel parameters:\n"
-                    "  PCG single-reduction threshold:     %d\n"),
-                 _pcg_sr_threshold);
+                    "  PCG single-reduction threshold:     %d\n"
+                    "  s-step solvers steps per reduction: %d\n"),
+                 _pcg_sr_threshold, _ca_s_step);
 #endif
 }
 
@@ -69,6 +69,10 @@ typedef enum {
   CS_SLES_P_GAUSS_SEIDEL,      /*!< Process-local Gauss-Seidel */
   CS_SLES_P_SYM_GAUSS_SEIDEL,  /*!< Process-local symmetric Gauss-Seidel */
   CS_SLES_PCR3,                /*!< 3-layer conjugate residual */
+  CS_SLES_CA_GMRES,            /*!< Communication-avoiding (s-step)
+                                    preconditioned GMRES */
+  CS_SLES_CA_BICGSTAB,         /*!< Communication-avoiding (s-step)
+                                    preconditioned BiCGstab */
 
   CS_SLES_N_IT_TYPES,          /*!< Number of resolution algorithms
                                     excluding smoother only*/
@@ -480,6 +484,32 @@ cs_sles_it_get_pcg_single_reduction(void);
 void
 cs_sles_it_set_pcg_single_reduction(cs_lnum_t  threshold);
 
+/*----------------------------------------------------------------------------
+ * Query number of Krylov vectors generated per block reduction by
+ * communication-avoiding (s-step) solvers.
+ *
+ * returns:
+ *   number of steps per block (s)
+ *----------------------------------------------------------------------------*/
+
+int
+cs_sles_it_get_ca_s_step(void);
+
+/*----------------------------------------------------------------------------
+ * Set number of Krylov vectors generated per block reduction by
+ * communication-avoiding (s-step) solvers.
+ *
+ * Higher values reduce the number of global reductions, but the monomial
+ * basis used becomes ill-conditioned, so values above 5 are rarely useful;
+ * the value is clipped to the [1, 8] range.
+ *
+ * parameters:
+ *   s_step <-- number of steps per block (s)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_sles_it_set_ca_s_step(int  s_step);
+
 /*----------------------------------------------------------------------------
  * Log the current global settings relative to parallelism.
  *----------------------------------------------------------------------------*/
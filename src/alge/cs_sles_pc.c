@@ -213,6 +213,8 @@ BEGIN_C_DECLS
   - Jacobi
   - polynomial of degree 1
   - polynomial of degree 2
+  - ILU(0)
+  - symmetric Gauss-Seidel
 
   Polynomial preconditioning is explained here:
   \a D being the diagonal part of matrix \a A and \a X its extra-diagonal
@@ -237,6 +239,20 @@ BEGIN_C_DECLS
   for additional parameter setting functions, only degrees 1
   and 2 are provided here.
 
+  Incomplete LU factorization without fill-in (ILU(0)) and symmetric
+  Gauss-Seidel (SGS) preconditioners are also provided. Both are
+  process-local (coupling terms with halo values are ignored, as
+  for the process-local Gauss-Seidel solver), and are written in the
+  common form \f$M = \tilde{L}\tilde{U}\f$, with \f$\tilde{L}\f$ unit
+  lower triangular and \f$\tilde{U}\f$ upper triangular. For SGS,
+  \f$M = (D+L)D^{-1}(D+U) = (Id+LD^{-1})(D+U)\f$. To allow threading
+  of the triangular solves, rows are grouped by level sets (rows of
+  a given level only depend on rows of previous levels), so that
+  all rows of a given level may be handled in parallel.
+
+  These preconditioners require an MSR matrix with scalar (non-block)
+  diagonal; for other matrices, they fall back to Jacobi.
+
 */
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
@@ -296,6 +312,40 @@ typedef struct {
 
 } cs_sles_pc_poly_t;
 
+/* Structure for ILU(0) or symmetric Gauss-Seidel preconditioner */
+/*---------------------------------------------------------------*/
+
+typedef struct {
+
+  bool                 ilu;               /* true for ILU(0), false for SGS */
+  bool                 jacobi;            /* true if falling back to Jacobi
+                                             (matrix not MSR, or block) */
+
+  cs_lnum_t            n_rows;            /* Number of associated rows */
+  cs_lnum_t            n_cols;            /* Number of associated columns */
+
+  int                  n_levels[2];       /* Number of levels for lower
+                                             and upper triangular solves */
+  cs_lnum_t           *level_idx[2];      /* Level index (size:
+                                             n_levels + 1) for lower and
+                                             upper triangular solves */
+  cs_lnum_t           *level_rows[2];     /* Rows ordered by level for
+                                             lower and upper solves */
+
+  cs_lnum_t           *row_index;         /* Local extra-diagonal row index
+                                             (sorted columns) */
+  cs_lnum_t           *u_row_index;       /* Start of upper part for each
+                                             row (in row_index range) */
+  cs_lnum_t           *col_id;            /* Local column ids */
+  cs_real_t           *x_val;             /* Lower (unit diagonal) and
+                                             upper factor values */
+
+  cs_real_t           *ad_inv;            /* Inverse of diagonal of upper
+                                             factor (or of matrix diagonal
+                                             for Jacobi fallback) */
+
+} cs_sles_pc_ilu_t;
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
@@ -661,6 +711,557 @@ _sles_pc_poly_destroy (void  **context)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Create an ILU(0) or symmetric Gauss-Seidel preconditioner structure.
+ *
+ * parameters:
+ *   ilu <-- true for ILU(0), false for symmetric Gauss-Seidel
+ *
+ * returns:
+ *   pointer to newly created preconditioner object.
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_pc_ilu_t *
+_sles_pc_ilu_create(bool  ilu)
+{
+  cs_sles_pc_ilu_t *pc;
+
+  BFT_MALLOC(pc, 1, cs_sles_pc_ilu_t);
+
+  pc->ilu = ilu;
+  pc->jacobi = false;
+
+  pc->n_rows = 0;
+  pc->n_cols = 0;
+
+  for (int i = 0; i < 2; i++) {
+    pc->n_levels[i] = 0;
+    pc->level_idx[i] = NULL;
+    pc->level_rows[i] = NULL;
+  }
+
+  pc->row_index = NULL;
+  pc->u_row_index = NULL;
+  pc->col_id = NULL;
+  pc->x_val = NULL;
+
+  pc->ad_inv = NULL;
+
+  return pc;
+}
+
+/*----------------------------------------------------------------------------
+ * Function returning the type name of ILU(0) or SGS preconditioner context.
+ *
+ * parameters:
+ *   context   <-- pointer to preconditioner context
+ *   logging   <-- if true, logging description; if false, canonical name
+ *----------------------------------------------------------------------------*/
+
+static const char *
+_sles_pc_ilu_get_type(const void  *context,
+                      bool         logging)
+{
+  const cs_sles_pc_ilu_t  *c = context;
+
+  int t_id = (c->ilu) ? 0 : 1;
+
+  if (logging == false) {
+    static const char *t[] = {"ilu0",
+                              "symmetric_gauss_seidel"};
+    return t[t_id];
+  }
+  else {
+    static const char *t[] = {N_("ILU(0)"),
+                              N_("symmetric Gauss-Seidel")};
+    return _(t[t_id]);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Build level sets for a lower or upper triangular solve.
+ *
+ * The level of a row is 1 + the maximum level of the rows it depends on,
+ * so that all rows of a given level may be handled simultaneously.
+ *
+ * parameters:
+ *   n_rows      <-- number of rows
+ *   row_index   <-- local extra-diagonal row index
+ *   u_row_index <-- start of upper part of each row
+ *   col_id      <-- local column ids
+ *   upper       <-- true for upper triangular part, false for lower
+ *   n_levels    --> number of levels
+ *   level_idx   --> level index (size: n_levels + 1)
+ *   level_rows  --> rows, ordered by level
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_levels(cs_lnum_t         n_rows,
+              const cs_lnum_t   row_index[],
+              const cs_lnum_t   u_row_index[],
+              const cs_lnum_t   col_id[],
+              bool              upper,
+              int              *n_levels,
+              cs_lnum_t       **level_idx,
+              cs_lnum_t       **level_rows)
+{
+  int _n_levels = 0;
+  int *row_level;
+  cs_lnum_t *_level_idx, *_level_rows;
+
+  BFT_MALLOC(row_level, n_rows, int);
+
+  /* Determine level of each row */
+
+  if (upper == false) {
+    for (cs_lnum_t i = 0; i < n_rows; i++) {
+      int l = 0;
+      for (cs_lnum_t j = row_index[i]; j < u_row_index[i]; j++) {
+        if (row_level[col_id[j]] >= l)
+          l = row_level[col_id[j]] + 1;
+      }
+      row_level[i] = l;
+      if (l >= _n_levels)
+        _n_levels = l + 1;
+    }
+  }
+  else {
+    for (cs_lnum_t i = n_rows - 1; i > -1; i--) {
+      int l = 0;
+      for (cs_lnum_t j = u_row_index[i]; j < row_index[i+1]; j++) {
+        if (row_level[col_id[j]] >= l)
+          l = row_level[col_id[j]] + 1;
+      }
+      row_level[i] = l;
+      if (l >= _n_levels)
+        _n_levels = l + 1;
+    }
+  }
+
+  /* Order rows by level (counting sort, preserving row order
+     inside each level) */
+
+  BFT_MALLOC(_level_idx, _n_levels + 1, cs_lnum_t);
+  BFT_MALLOC(_level_rows, n_rows, cs_lnum_t);
+
+  for (int l = 0; l < _n_levels + 1; l++)
+    _level_idx[l] = 0;
+
+  for (cs_lnum_t i = 0; i < n_rows; i++)
+    _level_idx[row_level[i] + 1] += 1;
+
+  for (int l = 0; l < _n_levels; l++)
+    _level_idx[l+1] += _level_idx[l];
+
+  for (cs_lnum_t i = 0; i < n_rows; i++) {
+    int l = row_level[i];
+    _level_rows[_level_idx[l]] = i;
+    _level_idx[l] += 1;
+  }
+
+  for (int l = _n_levels; l > 0; l--)
+    _level_idx[l] = _level_idx[l-1];
+  _level_idx[0] = 0;
+
+  BFT_FREE(row_level);
+
+  *n_levels = _n_levels;
+  *level_idx = _level_idx;
+  *level_rows = _level_rows;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute ILU(0) factorization in place, using level scheduling.
+ *
+ * On input, x_val contains the extra-diagonal matrix coefficients and
+ * ad_inv the matrix diagonal; on output, the lower part of x_val contains
+ * the (unit diagonal) lower factor, its upper part the upper factor,
+ * and ad_inv the inverse of the upper factor's diagonal.
+ *
+ * parameters:
+ *   c <-> pointer to preconditioner context
+ *----------------------------------------------------------------------------*/
+
+static void
+_ilu0_factorize(cs_sles_pc_ilu_t  *c)
+{
+  const cs_lnum_t *restrict row_index = c->row_index;
+  const cs_lnum_t *restrict u_row_index = c->u_row_index;
+  const cs_lnum_t *restrict col_id = c->col_id;
+  const cs_lnum_t *restrict level_idx = c->level_idx[0];
+  const cs_lnum_t *restrict level_rows = c->level_rows[0];
+
+  cs_real_t *restrict x_val = c->x_val;
+  cs_real_t *restrict ad_inv = c->ad_inv;
+
+  const int n_levels = c->n_levels[0];
+
+# pragma omp parallel if(c->n_rows > CS_THR_MIN)
+  for (int l = 0; l < n_levels; l++) {
+
+#   pragma omp for
+    for (cs_lnum_t ll = level_idx[l]; ll < level_idx[l+1]; ll++) {
+
+      const cs_lnum_t ii = level_rows[ll];
+      const cs_lnum_t e_id = row_index[ii+1];
+
+      cs_real_t d = ad_inv[ii];
+
+      /* Lower columns are sorted, so rows kk are handled in
+         increasing order (IKJ variant) */
+
+      for (cs_lnum_t p = row_index[ii]; p < u_row_index[ii]; p++) {
+
+        const cs_lnum_t kk = col_id[p];
+        const cs_real_t l_ik = x_val[p] * ad_inv[kk];
+
+        x_val[p] = l_ik;
+
+        /* Update remaining entries of row ii belonging to its pattern
+           (column ids are sorted, so use a binary search) */
+
+        for (cs_lnum_t q = u_row_index[kk]; q < row_index[kk+1]; q++) {
+
+          const cs_lnum_t jj = col_id[q];
+
+          if (jj == ii)
+            d -= l_ik * x_val[q];
+
+          else {
+            cs_lnum_t start_id = p + 1, end_id = e_id;
+            while (start_id < end_id) {
+              cs_lnum_t mid_id = start_id + (end_id - start_id)/2;
+              if (col_id[mid_id] < jj)
+                start_id = mid_id + 1;
+              else
+                end_id = mid_id;
+            }
+            if (start_id < e_id && col_id[start_id] == jj)
+              x_val[start_id] -= l_ik * x_val[q];
+          }
+
+        }
+
+      }
+
+      ad_inv[ii] = 1.0 / d;
+
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Function for setup of an ILU(0) or SGS preconditioner context.
+ *
+ * parameters:
+ *   context   <-> pointer to preconditioner context
+ *   name      <-- pointer to name of associated linear system
+ *   a         <-- matrix
+ *   verbosity <-- associated verbosity
+ *----------------------------------------------------------------------------*/
+
+static void
+_sles_pc_ilu_setup(void               *context,
+                   const char         *name,
+                   const cs_matrix_t  *a,
+                   int                 verbosity)
+{
+  cs_sles_pc_ilu_t  *c = context;
+
+  const int *db_size = cs_matrix_get_diag_block_size(a);
+
+  c->n_rows = cs_matrix_get_n_rows(a)*db_size[0];
+  c->n_cols = cs_matrix_get_n_columns(a)*db_size[0];
+
+  const cs_lnum_t n_rows = c->n_rows;
+
+  BFT_REALLOC(c->ad_inv, n_rows, cs_real_t);
+
+  cs_matrix_copy_diagonal(a, c->ad_inv);
+
+  /* Fall back to Jacobi if the matrix type is not adapted */
+
+  if (cs_matrix_get_type(a) != CS_MATRIX_MSR || db_size[0] > 1) {
+
+    c->jacobi = true;
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_rows; i++)
+      c->ad_inv[i] = 1.0 / c->ad_inv[i];
+
+    return;
+  }
+
+  c->jacobi = false;
+
+  const cs_lnum_t  *a_row_index, *a_col_id;
+  const cs_real_t  *a_d_val, *a_x_val;
+
+  cs_matrix_get_msr_arrays(a, &a_row_index, &a_col_id, &a_d_val, &a_x_val);
+
+  /* Build local structure with sorted columns, ignoring
+     columns matching halo values */
+
+  BFT_REALLOC(c->row_index, n_rows + 1, cs_lnum_t);
+  BFT_REALLOC(c->u_row_index, n_rows, cs_lnum_t);
+
+  c->row_index[0] = 0;
+  for (cs_lnum_t i = 0; i < n_rows; i++) {
+    cs_lnum_t n = 0;
+    for (cs_lnum_t j = a_row_index[i]; j < a_row_index[i+1]; j++) {
+      if (a_col_id[j] < n_rows)
+        n++;
+    }
+    c->row_index[i+1] = c->row_index[i] + n;
+  }
+
+  BFT_REALLOC(c->col_id, c->row_index[n_rows], cs_lnum_t);
+  BFT_REALLOC(c->x_val, c->row_index[n_rows], cs_real_t);
+
+  cs_lnum_t  *restrict col_id = c->col_id;
+  cs_real_t  *restrict x_val = c->x_val;
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_rows; i++) {
+
+    const cs_lnum_t s_id = c->row_index[i];
+    cs_lnum_t k = s_id;
+
+    for (cs_lnum_t j = a_row_index[i]; j < a_row_index[i+1]; j++) {
+      if (a_col_id[j] < n_rows) {
+        col_id[k] = a_col_id[j];
+        x_val[k] = a_x_val[j];
+        k++;
+      }
+    }
+
+    /* Insertion sort (rows are short) */
+
+    for (cs_lnum_t j = s_id + 1; j < k; j++) {
+      cs_lnum_t t_id = col_id[j];
+      cs_real_t t_val = x_val[j];
+      cs_lnum_t l = j;
+      while (l > s_id && col_id[l-1] > t_id) {
+        col_id[l] = col_id[l-1];
+        x_val[l] = x_val[l-1];
+        l--;
+      }
+      col_id[l] = t_id;
+      x_val[l] = t_val;
+    }
+
+    cs_lnum_t u_id = s_id;
+    while (u_id < k && col_id[u_id] < i)
+      u_id++;
+    c->u_row_index[i] = u_id;
+
+  }
+
+  /* Build level sets for triangular solves */
+
+  for (int i = 0; i < 2; i++) {
+    BFT_FREE(c->level_idx[i]);
+    BFT_FREE(c->level_rows[i]);
+    _build_levels(n_rows, c->row_index, c->u_row_index, c->col_id,
+                  (i == 0) ? false : true,
+                  c->n_levels + i, c->level_idx + i, c->level_rows + i);
+  }
+
+  /* Compute factors */
+
+  if (c->ilu)
+    _ilu0_factorize(c);
+
+  else {
+
+    /* (D+L)D^-1(D+U) = (Id + L.D^-1)(D+U) */
+
+    const cs_real_t *restrict ad = c->ad_inv;
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_rows; i++) {
+      for (cs_lnum_t j = c->row_index[i]; j < c->u_row_index[i]; j++)
+        x_val[j] /= ad[col_id[j]];
+    }
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_rows; i++)
+      c->ad_inv[i] = 1.0 / c->ad_inv[i];
+
+  }
+
+  if (verbosity > 1)
+    bft_printf(_("  %s preconditioner for \"%s\":\n"
+                 "    lower solve levels: %d; upper solve levels: %d\n"),
+               _sles_pc_ilu_get_type(c, true), name,
+               c->n_levels[0], c->n_levels[1]);
+}
+
+/*----------------------------------------------------------------------------
+ * Function for application of an ILU(0) or SGS preconditioner.
+ *
+ * In cases where it is desired that the preconditioner modify a vector
+ * "in place", x_in should be set to NULL, and x_out contain the vector to
+ * be modified (\f$x_{out} \leftarrow M^{-1}x_{out})\f$).
+ *
+ * parameters:
+ *   context       <-> pointer to preconditioner context
+ *   rotation_mode <-- halo update option for rotational periodicity
+ *   x_in          <-- input vector
+ *   x_out         <-> input/output vector
+ *
+ * returns:
+ *   preconditioner application status
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_pc_state_t
+_sles_pc_ilu_apply(void                *context,
+                   cs_halo_rotation_t   rotation_mode,
+                   const cs_real_t     *x_in,
+                   cs_real_t           *x_out)
+{
+  CS_UNUSED(rotation_mode);
+
+  cs_sles_pc_ilu_t  *c = context;
+
+  const cs_lnum_t n_rows = c->n_rows;
+  const cs_real_t *restrict ad_inv = c->ad_inv;
+
+  if (c->jacobi) {
+    if (x_in != NULL) {
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+        x_out[ii] = x_in[ii] * ad_inv[ii];
+    }
+    else {
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+        x_out[ii] *= ad_inv[ii];
+    }
+    return CS_SLES_PC_CONVERGED;
+  }
+
+  /* When applied in place, the forward solve only reads the
+     right-hand side value of a row before overwriting it;
+     r may alias x_out, so it is not qualified with restrict */
+
+  const cs_real_t *r = (x_in != NULL) ? x_in : x_out;
+
+  const cs_lnum_t *restrict row_index = c->row_index;
+  const cs_lnum_t *restrict u_row_index = c->u_row_index;
+  const cs_lnum_t *restrict col_id = c->col_id;
+  const cs_real_t *restrict x_val = c->x_val;
+
+# pragma omp parallel if(n_rows > CS_THR_MIN)
+  {
+    /* Forward solve with unit lower triangular factor */
+
+    const cs_lnum_t *restrict level_idx = c->level_idx[0];
+    const cs_lnum_t *restrict level_rows = c->level_rows[0];
+
+    for (int l = 0; l < c->n_levels[0]; l++) {
+
+#     pragma omp for
+      for (cs_lnum_t ll = level_idx[l]; ll < level_idx[l+1]; ll++) {
+        const cs_lnum_t ii = level_rows[ll];
+        cs_real_t s = r[ii];
+        for (cs_lnum_t jj = row_index[ii]; jj < u_row_index[ii]; jj++)
+          s -= x_val[jj] * x_out[col_id[jj]];
+        x_out[ii] = s;
+      }
+
+    }
+
+    /* Backward solve with upper triangular factor */
+
+    level_idx = c->level_idx[1];
+    level_rows = c->level_rows[1];
+
+    for (int l = 0; l < c->n_levels[1]; l++) {
+
+#     pragma omp for
+      for (cs_lnum_t ll = level_idx[l]; ll < level_idx[l+1]; ll++) {
+        const cs_lnum_t ii = level_rows[ll];
+        cs_real_t s = x_out[ii];
+        for (cs_lnum_t jj = u_row_index[ii]; jj < row_index[ii+1]; jj++)
+          s -= x_val[jj] * x_out[col_id[jj]];
+        x_out[ii] = s * ad_inv[ii];
+      }
+
+    }
+  }
+
+  return CS_SLES_PC_CONVERGED;
+}
+
+/*----------------------------------------------------------------------------
+ * Function for freeing of an ILU(0) or SGS preconditioner's context data.
+ *
+ * parameters:
+ *   context <-> pointer to preconditioner context
+ *----------------------------------------------------------------------------*/
+
+static void
+_sles_pc_ilu_free(void  *context)
+{
+  cs_sles_pc_ilu_t  *c = context;
+
+  c->n_rows = 0;
+  c->n_cols = 0;
+
+  for (int i = 0; i < 2; i++) {
+    c->n_levels[i] = 0;
+    BFT_FREE(c->level_idx[i]);
+    BFT_FREE(c->level_rows[i]);
+  }
+
+  BFT_FREE(c->row_index);
+  BFT_FREE(c->u_row_index);
+  BFT_FREE(c->col_id);
+  BFT_FREE(c->x_val);
+
+  BFT_FREE(c->ad_inv);
+}
+
+/*----------------------------------------------------------------------------
+ * Function for creation of an ILU(0) or SGS preconditioner context based
+ * on the copy of another.
+ *
+ * parameters:
+ *   context  <-- context to clone
+ *
+ * returns:
+ *   pointer to newly created context
+ *----------------------------------------------------------------------------*/
+
+static void *
+_sles_pc_ilu_clone(const void  *context)
+{
+  const cs_sles_pc_ilu_t *c = (const cs_sles_pc_ilu_t *)context;
+
+  cs_sles_pc_ilu_t *pc = _sles_pc_ilu_create(c->ilu);
+
+  return pc;
+}
+
+/*----------------------------------------------------------------------------
+ * Function pointer for destruction of an ILU(0) or SGS preconditioner
+ * context.
+ *
+ * parameters:
+ *   context <-> pointer to preconditioner context
+ *----------------------------------------------------------------------------*/
+
+static void
+_sles_pc_ilu_destroy (void  **context)
+{
+  if (context != NULL) {
+    _sles_pc_ilu_free(*context);
+    BFT_FREE(*context);
+  }
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1123,6 +1724,63 @@ cs_sles_pc_poly_2_create(void)
   return pc;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create an ILU(0) (incomplete LU factorization without fill-in)
+ *        preconditioner.
+ *
+ * Triangular solves are process-local, and threaded using level scheduling.
+ *
+ * \return  pointer to newly created preconditioner object.
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_pc_t *
+cs_sles_pc_ilu0_create(void)
+{
+  cs_sles_pc_ilu_t *pci = _sles_pc_ilu_create(true);
+
+  cs_sles_pc_t *pc = cs_sles_pc_define(pci,
+                                       _sles_pc_ilu_get_type,
+                                       _sles_pc_ilu_setup,
+                                       NULL,
+                                       _sles_pc_ilu_apply,
+                                       _sles_pc_ilu_free,
+                                       NULL,
+                                       _sles_pc_ilu_clone,
+                                       _sles_pc_ilu_destroy);
+
+  return pc;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a symmetric Gauss-Seidel preconditioner.
+ *
+ * Triangular solves are process-local, and threaded using level scheduling.
+ *
+ * \return  pointer to newly created preconditioner object.
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_pc_t *
+cs_sles_pc_sgs_create(void)
+{
+  cs_sles_pc_ilu_t *pci = _sles_pc_ilu_create(false);
+
+  cs_sles_pc_t *pc = cs_sles_pc_define(pci,
+                                       _sles_pc_ilu_get_type,
+                                       _sles_pc_ilu_setup,
+                                       NULL,
+                                       _sles_pc_ilu_apply,
+                                       _sles_pc_ilu_free,
+                                       NULL,
+                                       _sles_pc_ilu_clone,
+                                       _sles_pc_ilu_destroy);
+
+  return pc;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
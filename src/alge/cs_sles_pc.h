@@ -508,6 +508,33 @@ cs_sles_pc_poly_1_create(void);
 cs_sles_pc_t *
 cs_sles_pc_poly_2_create(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create an ILU(0) (incomplete LU factorization without fill-in)
+ *        preconditioner.
+ *
+ * Triangular solves are process-local, and threaded using level scheduling.
+ *
+ * \return  pointer to newly created preconditioner object.
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_pc_t *
+cs_sles_pc_ilu0_create(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a symmetric Gauss-Seidel preconditioner.
+ *
+ * Triangular solves are process-local, and threaded using level scheduling.
+ *
+ * \return  pointer to newly created preconditioner object.
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_pc_t *
+cs_sles_pc_sgs_create(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -0,0 +1,699 @@
+/*============================================================================
+ *  Conversion of compressed variable files to EnSight Gold format
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#define CS_IGNORE_MPI 1  /* No MPI for this application */
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <errno.h>
+#include <locale.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
+
+/* Record types and coding parameters (must match fvm_to_compressed.c) */
+
+#define _CZ_RECORD_PART      1
+#define _CZ_RECORD_SECTION   2
+
+#define _CZ_GROUP_SIZE      64
+#define _CZ_Q_MAX           24
+
+/* EnSight undefined value, used for elements or vertices skipped
+   based on the output stride */
+
+#define _CZ_UNDEF_VALUE     -1.e20f
+
+/*
+ * Allocate memory for _ni items of type _type.
+ *
+ * This macro calls _mem_malloc(), automatically setting the
+ * allocated variable name and source file name and line arguments.
+ *
+ * parameters:
+ *   _ptr  --> pointer to allocated memory.
+ *   _ni   <-- number of items.
+ *   _type <-- element type.
+ */
+
+#define MEM_MALLOC(_ptr, _ni, _type) \
+_ptr = (_type *) _mem_malloc(_ni, sizeof(_type), \
+                             #_ptr, __FILE__, __LINE__)
+
+/*
+ * Free allocated memory.
+ *
+ * The freed pointer is set to NULL to avoid accidental reuse.
+ *
+ * parameters:
+ *   _ptr  <->  pointer to allocated memory.
+ */
+
+#define MEM_FREE(_ptr) \
+free(_ptr), _ptr = NULL
+
+/*============================================================================
+ * Local Type Definitions
+ *============================================================================*/
+
+/* Input file descriptor */
+
+typedef struct {
+
+  const char     *filename;       /* File name */
+  FILE           *f;              /* File handle */
+  int             swap_endian;    /* Swap big-endian and little-endian ? */
+
+} _cz_file_t;
+
+/* Bit stream reader (most significant bit first) */
+
+typedef struct {
+
+  const unsigned char  *buf;      /* Byte buffer */
+  size_t                size;     /* Buffer size, in bytes */
+  size_t                pos;      /* Current position, in bits */
+
+} _bit_reader_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static const char _cz_magic_string[]
+  = "Code_Saturne compressed EnSight variable";
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Print usage and exit.
+ *
+ * parameters:
+ *   arg_0     <-- name of executable as given by argv[0]
+ *   exit_code <-- EXIT_SUCCESS or EXIT_FAILURE
+ *----------------------------------------------------------------------------*/
+
+static void
+_usage(const char  *arg_0,
+       int          exit_code)
+{
+  printf
+    (_("\n"
+       "Usage: %s [options] <file_name.cz> [<file_name.cz> ...]\n\n"
+       "Convert variable files written by the \"compressed\" post-processing\n"
+       "writer to EnSight Gold binary variable files (the \".cz\" extension\n"
+       "is removed, so as to match the names referenced by the case file).\n\n"
+       "Options:\n\n"
+       "  -i, --info        only print file structure and compression\n"
+       "                    statistics, with no conversion.\n\n"
+       "  -h, --help        this message.\n\n"),
+     arg_0);
+
+  exit(exit_code);
+}
+
+/*----------------------------------------------------------------------------
+ * Abort with error message.
+ *
+ * parameters:
+ *   file_name      <-- name of source file from which function is called.
+ *   line_num       <-- line of source file from which function is called.
+ *   sys_error_code <-- error code if error in system or libc call,
+ *                      0 otherwise.
+ *   format         <-- format string, as printf() and family.
+ *   ...            <-- variable arguments based on format string.
+ *----------------------------------------------------------------------------*/
+
+static void
+_error(const char  *file_name,
+       int          line_num,
+       int          sys_error_code,
+       const char  *format,
+       ...)
+{
+  va_list  arg_ptr;
+
+  va_start(arg_ptr, format);
+
+  fflush(stdout);
+
+  fprintf(stderr, "\n");
+
+  if (sys_error_code != 0)
+    fprintf(stderr, _("\nSystem error: %s\n"), strerror(sys_error_code));
+
+  fprintf(stderr, _("\n%s:%d: Fatal error.\n\n"), file_name, line_num);
+
+  vfprintf(stderr, format, arg_ptr);
+
+  fprintf(stderr, "\n\n");
+
+  va_end(arg_ptr);
+
+  assert(0);
+
+  exit(EXIT_FAILURE);
+}
+
+/*----------------------------------------------------------------------------
+ * Allocate memory and check result.
+ *
+ * This function simply wraps malloc() and calls _error() if it fails.
+ *
+ * parameters:
+ *   ni        <-- number of elements.
+ *   size      <-- element size.
+ *   var_name  <-- allocated variable name string.
+ *   file_name <-- name of calling source file.
+ *   line_num  <-- line number in calling source file.
+ *
+ * returns:
+ *   pointer to allocated memory.
+ *----------------------------------------------------------------------------*/
+
+static void *
+_mem_malloc(size_t       ni,
+            size_t       size,
+            const char  *var_name,
+            const char  *file_name,
+            int          line_num)
+{
+  void  *p_ret;
+  size_t  alloc_size = ni * size;
+
+  if (ni == 0)
+    return NULL;
+
+  /* Allocate memory and check return */
+
+  p_ret = malloc(alloc_size);
+
+  if (p_ret == NULL)
+    _error(file_name, line_num, errno,
+           _("Failure to allocate \"%s\" (%lu bytes)"),
+           var_name, (unsigned long)alloc_size);
+
+  return p_ret;
+}
+
+/*----------------------------------------------------------------------------
+ * Convert data from "little-endian" to "big-endian" or the reverse.
+ *
+ * parameters:
+ *   buf  <-> pointer to converted data location.
+ *   size <-- size of each item of data in bytes.
+ *   ni   <-- number of data items.
+ *----------------------------------------------------------------------------*/
+
+static void
+_swap_endian(void        *buf,
+             size_t       size,
+             size_t       ni)
+{
+  unsigned char  *p = (unsigned char *)buf;
+
+  for (size_t i = 0; i < ni; i++) {
+
+    size_t shift = i * size;
+
+    for (size_t ib = 0; ib < (size / 2); ib++) {
+      unsigned char tmpswap = p[shift + ib];
+      p[shift + ib] = p[shift + (size - 1) - ib];
+      p[shift + (size - 1) - ib] = tmpswap;
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Read data from a compressed variable file.
+ *
+ * parameters:
+ *   buf    --> pointer to location receiving data
+ *   size   <-- size of each item of data in bytes
+ *   ni     <-- number of items to read
+ *   inp    <-- input file descriptor
+ *   at_eof <-- if true, allow end of file before the first item
+ *
+ * returns:
+ *   the number of items (not bytes) sucessfully read;
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_file_read(void        *buf,
+           size_t       size,
+           size_t       ni,
+           _cz_file_t  *inp,
+           int          at_eof)
+{
+  size_t retval = 0;
+
+  if (ni != 0)
+    retval = fread(buf, size, ni, inp->f);
+
+  if (retval != ni) {
+    int err_num = ferror(inp->f);
+    if (err_num != 0)
+      _error(__FILE__, __LINE__, 0,
+             _("Error reading file \"%s\":\n\n  %s"),
+             inp->filename, strerror(err_num));
+    else if (retval == 0 && at_eof)
+      return retval;
+    else
+      _error(__FILE__, __LINE__, 0,
+             _("Premature end of file \"%s\""), inp->filename);
+  }
+
+  if (inp->swap_endian && size > 1)
+    _swap_endian(buf, size, ni);
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Write data to an EnSight Gold file.
+ *
+ * parameters:
+ *   buf       <-- pointer to data
+ *   size      <-- size of each item of data in bytes
+ *   ni        <-- number of items to write
+ *   f         <-- output file handle
+ *   file_name <-- output file name
+ *----------------------------------------------------------------------------*/
+
+static void
+_file_write(const void  *buf,
+            size_t       size,
+            size_t       ni,
+            FILE        *f,
+            const char  *file_name)
+{
+  if (f == NULL || ni == 0)
+    return;
+
+  if (fwrite(buf, size, ni, f) != ni)
+    _error(__FILE__, __LINE__, errno,
+           _("Error writing file \"%s\"."), file_name);
+}
+
+/*----------------------------------------------------------------------------
+ * Read bits from a bit stream.
+ *
+ * parameters:
+ *   br     <-> bit stream reader
+ *   n_bits <-- number of bits to read (0 to 64)
+ *
+ * returns:
+ *   value read
+ *----------------------------------------------------------------------------*/
+
+static uint64_t
+_bit_reader_get(_bit_reader_t  *br,
+                int             n_bits)
+{
+  uint64_t retval = 0;
+
+  if (br->pos + n_bits > br->size*8)
+    _error(__FILE__, __LINE__, 0, _("Corrupted compressed data chunk."));
+
+  for (int i = 0; i < n_bits; i++) {
+    size_t p = br->pos + i;
+    retval = (retval << 1) | ((br->buf[p >> 3] >> (7 - (p & 7))) & 1);
+  }
+  br->pos += n_bits;
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Decode a series of values (reverse of _encode_values in
+ * fvm_to_compressed.c).
+ *
+ * parameters:
+ *   br       <-> bit stream reader
+ *   n_values <-- number of values
+ *   eps      <-- absolute error bound
+ *   values   --> decoded values
+ *----------------------------------------------------------------------------*/
+
+static void
+_decode_values(_bit_reader_t  *br,
+               size_t          n_values,
+               double          eps,
+               double          values[])
+{
+  const double step = 2.*eps;
+
+  double pred = 0.;
+
+  for (size_t s_id = 0; s_id < n_values; s_id += _CZ_GROUP_SIZE) {
+
+    size_t e_id = s_id + _CZ_GROUP_SIZE;
+    if (e_id > n_values)
+      e_id = n_values;
+
+    int k = _bit_reader_get(br, 6);
+
+    for (size_t i = s_id; i < e_id; i++) {
+
+      uint64_t q = 0, u = 0;
+      while (q < _CZ_Q_MAX && _bit_reader_get(br, 1) == 1)
+        q++;
+      if (q < _CZ_Q_MAX)
+        u = (q << k) | _bit_reader_get(br, k);
+      else
+        u = _bit_reader_get(br, 64);
+
+      if (u == 0) {
+        uint64_t raw = _bit_reader_get(br, 64);
+        memcpy(values + i, &raw, sizeof(double));
+        pred = isfinite(values[i]) ? values[i] : 0.;
+      }
+      else {
+        uint64_t z = u - 1;
+        int64_t c = (z & 1) ? -(int64_t)(z >> 1) - 1 : (int64_t)(z >> 1);
+        values[i] = pred + (double)c*step;
+        pred = values[i];
+      }
+
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Convert a compressed variable file to an EnSight Gold variable file.
+ *
+ * parameters:
+ *   file_name <-- name of compressed file
+ *   info      <-- if nonzero, print structure only
+ *----------------------------------------------------------------------------*/
+
+static void
+_convert_file(const char  *file_name,
+              int          info)
+{
+  char buf[81];
+  int32_t n;
+
+  size_t l = strlen(file_name);
+  char *out_name = NULL;
+  FILE *out = NULL;
+
+  long long in_size = 0, out_size = 0;
+
+  _cz_file_t inp = {file_name, NULL, 0};
+
+  /* Open files */
+
+  inp.f = fopen(file_name, "rb");
+  if (inp.f == NULL)
+    _error(__FILE__, __LINE__, errno,
+           _("Error opening file \"%s\""), file_name);
+
+  _file_read(buf, 1, 80, &inp, 0);
+  buf[80] = '\0';
+  if (strncmp(buf, _cz_magic_string, 80) != 0)
+    _error(__FILE__, __LINE__, 0,
+           _("File \"%s\" is not a compressed variable file."), file_name);
+
+  _file_read(&n, sizeof(int32_t), 1, &inp, 0);
+  if (n != 1) {
+    _swap_endian(&n, sizeof(int32_t), 1);
+    if (n != 1)
+      _error(__FILE__, __LINE__, 0,
+             _("File \"%s\" has an unrecognized byte order."), file_name);
+    inp.swap_endian = 1;
+  }
+
+  if (info == 0) {
+    if (l < 4 || strcmp(file_name + l - 3, ".cz") != 0)
+      _error(__FILE__, __LINE__, 0,
+             _("File name \"%s\" does not end with \".cz\"."), file_name);
+    MEM_MALLOC(out_name, l - 2, char);
+    strncpy(out_name, file_name, l - 3);
+    out_name[l-3] = '\0';
+    out = fopen(out_name, "wb");
+    if (out == NULL)
+      _error(__FILE__, __LINE__, errno,
+             _("Error opening file \"%s\""), out_name);
+  }
+
+  /* Description line */
+
+  _file_read(buf, 1, 80, &inp, 0);
+  _file_write(buf, 1, 80, out, out_name);
+  buf[80] = '\0';
+
+  printf(_("\n  %s\n  \"%s\"\n"), file_name, buf);
+
+  out_size = 80;
+
+  /* Loop on records */
+
+  while (_file_read(&n, sizeof(int32_t), 1, &inp, 1) == 1) {
+
+    if (n == _CZ_RECORD_PART) {
+
+      int32_t part_num;
+      _file_read(&part_num, sizeof(int32_t), 1, &inp, 0);
+
+      memset(buf, 0, 80);
+      strcpy(buf, "part");
+      _file_write(buf, 1, 80, out, out_name);
+      _file_write(&part_num, sizeof(int32_t), 1, out, out_name);
+
+      out_size += 80 + 4;
+
+      printf(_("\n    part %d\n"), (int)part_num);
+
+    }
+
+    else if (n == _CZ_RECORD_SECTION) {
+
+      uint64_t n_values;
+      int32_t n_comp, stride;
+
+      _file_read(buf, 1, 80, &inp, 0);
+      _file_read(&n_values, sizeof(uint64_t), 1, &inp, 0);
+      _file_read(&n_comp, sizeof(int32_t), 1, &inp, 0);
+      _file_read(&stride, sizeof(int32_t), 1, &inp, 0);
+
+      if (stride < 1)
+        _error(__FILE__, __LINE__, 0,
+               _("Corrupted section record in file \"%s\"."), file_name);
+
+      buf[80] = '\0';
+
+      printf(_("      %-12s %12llu values, %d component(s), "
+               "stride %d\n"),
+             buf, (unsigned long long)n_values, (int)n_comp,
+             (int)stride);
+
+      /* Values which are not at a stride multiple are marked as undefined,
+         using the EnSight "<element type> undef" section variant */
+
+      if (stride > 1) {
+        char u_buf[81];
+        const float undef_value = _CZ_UNDEF_VALUE;
+        memset(u_buf, 0, 80);
+        snprintf(u_buf, 80, "%.72s undef", buf);
+        _file_write(u_buf, 1, 80, out, out_name);
+        _file_write(&undef_value, sizeof(float), 1, out, out_name);
+        out_size += sizeof(float);
+      }
+      else
+        _file_write(buf, 1, 80, out, out_name);
+
+      float *f_values;
+      MEM_MALLOC(f_values, n_values, float);
+
+      for (int32_t comp_id = 0; comp_id < n_comp; comp_id++) {
+
+        double eps;
+        uint64_t total_size, read_size = 0;
+
+        _file_read(&eps, sizeof(double), 1, &inp, 0);
+        _file_read(&total_size, sizeof(uint64_t), 1, &inp, 0);
+
+        printf(_("        component %d: error bound %12.5g, "
+                 "%llu bytes\n"),
+               (int)comp_id, eps, (unsigned long long)total_size);
+
+        while (read_size < total_size) {
+
+          uint64_t c_header[3];
+          _file_read(c_header, sizeof(uint64_t), 3, &inp, 0);
+
+          uint64_t s_id = c_header[0], e_id = c_header[0] + c_header[1];
+          if (e_id > n_values)
+            _error(__FILE__, __LINE__, 0,
+                   _("Corrupted data chunk in file \"%s\"."), file_name);
+
+          unsigned char *c_buf;
+          MEM_MALLOC(c_buf, c_header[2], unsigned char);
+          _file_read(c_buf, 1, c_header[2], &inp, 0);
+
+          read_size += sizeof(c_header) + c_header[2];
+
+          if (info) {
+            MEM_FREE(c_buf);
+            continue;
+          }
+
+          uint64_t j0 = ((s_id + stride - 1)/stride)*stride;
+          size_t n_samples = (e_id > j0) ? (e_id - j0 - 1)/stride + 1 : 0;
+
+          double *d_values;
+          MEM_MALLOC(d_values, n_samples, double);
+
+          _bit_reader_t br = {c_buf, c_header[2], 0};
+          _decode_values(&br, n_samples, eps, d_values);
+
+          size_t k = 0;
+          for (uint64_t j = s_id; j < e_id; j++) {
+            if (j % stride == 0)
+              f_values[j] = d_values[k++];
+            else
+              f_values[j] = _CZ_UNDEF_VALUE;
+          }
+
+          MEM_FREE(d_values);
+          MEM_FREE(c_buf);
+        }
+
+        _file_write(f_values, sizeof(float), n_values, out, out_name);
+
+      }
+
+      out_size += 80 + n_values*n_comp*sizeof(float);
+
+      MEM_FREE(f_values);
+
+    }
+
+    else
+      _error(__FILE__, __LINE__, 0,
+             _("Unknown record type (%d) in file \"%s\"."),
+             (int)n, file_name);
+
+  }
+
+  in_size = ftell(inp.f);
+
+  printf(_("\n    compressed size: %lld bytes, EnSight size: %lld bytes "
+           "(ratio: %g)\n"),
+         in_size, out_size, (double)out_size/(double)in_size);
+
+  /* Close files */
+
+  if (fclose(inp.f) != 0)
+    _error(__FILE__, __LINE__, errno,
+           _("Error closing file \"%s\""), file_name);
+
+  if (out != NULL) {
+    if (fclose(out) != 0)
+      _error(__FILE__, __LINE__, errno,
+             _("Error closing file \"%s\""), out_name);
+    MEM_FREE(out_name);
+  }
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Main program
+ *============================================================================*/
+
+int
+main (int argc, char *argv[])
+{
+  int info = 0, n_files = 0;
+
+  if (getenv("LANG") != NULL)
+    setlocale(LC_ALL,"");
+  else
+    setlocale(LC_ALL,"C");
+  setlocale(LC_NUMERIC,"C");
+
+#if defined(ENABLE_NLS)
+  bindtextdomain(PACKAGE, LOCALEDIR);
+  textdomain(PACKAGE);
+#endif
+
+  /* Parse command line arguments */
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-i") == 0 || strcmp(argv[i], "--info") == 0)
+      info = 1;
+    else if (strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0)
+      _usage(argv[0], EXIT_SUCCESS);
+    else if (argv[i][0] == '-')
+      _usage(argv[0], EXIT_FAILURE);
+    else
+      n_files++;
+  }
+
+  if (n_files == 0)
+    _usage(argv[0], EXIT_FAILURE);
+
+  /* Convert files */
+
+  for (int i = 1; i < argc; i++) {
+    if (argv[i][0] != '-')
+      _convert_file(argv[i], info);
+  }
+
+  printf("\n");
+
+  exit(EXIT_SUCCESS);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -81,7 +81,9 @@
 #include "cs_log_iteration.h"
 #include "cs_matrix_default.h"
 #include "cs_mesh.h"
+#include "cs_mesh_adapt.h"
 #include "cs_mesh_adjacencies.h"
+#include "cs_mesh_box_index.h"
 #include "cs_mesh_coherency.h"
 #include "cs_mesh_location.h"
 #include "cs_mesh_quality.h"
@@ -507,6 +509,10 @@ _run(void)
   cs_turbomachinery_finalize();
   cs_join_finalize();
 
+  /* Free runtime mesh adaptation structures */
+
+  cs_mesh_adapt_finalize();
+
   /* Free post processing or logging related structures */
 
   cs_probe_finalize();
@@ -535,6 +541,7 @@ _run(void)
   /* Free main mesh after printing some statistics */
 
   cs_cell_to_vertex_free();
+  cs_mesh_box_index_free();
   cs_mesh_adjacencies_finalize();
 
   cs_boundary_zone_finalize();
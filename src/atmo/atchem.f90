@@ -78,6 +78,12 @@ double precision, allocatable, dimension(:) ::  reacnum
 !> maximal time step for chemistry resolution
 double precision dtchemmax
 
+!> relative tolerance for adaptive sub-stepping of chemistry resolution
+!> (if <= 0, fixed sub-steps of at most dtchemmax are used)
+double precision, save :: rtolchem
+!> absolute tolerance for adaptive sub-stepping of chemistry resolution
+double precision, save :: atolchem
+
 !> latitude and longitude in degres
 double precision, save ::  lat, lon
 
@@ -83,6 +83,7 @@ double precision rk(nrg)
 double precision dtc
 integer ncycle
 double precision dtrest
+double precision dlerr
 
 double precision, dimension(:), pointer :: crom
 type(pmapper_double_r1), dimension(:), allocatable :: cvar_espg, cvara_espg
@@ -100,6 +101,13 @@ do ii = 1, nespg
   call field_get_val_prev_s(ivarfl(isca(isca_chem(ii))), cvara_espg(ii)%p)
 enddo
 
+! Cells are independent; as the cost of adaptive sub-stepping
+! varies between cells, use dynamic scheduling by blocks of cells.
+! The user scheme routines (usatch.f90) must be thread-safe.
+
+!$omp parallel do private(iel, ii, dtc, rom, rk, conv_factor, source,       &
+!$omp                     dlconc, dchema, ncycle, dtrest, dlerr)           &
+!$omp          schedule(dynamic, 64) if(ncel > thr_n_min)
 do iel = 1, ncel
 
   ! time step
@@ -166,15 +174,17 @@ do iel = 1, ncel
   ! Rosenbrock resoluion
 
   ! The maximum time step used for chemistry resolution is dtchemmax
-  if (dtc.le.dtchemmax) then
-    call roschem (dlconc,source,source,conv_factor,dtc,rk,rk)
+  if (rtolchem.gt.0.d0) then
+    call roschem_adaptive (dlconc,source,conv_factor,dtc,rk)
+  else if (dtc.le.dtchemmax) then
+    call roschem (dlconc,source,source,conv_factor,dtc,rk,rk,dlerr)
   else
     ncycle = int(dtc/dtchemmax)
     dtrest = mod(dtc,dtchemmax)
     do ii = 1, ncycle
-      call roschem (dlconc,source,source,conv_factor,dtchemmax,rk,rk)
+      call roschem (dlconc,source,source,conv_factor,dtchemmax,rk,rk,dlerr)
     enddo
-    call roschem (dlconc,source,source,conv_factor,dtrest,rk,rk)
+    call roschem (dlconc,source,source,conv_factor,dtrest,rk,rk,dlerr)
   endif
 
   ! Update of values at current time step
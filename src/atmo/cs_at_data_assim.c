@@ -298,8 +298,15 @@ cs_at_data_assim_build_ops(void)
       bft_printf("   *Building HBHT\n");
       for (int ii = 0; ii < n_obs; ii++) {
         bft_printf("    ");
-        for (int jj = 0; jj < n_obs; jj++)
-          bft_printf("%.8f ", oi->b_proj[ii*n_obs + jj]);
+        cs_lnum_t kk = oi->b_proj_idx[ii];
+        for (int jj = 0; jj < n_obs; jj++) {
+          cs_real_t b = 0.;
+          if (kk < oi->b_proj_idx[ii+1] && oi->b_proj_ids[kk] == jj) {
+            b = oi->b_proj[ms->dim*kk];
+            kk++;
+          }
+          bft_printf("%.8f ", b);
+        }
         bft_printf("\n");
       }
       bft_printf("\n");
@@ -476,6 +483,9 @@ cs_at_data_assim_log(cs_measures_set_t     *ms,
   bft_printf("  Influence radii of observations (m, used for Model covariance "
              "error matrix) : %.2f %.2f\n",
              oi->ir[0], oi->ir[1]);
+  bft_printf("  Localization cut-off of model covariance (relative to "
+             "influence radii) : %.2f\n",
+             oi->cutoff);
   for (int kk = 0; kk < f->dim; kk++) {
     bft_printf("  Relaxation factor (1/s) for comp. %i: %.1e\n",
                kk, oi->relax[kk]);
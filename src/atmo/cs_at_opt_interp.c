@@ -41,6 +41,7 @@
  * Local headers
  *----------------------------------------------------------------------------*/
 
+#include "bft_error.h"
 #include "bft_mem.h"
 #include "bft_printf.h"
 
@@ -53,6 +54,7 @@
 #include "cs_mesh_quantities.h"
 #include "cs_parall.h"
 #include "cs_math.h"
+#include "cs_sort.h"
 #include "cs_time_step.h"
 
 /*----------------------------------------------------------------------------
@@ -91,6 +93,18 @@ BEGIN_C_DECLS
  * Type definitions
  *============================================================================*/
 
+/* Uniform grid over points, used to find points within a given distance */
+
+typedef struct {
+
+  cs_real_t   origin[3];      /* grid origin */
+  cs_real_t   h;              /* grid cell size */
+  cs_lnum_t   n[3];           /* number of grid cells in each direction */
+  cs_lnum_t  *cell_idx;       /* grid cell -> points index */
+  cs_lnum_t  *pt_ids;         /* grid cell -> point ids */
+
+} _point_grid_t;
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -416,90 +430,516 @@ _p1_projection(cs_measures_set_t  *ms,
 }
 
 /*----------------------------------------------------------------------------
- * Compute coefficient bij of model covariance matrix (B)
- * of size n_cells*n_cells.
+ * Compute the distance between points I and J used for the coefficients of
+ * the model covariance matrix (B) of size n_cells*n_cells, given coordinates
+ * normalized by the influence radii (see _normalize_coords).
  *
  * parameters:
- *   xi     <-- x coordinate of point I
- *   yi     <-- y coordinate of point I
- *   zi     <-- z coordinate of point I
- *   xj     <-- x coordinate of point J
- *   yj     <-- y coordinate of point J
- *   zj     <-- z coordinate of point J
- *   ir_xy2 <-- square of influence radius with respect to x and y
- *   ir_z2  <-- square of influence radius with respect to z
+ *   xi  <-- normalized coordinates of point I
+ *   xj  <-- normalized coordinates of point J
  *----------------------------------------------------------------------------*/
 
 inline static cs_real_t
-_b_matrix(cs_real_t  xi,
-          cs_real_t  yi,
-          cs_real_t  zi,
-          cs_real_t  xj,
-          cs_real_t  yj,
-          cs_real_t  zj,
-          cs_real_t  ir_xy2,
-          cs_real_t  ir_z2)
+_b_dist(const cs_real_t  xi[3],
+        const cs_real_t  xj[3])
 {
-  cs_real_t dist = sqrt( ( cs_math_sq(xi - xj)
-                         + cs_math_sq(yi - yj) )/ir_xy2
-                       + cs_math_sq(zi - zj)/ir_z2);
+  return cs_math_3_distance(xi, xj);
+}
 
+/*----------------------------------------------------------------------------
+ * Compute coefficient bij of model covariance matrix (B) based on the
+ * normalized distance between points I and J.
+ *
+ * parameters:
+ *   dist <-- normalized distance between points I and J
+ *----------------------------------------------------------------------------*/
+
+inline static cs_real_t
+_b_matrix(cs_real_t  dist)
+{
   return (1. + dist) * exp(-dist);
 }
 
 /*----------------------------------------------------------------------------
- * Assemble full matrix HB(H)t+R.
+ * Normalize point coordinates by influence radii, so that the distance
+ * used by the model covariance is the euclidean distance.
+ *
+ * parameters:
+ *   oi  <-- pointer to an optimal interpolation
+ *   x   <-- coordinates
+ *   xn  --> normalized coordinates
+ *----------------------------------------------------------------------------*/
+
+inline static void
+_normalize_coords(const cs_at_opt_interp_t  *oi,
+                  const cs_real_t            x[3],
+                  cs_real_t                  xn[3])
+{
+  xn[0] = x[0] / oi->ir[0];
+  xn[1] = x[1] / oi->ir[0];
+  xn[2] = x[2] / oi->ir[1];
+}
+
+/*----------------------------------------------------------------------------
+ * Build a uniform grid over a set of points.
+ *
+ * The cell size is increased if needed so that the number of grid cells
+ * remains proportional to the number of points.
+ *
+ * parameters:
+ *   n_pts  <-- number of points
+ *   coords <-- point coordinates
+ *   h      <-- requested cell size
+ *   g      --> grid structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_point_grid_build(cs_lnum_t          n_pts,
+                  const cs_real_t    coords[][3],
+                  cs_real_t          h,
+                  _point_grid_t     *g)
+{
+  cs_real_t x_min[3] = {0., 0., 0.}, x_max[3] = {0., 0., 0.};
+
+  if (n_pts > 0) {
+    for (int k = 0; k < 3; k++) {
+      x_min[k] = coords[0][k];
+      x_max[k] = coords[0][k];
+    }
+  }
+  for (cs_lnum_t i = 1; i < n_pts; i++) {
+    for (int k = 0; k < 3; k++) {
+      x_min[k] = CS_MIN(x_min[k], coords[i][k]);
+      x_max[k] = CS_MAX(x_max[k], coords[i][k]);
+    }
+  }
+
+  const double n_cells_max = 8.*n_pts + 64.;
+
+  g->h = CS_MAX(h, 1.e-12*(1. + cs_math_3_distance(x_min, x_max)));
+
+  while (true) {
+    double n_cells = 1.;
+    for (int k = 0; k < 3; k++)
+      n_cells *= floor((x_max[k] - x_min[k]) / g->h) + 1.;
+    if (n_cells <= n_cells_max)
+      break;
+    g->h *= 2.;
+  }
+
+  for (int k = 0; k < 3; k++) {
+    g->origin[k] = x_min[k];
+    g->n[k] = (cs_lnum_t)floor((x_max[k] - x_min[k]) / g->h) + 1;
+  }
+
+  const cs_lnum_t n_cells = g->n[0]*g->n[1]*g->n[2];
+
+  BFT_MALLOC(g->cell_idx, n_cells + 1, cs_lnum_t);
+  BFT_MALLOC(g->pt_ids, n_pts, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_cells + 1; i++)
+    g->cell_idx[i] = 0;
+
+  cs_lnum_t *pt_cell = NULL;
+  BFT_MALLOC(pt_cell, n_pts, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_pts; i++) {
+    cs_lnum_t c[3];
+    for (int k = 0; k < 3; k++) {
+      c[k] = (cs_lnum_t)floor((coords[i][k] - g->origin[k]) / g->h);
+      c[k] = CS_MAX(0, CS_MIN(c[k], g->n[k] - 1));
+    }
+    pt_cell[i] = c[0] + g->n[0]*(c[1] + g->n[1]*c[2]);
+    g->cell_idx[pt_cell[i] + 1] += 1;
+  }
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    g->cell_idx[i+1] += g->cell_idx[i];
+
+  for (cs_lnum_t i = 0; i < n_pts; i++) {
+    cs_lnum_t c_id = pt_cell[i];
+    g->pt_ids[g->cell_idx[c_id]] = i;
+    g->cell_idx[c_id] += 1;
+  }
+
+  for (cs_lnum_t i = n_cells; i > 0; i--)
+    g->cell_idx[i] = g->cell_idx[i-1];
+  g->cell_idx[0] = 0;
+
+  BFT_FREE(pt_cell);
+}
+
+/*----------------------------------------------------------------------------
+ * Free arrays of a uniform point grid.
+ *
+ * parameters:
+ *   g  <-> grid structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_point_grid_free(_point_grid_t  *g)
+{
+  BFT_FREE(g->cell_idx);
+  BFT_FREE(g->pt_ids);
+}
+
+/*----------------------------------------------------------------------------
+ * Determine the range of grid cells intersecting a box centered on a point.
+ *
+ * parameters:
+ *   g   <-- grid structure
+ *   x   <-- point coordinates
+ *   r   <-- box half-width
+ *   lo  --> lowest cell coordinates in range
+ *   hi  --> highest cell coordinates in range
+ *
+ * returns:
+ *   true if the range is not empty, false otherwise
  *----------------------------------------------------------------------------*/
 
-static cs_real_t *
-_assembly_adding_obs_covariance(cs_measures_set_t  *ms,
-                                cs_at_opt_interp_t *oi,
-                                int                *ao_idx,
-                                int                 n_active_obs,
-                                int                 mc_id)
+static bool
+_point_grid_range(const _point_grid_t  *g,
+                  const cs_real_t       x[3],
+                  cs_real_t             r,
+                  cs_lnum_t             lo[3],
+                  cs_lnum_t             hi[3])
+{
+  for (int k = 0; k < 3; k++) {
+    double n = g->n[k];
+    double d_lo = floor((x[k] - r - g->origin[k]) / g->h);
+    double d_hi = floor((x[k] + r - g->origin[k]) / g->h);
+    if (d_hi < 0. || d_lo > n - 1.)
+      return false;
+    lo[k] = (cs_lnum_t)CS_MAX(d_lo, 0.);
+    hi[k] = (cs_lnum_t)CS_MIN(d_hi, n - 1.);
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Determine observations coupled to a given observation through the
+ * localized model covariance or the observation error covariance.
+ *
+ * The diagonal term is always included (first).
+ *
+ * parameters:
+ *   ms        <-- pointer to a measures set
+ *   oi        <-- pointer to an optimal interpolation
+ *   g         <-- grid over observation centers
+ *   obs_cen   <-- normalized observation neighborhood centers
+ *   obs_rad   <-- normalized observation neighborhood radii
+ *                 (< 0 for observations with empty neighborhood)
+ *   rad_max   <-- maximum observation neighborhood radius
+ *   obs_id    <-- observation id
+ *   ids       --> ids of coupled observations, or NULL
+ *
+ * returns:
+ *   number of coupled observations
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_obs_neighbors(const cs_measures_set_t   *ms,
+               const cs_at_opt_interp_t  *oi,
+               const _point_grid_t       *g,
+               const cs_real_t            obs_cen[][3],
+               const cs_real_t            obs_rad[],
+               cs_real_t                  rad_max,
+               cs_lnum_t                  obs_id,
+               cs_lnum_t                  ids[])
+{
+  const cs_lnum_t n_obs = ms->nb_measures;
+  const int dim = ms->dim;
+
+  cs_lnum_t n = 1;
+  if (ids != NULL)
+    ids[0] = obs_id;
+
+  /* full observation covariance: all pairs must be checked */
+
+  if (!oi->obs_cov_is_diag) {
+    for (cs_lnum_t jj = 0; jj < n_obs; jj++) {
+      if (jj == obs_id)
+        continue;
+      bool coupled = false;
+      if (obs_rad[obs_id] >= 0 && obs_rad[jj] >= 0) {
+        cs_real_t d = _b_dist(obs_cen[obs_id], obs_cen[jj]);
+        coupled = (d <= oi->cutoff + obs_rad[obs_id] + obs_rad[jj]);
+      }
+      for (int pp = 0; pp < dim && !coupled; pp++)
+        coupled = (CS_ABS(oi->obs_cov[dim*(obs_id*n_obs + jj) + pp]) > 0.);
+      if (coupled) {
+        if (ids != NULL)
+          ids[n] = jj;
+        n++;
+      }
+    }
+    return n;
+  }
+
+  if (obs_rad[obs_id] < 0)
+    return n;
+
+  /* diagonal observation covariance: use grid */
+
+  cs_lnum_t lo[3], hi[3];
+  const cs_real_t r = oi->cutoff + obs_rad[obs_id] + rad_max;
+
+  if (!_point_grid_range(g, obs_cen[obs_id], r, lo, hi))
+    return n;
+
+  for (cs_lnum_t c2 = lo[2]; c2 <= hi[2]; c2++) {
+    for (cs_lnum_t c1 = lo[1]; c1 <= hi[1]; c1++) {
+      for (cs_lnum_t c0 = lo[0]; c0 <= hi[0]; c0++) {
+        cs_lnum_t c_id = c0 + g->n[0]*(c1 + g->n[1]*c2);
+        for (cs_lnum_t kk = g->cell_idx[c_id]; kk < g->cell_idx[c_id+1]; kk++) {
+          cs_lnum_t jj = g->pt_ids[kk];
+          if (jj == obs_id || obs_rad[jj] < 0)
+            continue;
+          cs_real_t d = _b_dist(obs_cen[obs_id], obs_cen[jj]);
+          if (d <= oi->cutoff + obs_rad[obs_id] + obs_rad[jj]) {
+            if (ids != NULL)
+              ids[n] = jj;
+            n++;
+          }
+        }
+      }
+    }
+  }
+
+  return n;
+}
+
+/*----------------------------------------------------------------------------
+ * Assemble sparse matrix HB(H)t+R restricted to active observations.
+ *
+ * The matrix is stored in CSR form, with rows and columns numbered by
+ * active observation.
+ *
+ * parameters:
+ *   ms           <-- pointer to a measures set
+ *   oi           <-- pointer to an optimal interpolation
+ *   ao_idx       <-- index of active observations
+ *   n_active_obs <-- number of active observations
+ *   mc_id        <-- measures component id
+ *   a_idx        --> matrix row index (size: n_active_obs + 1)
+ *   a_ids        --> matrix column ids
+ *   a_val        --> matrix coefficients
+ *----------------------------------------------------------------------------*/
+
+static void
+_assembly_adding_obs_covariance(cs_measures_set_t   *ms,
+                                cs_at_opt_interp_t  *oi,
+                                int                 *ao_idx,
+                                int                  n_active_obs,
+                                int                  mc_id,
+                                cs_lnum_t          **a_idx,
+                                cs_lnum_t          **a_ids,
+                                cs_real_t          **a_val)
 {
   cs_lnum_t n_obs = ms->nb_measures;
-  cs_real_t *obs_cov = oi->obs_cov;
-  cs_real_t *b_proj = oi->b_proj;
-  cs_real_t *a, r;
+  const cs_real_t *obs_cov = oi->obs_cov;
+  const cs_real_t *b_proj = oi->b_proj;
+  const cs_lnum_t *b_idx = oi->b_proj_idx;
+  const cs_lnum_t *b_ids = oi->b_proj_ids;
 
   int m_dim = ms->dim;
-  int a_l_size = n_active_obs;
-  int a_size = cs_math_sq(a_l_size);
-  BFT_MALLOC(a, a_size, cs_real_t);
 
-  /* filling in the full matrix */
+  /* observation id to active observation id */
+
+  int *obs_to_ao = NULL;
+  BFT_MALLOC(obs_to_ao, n_obs, int);
+  for (cs_lnum_t ii = 0; ii < n_obs; ii++)
+    obs_to_ao[ii] = -1;
+  for (int ii = 0; ii < n_active_obs; ii++)
+    obs_to_ao[ao_idx[ii]] = ii;
 
-  for (cs_lnum_t ii = 0; ii < a_size; ii++)
-    a[ii] = 0.;
+  cs_lnum_t *_a_idx = NULL, *_a_ids = NULL;
+  cs_real_t *_a_val = NULL;
 
-  for (cs_lnum_t ii = 0; ii < n_active_obs; ii++) {
-    for (cs_lnum_t jj = 0; jj < n_active_obs; jj++) {
+  BFT_MALLOC(_a_idx, n_active_obs + 1, cs_lnum_t);
+  _a_idx[0] = 0;
 
-      int id = ii*a_l_size + jj;
-      a[id] = b_proj[m_dim*(ao_idx[ii] * n_obs + ao_idx[jj])+mc_id];
+  for (int ii = 0; ii < n_active_obs; ii++) {
+    cs_lnum_t obs_id = ao_idx[ii];
+    cs_lnum_t n = 0;
+    for (cs_lnum_t kk = b_idx[obs_id]; kk < b_idx[obs_id+1]; kk++)
+      if (obs_to_ao[b_ids[kk]] > -1)
+        n++;
+    _a_idx[ii+1] = _a_idx[ii] + n;
+  }
+
+  BFT_MALLOC(_a_ids, _a_idx[n_active_obs], cs_lnum_t);
+  BFT_MALLOC(_a_val, _a_idx[n_active_obs], cs_real_t);
+
+  /* filling in the sparse matrix */
+
+# pragma omp parallel for if(n_active_obs > CS_THR_MIN)
+  for (int ii = 0; ii < n_active_obs; ii++) {
+    cs_lnum_t obs_id = ao_idx[ii];
+    cs_lnum_t id = _a_idx[ii];
+
+    for (cs_lnum_t kk = b_idx[obs_id]; kk < b_idx[obs_id+1]; kk++) {
+      cs_lnum_t obs_jd = b_ids[kk];
+      int jj = obs_to_ao[obs_jd];
+      if (jj < 0)
+        continue;
+
+      _a_ids[id] = jj;
+      _a_val[id] = b_proj[m_dim*kk + mc_id];
 
       /* time weighting of variances */
       if (ii == jj) {
-        if (!oi->obs_cov_is_diag) {
-          r = obs_cov[m_dim*(ao_idx[ii] * n_obs + ao_idx[jj])+mc_id];
-        } else if (oi->obs_cov_is_diag) {
-          r = obs_cov[m_dim*ao_idx[ii]+mc_id];
-        }
+        cs_real_t r;
+        if (!oi->obs_cov_is_diag)
+          r = obs_cov[m_dim*(obs_id * n_obs + obs_id) + mc_id];
+        else
+          r = obs_cov[m_dim*obs_id + mc_id];
 
         if (oi->steady <= 0) {
-          a[id] += (r + 1.) / oi->time_weights[m_dim*ao_idx[ii]+mc_id] - 1.;
+          _a_val[id] += (r + 1.) / oi->time_weights[m_dim*obs_id + mc_id] - 1.;
         } else {
-          a[id] += r;
+          _a_val[id] += r;
         }
 
       } else if (!oi->obs_cov_is_diag) {
-        a[id] += obs_cov[m_dim*(ao_idx[ii] * n_obs + ao_idx[jj])+mc_id];
+        _a_val[id] += obs_cov[m_dim*(obs_id * n_obs + obs_jd) + mc_id];
       }
+
+      id++;
     }
   }
 
-  return a;
+  BFT_FREE(obs_to_ao);
+
+  *a_idx = _a_idx;
+  *a_ids = _a_ids;
+  *a_val = _a_val;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute y = A.x for a sparse matrix in CSR form.
+ *
+ * parameters:
+ *   n      <-- number of rows
+ *   a_idx  <-- matrix row index
+ *   a_ids  <-- matrix column ids
+ *   a_val  <-- matrix coefficients
+ *   x      <-- input vector
+ *   y      --> output vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_csr_mat_vec(cs_lnum_t        n,
+             const cs_lnum_t  a_idx[],
+             const cs_lnum_t  a_ids[],
+             const cs_real_t  a_val[],
+             const cs_real_t  x[],
+             cs_real_t        y[])
+{
+# pragma omp parallel for if(n > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n; ii++) {
+    cs_real_t s = 0.;
+    for (cs_lnum_t kk = a_idx[ii]; kk < a_idx[ii+1]; kk++)
+      s += a_val[kk] * x[a_ids[kk]];
+    y[ii] = s;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Solve A.x = b with a Jacobi-preconditioned conjugate gradient, for a
+ * symmetric positive definite sparse matrix in CSR form.
+ *
+ * Dot products are computed serially, so that the result is identical
+ * on all ranks (the system is replicated).
+ *
+ * parameters:
+ *   n      <-- number of rows
+ *   a_idx  <-- matrix row index
+ *   a_ids  <-- matrix column ids
+ *   a_val  <-- matrix coefficients
+ *   b      <-- right-hand side
+ *   x      --> solution
+ *
+ * returns:
+ *   number of iterations, or -1 in case of non-convergence
+ *----------------------------------------------------------------------------*/
+
+static int
+_solve_pcg(cs_lnum_t        n,
+           const cs_lnum_t  a_idx[],
+           const cs_lnum_t  a_ids[],
+           const cs_real_t  a_val[],
+           const cs_real_t  b[],
+           cs_real_t        x[])
+{
+  const double epsilon = 1.e-12;
+  const int n_max_iter = CS_MAX(10*n, 100);
+
+  cs_real_t *_work = NULL;
+  BFT_MALLOC(_work, 5*n, cs_real_t);
+  cs_real_t *r = _work, *z = _work + n, *p = _work + 2*n;
+  cs_real_t *ap = _work + 3*n, *d_inv = _work + 4*n;
+
+  double b_norm2 = 0.;
+  for (cs_lnum_t ii = 0; ii < n; ii++) {
+    x[ii] = 0.;
+    r[ii] = b[ii];
+    d_inv[ii] = 1.;
+    for (cs_lnum_t kk = a_idx[ii]; kk < a_idx[ii+1]; kk++) {
+      if (a_ids[kk] == ii && a_val[kk] > 0.)
+        d_inv[ii] = 1. / a_val[kk];
+    }
+    b_norm2 += b[ii]*b[ii];
+  }
+
+  int n_iter = 0;
+  double rz = 0.;
+  for (cs_lnum_t ii = 0; ii < n; ii++) {
+    z[ii] = d_inv[ii]*r[ii];
+    p[ii] = z[ii];
+    rz += r[ii]*z[ii];
+  }
+
+  double r_norm2 = b_norm2;
+  const double tol2 = epsilon*epsilon*b_norm2;
+
+  while (r_norm2 > tol2 && n_iter < n_max_iter) {
+
+    _csr_mat_vec(n, a_idx, a_ids, a_val, p, ap);
+
+    double pap = 0.;
+    for (cs_lnum_t ii = 0; ii < n; ii++)
+      pap += p[ii]*ap[ii];
+
+    if (pap <= 0.)
+      break;
+
+    double alpha = rz / pap;
+    r_norm2 = 0.;
+    for (cs_lnum_t ii = 0; ii < n; ii++) {
+      x[ii] += alpha*p[ii];
+      r[ii] -= alpha*ap[ii];
+      r_norm2 += r[ii]*r[ii];
+    }
+
+    double rz_prev = rz;
+    rz = 0.;
+    for (cs_lnum_t ii = 0; ii < n; ii++) {
+      z[ii] = d_inv[ii]*r[ii];
+      rz += r[ii]*z[ii];
+    }
+
+    double beta = rz / rz_prev;
+    for (cs_lnum_t ii = 0; ii < n; ii++)
+      p[ii] = z[ii] + beta*p[ii];
+
+    n_iter++;
+  }
+
+  BFT_FREE(_work);
+
+  return (r_norm2 > tol2) ? -1 : n_iter;
 }
 
 /*============================================================================
@@ -582,6 +1022,8 @@ cs_at_opt_interp_create(const char   *name)
   oi->ig_id = -1;
 
   if (!reall) {
+    oi->b_proj_idx = NULL;
+    oi->b_proj_ids = NULL;
     oi->b_proj = NULL;
     oi->relax = NULL;
     oi->times = NULL;
@@ -596,6 +1038,8 @@ cs_at_opt_interp_create(const char   *name)
     oi->time_window = NULL;
   }
   else {
+    BFT_FREE(oi->b_proj_idx);
+    BFT_FREE(oi->b_proj_ids);
     BFT_FREE(oi->b_proj);
     BFT_FREE(oi->relax);
     BFT_FREE(oi->times);
@@ -676,6 +1120,8 @@ cs_at_opt_interps_destroy(void)
 {
   for (int i = 0; i < _n_opt_interps; i++) {
     cs_at_opt_interp_t  *oi = _opt_interps + i;
+    BFT_FREE(oi->b_proj_idx);
+    BFT_FREE(oi->b_proj_ids);
     BFT_FREE(oi->b_proj);
     BFT_FREE(oi->relax);
     BFT_FREE(oi->obs_cov);
@@ -730,6 +1176,7 @@ cs_at_opt_interp_read_file(char const           filename[50],
   oi->nb_times = 0;
   oi->ir[0] = 100.;
   oi->ir[1] = 100.;
+  oi->cutoff = 20.;
   oi->n_log_data = 10;
   oi->interp_type = CS_AT_OPT_INTERP_P0;
   oi->steady = -1;
@@ -895,6 +1342,25 @@ cs_at_opt_interp_read_file(char const           filename[50],
       }
     }
 
+    /* Reading covariance localization cut-off */
+    if (strncmp(line, "_cutoff_", 8) == 0) {
+      if (fscanf(fichier, "%lf", &(oi->cutoff)) != 1)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("File %s: error reading the covariance localization"
+                    " cut-off (_cutoff_)."), filename);
+
+#if _OI_DEBUG_
+      bft_printf("   * Reading _cutoff_ : %.2f\n", oi->cutoff);
+#endif
+
+      if (oi->cutoff <= 0.) {
+        bft_printf(" File %s. The covariance localization cut-off (_cutoff_,"
+                   " relative to influence radii) must be strictly positive"
+                   " - exit\n", filename);
+        cs_exit(EXIT_FAILURE);
+      }
+    }
+
     /* Reading relaxation time */
     if (strncmp(line, "_t_", 3) == 0) {
       cs_real_t *tau = NULL;
@@ -1366,6 +1832,12 @@ cs_at_opt_interp_obs_operator(cs_measures_set_t  *ms,
 /*!
  * \brief Compute $\tens{H}\tens{B}\transpose{\tens{H}}$.
  *
+ * The model covariance is localized: correlations between points whose
+ * distance (normalized by the influence radii) is larger than the
+ * cut-off are ignored, so that only pairs of observations with nearby
+ * neighborhoods (or coupled through the observation covariance) are
+ * stored, in CSR form.
+ *
  * \param[in]  ms  pointer to measures set
  * \param[in]  oi  pointer to an optimal interpolation
  */
@@ -1375,43 +1847,122 @@ void
 cs_at_opt_interp_project_model_covariance(cs_measures_set_t  *ms,
                                           cs_at_opt_interp_t *oi)
 {
-  int n_obs = ms->nb_measures;
-  cs_real_t *proj = oi->model_to_obs_proj;
-  cs_lnum_t *proj_idx = oi->model_to_obs_proj_idx;
+  const cs_lnum_t n_obs = ms->nb_measures;
+  const cs_real_t *proj = oi->model_to_obs_proj;
+  const cs_lnum_t *proj_idx = oi->model_to_obs_proj_idx;
 
   const int dim = ms->dim;
   const int stride = dim + 3; /* dimension of field + dimension of space */
 
-  BFT_MALLOC(oi->b_proj, n_obs*n_obs*dim, cs_real_t);
+  const cs_lnum_t n_pts = proj_idx[n_obs];
+
+  /* normalized coordinates of neighborhood points */
+
+  cs_real_3_t *pt_coo = NULL;
+  BFT_MALLOC(pt_coo, n_pts, cs_real_3_t);
+
+  for (cs_lnum_t kk = 0; kk < n_pts; kk++)
+    _normalize_coords(oi, proj + kk*stride + dim, pt_coo[kk]);
+
+  /* center (first point) and radius of each observation's neighborhood */
+
+  cs_real_3_t *obs_cen = NULL;
+  cs_real_t *obs_rad = NULL;
+  BFT_MALLOC(obs_cen, n_obs, cs_real_3_t);
+  BFT_MALLOC(obs_rad, n_obs, cs_real_t);
+
+  cs_real_t rad_max = 0.;
+
+  for (cs_lnum_t ii = 0; ii < n_obs; ii++) {
+    obs_rad[ii] = -1.;
+    for (int k = 0; k < 3; k++)
+      obs_cen[ii][k] = 0.;
+    if (proj_idx[ii] < proj_idx[ii+1]) {
+      for (int k = 0; k < 3; k++)
+        obs_cen[ii][k] = pt_coo[proj_idx[ii]][k];
+      obs_rad[ii] = 0.;
+      for (cs_lnum_t kk = proj_idx[ii] + 1; kk < proj_idx[ii+1]; kk++)
+        obs_rad[ii] = CS_MAX(obs_rad[ii],
+                             _b_dist(obs_cen[ii], pt_coo[kk]));
+      rad_max = CS_MAX(rad_max, obs_rad[ii]);
+    }
+  }
+
+  _point_grid_t g;
+  _point_grid_build(n_obs,
+                    (const cs_real_3_t *)obs_cen,
+                    oi->cutoff + 2.*rad_max,
+                    &g);
+
+  /* build observation pairs index */
+
+  BFT_MALLOC(oi->b_proj_idx, n_obs + 1, cs_lnum_t);
+  cs_lnum_t *b_idx = oi->b_proj_idx;
+
+  b_idx[0] = 0;
+
+# pragma omp parallel for if(n_obs > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_obs; ii++)
+    b_idx[ii+1] = _obs_neighbors(ms, oi, &g,
+                                 (const cs_real_3_t *)obs_cen, obs_rad,
+                                 rad_max, ii, NULL);
+
+  for (cs_lnum_t ii = 0; ii < n_obs; ii++)
+    b_idx[ii+1] += b_idx[ii];
+
+  BFT_MALLOC(oi->b_proj_ids, b_idx[n_obs], cs_lnum_t);
+  cs_lnum_t *b_ids = oi->b_proj_ids;
+
+# pragma omp parallel for if(n_obs > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_obs; ii++)
+    _obs_neighbors(ms, oi, &g,
+                   (const cs_real_3_t *)obs_cen, obs_rad,
+                   rad_max, ii, b_ids + b_idx[ii]);
+
+  cs_sort_indexed(n_obs, b_idx, b_ids);
+
+  _point_grid_free(&g);
+  BFT_FREE(obs_cen);
+  BFT_FREE(obs_rad);
+
+  /* compute coefficients */
+
+  BFT_MALLOC(oi->b_proj, b_idx[n_obs]*dim, cs_real_t);
   cs_real_t *b_proj = oi->b_proj;
 
-  const cs_real_t ir_xy2 = cs_math_sq(oi->ir[0]);
-  const cs_real_t ir_z2 = cs_math_sq(oi->ir[1]);
+  const cs_real_t cutoff = oi->cutoff;
 
+# pragma omp parallel for if(n_obs > CS_THR_MIN)
   for (cs_lnum_t ii = 0; ii < n_obs; ii++) {
-    for (cs_lnum_t jj = 0; jj < n_obs; jj++) {
+    for (cs_lnum_t b_id = b_idx[ii]; b_id < b_idx[ii+1]; b_id++) {
+      cs_lnum_t jj = b_ids[b_id];
+
       for (int pp = 0; pp < dim; pp++)
-        b_proj[dim*(ii*n_obs + jj) + pp] = 0;
+        b_proj[dim*b_id + pp] = 0;
 
       for (cs_lnum_t kk = proj_idx[ii]; kk < proj_idx[ii+1]; kk++) {
-        cs_real_t x1 = (proj + kk*stride)[dim  ];
-        cs_real_t y1 = (proj + kk*stride)[dim+1];
-        cs_real_t z1 = (proj + kk*stride)[dim+2];
-
         for (cs_lnum_t ll = proj_idx[jj]; ll < proj_idx[jj+1]; ll++) {
-          cs_real_t x2 = (proj + ll*stride)[dim  ];
-          cs_real_t y2 = (proj + ll*stride)[dim+1];
-          cs_real_t z2 = (proj + ll*stride)[dim+2];
 
-          cs_real_t influ = _b_matrix(x1, y1, z1, x2, y2, z2, ir_xy2, ir_z2);
+          cs_real_t dist = _b_dist(pt_coo[kk], pt_coo[ll]);
+          if (dist > cutoff)
+            continue;
+
+          cs_real_t influ = _b_matrix(dist);
 
           for (int pp = 0; pp < dim; pp++)
-            b_proj[dim*(ii*n_obs + jj) + pp] += (proj + kk*stride)[pp] * (proj + ll*stride)[pp]
-                                              * influ;
+            b_proj[dim*b_id + pp] +=   (proj + kk*stride)[pp]
+                                     * (proj + ll*stride)[pp] * influ;
         }
       }
     }
   }
+
+  BFT_FREE(pt_coo);
+
+#if _OI_DEBUG_
+  bft_printf("   * Localized HBHT: %ld of %ld observation pairs\n",
+             (long)b_idx[n_obs], (long)n_obs*(long)n_obs);
+#endif
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1584,13 +2135,19 @@ cs_at_opt_interp_get_active_obs(cs_measures_set_t   *ms,
 /*!
  * \brief Compute analysis for a given variable.
  *
+ * The (HB(H)t + R) system is assembled in sparse form and solved using
+ * a preconditioned conjugate gradient; the analysis increment at each
+ * cell only accounts for observations within the localization cut-off.
+ *
  * \param[in]  f            field variable of which analysis will be computed
  * \param[in]  oi           optimal interpolation for field variable
  * \param[in]  f_oia        analysis field of field variable
  * \param[in]  n_active_obs number of active observations.
  * \param[in]  ao_idx       index of active observations
  * \param[in]  inverse      boolean, true if it necessary to recompute the
- *                          inverse of HB(H)
+ *                          inverse of HB(H) (unused, as the sparse
+ *                          system is always reassembled)
+ * \param[in]  mc_id        measures component id
  */
 /*----------------------------------------------------------------------------*/
 
@@ -1619,6 +2176,8 @@ cs_at_opt_interp_compute_analysis(cs_field_t         *f,
 
   cs_interpol_grid_t *ig = cs_interpol_grid_by_id(oi->ig_id);
 
+  CS_UNUSED(inverse);
+
 #if _OI_DEBUG_
   bft_printf("   * %i active observations\n    ", n_active_obs);
   for (int ii = 0; ii < n_active_obs; ii++)
@@ -1639,7 +2198,6 @@ cs_at_opt_interp_compute_analysis(cs_field_t         *f,
   const int stride = m_dim + 3; /* dimension of field + dimension of space */
 
   int a_l_size = n_active_obs;
-  int a_size = cs_math_sq(a_l_size);
 
   cs_real_t *inc = NULL;
   BFT_MALLOC(inc, a_l_size, cs_real_t);
@@ -1680,69 +2238,109 @@ cs_at_opt_interp_compute_analysis(cs_field_t         *f,
   bft_printf("\n");
 #endif
 
-  cs_real_t *alu = NULL;
-  if (inverse) {
-    cs_real_t *a = _assembly_adding_obs_covariance(ms,
-                                                   oi,
-                                                   ao_idx,
-                                                   n_active_obs,
-                                                   mc_id);
-    BFT_MALLOC(alu, a_size, cs_real_t);
+  /* sparse system (HB(H)t + R) restricted to active observations;
+     it is reassembled at each call, since this is inexpensive */
 
-    cs_math_fact_lu(1, a_l_size, a, alu);
-    BFT_FREE(a);
+  cs_lnum_t *a_idx = NULL, *a_ids = NULL;
+  cs_real_t *a_val = NULL;
 
-#if _OI_DEBUG_
-    bft_printf("\n   * LU Matrix\n");
-    for (int ii = 0; ii < n_active_obs; ii++) {
-      bft_printf("    ");
-      for (int jj = 0; jj < n_active_obs; jj++) {
-        int id = ii*a_l_size + jj;
-        bft_printf("%.8f ", alu[id]);
-      }
-      bft_printf("\n");
-    }
-#endif
-  }
+  _assembly_adding_obs_covariance(ms,
+                                  oi,
+                                  ao_idx,
+                                  n_active_obs,
+                                  mc_id,
+                                  &a_idx,
+                                  &a_ids,
+                                  &a_val);
 
 #if _OI_DEBUG_
+  bft_printf("\n   * Sparse matrix: %ld non-zero coefficients\n",
+             (long)a_idx[n_active_obs]);
   bft_printf("\n   * Computing (HBHT + R)^-1*I\n");
 #endif
 
   cs_real_t *vect = NULL;
   BFT_MALLOC(vect, a_l_size, cs_real_t);
 
-  /* Forward and backward */
+  /* Preconditioned conjugate gradient */
 
-  cs_math_fw_and_bw_lu(alu, a_l_size, vect, inc);
+  int n_iter = _solve_pcg(a_l_size, a_idx, a_ids, a_val, inc, vect);
 
-  BFT_FREE(alu);
+  if (n_iter < 0)
+    bft_printf(_("\n Warning: optimal interpolation \"%s\":\n"
+                 "   solution of (HBHT + R) system for component %d"
+                 " did not converge.\n"), oi->name, mc_id);
+
+  BFT_FREE(a_idx);
+  BFT_FREE(a_ids);
+  BFT_FREE(a_val);
   BFT_FREE(inc);
 
-  const cs_real_t ir_xy2 = cs_math_sq(oi->ir[0]);
-  const cs_real_t ir_z2 = cs_math_sq(oi->ir[1]);
+  /* weighted neighborhood points of active observations */
+
+  cs_lnum_t n_pts = 0;
+  for (int ll = 0; ll < n_active_obs; ll++)
+    n_pts += proj_idx[ao_idx[ll]+1] - proj_idx[ao_idx[ll]];
+
+  cs_real_3_t *pt_coo = NULL;
+  cs_real_t *pt_w = NULL;
+  BFT_MALLOC(pt_coo, n_pts, cs_real_3_t);
+  BFT_MALLOC(pt_w, n_pts, cs_real_t);
+
+  n_pts = 0;
+  for (int ll = 0; ll < n_active_obs; ll++) {
+    for (cs_lnum_t mm = proj_idx[ao_idx[ll]];
+         mm < proj_idx[ao_idx[ll]+1];
+         mm++) {
+      _normalize_coords(oi, proj + mm*stride + m_dim, pt_coo[n_pts]);
+      pt_w[n_pts] = (proj + mm*stride)[mc_id] * vect[ll];
+      n_pts++;
+    }
+  }
+
+  BFT_FREE(vect);
+
+  const cs_real_t cutoff = oi->cutoff;
+
+  _point_grid_t g;
+  _point_grid_build(n_pts, (const cs_real_3_t *)pt_coo, cutoff, &g);
 
+  /* analysis increment, using only points within cut-off distance */
+
+  const int c_id = ms->comp_ids[mc_id];
+
+# pragma omp parallel for if(mesh->n_cells > CS_THR_MIN)
   for (cs_lnum_t ii = 0; ii < mesh->n_cells; ii++) {
-    f_oia->val[ii*f_dim+ms->comp_ids[mc_id]] =
-      f->val_pre[ii*f_dim+ms->comp_ids[mc_id]];
-
-    for (int ll = 0; ll < n_active_obs; ll++) {
-      for (int mm = proj_idx[ao_idx[ll]];
-           mm < proj_idx[ao_idx[ll]+1];
-           mm++) {
-        cs_real_t x = (proj + mm*stride)[m_dim  ];
-        cs_real_t y = (proj + mm*stride)[m_dim+1];
-        cs_real_t z = (proj + mm*stride)[m_dim+2];
-        f_oia->val[ii*f_dim+ms->comp_ids[mc_id]] +=  (proj + mm*stride)[mc_id] * vect[ll]
-                                                   * _b_matrix(cell_cen[ii][0],
-                                                               cell_cen[ii][1],
-                                                               cell_cen[ii][2],
-                                                               x, y, z, ir_xy2, ir_z2);
+    cs_real_t val = f->val_pre[ii*f_dim+c_id];
+
+    cs_real_t x[3];
+    cs_lnum_t lo[3], hi[3];
+    _normalize_coords(oi, cell_cen[ii], x);
+
+    if (_point_grid_range(&g, x, cutoff, lo, hi)) {
+      for (cs_lnum_t c2 = lo[2]; c2 <= hi[2]; c2++) {
+        for (cs_lnum_t c1 = lo[1]; c1 <= hi[1]; c1++) {
+          for (cs_lnum_t c0 = lo[0]; c0 <= hi[0]; c0++) {
+            cs_lnum_t g_id = c0 + g.n[0]*(c1 + g.n[1]*c2);
+            for (cs_lnum_t kk = g.cell_idx[g_id];
+                 kk < g.cell_idx[g_id+1];
+                 kk++) {
+              cs_lnum_t pt_id = g.pt_ids[kk];
+              cs_real_t dist = _b_dist(x, pt_coo[pt_id]);
+              if (dist <= cutoff)
+                val += pt_w[pt_id] * _b_matrix(dist);
+            }
+          }
+        }
       }
     }
+
+    f_oia->val[ii*f_dim+c_id] = val;
   }
 
-  BFT_FREE(vect);
+  _point_grid_free(&g);
+  BFT_FREE(pt_coo);
+  BFT_FREE(pt_w);
 }
 
 /*----------------------------------------------------------------------------*/
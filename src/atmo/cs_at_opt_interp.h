@@ -70,8 +70,15 @@ typedef struct _cs_at_opt_interp_t {
   cs_real_t               *model_to_obs_proj;
   cs_lnum_t               *model_to_obs_proj_idx;
   cs_lnum_t               *model_to_obs_proj_c_ids;
-  cs_real_t               *b_proj;
+  cs_lnum_t               *b_proj_idx;          /* HB(H)t row index
+                                                   (size: n_obs + 1) */
+  cs_lnum_t               *b_proj_ids;          /* HB(H)t column (obs.) ids */
+  cs_real_t               *b_proj;              /* HB(H)t values, interleaved
+                                                   by measure component */
   cs_real_t                ir[2];
+  cs_real_t                cutoff;              /* covariance localization
+                                                   cut-off, relative to
+                                                   influence radii */
   cs_real_t               *relax;
   int                      nb_times;
   int                     *measures_idx;
@@ -213,6 +220,12 @@ cs_at_opt_interp_obs_operator(cs_measures_set_t  *ms,
 /*!
  * \brief Compute $\tens{H}\tens{B}\transpose{\tens{H}}$.
  *
+ * The model covariance is localized: correlations between points whose
+ * distance (normalized by the influence radii) is larger than the
+ * cut-off are ignored, so that only pairs of observations with nearby
+ * neighborhoods (or coupled through the observation covariance) are
+ * stored, in CSR form.
+ *
  * \param[in]  ms  pointer to measures set
  * \param[in]  oi  pointer to an optimal interpolation
  */
@@ -249,13 +262,19 @@ cs_at_opt_interp_get_active_obs(cs_measures_set_t  *ms,
 /*!
  * \brief Compute analysis for a given variable.
  *
+ * The (HB(H)t + R) system is assembled in sparse form and solved using
+ * a preconditioned conjugate gradient; the analysis increment at each
+ * cell only accounts for observations within the localization cut-off.
+ *
  * \param[in]  f            field variable of which analysis will be computed
  * \param[in]  oi           optimal interpolation for field variable
  * \param[in]  f_oia        analysis field of field variable
  * \param[in]  n_active_obs number of active observations.
  * \param[in]  ao_idx       index of active observations
  * \param[in]  inverse      boolean, true if it necessary to recompute the
- *                          inverse of HB(H)
+ *                          inverse of HB(H) (unused, as the sparse
+ *                          system is always reassembled)
+ * \param[in]  mc_id        measures component id
  */
 /*----------------------------------------------------------------------------*/
 
@@ -37,10 +37,12 @@
 !> \param[in]     dlstep        time step
 !> \param[in]     dlrki         kinetic rates for first iteration
 !> \param[in]     dlrkf         kinetic rates for second iteration
+!> \param[out]    dlerr         scaled estimate of the local error
+!>                              (0 if rtolchem <= 0)
 !______________________________________________________________________________
 
 subroutine roschem (dlconc,zcsourc,zcsourcf,conv_factor,                      &
-                    dlstep,dlrki,dlrkf)
+                    dlstep,dlrki,dlrkf,dlerr)
 
 !===============================================================================
 ! Module files
@@ -58,6 +60,7 @@ double precision zcsourc(nespg),zcsourcf(nespg)
 double precision conv_factor(nespg)
 double precision dlstep
 double precision dlrki(nrg),dlrkf(nrg)
+double precision dlerr
 
 
 ! Local variables
@@ -170,5 +173,91 @@ do ji = 1, nespg
   endif
 enddo
 
+!------------------------------------------------------------------------
+!*    7. Local error estimate, based on the difference with the
+!*       embedded first order solution DLconc + DLstep * K1
+
+dlerr = 0.d0
+
+if (rtolchem.gt.0.d0) then
+  do ji = 1, nespg
+    dlerr = max(dlerr, 0.5d0 * dlstep * abs(dlk1(ji) + dlk2(ji))      &
+                       / (atolchem + rtolchem * abs(dlconc(ji))))
+  enddo
+endif
+
 return
 end subroutine roschem
+
+!===============================================================================
+
+!> \brief Rosenbrock solver for atmospheric chemistry with adaptive
+!>        sub-steps, based on the local error estimate of roschem.
+!>
+!> Sub-steps are bounded by dtchemmax.
+
+!------------------------------------------------------------------------------
+! Arguments
+!------------------------------------------------------------------------------
+!   mode          name          role
+!------------------------------------------------------------------------------
+!> \param[in,out] dlconc        concentrations vector
+!> \param[in]     zcsourc       source term
+!> \param[in]     conv_factor   conversion factor
+!> \param[in]     dlstep        time step
+!> \param[in]     dlrk          kinetic rates
+!______________________________________________________________________________
+
+subroutine roschem_adaptive (dlconc,zcsourc,conv_factor,dlstep,dlrk)
+
+!===============================================================================
+! Module files
+!===============================================================================
+
+use atchem
+
+implicit none
+
+! Arguments
+
+double precision dlconc(nespg)
+double precision zcsourc(nespg)
+double precision conv_factor(nespg)
+double precision dlstep
+double precision dlrk(nrg)
+
+! Local variables
+
+double precision dlconcsav(nespg)
+double precision dlerr, dlsub, dlrest, dlsubmin, dlfac
+
+!------------------------------------------------------------------------
+
+dlrest = dlstep
+dlsub = min(dlstep, dtchemmax)
+dlsubmin = 1.d-6 * dlsub
+
+do while (dlrest .gt. 1.d-12*dlstep)
+
+  dlsub = min(dlsub, dlrest)
+
+  dlconcsav(:) = dlconc(:)
+
+  call roschem (dlconc,zcsourc,zcsourc,conv_factor,dlsub,dlrk,dlrk,dlerr)
+
+  dlfac = 0.9d0 / sqrt(max(dlerr, 1.d-10))
+
+  if (dlerr.le.1.d0 .or. dlsub.le.dlsubmin) then
+    ! Accept sub-step
+    dlrest = dlrest - dlsub
+    dlsub = min(dlsub * min(dlfac, 5.d0), dtchemmax)
+  else
+    ! Reject sub-step and restart with smaller sub-step
+    dlconc(:) = dlconcsav(:)
+    dlsub = max(dlsub * max(dlfac, 0.2d0), dlsubmin)
+  endif
+
+enddo
+
+return
+end subroutine roschem_adaptive
@@ -457,6 +457,19 @@ if (nfpt1t.gt.0) then
   call init_1d_wall_thermal_local_models
 endif
 
+! Runtime mesh adaptation does not resize Fortran work arrays
+! defined on selected cells or boundary faces; other incompatible
+! features are checked on the C side.
+if (cs_mesh_adapt_is_active()) then
+  if (     ncpdct.gt.0 .or. nctsmt.gt.0 .or. nftcdt.gt.0           &
+      .or. nfpt1t.gt.0 .or. icondv.eq.0 .or. ivrtex.eq.1           &
+      .or. iand(ivofmt,VOF_MERKLE_MASS_TRANSFER).ne.0) then
+    write(nfecra,1000)
+    call csexit(1)
+  endif
+  call cs_mesh_adapt_check_setup
+endif
+
 ! Map arrays from Lagrangian module
 if (iilagr.gt.0) then
   call init_lagr_arrays(tslagr)
@@ -978,6 +991,31 @@ if (iale.ge.1 .and. ntmabs.gt.ntpabs) then
 
 endif
 
+!===============================================================================
+! Runtime mesh adaptation
+!===============================================================================
+
+if (ntmabs.gt.ntpabs .and. itrale.gt.0) then
+
+  if (cs_mesh_adapt_update()) then
+
+    ! Resize boundary face arrays
+
+    deallocate(itrifb)
+    allocate(itrifb(nfabor))
+
+    call boundary_conditions_finalize
+    call boundary_conditions_init
+
+    ! Update field mappings
+
+    call fldtri
+    call field_get_val_s_by_name('dt', dt)
+
+  endif
+
+endif
+
 !===============================================================================
 ! Optional processing by user
 !===============================================================================
@@ -1277,6 +1315,16 @@ write(nfecra,7000)
 
 #if defined(_CS_LANG_FR)
 
+ 1000 format(                                                     &
+'@',/,                                                            &
+'@ @@ ATTENTION : ARRET A L''INITIALISATION',/,                   &
+'@    =========',/,                                               &
+'@    L''ADAPTATION DE MAILLAGE EN COURS DE CALCUL N''EST PAS',/, &
+'@    COMPATIBLE AVEC LES PERTES DE CHARGE, LES TERMES SOURCES',/,&
+'@    DE MASSE, LA CONDENSATION, LE MODULE THERMIQUE 1D EN',/,    &
+'@    PAROI, LA METHODE DES VORTEX NI LA CAVITATION.',/,          &
+'@',/)
+
  2000 format(/,/,                                                 &
 '===============================================================',&
                                                               /,/,&
@@ -1333,6 +1381,15 @@ write(nfecra,7000)
 
 #else
 
+ 1000 format(                                                     &
+'@',/,                                                            &
+'@ @@ WARNING: ABORT AT INITIALIZATION',/,                        &
+'@    ========',/,                                                &
+'@    RUNTIME MESH ADAPTATION IS NOT COMPATIBLE WITH HEAD',/,     &
+'@    LOSSES, MASS SOURCE TERMS, CONDENSATION, THE 1D WALL',/,    &
+'@    THERMAL MODULE, THE VORTEX METHOD OR CAVITATION.',/,        &
+'@',/)
+
  2000 format(/,/,                                                 &
 '===============================================================',&
                                                               /,/,&
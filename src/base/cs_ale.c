@@ -60,6 +60,7 @@
 #include "cs_math.h"
 #include "cs_mesh.h"
 #include "cs_mesh_quantities.h"
+#include "cs_mesh_box_index.h"
 #include "cs_mesh_bad_cells.h"
 #include "cs_parall.h"
 #include "cs_time_step.h"
@@ -1092,6 +1093,28 @@ _ale_solve_poisson_legacy(const cs_domain_t *domain,
   BFT_FREE(gradm);
 }
 
+/*----------------------------------------------------------------------------
+ * Compute cell and face centers of gravity, cell volumes
+ * and update bad cells.
+ *
+ * parameters:
+ *   vtx_moved <-- flag for vertices moved since the last update, or NULL
+ *                 to update all quantities
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_mesh_quantities(const bool  vtx_moved[])
+{
+  cs_mesh_t *m = cs_glob_mesh;
+  cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+
+  cs_gradient_free_quantities();
+  cs_cell_to_vertex_free();
+  cs_mesh_box_index_free();
+  cs_mesh_quantities_update_moved(m, vtx_moved, mq);
+  cs_mesh_bad_cells_detect(m, mq);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1114,13 +1137,9 @@ cs_ale_update_mesh_quantities(cs_real_t  *min_vol,
                               cs_real_t  *max_vol,
                               cs_real_t  *tot_vol)
 {
-  cs_mesh_t *m = cs_glob_mesh;
   cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
 
-  cs_gradient_free_quantities();
-  cs_cell_to_vertex_free();
-  cs_mesh_quantities_compute(m, mq);
-  cs_mesh_bad_cells_detect(m, mq);
+  _update_mesh_quantities(NULL);
 
   *min_vol = mq->min_vol;
   *max_vol = mq->max_vol;
@@ -1391,15 +1410,26 @@ cs_ale_update_mesh(const int           itrale,
   cs_real_3_t *disale = (cs_real_3_t *)(f_displ->val);
   cs_real_3_t *disala = (cs_real_3_t *)(f_displ->val_pre);
 
-  /* Update geometry */
+  /* Update geometry, keeping track of moved vertices so that only
+     the quantities of the moving part of the mesh are recomputed */
+
+  bool *vtx_moved;
+  BFT_MALLOC(vtx_moved, n_vertices, bool);
+
   for (int v_id = 0; v_id < n_vertices; v_id++) {
+    vtx_moved[v_id] = false;
     for (int idim = 0; idim < ndim; idim++) {
-      vtx_coord[v_id][idim] = xyzno0[v_id][idim] + disale[v_id][idim];
+      cs_real_t x = xyzno0[v_id][idim] + disale[v_id][idim];
+      if (fabs(x - vtx_coord[v_id][idim]) > 0.)
+        vtx_moved[v_id] = true;
+      vtx_coord[v_id][idim] = x;
       disala[v_id][idim] = vtx_coord[v_id][idim] - xyzno0[v_id][idim];
     }
   }
 
-  cs_ale_update_mesh_quantities(&(mq->min_vol), &(mq->max_vol), &(mq->tot_vol));
+  _update_mesh_quantities(vtx_moved);
+
+  BFT_FREE(vtx_moved);
 
   /* Abort at the end of the current time-step if there is a negative volume */
   if (mq->min_vol <= 0.)
@@ -63,6 +63,7 @@
 #include "cs_map.h"
 #include "cs_math.h"
 #include "cs_measures_util.h"
+#include "cs_mesh_adapt.h"
 #include "cs_notebook.h"
 #include "cs_numbering.h"
 #include "cs_order.h"
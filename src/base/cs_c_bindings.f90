@@ -249,6 +249,40 @@ module cs_c_bindings
 
     !---------------------------------------------------------------------------
 
+    ! Interface to C function indicating if runtime mesh adaptation is active.
+
+    function cs_mesh_adapt_is_active() result(active) &
+      bind(C, name='cs_mesh_adapt_is_active')
+      use, intrinsic :: iso_c_binding
+      implicit none
+      logical(kind=c_bool) :: active
+    end function cs_mesh_adapt_is_active
+
+    !---------------------------------------------------------------------------
+
+    ! Interface to C function checking that the setup is compatible with
+    ! runtime mesh adaptation.
+
+    subroutine cs_mesh_adapt_check_setup()  &
+      bind(C, name='cs_mesh_adapt_check_setup')
+      use, intrinsic :: iso_c_binding
+      implicit none
+    end subroutine cs_mesh_adapt_check_setup
+
+    !---------------------------------------------------------------------------
+
+    ! Interface to C function adapting the mesh if required at the
+    ! current time step.
+
+    function cs_mesh_adapt_update() result(modified) &
+      bind(C, name='cs_mesh_adapt_update')
+      use, intrinsic :: iso_c_binding
+      implicit none
+      logical(kind=c_bool) :: modified
+    end function cs_mesh_adapt_update
+
+    !---------------------------------------------------------------------------
+
     ! Interface to C function logging field and other array statistics
     ! at relevant time steps.
 
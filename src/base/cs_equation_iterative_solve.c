@@ -274,8 +274,10 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
 
   cs_real_t *dam, *xam, *smbini, *w1, *adxk, *adxkm1, *dpvarm1, *rhs0;
   cs_real_t *dam_conv, *xam_conv, *dam_diff, *xam_diff;
+  cs_matrix_t *a_mf = NULL;
 
   bool conv_diff_mg = false;
+  bool matrix_free = false;
 
   /*============================================================================
    * 0.  Initialization
@@ -323,7 +325,15 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
 
   bool symmetric = (isym == 1) ? true : false;
 
-  BFT_MALLOC(xam,isym*n_i_faces,cs_real_t);
+  /* Use a matrix-free operator when the solver only requires
+     matrix-vector products and the diagonal */
+
+  if (!conv_diff_mg && coupling_id < 0)
+    matrix_free = cs_sles_native_matrix_free_compatible(f_id, var_name);
+
+  xam = NULL;
+  if (!matrix_free)
+    BFT_MALLOC(xam,isym*n_i_faces,cs_real_t);
   if (conv_diff_mg) {
     BFT_MALLOC(xam_conv, 2*n_i_faces, cs_real_t);
     BFT_MALLOC(xam_diff,   n_i_faces, cs_real_t);
@@ -403,6 +413,23 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
                                        dam_diff,
                                        xam_diff);
   }
+  else if (matrix_free) {
+    cs_matrix_wrapper_scalar_diag(iconvp,
+                                  idiffp,
+                                  ndircp,
+                                  isym,
+                                  thetap,
+                                  imucpp,
+                                  coefbp,
+                                  cofbfp,
+                                  rovsdt,
+                                  i_massflux,
+                                  b_massflux,
+                                  i_viscm,
+                                  b_viscm,
+                                  xcpp,
+                                  dam);
+  }
   else {
     cs_matrix_wrapper_scalar(iconvp,
                              idiffp,
@@ -429,6 +456,21 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
       dam[iel] /= relaxp;
   }
 
+  /* Extra-diagonal terms are computed on the fly from face fluxes */
+  if (matrix_free) {
+    a_mf = cs_matrix_create_by_copy(cs_matrix_native(symmetric,
+                                                     db_size,
+                                                     eb_size));
+    cs_matrix_set_coefficients_conv_diff(a_mf,
+                                         thetap,
+                                         iconvp,
+                                         idiffp,
+                                         dam,
+                                         i_massflux,
+                                         i_viscm,
+                                         (imucpp > 0) ? xcpp : NULL);
+  }
+
   /*==========================================================================
    * 2. Iterative process to handle non orthogonalities (starting from the
    *    second iteration).
@@ -594,15 +636,18 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
   if (iinvpe == 2)
     rotation_mode = CS_HALO_ROTATION_IGNORE;
 
-  cs_matrix_vector_native_multiply(symmetric,
-                                   db_size,
-                                   eb_size,
-                                   rotation_mode,
-                                   f_id,
-                                   dam,
-                                   xam,
-                                   pvar,
-                                   w1);
+  if (a_mf != NULL)
+    cs_matrix_vector_multiply(rotation_mode, a_mf, pvar, w1);
+  else
+    cs_matrix_vector_native_multiply(symmetric,
+                                     db_size,
+                                     eb_size,
+                                     rotation_mode,
+                                     f_id,
+                                     dam,
+                                     xam,
+                                     pvar,
+                                     w1);
 
 # pragma omp parallel for
   for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
@@ -626,6 +671,10 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
   /* Warning: for Weight Matrix, one and only one sweep is done. */
   nswmod = CS_MAX(var_cal_opt->nswrsm, 1);
 
+  /* The matrix-free operator is freed by cs_sles_free_native */
+  if (a_mf != NULL)
+    cs_sles_setup_native_matrix_free(f_id, var_name, a_mf);
+
   /* Reconstruction loop (beginning) */
   if (iterns <= 1)
     sinfo.n_it = 0;
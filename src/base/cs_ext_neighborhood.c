@@ -1049,6 +1049,17 @@ _create_cell_cells_connect(cs_mesh_t  *mesh,
 
   BFT_MALLOC(cell_cells_lst, cell_cells_idx[n_cells], cs_lnum_t);
 
+  /* Initialize list using the same partition as loops on cells, so that
+     memory is first touched by the threads which will later use it */
+
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    for (cs_lnum_t j_id = cell_cells_idx[c_id];
+         j_id < cell_cells_idx[c_id+1];
+         j_id++)
+      cell_cells_lst[j_id] = -1;
+  }
+
   /* Fill list */
 
   for (i_cel = 0; i_cel < n_cells; i_cel++) {
@@ -48,8 +48,10 @@
 
 #include "cs_log.h"
 #include "cs_map.h"
-#include "cs_parall.h"
+#include "cs_mesh.h"
 #include "cs_mesh_location.h"
+#include "cs_numbering.h"
+#include "cs_parall.h"
 
 /*----------------------------------------------------------------------------
  * Header for the current file
@@ -519,36 +521,71 @@ _field_create(const char   *name,
   return f;
 }
 
+/*----------------------------------------------------------------------------
+ * Return the numbering used by computation loops on a mesh location.
+ *
+ * parameters:
+ *   location_id <-- associated mesh location id
+ *
+ * returns  pointer to associated numbering, or NULL
+ *----------------------------------------------------------------------------*/
+
+static const cs_numbering_t *
+_location_numbering(int  location_id)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  if (m == NULL || cs_mesh_location_get_elt_ids_try(location_id) != NULL)
+    return NULL;
+
+  switch (cs_mesh_location_get_type(location_id)) {
+  case CS_MESH_LOCATION_CELLS:
+    return m->cell_numbering;
+  case CS_MESH_LOCATION_INTERIOR_FACES:
+    return m->i_face_numbering;
+  case CS_MESH_LOCATION_BOUNDARY_FACES:
+    return m->b_face_numbering;
+  case CS_MESH_LOCATION_VERTICES:
+    return m->vtx_numbering;
+  default:
+    return NULL;
+  }
+}
+
 /*----------------------------------------------------------------------------*
  * allocate and initialize a field values array.
  *
  * parameters:
- *   n_elts  <-- number of associated elements
- *   dim     <-- associated dimension
- *   val_old <-- pointer to previous array in case of reallocation
- *               (usually NULL)
+ *   location_id <-- associated mesh location id
+ *   dim         <-- associated dimension
+ *   val_old     <-- pointer to previous array in case of reallocation
+ *                   (usually NULL)
  *
  * returns  pointer to new field values.
  *----------------------------------------------------------------------------*/
 
 static cs_real_t *
-_add_val(cs_lnum_t   n_elts,
+_add_val(int         location_id,
          int         dim,
          cs_real_t  *val_old)
 {
   cs_real_t  *val = val_old;
 
-  BFT_REALLOC(val, n_elts*dim, cs_real_t);
+  const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(location_id);
+
+  BFT_REALLOC(val, n_elts[2]*dim, cs_real_t);
 
   /* Initialize field. This should not be necessary, but when using
      threads with Open MP, this should help ensure that the memory will
      first be touched by the same core that will later operate on
-     this memory, usually leading to better core/memory affinity. */
+     this memory, usually leading to better core/memory affinity;
+     the thread partition of loops on the location's elements is used. */
 
-  const cs_lnum_t _n_elts = dim * n_elts;
-# pragma omp parallel for if (_n_elts > CS_THR_MIN)
-  for (cs_lnum_t ii = 0; ii < _n_elts; ii++)
-    val[ii] = 0.0;
+  cs_numbering_first_touch(_location_numbering(location_id),
+                           n_elts[2],
+                           dim*sizeof(cs_real_t),
+                           NULL,
+                           val);
 
   return val;
 }
@@ -1685,10 +1722,8 @@ cs_field_set_n_time_vals(cs_field_t  *f,
         f->val_pre = NULL;
     }
     else { /* if (n_time_vals_ini < _n_time_vals) */
-      if (f->is_owner) {
-        const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(f->location_id);
-        f->val_pre = _add_val(n_elts[2], f->dim, f->val_pre);
-      }
+      if (f->is_owner)
+        f->val_pre = _add_val(f->location_id, f->dim, f->val_pre);
     }
   }
 }
@@ -1708,13 +1743,12 @@ cs_field_allocate_values(cs_field_t  *f)
 
   if (f->is_owner) {
 
-    const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(f->location_id);
     int ii;
 
     /* Initialization */
 
     for (ii = 0; ii < f->n_time_vals; ii++)
-      f->vals[ii] = _add_val(n_elts[2], f->dim, f->vals[ii]);
+      f->vals[ii] = _add_val(f->location_id, f->dim, f->vals[ii]);
 
     f->val = f->vals[0];
     if (f->n_time_vals > 1)
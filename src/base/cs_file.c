@@ -175,10 +175,33 @@ BEGIN_C_DECLS
 /* MPI tag for file operations */
 #define CS_FILE_MPI_TAG  (int)('C'+'S'+'_'+'F'+'I'+'L'+'E')
 
+/* Non-blocking collective MPI-IO requires MPI 3.1 */
+#if defined(HAVE_MPI_IO)
+#  if MPI_VERSION > 3 || (MPI_VERSION == 3 && MPI_SUBVERSION > 0)
+#    define CS_FILE_MPI_NONBLOCKING 1
+#  endif
+#endif
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
 
+#if defined(HAVE_MPI_IO)
+
+/* Pending non-blocking read or write */
+
+typedef struct {
+
+  unsigned char     *buf;          /* Data buffer (owned for writes) */
+  cs_file_off_t      size;         /* Size (in bytes) of data */
+  size_t             swap_size;    /* Element size for endianness swap
+                                      after read, or 0 */
+  bool               write;        /* true for writes, false for reads */
+
+} _cs_file_request_t;
+
+#endif
+
 /* File descriptor */
 
 struct _cs_file_t {
@@ -200,6 +223,10 @@ struct _cs_file_t {
   MPI_File           fh;           /* MPI file handle */
   MPI_Info           info;         /* MPI file info */
   MPI_Offset         offset;       /* MPI file offset */
+  int                n_requests;   /* Number of pending non-blocking
+                                      reads and writes */
+  MPI_Request       *requests;     /* Pending non-blocking requests */
+  _cs_file_request_t  *req_info;   /* Pending non-blocking requests info */
 #else
   cs_file_off_t      offset;       /* File offset */
 #endif
@@ -1713,6 +1740,172 @@ _mpi_file_write_block_ip(cs_file_t  *f,
   return retval;
 }
 
+#if defined(CS_FILE_MPI_NONBLOCKING)
+
+/*----------------------------------------------------------------------------
+ * Add a pending non-blocking request to a file descriptor.
+ *
+ * parameters:
+ *   f         <-> cs_file_t descriptor
+ *   buf       <-- associated data buffer
+ *   size      <-- size (in bytes) of associated data
+ *   swap_size <-- element size for endianness swap after read, or 0
+ *   write     <-- true for a write, false for a read
+ *
+ * returns:
+ *   pointer to the request handle
+ *----------------------------------------------------------------------------*/
+
+static MPI_Request *
+_add_request(cs_file_t      *f,
+             unsigned char  *buf,
+             cs_file_off_t   size,
+             size_t          swap_size,
+             bool            write)
+{
+  int r_id = f->n_requests;
+
+  f->n_requests += 1;
+  BFT_REALLOC(f->requests, f->n_requests, MPI_Request);
+  BFT_REALLOC(f->req_info, f->n_requests, _cs_file_request_t);
+
+  _cs_file_request_t *r = f->req_info + r_id;
+
+  r->buf = buf;
+  r->size = size;
+  r->swap_size = swap_size;
+  r->write = write;
+
+  return f->requests + r_id;
+}
+
+/*----------------------------------------------------------------------------
+ * Start reading data from a file using non-blocking collective MPI-IO
+ * with explicit offsets, each associated process reading a contiguous
+ * part of this data.
+ *
+ * The buffer must not be accessed until cs_file_wait() is called.
+ *
+ * parameters:
+ *   f                <-> cs_file_t descriptor
+ *   buf              --> pointer to location receiving data
+ *   size             <-- size of each item of data in bytes
+ *   global_num_start <-- global number of first block item (1 to n numbering)
+ *   global_num_end   <-- global number of past-the end block item
+ *                        (1 to n numbering)
+ *
+ * returns:
+ *   the (local) number of items (not bytes) whose read was started;
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_mpi_file_iread_block_eo(cs_file_t  *f,
+                         void       *buf,
+                         size_t      size,
+                         cs_gnum_t   global_num_start,
+                         cs_gnum_t   global_num_end)
+{
+  int errcode, count;
+
+  MPI_Datatype ent_type = MPI_BYTE;
+  MPI_Offset disp = f->offset + ((global_num_start - 1) * size);
+  cs_gnum_t gcount = (global_num_end - global_num_start)*size;
+
+  assert(gcount == 0 || f->fh != MPI_FILE_NULL);
+
+  if (f->fh == MPI_FILE_NULL)
+    return 0;
+
+  if (gcount > INT_MAX) {
+    MPI_Type_contiguous(size, MPI_BYTE, &ent_type);
+    MPI_Type_commit(&ent_type);
+    count = global_num_end - global_num_start;
+  }
+  else
+    count = gcount;
+
+  size_t swap_size = (f->swap_endian == true && size > 1) ? size : 0;
+
+  MPI_Request *request = _add_request(f, buf, gcount, swap_size, false);
+
+  errcode = MPI_File_iread_at_all(f->fh, disp, buf, count, ent_type, request);
+
+  if (errcode != MPI_SUCCESS)
+    _mpi_io_error_message(f->name, errcode);
+
+  /* The datatype is only freed once pending operations are complete */
+
+  if (ent_type != MPI_BYTE)
+    MPI_Type_free(&ent_type);
+
+  return global_num_end - global_num_start;
+}
+
+/*----------------------------------------------------------------------------
+ * Start writing data to a file using non-blocking collective MPI-IO
+ * with explicit offsets, each associated process providing a contiguous
+ * part of this data.
+ *
+ * The buffer is owned by the file descriptor once this function is called,
+ * and freed by cs_file_wait() once the write is complete.
+ *
+ * parameters:
+ *   f                <-> cs_file_t descriptor
+ *   buf              <-- pointer to location containing data
+ *   size             <-- size of each item of data in bytes
+ *   global_num_start <-- global number of first block item (1 to n numbering)
+ *   global_num_end   <-- global number of past-the end block item
+ *                        (1 to n numbering)
+ *
+ * returns:
+ *   the (local) number of items (not bytes) whose write was started;
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_mpi_file_iwrite_block_eo(cs_file_t      *f,
+                          unsigned char  *buf,
+                          size_t          size,
+                          cs_gnum_t       global_num_start,
+                          cs_gnum_t       global_num_end)
+{
+  int errcode, count;
+
+  MPI_Datatype ent_type = MPI_BYTE;
+  MPI_Offset disp = f->offset + ((global_num_start - 1) * size);
+  cs_gnum_t gcount = (global_num_end - global_num_start)*size;
+
+  assert(gcount == 0 || f->fh != MPI_FILE_NULL);
+
+  if (f->fh == MPI_FILE_NULL) {
+    BFT_FREE(buf);
+    return 0;
+  }
+
+  if (gcount > INT_MAX) {
+    MPI_Type_contiguous(size, MPI_BYTE, &ent_type);
+    MPI_Type_commit(&ent_type);
+    count = global_num_end - global_num_start;
+  }
+  else
+    count = gcount;
+
+  MPI_Request *request = _add_request(f, buf, gcount, 0, true);
+
+  errcode = MPI_File_iwrite_at_all(f->fh, disp, buf, count, ent_type, request);
+
+  if (errcode != MPI_SUCCESS)
+    _mpi_io_error_message(f->name, errcode);
+
+  /* The datatype is only freed once pending operations are complete */
+
+  if (ent_type != MPI_BYTE)
+    MPI_Type_free(&ent_type);
+
+  return global_num_end - global_num_start;
+}
+
+#endif /* defined(CS_FILE_MPI_NONBLOCKING) */
+
 #endif /* defined(HAVE_MPI_IO) */
 
 /*----------------------------------------------------------------------------
@@ -1815,6 +2008,9 @@ cs_file_open(const char        *name,
 #if defined(HAVE_MPI_IO)
   f->fh = MPI_FILE_NULL;
   f->info = hints;
+  f->n_requests = 0;
+  f->requests = NULL;
+  f->req_info = NULL;
 #endif
 #endif
 
@@ -1996,8 +2192,10 @@ cs_file_free(cs_file_t  *f)
     _file_close(_f);
 
 #if defined(HAVE_MPI_IO)
-  else if (_f->fh != MPI_FILE_NULL)
+  else if (_f->fh != MPI_FILE_NULL) {
+    cs_file_wait(_f);
     _mpi_file_close(_f);
+  }
 #endif
 
   BFT_FREE(_f->name);
@@ -2421,6 +2619,86 @@ cs_file_read_block(cs_file_t  *f,
   return retval;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Start reading data from a file, each associated process reading
+ * a contiguous part of this data.
+ *
+ * This function behaves as \ref cs_file_read_block, except that when
+ * using collective MPI-IO with explicit offsets (and MPI 3.1 or above),
+ * the read is only started, and completed by \ref cs_file_wait (or when
+ * the file is closed).
+ *
+ * The file offset is updated immediately, so following sections of the
+ * file may be read before the read is complete, as long as no file view
+ * is set. The buffer contents are undefined until the read is complete.
+ *
+ * With other access methods, the data is read immediately.
+ *
+ * \param[in]  f                 cs_file_t descriptor
+ * \param[out] buf               pointer to location receiving data
+ * \param[in]  size              size of each item of data in bytes
+ * \param[in]  stride            number of (interlaced) values per block item
+ * \param[in]  global_num_start  global number of first block item
+ *                               (1 to n numbering)
+ * \param[in]  global_num_end    global number of past-the end block item
+ *                               (1 to n numbering)
+ *
+ * \return the (local) number of items (not bytes) whose read was
+ *         sucessfully started or completed; currently, errors are fatal.
+ */
+/*----------------------------------------------------------------------------*/
+
+size_t
+cs_file_iread_block(cs_file_t  *f,
+                    void       *buf,
+                    size_t      size,
+                    size_t      stride,
+                    cs_gnum_t   global_num_start,
+                    cs_gnum_t   global_num_end)
+{
+  size_t retval = 0;
+
+#if defined(CS_FILE_MPI_NONBLOCKING)
+
+  if (   f->method == CS_FILE_MPI_COLLECTIVE
+      && _mpi_io_positioning == CS_FILE_MPI_EXPLICIT_OFFSETS) {
+
+    cs_gnum_t global_num_end_last = global_num_end;
+
+    const cs_gnum_t _global_num_start = (global_num_start-1)*stride + 1;
+    const cs_gnum_t _global_num_end = (global_num_end-1)*stride + 1;
+
+    assert(global_num_end >= global_num_start);
+
+    retval = _mpi_file_iread_block_eo(f,
+                                      buf,
+                                      size,
+                                      _global_num_start,
+                                      _global_num_end);
+
+    /* Update offset */
+
+    if (f->n_ranks > 1)
+      MPI_Bcast(&global_num_end_last, 1, CS_MPI_GNUM, f->n_ranks-1, f->comm);
+
+    f->offset += ((global_num_end_last - 1) * size * stride);
+
+    return retval;
+  }
+
+#endif /* defined(CS_FILE_MPI_NONBLOCKING) */
+
+  retval = cs_file_read_block(f,
+                              buf,
+                              size,
+                              stride,
+                              global_num_start,
+                              global_num_end);
+
+  return retval;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Write data to a file, each associated process providing a
@@ -2639,6 +2917,153 @@ cs_file_write_block_buffer(cs_file_t  *f,
   return retval;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Start writing data to a file, each associated process providing a
+ * contiguous part of this data.
+ *
+ * This function behaves as \ref cs_file_write_block, except that when
+ * using collective MPI-IO with explicit offsets (and MPI 3.1 or above),
+ * the write is only started, and completed by \ref cs_file_wait (or when
+ * the file is closed).
+ *
+ * The file offset is updated immediately, so other data (such as headers)
+ * may be written to the file before the write is complete, as long as it
+ * does not overlap this block, and no file view is set. The data is copied
+ * to an internal buffer, so the input buffer may be modified or freed
+ * as soon as this function returns. Copies are only freed when the
+ * associated writes are complete.
+ *
+ * With other access methods, the data is written immediately.
+ *
+ * \param[in]  f                 cs_file_t descriptor
+ * \param[in]  buf               pointer to location containing data
+ * \param[in]  size              size of each item of data in bytes
+ * \param[in]  stride            number of (interlaced) values per block item
+ * \param[in]  global_num_start  global number of first block item
+ *                               (1 to n numbering)
+ * \param[in]  global_num_end    global number of past-the end block item
+ *                               (1 to n numbering)
+ *
+ * \return the (local) number of items (not bytes) whose write was
+ *         sucessfully started or completed; currently, errors are fatal.
+ */
+/*----------------------------------------------------------------------------*/
+
+size_t
+cs_file_iwrite_block(cs_file_t   *f,
+                     const void  *buf,
+                     size_t       size,
+                     size_t       stride,
+                     cs_gnum_t    global_num_start,
+                     cs_gnum_t    global_num_end)
+{
+  size_t retval = 0;
+
+#if defined(CS_FILE_MPI_NONBLOCKING)
+
+  if (   f->method == CS_FILE_MPI_COLLECTIVE
+      && _mpi_io_positioning == CS_FILE_MPI_EXPLICIT_OFFSETS) {
+
+    cs_gnum_t global_num_end_last = global_num_end;
+
+    const cs_gnum_t _global_num_start = (global_num_start-1)*stride + 1;
+    const cs_gnum_t _global_num_end = (global_num_end-1)*stride + 1;
+    const size_t n_vals = _global_num_end - _global_num_start;
+
+    unsigned char *copybuf = NULL;
+
+    BFT_MALLOC(copybuf, n_vals*size, unsigned char);
+
+    if (n_vals > 0)
+      memcpy(copybuf, buf, n_vals*size);
+
+    if (f->swap_endian == true && size > 1)
+      _swap_endian(copybuf, copybuf, size, n_vals);
+
+    retval = _mpi_file_iwrite_block_eo(f,
+                                       copybuf,
+                                       size,
+                                       _global_num_start,
+                                       _global_num_end);
+
+    /* Update offset */
+
+    if (f->n_ranks > 1)
+      MPI_Bcast(&global_num_end_last, 1, CS_MPI_GNUM, f->n_ranks-1, f->comm);
+
+    f->offset += ((global_num_end_last - 1) * size * stride);
+
+    return retval;
+  }
+
+#endif /* defined(CS_FILE_MPI_NONBLOCKING) */
+
+  retval = cs_file_write_block(f,
+                               buf,
+                               size,
+                               stride,
+                               global_num_start,
+                               global_num_end);
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Wait for completion of pending reads and writes started by
+ * \ref cs_file_iread_block and \ref cs_file_iwrite_block.
+ *
+ * \param[in, out]  f  cs_file_t descriptor
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_file_wait(cs_file_t  *f)
+{
+#if defined(CS_FILE_MPI_NONBLOCKING)
+
+  if (f->n_requests > 0) {
+
+    MPI_Status *statuses;
+    BFT_MALLOC(statuses, f->n_requests, MPI_Status);
+
+    int errcode = MPI_Waitall(f->n_requests, f->requests, statuses);
+
+    if (errcode != MPI_SUCCESS)
+      _mpi_io_error_message(f->name, errcode);
+
+    for (int i = 0; i < f->n_requests; i++) {
+      _cs_file_request_t *r = f->req_info + i;
+      MPI_Count count = 0;
+      if (r->size > 0)
+        MPI_Get_elements_x(statuses + i, MPI_BYTE, &count);
+      if ((cs_file_off_t)count != r->size)
+        bft_error(__FILE__, __LINE__, 0,
+                  (r->write) ?
+                  _("Error writing %llu bytes to file \"%s\".") :
+                  _("Error reading %llu bytes from file \"%s\"."),
+                  (unsigned long long)(r->size), f->name);
+      if (r->write)
+        BFT_FREE(r->buf);
+      else if (r->swap_size > 0)
+        _swap_endian(r->buf, r->buf, r->swap_size, r->size / r->swap_size);
+    }
+
+    BFT_FREE(statuses);
+
+    f->n_requests = 0;
+    BFT_FREE(f->requests);
+    BFT_FREE(f->req_info);
+  }
+
+#else
+
+  CS_UNUSED(f);
+
+#endif /* defined(CS_FILE_MPI_NONBLOCKING) */
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Update the file pointer according to whence.
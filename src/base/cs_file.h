@@ -347,6 +347,43 @@ cs_file_read_block(cs_file_t  *f,
                    cs_gnum_t   global_num_start,
                    cs_gnum_t   global_num_end);
 
+/*----------------------------------------------------------------------------
+ * Start reading data from a file, each associated process reading a
+ * contiguous part of this data.
+ *
+ * This function behaves as cs_file_read_block(), except that when
+ * using collective MPI-IO with explicit offsets (and MPI 3.1 or above),
+ * the read is only started, and completed by cs_file_wait() (or when
+ * the file is closed).
+ *
+ * The file offset is updated immediately, so following sections of the
+ * file may be read before the read is complete, as long as no file view
+ * is set. The buffer contents are undefined until the read is complete.
+ *
+ * With other access methods, the data is read immediately.
+ *
+ * parameters:
+ *   f                <-- cs_file_t descriptor
+ *   buf              --> pointer to location receiving data
+ *   size             <-- size of each item of data in bytes
+ *   stride           <-- number of (interlaced) values per block item
+ *   global_num_start <-- global number of first block item (1 to n numbering)
+ *   global_num_end   <-- global number of past-the end block item
+ *                        (1 to n numbering)
+ *
+ * returns:
+ *   the (local) number of items (not bytes) whose read was sucessfully
+ *   started or completed; currently, errors are fatal.
+ *----------------------------------------------------------------------------*/
+
+size_t
+cs_file_iread_block(cs_file_t  *f,
+                    void       *buf,
+                    size_t      size,
+                    size_t      stride,
+                    cs_gnum_t   global_num_start,
+                    cs_gnum_t   global_num_end);
+
 /*----------------------------------------------------------------------------
  * Write data to a file, each associated process providing a contiguous part
  * of this data.
@@ -423,6 +460,57 @@ cs_file_write_block_buffer(cs_file_t  *f,
                            cs_gnum_t   global_num_start,
                            cs_gnum_t   global_num_end);
 
+/*----------------------------------------------------------------------------
+ * Start writing data to a file, each associated process providing a
+ * contiguous part of this data.
+ *
+ * This function behaves as cs_file_write_block(), except that when
+ * using collective MPI-IO with explicit offsets (and MPI 3.1 or above),
+ * the write is only started, and completed by cs_file_wait() (or when
+ * the file is closed).
+ *
+ * The file offset is updated immediately, so other data (such as headers)
+ * may be written to the file before the write is complete, as long as it
+ * does not overlap this block, and no file view is set. The data is copied
+ * to an internal buffer, so the input buffer may be modified or freed
+ * as soon as this function returns. Copies are only freed when the
+ * associated writes are complete.
+ *
+ * With other access methods, the data is written immediately.
+ *
+ * parameters:
+ *   f                <-- cs_file_t descriptor
+ *   buf              <-- pointer to location containing data
+ *   size             <-- size of each item of data in bytes
+ *   stride           <-- number of (interlaced) values per block item
+ *   global_num_start <-- global number of first block item (1 to n numbering)
+ *   global_num_end   <-- global number of past-the end block item
+ *                        (1 to n numbering)
+ *
+ * returns:
+ *   the (local) number of items (not bytes) whose write was sucessfully
+ *   started or completed; currently, errors are fatal.
+ *----------------------------------------------------------------------------*/
+
+size_t
+cs_file_iwrite_block(cs_file_t   *f,
+                     const void  *buf,
+                     size_t       size,
+                     size_t       stride,
+                     cs_gnum_t    global_num_start,
+                     cs_gnum_t    global_num_end);
+
+/*----------------------------------------------------------------------------
+ * Wait for completion of pending reads and writes started by
+ * cs_file_iread_block() and cs_file_iwrite_block().
+ *
+ * parameters:
+ *   f <-> cs_file_t descriptor
+ *----------------------------------------------------------------------------*/
+
+void
+cs_file_wait(cs_file_t  *f);
+
 /*----------------------------------------------------------------------------
  * Update the file pointer according to whence.
  *
@@ -2571,6 +2571,89 @@ cs_io_read_block(const cs_io_sec_header_t  *header,
                           cs_io);
 }
 
+/*----------------------------------------------------------------------------
+ * Start reading a section body, assigning a different block to each
+ * processor.
+ *
+ * This function behaves as cs_io_read_block(), except that the read may
+ * only be started (see cs_file_iread_block()), so that following sections
+ * may be read before it is complete. Pending reads are completed by
+ * cs_io_wait() (or when the file is closed), and the array contents are
+ * undefined until then.
+ *
+ * Values embedded in the header, values requiring a type conversion,
+ * or values to echo are read immediately.
+ *
+ * parameters:
+ *   header           <-- header structure
+ *   global_num_start <-- global number of first block item (1 to n numbering)
+ *   global_num_end   <-- global number of past-the end block item
+ *                        (1 to n numbering)
+ *   elts             --> pointer to data array
+ *   cs_io            --> kernel IO structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_io_iread_block(const cs_io_sec_header_t  *header,
+                  cs_gnum_t                  global_num_start,
+                  cs_gnum_t                  global_num_end,
+                  void                      *elts,
+                  cs_io_t                   *cs_io)
+{
+  double t_start = 0.;
+  size_t stride = 1;
+  cs_io_log_t  *log = NULL;
+
+  assert(global_num_start > 0);
+  assert(global_num_end >= global_num_start);
+  assert(elts != NULL);
+
+  assert(header->n_vals == cs_io->n_vals);
+
+  if (   cs_io->data != NULL
+      || header->elt_type != header->type_read
+      || cs_io->echo > CS_IO_ECHO_HEADERS) {
+    _cs_io_read_body(header,
+                     global_num_start,
+                     global_num_end,
+                     elts,
+                     cs_io);
+    return;
+  }
+
+  if (cs_io->log_id > -1) {
+    log = _cs_io_log[cs_io->mode] + cs_io->log_id;
+    t_start = cs_timer_wtime();
+  }
+
+  if (header->n_location_vals > 1)
+    stride = header->n_location_vals;
+
+  size_t type_size = cs_datatype_size[header->type_read];
+
+  /* Position read pointer if necessary */
+
+  if (cs_io->body_align > 0) {
+    cs_file_off_t offset = cs_file_tell(cs_io->f);
+    size_t ba = cs_io->body_align;
+    offset += (ba - (offset % ba)) % ba;
+    cs_file_seek(cs_io->f, offset, CS_FILE_SEEK_SET);
+  }
+
+  cs_file_iread_block(cs_io->f,
+                      elts,
+                      type_size,
+                      stride,
+                      global_num_start,
+                      global_num_end);
+
+  if (log != NULL) {
+    double t_end = cs_timer_wtime();
+    log->wtimes[1] += t_end - t_start;
+    log->data_size[1] += (global_num_end - global_num_start)*type_size;
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Read a section body, assigning a different block to each processor,
  * when the body corresponds to an index.
@@ -3021,6 +3104,130 @@ cs_io_write_block_buffer(const char     *sec_name,
                elt_type, elts);
 }
 
+/*----------------------------------------------------------------------------
+ * Start writing a section to file, each associated process providing a
+ * contiguous part of the section's body.
+ *
+ * This function behaves as cs_io_write_block(), except that the body
+ * write is only started when the underlying file uses non-blocking
+ * collective MPI-IO (see cs_file_iwrite_block()). As the section's size
+ * is known, the offset of the next section's header is computed
+ * immediately, so following sections may be written while this one is
+ * still in progress. Pending writes are completed by cs_io_wait()
+ * (or when the file is closed).
+ *
+ * The input buffer may be modified or freed as soon as this function
+ * returns.
+ *
+ * parameters:
+ *   section_name     <-- section name
+ *   n_g_elts         <-- number of global elements (locations)
+ *   global_num_start <-- global number of first block item (1 to n numbering)
+ *   global_num_end   <-- global number of past-the end block item
+ *   location_id      <-- id of associated location, or 0
+ *   index_id         <-- id of associated index, or 0
+ *   n_location_vals  <-- number of values per location
+ *   elt_type         <-- element type
+ *                        (1 to n numbering)
+ *   elts             <-- pointer to element data
+ *   outp             <-> output kernel IO structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_io_iwrite_block(const char     *sec_name,
+                   cs_gnum_t       n_g_elts,
+                   cs_gnum_t       global_num_start,
+                   cs_gnum_t       global_num_end,
+                   size_t          location_id,
+                   size_t          index_id,
+                   size_t          n_location_vals,
+                   cs_datatype_t   elt_type,
+                   const void     *elts,
+                   cs_io_t        *outp)
+{
+  double t_start = 0.;
+  size_t n_written = 0;
+  size_t n_g_vals = n_g_elts;
+  size_t n_vals = global_num_end - global_num_start;
+  size_t stride = 1;
+  cs_io_log_t  *log = NULL;
+
+  if (n_location_vals > 1) {
+    stride = n_location_vals;
+    n_g_vals *= n_location_vals;
+    n_vals *= n_location_vals;
+  }
+
+  _write_header(sec_name,
+                n_g_vals,
+                location_id,
+                index_id,
+                n_location_vals,
+                elt_type,
+                NULL,
+                outp);
+
+  if (outp->log_id > -1) {
+    log = _cs_io_log[outp->mode] + outp->log_id;
+    t_start = cs_timer_wtime();
+  }
+
+  _write_padding(outp->body_align, outp);
+
+  n_written = cs_file_iwrite_block(outp->f,
+                                   elts,
+                                   cs_datatype_size[elt_type],
+                                   stride,
+                                   global_num_start,
+                                   global_num_end);
+
+  if (n_vals != (cs_gnum_t)n_written)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error writing %llu bytes to file \"%s\"."),
+              (unsigned long long)n_vals, cs_file_get_name(outp->f));
+
+  if (log != NULL) {
+    double t_end = cs_timer_wtime();
+    log->wtimes[1] += t_end - t_start;
+    log->data_size[1] += n_written*cs_datatype_size[elt_type];
+  }
+
+  if (n_vals != 0 && outp->echo > CS_IO_ECHO_HEADERS)
+    _echo_data(outp->echo, n_g_vals,
+               (global_num_start-1)*stride + 1,
+               (global_num_end -1)*stride + 1,
+               elt_type, elts);
+}
+
+/*----------------------------------------------------------------------------
+ * Wait for completion of pending section reads and writes started by
+ * cs_io_iread_block() and cs_io_iwrite_block().
+ *
+ * parameters:
+ *   cs_io <-> kernel IO structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_io_wait(cs_io_t  *cs_io)
+{
+  double t_start = 0.;
+  cs_io_log_t  *log = NULL;
+
+  assert(cs_io != NULL);
+
+  if (cs_io->log_id > -1) {
+    log = _cs_io_log[cs_io->mode] + cs_io->log_id;
+    t_start = cs_timer_wtime();
+  }
+
+  cs_file_wait(cs_io->f);
+
+  if (log != NULL) {
+    double t_end = cs_timer_wtime();
+    log->wtimes[1] += t_end - t_start;
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Skip a message.
  *
@@ -390,6 +390,35 @@ cs_io_read_block(const cs_io_sec_header_t  *header,
                  void                      *elts,
                  cs_io_t                   *pp_io);
 
+/*----------------------------------------------------------------------------
+ * Start reading a section body, assigning a different block to each
+ * processor.
+ *
+ * This function behaves as cs_io_read_block(), except that the read may
+ * only be started (see cs_file_iread_block()), so that following sections
+ * may be read before it is complete. Pending reads are completed by
+ * cs_io_wait() (or when the file is closed), and the array contents are
+ * undefined until then.
+ *
+ * Values embedded in the header, values requiring a type conversion,
+ * or values to echo are read immediately.
+ *
+ * parameters:
+ *   header           <-- header structure
+ *   global_num_start <-- global number of first block item (1 to n numbering)
+ *   global_num_end   <-- global number of past-the end block item
+ *                        (1 to n numbering)
+ *   elts             --> pointer to data array
+ *   pp_io            --> kernel IO structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_io_iread_block(const cs_io_sec_header_t  *header,
+                  cs_gnum_t                  global_num_start,
+                  cs_gnum_t                  global_num_end,
+                  void                      *elts,
+                  cs_io_t                   *pp_io);
+
 /*----------------------------------------------------------------------------
  * Read a message body, assigning a different block to each processor,
  * when the body corresponds to an index.
@@ -549,6 +578,58 @@ cs_io_write_block_buffer(const char     *sec_name,
                          void           *elts,
                          cs_io_t        *outp);
 
+/*----------------------------------------------------------------------------
+ * Start writing a section to file, each associated process providing a
+ * contiguous part of the section's body.
+ *
+ * This function behaves as cs_io_write_block(), except that the body
+ * write is only started when the underlying file uses non-blocking
+ * collective MPI-IO (see cs_file_iwrite_block()). As the section's size
+ * is known, the offset of the next section's header is computed
+ * immediately, so following sections may be written while this one is
+ * still in progress. Pending writes are completed by cs_io_wait()
+ * (or when the file is closed).
+ *
+ * The input buffer may be modified or freed as soon as this function
+ * returns.
+ *
+ * parameters:
+ *   section_name     <-- section name
+ *   n_g_elts         <-- number of global elements (locations)
+ *   global_num_start <-- global number of first block item (1 to n numbering)
+ *   global_num_end   <-- global number of past-the end block item
+ *   location_id      <-- id of associated location, or 0
+ *   index_id         <-- id of associated index, or 0
+ *   n_location_vals  <-- number of values per location
+ *   elt_type         <-- element type
+ *                        (1 to n numbering)
+ *   elts             <-- pointer to element data
+ *   outp             <-> output kernel IO structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_io_iwrite_block(const char     *sec_name,
+                   cs_gnum_t       n_g_elts,
+                   cs_gnum_t       global_num_start,
+                   cs_gnum_t       global_num_end,
+                   size_t          location_id,
+                   size_t          index_id,
+                   size_t          n_location_vals,
+                   cs_datatype_t   elt_type,
+                   const void     *elts,
+                   cs_io_t        *outp);
+
+/*----------------------------------------------------------------------------
+ * Wait for completion of pending section reads and writes started by
+ * cs_io_iread_block() and cs_io_iwrite_block().
+ *
+ * parameters:
+ *   cs_io <-> kernel IO structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_io_wait(cs_io_t  *cs_io);
+
 /*----------------------------------------------------------------------------
  * Skip a message.
  *
@@ -0,0 +1,1359 @@
+/*============================================================================
+ * Runtime mesh adaptation (refinement of flagged cells).
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <math.h>
+#include <string.h>
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+#include "bft_error.h"
+#include "bft_printf.h"
+
+#include "cs_ale.h"
+#include "cs_all_to_all.h"
+#include "cs_base.h"
+#include "cs_block_dist.h"
+#include "cs_boundary_zone.h"
+#include "cs_cell_to_vertex.h"
+#include "cs_ext_neighborhood.h"
+#include "cs_field_operator.h"
+#include "cs_fan.h"
+#include "cs_field_pointer.h"
+#include "cs_gradient.h"
+#include "cs_gradient_perio.h"
+#include "cs_halo.h"
+#include "cs_internal_coupling.h"
+#include "cs_les_balance.h"
+#include "cs_lagr.h"
+#include "cs_log.h"
+#include "cs_math.h"
+#include "cs_matrix_default.h"
+#include "cs_mesh.h"
+#include "cs_mesh_adjacencies.h"
+#include "cs_mesh_bad_cells.h"
+#include "cs_mesh_box_index.h"
+#include "cs_mesh_builder.h"
+#include "cs_mesh_from_builder.h"
+#include "cs_mesh_location.h"
+#include "cs_mesh_quantities.h"
+#include "cs_mesh_refine.h"
+#include "cs_mesh_to_builder.h"
+#include "cs_numbering.h"
+#include "cs_parall.h"
+#include "cs_partition.h"
+#include "cs_physical_constants.h"
+#include "cs_post.h"
+#include "cs_preprocess.h"
+#include "cs_prototypes.h"
+#include "cs_renumber.h"
+#include "cs_sat_coupling.h"
+#include "cs_syr_coupling.h"
+#include "cs_time_moment.h"
+#include "cs_time_step.h"
+#include "cs_timer.h"
+#include "cs_timer_stats.h"
+#include "cs_turbomachinery.h"
+#include "cs_volume_zone.h"
+
+/*----------------------------------------------------------------------------
+ * Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_mesh_adapt.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_mesh_adapt.c
+        Runtime mesh adaptation.
+
+  Cells flagged based on an error indicator are refined using
+  \ref cs_mesh_refine_simple_o2n, after which field values are mapped to
+  the new mesh and mesh-dependent structures (halos, numberings, quantities,
+  zones, matrix structures) are rebuilt. The mesh may optionally be
+  repartitioned to restore load balance.
+
+  Coarsening is not available yet, as cell coarsening
+  (\ref cs_mesh_coarsen_simple) does not merge faces of merged cells.
+
+  Only field values and boundary condition coefficients are remapped,
+  so features keeping other arrays based on cells or boundary faces
+  are rejected at setup.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Local structure definitions
+ *============================================================================*/
+
+/* Mesh adaptation options and statistics */
+
+typedef struct {
+
+  int                         f_id;                 /* indicator field id,
+                                                       or -1 */
+  int                         interval;             /* time steps between
+                                                       adaptations */
+  int                         max_level;            /* maximum refinement
+                                                       level */
+  double                      refine_threshold;     /* relative indicator
+                                                       threshold for
+                                                       refinement */
+
+  bool                        rebalance;            /* repartition if
+                                                       imbalanced */
+  double                      imbalance_threshold;  /* max/mean cells ratio
+                                                       for repartitioning */
+
+  cs_mesh_adapt_indicator_t  *indicator_func;       /* user indicator, or
+                                                       NULL */
+  void                       *indicator_input;      /* user indicator input */
+
+  int                         n_updates;            /* number of mesh
+                                                       modifications */
+  int                         n_rebalances;         /* number of mesh
+                                                       repartitionings */
+  cs_timer_counter_t          t_adapt;              /* adaptation time */
+
+} cs_mesh_adapt_t;
+
+/* Array remapped upon mesh adaptation */
+
+typedef struct {
+
+  cs_real_t               **val;        /* pointer to values array */
+  int                       stride;     /* number of values per element */
+  cs_mesh_location_type_t   location;   /* cells or boundary faces */
+  bool                      extensive;  /* values proportional to
+                                           face surface */
+
+} cs_mesh_adapt_array_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static cs_mesh_adapt_t  *_mesh_adapt = NULL;
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Check that the current setup is compatible with mesh adaptation.
+ *
+ * Only field values and their boundary condition coefficients are
+ * remapped, so features keeping their own arrays based on cells or
+ * boundary faces are rejected, as are fields which do not own their values.
+ *----------------------------------------------------------------------------*/
+
+static void
+_check_setup(void)
+{
+  const char *unsupported = NULL;
+
+  if (cs_glob_mesh->n_init_perio > 0)
+    unsupported = _("periodicity");
+  else if (cs_glob_ale > 0)
+    unsupported = _("ALE");
+  else if (cs_turbomachinery_get_model() != CS_TURBOMACHINERY_NONE)
+    unsupported = _("turbomachinery");
+  else if (cs_glob_lagr_time_scheme->iilagr > 0)
+    unsupported = _("Lagrangian particle tracking");
+  else if (cs_internal_coupling_n_couplings() > 0)
+    unsupported = _("internal coupling");
+  else if (cs_glob_porous_model > 0)
+    unsupported = _("porosity models");
+  else if (cs_time_moment_n_moments() > 0)
+    unsupported = _("time moments");
+  else if (cs_glob_les_balance->i_les_balance > 0)
+    unsupported = _("LES balance");
+  else if (cs_fan_n_fans() > 0)
+    unsupported = _("fans");
+  else if (   cs_sat_coupling_n_couplings() > 0
+           || cs_syr_coupling_n_couplings() > 0)
+    unsupported = _("code coupling");
+
+  if (unsupported != NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Runtime mesh adaptation is not compatible with %s."),
+              unsupported);
+
+  const int n_fields = cs_field_n_fields();
+  const int k_oi = cs_field_key_id_try("opt_interp_id");
+
+  for (int f_id = 0; f_id < n_fields; f_id++) {
+
+    const cs_field_t *f = cs_field_by_id(f_id);
+
+    if (   f->location_id != CS_MESH_LOCATION_CELLS
+        && f->location_id != CS_MESH_LOCATION_BOUNDARY_FACES)
+      continue;
+
+    if (f->is_owner == false)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Field \"%s\" does not own its values, so it can not be\n"
+                  "remapped by runtime mesh adaptation."), f->name);
+
+    if (   k_oi > -1 && (f->type & CS_FIELD_VARIABLE)
+        && cs_field_get_key_int(f, k_oi) > -1)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Runtime mesh adaptation is not compatible with\n"
+                  "optimal interpolation (field \"%s\")."), f->name);
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Compute cell refinement levels, based on the highest generation
+ * of adjacent interior faces.
+ *
+ * parameters:
+ *   m       <-- pointer to mesh structure
+ *   level   --> refinement level for each cell
+ *----------------------------------------------------------------------------*/
+
+static void
+_cell_r_level(const cs_mesh_t  *m,
+              int               level[])
+{
+  const cs_lnum_t n_cells = m->n_cells;
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    level[i] = 0;
+
+  if (m->i_face_r_gen == NULL)
+    return;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+
+  for (cs_lnum_t f_id = 0; f_id < m->n_i_faces; f_id++) {
+    int f_level = m->i_face_r_gen[f_id];
+    for (cs_lnum_t i = 0; i < 2; i++) {
+      cs_lnum_t c_id = i_face_cells[f_id][i];
+      if (c_id < n_cells && f_level > level[c_id])
+        level[c_id] = f_level;
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Add an array to the list of remapped arrays.
+ *
+ * parameters:
+ *   n_arrays   <-> number of arrays in list
+ *   n_max      <-> allocated list size
+ *   arrays     <-> list of remapped arrays
+ *   val        <-- pointer to values array
+ *   stride     <-- number of values per element
+ *   location   <-- associated location type
+ *   extensive  <-- true if values are proportional to face surfaces
+ *----------------------------------------------------------------------------*/
+
+static void
+_add_array(int                       *n_arrays,
+           int                       *n_max,
+           cs_mesh_adapt_array_t    **arrays,
+           cs_real_t                **val,
+           int                        stride,
+           cs_mesh_location_type_t    location,
+           bool                       extensive)
+{
+  if (*val == NULL)
+    return;
+
+  if (*n_arrays >= *n_max) {
+    *n_max = CS_MAX(*n_max * 2, 16);
+    BFT_REALLOC(*arrays, *n_max, cs_mesh_adapt_array_t);
+  }
+
+  cs_mesh_adapt_array_t *a = *arrays + *n_arrays;
+
+  a->val = val;
+  a->stride = stride;
+  a->location = location;
+  a->extensive = extensive;
+
+  *n_arrays += 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Build the list of cell and boundary face based arrays which should
+ * be remapped upon mesh adaptation.
+ *
+ * These are the values of fields owning their values on cells or
+ * boundary faces, and the associated boundary condition coefficients.
+ *
+ * The caller is responsible for freeing the returned array.
+ *
+ * parameters:
+ *   n_arrays --> number of arrays
+ *
+ * returns:
+ *   list of remapped arrays
+ *----------------------------------------------------------------------------*/
+
+static cs_mesh_adapt_array_t *
+_remapped_arrays(int  *n_arrays)
+{
+  int n = 0, n_max = 0;
+  cs_mesh_adapt_array_t *a = NULL;
+
+  const int n_fields = cs_field_n_fields();
+  const int k_bflux = cs_field_key_id_try("boundary_mass_flux_id");
+  const int k_coupled = cs_field_key_id_try("coupled");
+
+  /* Flag boundary mass fluxes, which scale with face surfaces */
+
+  bool *is_b_flux;
+  BFT_MALLOC(is_b_flux, n_fields, bool);
+  for (int f_id = 0; f_id < n_fields; f_id++)
+    is_b_flux[f_id] = false;
+
+  if (k_bflux > -1) {
+    for (int f_id = 0; f_id < n_fields; f_id++) {
+      const cs_field_t *f = cs_field_by_id(f_id);
+      if (f->type & CS_FIELD_VARIABLE) {
+        int b_flux_id = cs_field_get_key_int(f, k_bflux);
+        if (b_flux_id > -1)
+          is_b_flux[b_flux_id] = true;
+      }
+    }
+  }
+
+  for (int f_id = 0; f_id < n_fields; f_id++) {
+
+    cs_field_t *f = cs_field_by_id(f_id);
+
+    if (   f->location_id != CS_MESH_LOCATION_CELLS
+        && f->location_id != CS_MESH_LOCATION_BOUNDARY_FACES)
+      continue;
+
+    cs_mesh_location_type_t l_type = f->location_id;
+
+    for (int kk = 0; kk < f->n_time_vals; kk++)
+      _add_array(&n, &n_max, &a, f->vals + kk, f->dim, l_type,
+                 is_b_flux[f_id]);
+
+    cs_field_bc_coeffs_t *bc_coeffs = f->bc_coeffs;
+
+    if (bc_coeffs != NULL) {
+
+      const cs_mesh_location_type_t b_type = CS_MESH_LOCATION_BOUNDARY_FACES;
+
+      int b_mult = f->dim;
+      if ((f->type & CS_FIELD_VARIABLE) && k_coupled > -1) {
+        if (cs_field_get_key_int(f, k_coupled))
+          b_mult *= f->dim;
+      }
+
+      _add_array(&n, &n_max, &a, &(bc_coeffs->a), f->dim, b_type, false);
+      _add_array(&n, &n_max, &a, &(bc_coeffs->b), b_mult, b_type, false);
+      _add_array(&n, &n_max, &a, &(bc_coeffs->af), f->dim, b_type, false);
+      _add_array(&n, &n_max, &a, &(bc_coeffs->bf), b_mult, b_type, false);
+      _add_array(&n, &n_max, &a, &(bc_coeffs->ad), f->dim, b_type, false);
+      _add_array(&n, &n_max, &a, &(bc_coeffs->bd), b_mult, b_type, false);
+      _add_array(&n, &n_max, &a, &(bc_coeffs->ac), f->dim, b_type, false);
+      _add_array(&n, &n_max, &a, &(bc_coeffs->bc), b_mult, b_type, false);
+      _add_array(&n, &n_max, &a, &(bc_coeffs->hint), 1, b_type, false);
+      _add_array(&n, &n_max, &a, &(bc_coeffs->hext), 1, b_type, false);
+
+    }
+
+  }
+
+  BFT_FREE(is_b_flux);
+
+  *n_arrays = n;
+
+  return a;
+}
+
+/*----------------------------------------------------------------------------
+ * Synchronize ghost cell values of remapped cell arrays.
+ *
+ * parameters:
+ *   m         <-- pointer to mesh structure
+ *   n_arrays  <-- number of remapped arrays
+ *   arrays    <-- remapped arrays
+ *----------------------------------------------------------------------------*/
+
+static void
+_sync_cell_arrays(const cs_mesh_t              *m,
+                  int                           n_arrays,
+                  const cs_mesh_adapt_array_t   arrays[])
+{
+  if (m->halo == NULL)
+    return;
+
+  for (int a_id = 0; a_id < n_arrays; a_id++) {
+    const cs_mesh_adapt_array_t *a = arrays + a_id;
+    if (a->location == CS_MESH_LOCATION_CELLS)
+      cs_halo_sync_untyped(m->halo,
+                           CS_HALO_EXTENDED,
+                           a->stride*sizeof(cs_real_t),
+                           *(a->val));
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Remap arrays after refinement.
+ *
+ * Values of sub-cells and sub-faces are injected from their parent,
+ * so volume integrals are preserved; values proportional to face surfaces
+ * are scaled by the ratio of sub-face to parent face surfaces.
+ *
+ * parameters:
+ *   m            <-- pointer to (refined) mesh structure
+ *   n_arrays     <-- number of remapped arrays
+ *   arrays       <-> remapped arrays
+ *   n_c_old      <-- number of cells before refinement
+ *   c_o2n_idx    <-- old to new cells index
+ *   n_b_f_old    <-- number of boundary faces before refinement
+ *   b_f_o2n_idx  <-- old to new boundary faces index
+ *   b_f_surf_o   <-- boundary face surfaces before refinement
+ *----------------------------------------------------------------------------*/
+
+static void
+_remap_refined(const cs_mesh_t        *m,
+               int                     n_arrays,
+               cs_mesh_adapt_array_t   arrays[],
+               cs_lnum_t               n_c_old,
+               const cs_lnum_t         c_o2n_idx[],
+               cs_lnum_t               n_b_f_old,
+               const cs_lnum_t         b_f_o2n_idx[],
+               const cs_real_t         b_f_surf_o[])
+{
+  cs_real_t *b_f_surf_r = NULL;
+
+  for (int a_id = 0; a_id < n_arrays; a_id++) {
+
+    cs_mesh_adapt_array_t *a = arrays + a_id;
+
+    const cs_lnum_t stride = a->stride;
+    const cs_real_t *v_o = *(a->val);
+
+    cs_lnum_t n_old = n_c_old, n_alloc = m->n_cells_with_ghosts;
+    const cs_lnum_t *o2n_idx = c_o2n_idx;
+
+    if (a->location == CS_MESH_LOCATION_BOUNDARY_FACES) {
+      n_old = n_b_f_old;
+      n_alloc = m->n_b_faces;
+      o2n_idx = b_f_o2n_idx;
+    }
+
+    cs_real_t *v_n;
+    BFT_MALLOC(v_n, n_alloc*stride, cs_real_t);
+
+#   pragma omp parallel for if (n_old > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_old; i++) {
+      for (cs_lnum_t j = o2n_idx[i]; j < o2n_idx[i+1]; j++) {
+        for (cs_lnum_t k = 0; k < stride; k++)
+          v_n[j*stride + k] = v_o[i*stride + k];
+      }
+    }
+
+    /* Scale surface-proportional values (such as mass fluxes) */
+
+    if (a->extensive) {
+
+      const cs_lnum_t n_b_faces = m->n_b_faces;
+
+      if (b_f_surf_r == NULL) {
+
+        cs_real_t *b_face_cog = NULL, *b_face_normal = NULL;
+        cs_mesh_quantities_b_faces(m, &b_face_cog, &b_face_normal);
+        BFT_FREE(b_face_cog);
+
+        BFT_MALLOC(b_f_surf_r, n_b_faces, cs_real_t);
+
+#       pragma omp parallel for if (n_b_f_old > CS_THR_MIN)
+        for (cs_lnum_t i = 0; i < n_b_f_old; i++) {
+          for (cs_lnum_t j = b_f_o2n_idx[i]; j < b_f_o2n_idx[i+1]; j++) {
+            cs_real_t s = cs_math_3_norm(b_face_normal + 3*j);
+            b_f_surf_r[j] = (b_f_surf_o[i] > 0.) ? s / b_f_surf_o[i] : 0.;
+          }
+        }
+
+        BFT_FREE(b_face_normal);
+
+      }
+
+#     pragma omp parallel for if (n_b_faces > CS_THR_MIN)
+      for (cs_lnum_t j = 0; j < n_b_faces; j++) {
+        for (cs_lnum_t k = 0; k < stride; k++)
+          v_n[j*stride + k] *= b_f_surf_r[j];
+      }
+
+    }
+
+    BFT_FREE(*(a->val));
+    *(a->val) = v_n;
+
+  }
+
+  BFT_FREE(b_f_surf_r);
+
+  _sync_cell_arrays(m, n_arrays, arrays);
+}
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Repartition the mesh if the load imbalance is too high, migrating
+ * remapped arrays accordingly.
+ *
+ * Arrays are moved to a block distribution based on global element
+ * numbers, which are preserved by repartitioning, then redistributed.
+ *
+ * parameters:
+ *   m                    <-> pointer to mesh structure
+ *   imbalance_threshold  <-- max/mean cells ratio above which the mesh
+ *                            is repartitioned
+ *   n_arrays             <-- number of remapped arrays
+ *   arrays               <-> remapped arrays
+ *
+ * returns:
+ *   true if the mesh was repartitioned, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_rebalance(cs_mesh_t              *m,
+           double                  imbalance_threshold,
+           int                     n_arrays,
+           cs_mesh_adapt_array_t   arrays[])
+{
+  if (cs_glob_n_ranks < 2)
+    return false;
+
+  cs_gnum_t n_cells_max = m->n_cells;
+  cs_parall_max(1, CS_GNUM_TYPE, &n_cells_max);
+
+  double n_cells_mean = (double)(m->n_g_cells) / cs_glob_n_ranks;
+
+  if (n_cells_max <= imbalance_threshold*n_cells_mean)
+    return false;
+
+  /* Move values to block distribution */
+
+  cs_block_dist_info_t bi[2];
+  const cs_gnum_t n_g_elts[2] = {m->n_g_cells, m->n_g_b_faces};
+
+  for (int l_id = 0; l_id < 2; l_id++)
+    bi[l_id] = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                           cs_glob_n_ranks,
+                                           1,
+                                           0,
+                                           n_g_elts[l_id]);
+
+  cs_real_t **block_vals;
+  BFT_MALLOC(block_vals, n_arrays, cs_real_t *);
+
+  for (int l_id = 0; l_id < 2; l_id++) {
+
+    cs_mesh_location_type_t l_type = (l_id == 0) ?
+      CS_MESH_LOCATION_CELLS : CS_MESH_LOCATION_BOUNDARY_FACES;
+
+    cs_all_to_all_t *d
+      = cs_all_to_all_create_from_block
+          ((l_id == 0) ? m->n_cells : m->n_b_faces,
+           CS_ALL_TO_ALL_USE_DEST_ID,
+           (l_id == 0) ? m->global_cell_num : m->global_b_face_num,
+           bi[l_id],
+           cs_glob_mpi_comm);
+
+    for (int a_id = 0; a_id < n_arrays; a_id++) {
+      cs_mesh_adapt_array_t *a = arrays + a_id;
+      if (a->location == l_type) {
+        block_vals[a_id] = cs_all_to_all_copy_array(d,
+                                                    CS_REAL_TYPE,
+                                                    a->stride,
+                                                    false,
+                                                    *(a->val),
+                                                    NULL);
+        BFT_FREE(*(a->val));
+      }
+    }
+
+    cs_all_to_all_destroy(&d);
+
+  }
+
+  /* Repartition mesh */
+
+  cs_halo_type_t halo_type = m->halo_type;
+  cs_mesh_builder_t *mb = cs_mesh_builder_create();
+
+  if (m->i_face_r_gen == NULL) {
+    BFT_MALLOC(m->i_face_r_gen, m->n_i_faces, char);
+    for (cs_lnum_t i = 0; i < m->n_i_faces; i++)
+      m->i_face_r_gen[i] = 0;
+  }
+
+  cs_mesh_to_builder(m, mb, true, NULL);
+  cs_partition(m, mb, CS_PARTITION_MAIN);
+  cs_mesh_from_builder(m, mb);
+  cs_mesh_init_halo(m, mb, halo_type);
+  cs_mesh_update_auxiliary(m);
+
+  cs_mesh_builder_destroy(&mb);
+
+  /* Distribute values to new partition */
+
+  for (int l_id = 0; l_id < 2; l_id++) {
+
+    cs_mesh_location_type_t l_type = (l_id == 0) ?
+      CS_MESH_LOCATION_CELLS : CS_MESH_LOCATION_BOUNDARY_FACES;
+
+    cs_lnum_t n_elts = (l_id == 0) ? m->n_cells : m->n_b_faces;
+    cs_lnum_t n_alloc = (l_id == 0) ? m->n_cells_with_ghosts : m->n_b_faces;
+
+    cs_all_to_all_t *d
+      = cs_all_to_all_create_from_block
+          (n_elts,
+           CS_ALL_TO_ALL_USE_DEST_ID,
+           (l_id == 0) ? m->global_cell_num : m->global_b_face_num,
+           bi[l_id],
+           cs_glob_mpi_comm);
+
+    for (int a_id = 0; a_id < n_arrays; a_id++) {
+      cs_mesh_adapt_array_t *a = arrays + a_id;
+      if (a->location == l_type) {
+        BFT_MALLOC(*(a->val), n_alloc*a->stride, cs_real_t);
+        cs_all_to_all_copy_array(d,
+                                 CS_REAL_TYPE,
+                                 a->stride,
+                                 true, /* reverse */
+                                 block_vals[a_id],
+                                 *(a->val));
+        BFT_FREE(block_vals[a_id]);
+      }
+    }
+
+    cs_all_to_all_destroy(&d);
+
+  }
+
+  BFT_FREE(block_vals);
+
+  _sync_cell_arrays(m, n_arrays, arrays);
+
+  return true;
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------
+ * Update field value pointers and reinitialize fields which are not
+ * remapped (interior faces, vertices, and other locations).
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_fields(void)
+{
+  const int n_fields = cs_field_n_fields();
+
+  for (int f_id = 0; f_id < n_fields; f_id++) {
+
+    cs_field_t *f = cs_field_by_id(f_id);
+
+    if (   f->location_id != CS_MESH_LOCATION_CELLS
+        && f->location_id != CS_MESH_LOCATION_BOUNDARY_FACES
+        && f->location_id != CS_MESH_LOCATION_NONE
+        && f->is_owner) {
+
+      cs_field_allocate_values(f);
+
+      for (int kk = 0; kk < f->n_time_vals; kk++) {
+        const cs_lnum_t *n_elts
+          = cs_mesh_location_get_n_elts(f->location_id);
+        cs_real_t *v = f->vals[kk];
+        for (cs_lnum_t i = 0; i < n_elts[2]*f->dim; i++)
+          v[i] = 0.;
+      }
+
+    }
+
+    f->val = f->vals[0];
+    if (f->n_time_vals > 1)
+      f->val_pre = f->vals[1];
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Rebuild the interior mass flux associated with the velocity from
+ * the remapped velocity and density.
+ *
+ * parameters:
+ *   m   <-- pointer to mesh structure
+ *   mq  <-- pointer to mesh quantities structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_rebuild_i_mass_flux(const cs_mesh_t             *m,
+                     const cs_mesh_quantities_t  *mq)
+{
+  const cs_field_t *f_vel = cs_field_by_name_try("velocity");
+
+  if (f_vel == NULL)
+    return;
+
+  const int k_iflux = cs_field_key_id_try("inner_mass_flux_id");
+  if (k_iflux < 0)
+    return;
+
+  const int i_flux_id = cs_field_get_key_int(f_vel, k_iflux);
+  if (i_flux_id < 0)
+    return;
+
+  cs_field_t *f_flux = cs_field_by_id(i_flux_id);
+
+  const cs_field_t *f_rho = cs_field_by_name_try("density");
+  const cs_real_t ro0 = cs_glob_fluid_properties->ro0;
+
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_real_3_t *restrict i_face_normal
+    = (const cs_real_3_t *restrict)mq->i_f_face_normal;
+  const cs_real_t *restrict weight = mq->weight;
+
+  const cs_real_3_t *restrict vel = (const cs_real_3_t *restrict)f_vel->val;
+  const cs_real_t *rho = (f_rho != NULL) ? f_rho->val : NULL;
+
+  cs_real_t *restrict i_massflux = f_flux->val;
+
+# pragma omp parallel for if (n_i_faces > CS_THR_MIN)
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+
+    cs_lnum_t ii = i_face_cells[f_id][0];
+    cs_lnum_t jj = i_face_cells[f_id][1];
+
+    cs_real_t pnd = weight[f_id];
+    cs_real_t rho_i = (rho != NULL) ? rho[ii] : ro0;
+    cs_real_t rho_j = (rho != NULL) ? rho[jj] : ro0;
+
+    i_massflux[f_id] = 0.;
+    for (cs_lnum_t k = 0; k < 3; k++)
+      i_massflux[f_id] += (       pnd  * rho_i * vel[ii][k]
+                           + (1. - pnd) * rho_j * vel[jj][k])
+                          * i_face_normal[f_id][k];
+
+  }
+
+  for (int kk = 1; kk < f_flux->n_time_vals; kk++)
+    memcpy(f_flux->vals[kk], i_massflux, n_i_faces*sizeof(cs_real_t));
+}
+
+/*----------------------------------------------------------------------------
+ * Rebuild mesh-dependent structures after modification of the global mesh.
+ *
+ * Cells and boundary faces are not renumbered, so as to keep remapped
+ * values consistent; interior faces, whose values are reinitialized,
+ * are renumbered for threading.
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_mesh_structures(void)
+{
+  cs_mesh_t *m = cs_glob_mesh;
+  cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+
+  /* Update numberings */
+
+  if (m->cell_numbering == NULL)
+    m->cell_numbering = cs_numbering_create_default(m->n_cells);
+  if (m->b_face_numbering == NULL)
+    m->b_face_numbering = cs_numbering_create_default(m->n_b_faces);
+  if (m->vtx_numbering == NULL)
+    m->vtx_numbering = cs_numbering_create_default(m->n_vertices);
+
+  cs_renumber_i_faces(m);
+
+  /* Build group classes */
+
+  cs_mesh_init_group_classes(m);
+
+  /* Compute geometric quantities related to the mesh */
+
+  cs_mesh_quantities_free_all(mq);
+  cs_mesh_quantities_compute(m, mq);
+  cs_mesh_bad_cells_detect(m, mq);
+  cs_user_mesh_bad_cells_tag(m, mq);
+
+  cs_ext_neighborhood_reduce(m, mq);
+
+  /* Initialize selectors and locations for the mesh */
+
+  cs_mesh_init_selectors();
+  cs_mesh_location_build(m, -1);
+  cs_volume_zone_build_all(true);
+  cs_boundary_zone_build_all(true);
+
+  /* Update Fortran mesh sizes and quantities */
+
+  cs_preprocess_mesh_update_fortran();
+
+  /* Update mesh-related auxiliary structures */
+
+  cs_gradient_free_quantities();
+  cs_cell_to_vertex_free();
+  cs_mesh_box_index_free();
+  cs_mesh_adjacencies_update_mesh();
+
+  /* Update linear algebra APIs relative to mesh */
+
+  cs_gradient_perio_update_mesh();
+  cs_matrix_update_mesh();
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define runtime mesh adaptation.
+ *
+ * Every interval time steps, cells whose error indicator is higher than
+ * refine_threshold times the maximum indicator value are refined (up to
+ * max_level refinement levels).
+ *
+ * Unless a user indicator function is defined, the error indicator is based
+ * on the jumps of the gradient of the given field across interior faces
+ * (\ref cs_mesh_adapt_error_indicator).
+ *
+ * This function should be called during the setup stage (for example
+ * in \ref cs_user_parameters), before postprocessing meshes are defined.
+ *
+ * \param[in]  f_name             name of field used for the error indicator,
+ *                                or NULL if a user function is used
+ * \param[in]  interval           number of time steps between adaptations
+ * \param[in]  max_level          maximum cell refinement level
+ * \param[in]  refine_threshold   relative indicator threshold for refinement
+ * \param[in]  coarsen_threshold  relative indicator threshold for coarsening
+ *                                (coarsening is not available yet, so this
+ *                                must be 0 or negative)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_define(const char  *f_name,
+                     int          interval,
+                     int          max_level,
+                     double       refine_threshold,
+                     double       coarsen_threshold)
+{
+  if (_mesh_adapt == NULL) {
+
+    BFT_MALLOC(_mesh_adapt, 1, cs_mesh_adapt_t);
+
+    _mesh_adapt->rebalance = false;
+    _mesh_adapt->imbalance_threshold = 1.2;
+    _mesh_adapt->indicator_func = NULL;
+    _mesh_adapt->indicator_input = NULL;
+    _mesh_adapt->n_updates = 0;
+    _mesh_adapt->n_rebalances = 0;
+    CS_TIMER_COUNTER_INIT(_mesh_adapt->t_adapt);
+
+  }
+
+  cs_mesh_adapt_t *ma = _mesh_adapt;
+
+  ma->f_id = -1;
+  if (f_name != NULL) {
+    const cs_field_t *f = cs_field_by_name(f_name);
+    if (f->location_id != CS_MESH_LOCATION_CELLS)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Mesh adaptation indicator field \"%s\"\n"
+                  "is not defined on cells."), f->name);
+    ma->f_id = f->id;
+  }
+
+  if (coarsen_threshold > 0.)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Mesh adaptation coarsening threshold: %g\n"
+                "Coarsening is not available yet, so this threshold\n"
+                "must be 0 or negative."), coarsen_threshold);
+
+  ma->interval = CS_MAX(interval, 1);
+  ma->max_level = CS_MAX(max_level, 0);
+  ma->refine_threshold = refine_threshold;
+
+  /* Postprocessing meshes must follow connectivity changes */
+
+  cs_post_set_changing_connectivity();
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define a user error indicator function for mesh adaptation.
+ *
+ * \param[in]  func   indicator function, or NULL to use the field-based one
+ * \param[in]  input  pointer to optional (untyped) value or structure
+ *                    passed to the function
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_set_indicator(cs_mesh_adapt_indicator_t  *func,
+                            void                       *input)
+{
+  if (_mesh_adapt == NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: mesh adaptation must be defined first."), __func__);
+
+  _mesh_adapt->indicator_func = func;
+  _mesh_adapt->indicator_input = input;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set load rebalancing options for mesh adaptation.
+ *
+ * When active, the mesh is repartitioned after adaptation if the maximum
+ * number of cells on a rank exceeds the mean number of cells per rank
+ * by more than the given imbalance factor.
+ *
+ * \param[in]  rebalance            if true, rebalance mesh when needed
+ * \param[in]  imbalance_threshold  maximum to mean cell count ratio above
+ *                                  which the mesh is repartitioned
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_set_rebalance(bool    rebalance,
+                            double  imbalance_threshold)
+{
+  if (_mesh_adapt == NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: mesh adaptation must be defined first."), __func__);
+
+  _mesh_adapt->rebalance = rebalance;
+  _mesh_adapt->imbalance_threshold = CS_MAX(imbalance_threshold, 1.);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate if runtime mesh adaptation is active.
+ *
+ * \return  true if mesh adaptation is defined, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_mesh_adapt_is_active(void)
+{
+  return (_mesh_adapt != NULL) ? true : false;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check that the computation setup is compatible with runtime
+ *        mesh adaptation, if defined.
+ *
+ * Features whose data is not remapped when the mesh is modified (such as
+ * time moments, or fields not owning their values) lead to an error.
+ *
+ * This function should be called once all fields and other setup-time
+ * structures are defined, so that incompatible setups are rejected
+ * before the first time step.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_check_setup(void)
+{
+  if (_mesh_adapt != NULL)
+    _check_setup();
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute a gradient jump based error indicator for a given field.
+ *
+ * For each cell, the indicator is the maximum over its interior faces
+ * of the norm of \f$ (\grad \varia_j - \grad \varia_i) \cdot \vect{IJ} \f$.
+ * For fields without boundary condition coefficients or with
+ * dimensions other than 1 or 3, the jump of the values themselves is used.
+ *
+ * \param[in]   f    pointer to field
+ * \param[out]  eta  error indicator for each cell
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_error_indicator(const cs_field_t  *f,
+                              cs_real_t          eta[])
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *restrict)mq->cell_cen;
+
+  const int n_i_groups = m->i_face_numbering->n_groups;
+  const int n_i_threads = m->i_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
+
+  const cs_lnum_t dim = f->dim;
+
+  /* Use gradient jumps when the gradient is available,
+     value jumps otherwise */
+
+  cs_lnum_t stride = dim;
+  const cs_real_t *v = f->val;
+  cs_real_t *grad = NULL;
+
+  if (f->bc_coeffs != NULL && (dim == 1 || dim == 3)) {
+    stride = dim*3;
+    BFT_MALLOC(grad, n_cells_ext*stride, cs_real_t);
+    if (dim == 1)
+      cs_field_gradient_scalar(f, false, 1, true, (cs_real_3_t *)grad);
+    else
+      cs_field_gradient_vector(f, false, 1, (cs_real_33_t *)grad);
+    v = grad;
+  }
+
+# pragma omp parallel for if (n_cells_ext > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++)
+    eta[c_id] = 0.;
+
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+
+      for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           f_id++) {
+
+        cs_lnum_t ii = i_face_cells[f_id][0];
+        cs_lnum_t jj = i_face_cells[f_id][1];
+
+        const cs_real_t *v_i = v + ii*stride;
+        const cs_real_t *v_j = v + jj*stride;
+
+        cs_real_t jump = 0.;
+
+        if (grad != NULL) {
+          cs_real_t d_ij[3];
+          for (cs_lnum_t l = 0; l < 3; l++)
+            d_ij[l] = cell_cen[jj][l] - cell_cen[ii][l];
+          for (cs_lnum_t k = 0; k < dim; k++) {
+            cs_real_t s = 0.;
+            for (cs_lnum_t l = 0; l < 3; l++)
+              s += (v_j[k*3 + l] - v_i[k*3 + l]) * d_ij[l];
+            jump += s*s;
+          }
+        }
+        else {
+          for (cs_lnum_t k = 0; k < dim; k++)
+            jump += (v_j[k] - v_i[k]) * (v_j[k] - v_i[k]);
+        }
+
+        jump = sqrt(jump);
+
+        if (jump > eta[ii])
+          eta[ii] = jump;
+        if (jump > eta[jj])
+          eta[jj] = jump;
+
+      }
+
+    }
+
+  }
+
+  BFT_FREE(grad);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Refine flagged cells of the global mesh, and update fields
+ *        and mesh-dependent structures accordingly.
+ *
+ * Cell fields are interpolated conservatively (injection for refined cells),
+ * as are boundary face fields (boundary mass fluxes being scaled by face
+ * surfaces). Interior face fields are reinitialized, the main inner mass
+ * flux being rebuilt from the velocity and density. Vertex fields are
+ * reinitialized.
+ *
+ * \param[in]  cell_flag  adaptation flag for each cell
+ *                        (1: refine; 0: unchanged)
+ *
+ * \return  true if the mesh was modified, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_mesh_adapt_cells(const int  cell_flag[])
+{
+  cs_mesh_t *m = cs_glob_mesh;
+  cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+
+  /* The setup is checked once when adaptation is defined
+     (see cs_mesh_adapt_check_setup) */
+
+  if (_mesh_adapt == NULL)
+    _check_setup();
+
+  /* Count flagged cells */
+
+  cs_gnum_t n_g_flagged = 0;
+
+  for (cs_lnum_t i = 0; i < m->n_cells; i++) {
+    if (cell_flag[i] > 0)
+      n_g_flagged += 1;
+  }
+
+  cs_parall_counter(&n_g_flagged, 1);
+
+  if (n_g_flagged == 0)
+    return false;
+
+  int t_stat_id = cs_timer_stats_id_by_name("mesh_processing");
+  int t_top_id = cs_timer_stats_switch(t_stat_id);
+
+  cs_timer_t t0 = cs_timer_time();
+
+  cs_gnum_t n_g_cells_ini = m->n_g_cells;
+
+  int mv_save = m->verbosity;
+  m->verbosity = 0;
+
+  int n_arrays = 0;
+  cs_mesh_adapt_array_t *arrays = _remapped_arrays(&n_arrays);
+
+  /* Refinement */
+
+  const cs_lnum_t n_c_old = m->n_cells;
+  const cs_lnum_t n_b_f_old = m->n_b_faces;
+
+  int *r_flag;
+  BFT_MALLOC(r_flag, n_c_old, int);
+  for (cs_lnum_t i = 0; i < n_c_old; i++)
+    r_flag[i] = (cell_flag[i] > 0) ? 1 : 0;
+
+  cs_real_t *b_f_surf_o;
+  BFT_MALLOC(b_f_surf_o, n_b_f_old, cs_real_t);
+  memcpy(b_f_surf_o, mq->b_face_surf, n_b_f_old*sizeof(cs_real_t));
+
+  cs_lnum_t *c_o2n_idx = NULL, *b_f_o2n_idx = NULL;
+  cs_mesh_refine_simple_o2n(m, true, r_flag, &c_o2n_idx, &b_f_o2n_idx);
+
+  _remap_refined(m, n_arrays, arrays,
+                 n_c_old, c_o2n_idx,
+                 n_b_f_old, b_f_o2n_idx, b_f_surf_o);
+
+  BFT_FREE(b_f_o2n_idx);
+  BFT_FREE(c_o2n_idx);
+  BFT_FREE(b_f_surf_o);
+  BFT_FREE(r_flag);
+
+  /* Optional load rebalancing */
+
+  bool rebalanced = false;
+
+#if defined(HAVE_MPI)
+  if (_mesh_adapt != NULL && _mesh_adapt->rebalance)
+    rebalanced = _rebalance(m,
+                            _mesh_adapt->imbalance_threshold,
+                            n_arrays,
+                            arrays);
+#endif
+
+  BFT_FREE(arrays);
+
+  m->verbosity = mv_save;
+
+  /* Rebuild mesh-dependent structures and update fields */
+
+  _update_mesh_structures();
+
+  _update_fields();
+
+  _rebuild_i_mass_flux(m, mq);
+
+  cs_timer_t t1 = cs_timer_time();
+
+  if (_mesh_adapt != NULL) {
+    _mesh_adapt->n_updates += 1;
+    if (rebalanced)
+      _mesh_adapt->n_rebalances += 1;
+    cs_timer_counter_add_diff(&(_mesh_adapt->t_adapt), &t0, &t1);
+  }
+
+  cs_log_printf(CS_LOG_DEFAULT,
+                _("\n"
+                  " Mesh adaptation: %llu cells refined\n"
+                  "   number of cells: %llu -> %llu%s (%.3g s)\n"),
+                (unsigned long long)n_g_flagged,
+                (unsigned long long)n_g_cells_ini,
+                (unsigned long long)m->n_g_cells,
+                (rebalanced) ? _(", rebalanced") : "",
+                (double)(t1.wall_nsec - t0.wall_nsec)*1.e-9
+                + (double)(t1.wall_sec - t0.wall_sec));
+
+  cs_timer_stats_switch(t_top_id);
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Adapt the global mesh if required at the current time step.
+ *
+ * \return  true if the mesh was modified, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_mesh_adapt_update(void)
+{
+  cs_mesh_adapt_t *ma = _mesh_adapt;
+
+  if (ma == NULL)
+    return false;
+
+  const cs_time_step_t *ts = cs_glob_time_step;
+
+  if (ts->nt_cur <= ts->nt_prev || ts->nt_cur % ma->interval != 0)
+    return false;
+
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_t n_cells = m->n_cells;
+
+  /* Compute error indicator */
+
+  cs_real_t *eta;
+  BFT_MALLOC(eta, m->n_cells_with_ghosts, cs_real_t);
+
+  if (ma->indicator_func != NULL)
+    ma->indicator_func(ma->indicator_input, eta);
+  else if (ma->f_id > -1)
+    cs_mesh_adapt_error_indicator(cs_field_by_id(ma->f_id), eta);
+  else
+    bft_error(__FILE__, __LINE__, 0,
+              _("Mesh adaptation is defined with neither\n"
+                "an indicator field nor an indicator function."));
+
+  cs_real_t eta_max = 0.;
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    eta_max = CS_MAX(eta_max, eta[i]);
+
+  cs_parall_max(1, CS_REAL_TYPE, &eta_max);
+
+  if (eta_max <= 0.) {
+    BFT_FREE(eta);
+    return false;
+  }
+
+  /* Flag cells */
+
+  int *level, *cell_flag;
+  BFT_MALLOC(level, n_cells, int);
+  BFT_MALLOC(cell_flag, n_cells, int);
+
+  _cell_r_level(m, level);
+
+  const cs_real_t r_threshold = ma->refine_threshold * eta_max;
+
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    cell_flag[i] = 0;
+    if (eta[i] > r_threshold && level[i] < ma->max_level)
+      cell_flag[i] = 1;
+  }
+
+  BFT_FREE(level);
+  BFT_FREE(eta);
+
+  bool modified = cs_mesh_adapt_cells(cell_flag);
+
+  BFT_FREE(cell_flag);
+
+  return modified;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free mesh adaptation structures and log statistics.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_finalize(void)
+{
+  if (_mesh_adapt == NULL)
+    return;
+
+  cs_mesh_adapt_t *ma = _mesh_adapt;
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\nRuntime mesh adaptation:\n\n"
+                  "  Number of mesh modifications:     %d\n"
+                  "  Number of repartitionings:        %d\n"
+                  "  Elapsed time:                     %.3g\n"),
+                ma->n_updates,
+                ma->n_rebalances,
+                (double)(ma->t_adapt.wall_nsec*1.e-9));
+  cs_log_separator(CS_LOG_PERFORMANCE);
+
+  BFT_FREE(_mesh_adapt);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,233 @@
+#ifndef __CS_MESH_ADAPT_H__
+#define __CS_MESH_ADAPT_H__
+
+/*============================================================================
+ * Runtime mesh adaptation (refinement and coarsening of flagged cells).
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_field.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Local Macro definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Function pointer for user-defined error indicator.
+ *
+ * Note: if the input pointer is non-NULL, it must point to valid data
+ * when the indicator function is called, so either:
+ * - that value or structure should not be temporary (i.e. local);
+ * - post-processing output must be ensured using cs_post_write_var()
+ *   or similar before the data pointed to goes out of scope.
+ *
+ * \param[in, out]  input  pointer to optional (untyped) value or structure
+ * \param[out]      eta    error indicator for each cell
+ */
+/*----------------------------------------------------------------------------*/
+
+typedef void
+(cs_mesh_adapt_indicator_t) (void       *input,
+                             cs_real_t   eta[]);
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define runtime mesh adaptation.
+ *
+ * Every interval time steps, cells whose error indicator is higher than
+ * refine_threshold times the maximum indicator value are refined (up to
+ * max_level refinement levels).
+ *
+ * Unless a user indicator function is defined, the error indicator is based
+ * on the jumps of the gradient of the given field across interior faces
+ * (\ref cs_mesh_adapt_error_indicator).
+ *
+ * This function should be called during the setup stage (for example
+ * in \ref cs_user_parameters), before postprocessing meshes are defined.
+ *
+ * \param[in]  f_name             name of field used for the error indicator,
+ *                                or NULL if a user function is used
+ * \param[in]  interval           number of time steps between adaptations
+ * \param[in]  max_level          maximum cell refinement level
+ * \param[in]  refine_threshold   relative indicator threshold for refinement
+ * \param[in]  coarsen_threshold  relative indicator threshold for coarsening
+ *                                (coarsening is not available yet, so this
+ *                                must be 0 or negative)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_define(const char  *f_name,
+                     int          interval,
+                     int          max_level,
+                     double       refine_threshold,
+                     double       coarsen_threshold);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define a user error indicator function for mesh adaptation.
+ *
+ * \param[in]  func   indicator function, or NULL to use the field-based one
+ * \param[in]  input  pointer to optional (untyped) value or structure
+ *                    passed to the function
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_set_indicator(cs_mesh_adapt_indicator_t  *func,
+                            void                       *input);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set load rebalancing options for mesh adaptation.
+ *
+ * When active, the mesh is repartitioned after adaptation if the maximum
+ * number of cells on a rank exceeds the mean number of cells per rank
+ * by more than the given imbalance factor.
+ *
+ * \param[in]  rebalance            if true, rebalance mesh when needed
+ * \param[in]  imbalance_threshold  maximum to mean cell count ratio above
+ *                                  which the mesh is repartitioned
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_set_rebalance(bool    rebalance,
+                            double  imbalance_threshold);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate if runtime mesh adaptation is active.
+ *
+ * \return  true if mesh adaptation is defined, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_mesh_adapt_is_active(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check that the computation setup is compatible with runtime
+ *        mesh adaptation, if defined.
+ *
+ * Features whose data is not remapped when the mesh is modified (such as
+ * time moments, or fields not owning their values) lead to an error.
+ *
+ * This function should be called once all fields and other setup-time
+ * structures are defined, so that incompatible setups are rejected
+ * before the first time step.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_check_setup(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute a gradient jump based error indicator for a given field.
+ *
+ * For each cell, the indicator is the maximum over its interior faces
+ * of the norm of \f$ (\grad \varia_j - \grad \varia_i) \cdot \vect{IJ} \f$.
+ * For fields without boundary condition coefficients or with
+ * dimensions other than 1 or 3, the jump of the values themselves is used.
+ *
+ * \param[in]   f    pointer to field
+ * \param[out]  eta  error indicator for each cell
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_error_indicator(const cs_field_t  *f,
+                              cs_real_t          eta[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Refine flagged cells of the global mesh, and update fields
+ *        and mesh-dependent structures accordingly.
+ *
+ * Cell fields are interpolated conservatively (injection for refined cells),
+ * as are boundary face fields (boundary mass fluxes being scaled by face
+ * surfaces). Interior face fields are reinitialized, the main inner mass
+ * flux being rebuilt from the velocity and density. Vertex fields are
+ * reinitialized.
+ *
+ * \param[in]  cell_flag  adaptation flag for each cell
+ *                        (1: refine; 0: unchanged)
+ *
+ * \return  true if the mesh was modified, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_mesh_adapt_cells(const int  cell_flag[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Adapt the global mesh if required at the current time step.
+ *
+ * \return  true if the mesh was modified, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_mesh_adapt_update(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free mesh adaptation structures and log statistics.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_finalize(void);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_MESH_ADAPT_H__ */
@@ -643,6 +643,116 @@ cs_numbering_destroy(cs_numbering_t  **numbering)
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Initialize an array using the same static thread partition as
+ *        loops on the associated elements.
+ *
+ * With OpenMP, memory pages are usually placed on the NUMA domain of the
+ * thread which first touches them. Initializing arrays with the same
+ * partition as later computation loops thus helps ensure the memory is
+ * local to the threads operating on it.
+ *
+ * For a threaded numbering, each thread initializes the elements of all
+ * its groups, as in loops on thread groups. Otherwise, elements are
+ * initialized using a static partition, as with "omp parallel for" loops
+ * on elements. Elements beyond those defined by the numbering (such as
+ * ghost cells) are initialized using a static partition of their own.
+ * If the numbering does not match the number of elements, it is ignored.
+ *
+ * \param[in]   numbering  pointer to associated numbering, or NULL
+ * \param[in]   n_elts     number of elements
+ * \param[in]   elt_size   size of each element, in bytes
+ * \param[in]   src        values to copy, or NULL to initialize to zero
+ * \param[out]  dest       array to initialize (size: n_elts*elt_size bytes)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_numbering_first_touch(const cs_numbering_t  *numbering,
+                         cs_lnum_t              n_elts,
+                         size_t                 elt_size,
+                         const void            *src,
+                         void                  *dest)
+{
+  if (n_elts < 1 || dest == NULL)
+    return;
+
+  const unsigned char *_src = src;
+  unsigned char *_dest = dest;
+
+  cs_lnum_t s_id = 0;
+
+  if (numbering != NULL) {
+
+    const int n_threads = numbering->n_threads;
+    const int n_groups = numbering->n_groups;
+    const cs_lnum_t *group_index = numbering->group_index;
+
+    cs_lnum_t n_num_elts = 0;
+    for (int i = 0; i < n_threads*n_groups; i++) {
+      if (group_index[i*2 + 1] > n_num_elts)
+        n_num_elts = group_index[i*2 + 1];
+    }
+
+    if (n_num_elts <= n_elts) {
+
+      if (numbering->type == CS_NUMBERING_THREADS && n_threads > 1) {
+
+#       pragma omp parallel for
+        for (int t_id = 0; t_id < n_threads; t_id++) {
+          for (int g_id = 0; g_id < n_groups; g_id++) {
+            cs_lnum_t b_id = group_index[(t_id*n_groups + g_id)*2];
+            cs_lnum_t e_id = group_index[(t_id*n_groups + g_id)*2 + 1];
+            if (e_id > b_id) {
+              size_t n_bytes = (size_t)(e_id - b_id)*elt_size;
+              if (_src != NULL)
+                memcpy(_dest + b_id*elt_size, _src + b_id*elt_size, n_bytes);
+              else
+                memset(_dest + b_id*elt_size, 0, n_bytes);
+            }
+          }
+        }
+
+        s_id = n_num_elts;
+
+      }
+
+      else if (n_num_elts > 0 && n_num_elts < n_elts) {
+
+        /* Partition main elements and remaining elements separately */
+
+        cs_numbering_first_touch(NULL, n_num_elts, elt_size, src, dest);
+        s_id = n_num_elts;
+
+      }
+
+    }
+
+  }
+
+  /* Static partition for remaining elements */
+
+  const cs_lnum_t n_s_elts = n_elts - s_id;
+
+  if (n_s_elts < 1)
+    return;
+
+  unsigned char *s_dest = _dest + s_id*elt_size;
+
+  if (_src != NULL) {
+    const unsigned char *s_src = _src + s_id*elt_size;
+#   pragma omp parallel for if (n_s_elts > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_s_elts; i++)
+      memcpy(s_dest + i*elt_size, s_src + i*elt_size, elt_size);
+  }
+  else {
+#   pragma omp parallel for if (n_s_elts > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_s_elts; i++)
+      memset(s_dest + i*elt_size, 0, elt_size);
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Log information relative to a cs_numbering_t structure.
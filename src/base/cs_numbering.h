@@ -182,6 +182,38 @@ cs_numbering_create_threaded(int        n_threads,
 void
 cs_numbering_destroy(cs_numbering_t  **numbering);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Initialize an array using the same static thread partition as
+ *        loops on the associated elements.
+ *
+ * With OpenMP, memory pages are usually placed on the NUMA domain of the
+ * thread which first touches them. Initializing arrays with the same
+ * partition as later computation loops thus helps ensure the memory is
+ * local to the threads operating on it.
+ *
+ * For a threaded numbering, each thread initializes the elements of all
+ * its groups, as in loops on thread groups. Otherwise, elements are
+ * initialized using a static partition, as with "omp parallel for" loops
+ * on elements. Elements beyond those defined by the numbering (such as
+ * ghost cells) are initialized using a static partition of their own.
+ * If the numbering does not match the number of elements, it is ignored.
+ *
+ * \param[in]   numbering  pointer to associated numbering, or NULL
+ * \param[in]   n_elts     number of elements
+ * \param[in]   elt_size   size of each element, in bytes
+ * \param[in]   src        values to copy, or NULL to initialize to zero
+ * \param[out]  dest       array to initialize (size: n_elts*elt_size bytes)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_numbering_first_touch(const cs_numbering_t  *numbering,
+                         cs_lnum_t              n_elts,
+                         size_t                 elt_size,
+                         const void            *src,
+                         void                  *dest);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Log information relative to a cs_numbering_t structure.
@@ -45,6 +45,12 @@
 #include "bft_mem.h"
 #include "bft_printf.h"
 
+#include "cs_base.h"
+#include "cs_file.h"
+#include "cs_log.h"
+#include "cs_parall.h"
+#include "cs_timer.h"
+
 /*----------------------------------------------------------------------------
  *  Header for the current file
  *----------------------------------------------------------------------------*/
@@ -89,6 +95,18 @@ BEGIN_C_DECLS
 
 #define DIR_SEPARATOR '/'
 
+/* Number of property types */
+
+#define CS_PHYS_PROP_N_TYPES (CS_PHYS_PROP_SPEED_OF_SOUND + 1)
+
+/* Initial number of nodes per axis for property tables */
+
+#define CS_PHYS_PROP_TABLE_N_INIT 9
+
+/* Maximum number of threshold doublings when selecting intervals to refine */
+
+#define CS_PHYS_PROP_TABLE_N_THRESHOLD_MAX 128
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
@@ -114,6 +132,41 @@ typedef struct {
 
 } cs_thermal_table_t;
 
+/* Property interpolation table structure.
+
+   Nodes are defined on a tensor product of (non-uniform) axes in the
+   thermodynamic plane; for each node, the value, first derivatives and
+   cross derivative are stored, allowing bicubic Hermite interpolation. */
+
+typedef struct {
+
+  int          n_nodes[2];           /* number of nodes on each axis */
+  cs_real_t   *x[2];                 /* node coordinates on each axis */
+  cs_real_t   *c;                    /* value, d/dvar1, d/dvar2 and
+                                        d2/dvar1dvar2 at each node
+                                        (interleaved, var1 major) */
+
+  double       abs_err;              /* estimated max. absolute error */
+  double       rel_err;              /* estimated max. relative error */
+
+} cs_phys_prop_table_t;
+
+/* Property table cache file header */
+
+typedef struct {
+
+  char         magic[32];            /* file type and version */
+  char         material[64];         /* material name */
+  char         method[64];           /* method name */
+  int          thermo_plane;         /* thermodynamic plane */
+  int          property;             /* property type */
+  int          n_max;                /* maximum number of nodes per axis */
+  int          n_nodes[2];           /* number of nodes on each axis */
+  double       range[4];             /* var1 and var2 ranges */
+  double       tolerance;            /* relative tolerance */
+
+} cs_phys_prop_table_header_t;
+
 /*----------------------------------------------------------------------------
  * Function pointer types
  *----------------------------------------------------------------------------*/
@@ -148,6 +201,28 @@ typedef void
 
 cs_thermal_table_t *cs_glob_thermal_table = NULL;
 
+static cs_phys_prop_table_t  *_phys_prop_tables[CS_PHYS_PROP_N_TYPES];
+static bool                   _phys_prop_tables_init = false;
+
+static const char *_phys_prop_name[] = {N_("pressure"),
+                                        N_("temperature"),
+                                        N_("enthalpy"),
+                                        N_("entropy"),
+                                        N_("isobaric heat capacity"),
+                                        N_("isochoric heat capacity"),
+                                        N_("specific volume"),
+                                        N_("density"),
+                                        N_("internal energy"),
+                                        N_("quality"),
+                                        N_("thermal conductivity"),
+                                        N_("dynamic viscosity"),
+                                        N_("speed of sound")};
+
+static const char *_thermo_plane_name[] = {"ph", "pT", "ps", "pu",
+                                           "pv", "Ts", "Tx"};
+
+static const char _table_magic[] = "code_saturne property table 1.0";
+
 #if defined(HAVE_DLOPEN) && defined(HAVE_EOS)
 
 static void                     *_cs_eos_dl_lib = NULL;
@@ -186,6 +261,917 @@ _thermal_table_create(void)
   return tt;
 }
 
+/*----------------------------------------------------------------------------
+ * Compute a physical property using the thermal table's backend.
+ *
+ * parameters:
+ *   property <-- property queried
+ *   n_vals   <-- number of values
+ *   var1     <-- values on first plane axis
+ *   var2     <-- values on second plane axis
+ *   val      --> resulting property values
+ *----------------------------------------------------------------------------*/
+
+static void
+_compute_backend(cs_phys_prop_type_t   property,
+                 cs_lnum_t             n_vals,
+                 const cs_real_t       var1[],
+                 const cs_real_t       var2[],
+                 cs_real_t             val[])
+{
+  if (cs_glob_thermal_table->type == 1) {
+    cs_phys_prop_freesteam(cs_glob_thermal_table->thermo_plane,
+                           property,
+                           n_vals,
+                           var1,
+                           var2,
+                           val);
+  }
+#if defined(HAVE_EOS)
+  else if (cs_glob_thermal_table->type == 2) {
+    _cs_phys_prop_eos(cs_glob_thermal_table->thermo_plane,
+                      property,
+                      n_vals,
+                      var1,
+                      var2,
+                      val);
+  }
+#endif
+#if defined(HAVE_COOLPROP)
+  else if (cs_glob_thermal_table->type == 3) {
+    _cs_phys_prop_coolprop(cs_glob_thermal_table->material,
+                           cs_glob_thermal_table->thermo_plane,
+                           property,
+                           n_vals,
+                           var1,
+                           var2,
+                           val);
+  }
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Compute a physical property using the thermal table's backend,
+ * with values distributed across ranks.
+ *
+ * This function is collective, and all ranks must provide the same
+ * input values; all ranks obtain the same resulting values.
+ *
+ * parameters:
+ *   property <-- property queried
+ *   n_vals   <-- number of values
+ *   var1     <-- values on first plane axis
+ *   var2     <-- values on second plane axis
+ *   val      --> resulting property values
+ *----------------------------------------------------------------------------*/
+
+static void
+_compute_backend_distributed(cs_phys_prop_type_t   property,
+                             cs_lnum_t             n_vals,
+                             const cs_real_t       var1[],
+                             const cs_real_t       var2[],
+                             cs_real_t             val[])
+{
+  if (cs_glob_n_ranks < 2) {
+    _compute_backend(property, n_vals, var1, var2, val);
+    return;
+  }
+
+  const int rank_id = cs_glob_rank_id, n_ranks = cs_glob_n_ranks;
+
+  cs_lnum_t s_id = ((cs_gnum_t)n_vals * rank_id) / n_ranks;
+  cs_lnum_t e_id = ((cs_gnum_t)n_vals * (rank_id+1)) / n_ranks;
+
+  cs_real_t *l_val;
+  BFT_MALLOC(l_val, e_id - s_id + 1, cs_real_t);
+
+  if (e_id > s_id)
+    _compute_backend(property, e_id - s_id, var1 + s_id, var2 + s_id, l_val);
+
+  cs_parall_allgather_r(e_id - s_id, n_vals, l_val, val);
+
+  BFT_FREE(l_val);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute derivatives of a function sampled on a (non-uniform) axis.
+ *
+ * Second order centered differences are used for interior nodes,
+ * and first order differences for end nodes.
+ *
+ * parameters:
+ *   n      <-- number of nodes
+ *   x      <-- node coordinates
+ *   stride <-- stride between successive values in f and df
+ *   f      <-- function values
+ *   df     --> function derivatives
+ *----------------------------------------------------------------------------*/
+
+static void
+_table_derivative(int               n,
+                  const cs_real_t   x[],
+                  cs_lnum_t         stride,
+                  const cs_real_t   f[],
+                  cs_real_t         df[])
+{
+  if (n < 2) {
+    df[0] = 0.;
+    return;
+  }
+
+  df[0] = (f[stride] - f[0]) / (x[1] - x[0]);
+  df[(n-1)*stride] =   (f[(n-1)*stride] - f[(n-2)*stride])
+                     / (x[n-1] - x[n-2]);
+
+  for (int i = 1; i < n-1; i++) {
+    double h0 = x[i] - x[i-1], h1 = x[i+1] - x[i];
+    df[i*stride] = (  h0*h0*(f[(i+1)*stride] - f[i*stride])
+                    + h1*h1*(f[i*stride] - f[(i-1)*stride]))
+                   / (h0*h1*(h0 + h1));
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Compute derivatives at table nodes, based on node values.
+ *
+ * parameters:
+ *   t <-> pointer to property table
+ *----------------------------------------------------------------------------*/
+
+static void
+_table_compute_derivatives(cs_phys_prop_table_t  *t)
+{
+  const int n1 = t->n_nodes[0], n2 = t->n_nodes[1];
+
+  for (int j = 0; j < n2; j++) {
+    _table_derivative(n1, t->x[0], 4*n2, t->c + 4*j, t->c + 4*j + 1);
+  }
+  for (int i = 0; i < n1; i++)
+    _table_derivative(n2, t->x[1], 4, t->c + 4*n2*i, t->c + 4*n2*i + 2);
+  for (int j = 0; j < n2; j++)
+    _table_derivative(n1, t->x[0], 4*n2, t->c + 4*j + 2, t->c + 4*j + 3);
+}
+
+/*----------------------------------------------------------------------------
+ * Find the interval of an axis containing a given value.
+ *
+ * parameters:
+ *   n <-- number of nodes
+ *   x <-- node coordinates
+ *   v <-- value, assumed to be in range [x[0], x[n-1]]
+ *
+ * returns:
+ *   id i of interval such that x[i] <= v <= x[i+1]
+ *----------------------------------------------------------------------------*/
+
+static inline int
+_table_interval(int               n,
+                const cs_real_t   x[],
+                cs_real_t         v)
+{
+  int s_id = 0, e_id = n-1;
+
+  while (e_id - s_id > 1) {
+    int m_id = (s_id + e_id) / 2;
+    if (v < x[m_id])
+      e_id = m_id;
+    else
+      s_id = m_id;
+  }
+
+  return s_id;
+}
+
+/*----------------------------------------------------------------------------
+ * Interpolate a property value in a table cell using bicubic Hermite
+ * interpolation.
+ *
+ * parameters:
+ *   t  <-- pointer to property table
+ *   i  <-- cell id on first axis
+ *   j  <-- cell id on second axis
+ *   v1 <-- value on first plane axis
+ *   v2 <-- value on second plane axis
+ *
+ * returns:
+ *   interpolated value
+ *----------------------------------------------------------------------------*/
+
+static inline cs_real_t
+_table_interpolate(const cs_phys_prop_table_t  *t,
+                   int                          i,
+                   int                          j,
+                   cs_real_t                    v1,
+                   cs_real_t                    v2)
+{
+  const int n2 = t->n_nodes[1];
+
+  const double h1 = t->x[0][i+1] - t->x[0][i];
+  const double h2 = t->x[1][j+1] - t->x[1][j];
+  const double s = (v1 - t->x[0][i]) / h1;
+  const double u = (v2 - t->x[1][j]) / h2;
+
+  const double s2 = s*s, s3 = s2*s, u2 = u*u, u3 = u2*u;
+
+  /* Hermite basis functions for values (p0, q0) and slopes (p1, q1) */
+
+  const double p0[2] = {2*s3 - 3*s2 + 1, -2*s3 + 3*s2};
+  const double p1[2] = {(s3 - 2*s2 + s)*h1, (s3 - s2)*h1};
+  const double q0[2] = {2*u3 - 3*u2 + 1, -2*u3 + 3*u2};
+  const double q1[2] = {(u3 - 2*u2 + u)*h2, (u3 - u2)*h2};
+
+  cs_real_t f = 0.;
+
+  for (int a = 0; a < 2; a++) {
+    for (int b = 0; b < 2; b++) {
+      const cs_real_t *c = t->c + 4*((i+a)*n2 + j+b);
+      f +=   p0[a]*q0[b]*c[0] + p1[a]*q0[b]*c[1]
+           + p0[a]*q1[b]*c[2] + p1[a]*q1[b]*c[3];
+    }
+  }
+
+  return f;
+}
+
+/*----------------------------------------------------------------------------
+ * Evaluate interpolation error at table cell centers.
+ *
+ * parameters:
+ *   t         <-> pointer to property table (error estimates updated)
+ *   property  <-- property type
+ *   cell_err  --> relative error for each cell, or NULL
+ *----------------------------------------------------------------------------*/
+
+static void
+_table_error(cs_phys_prop_table_t  *t,
+             cs_phys_prop_type_t    property,
+             cs_real_t              cell_err[])
+{
+  const int n1 = t->n_nodes[0], n2 = t->n_nodes[1];
+  const cs_lnum_t n_cells = (cs_lnum_t)(n1-1)*(n2-1);
+
+  cs_real_t *v1, *v2, *f;
+  BFT_MALLOC(v1, n_cells, cs_real_t);
+  BFT_MALLOC(v2, n_cells, cs_real_t);
+  BFT_MALLOC(f, n_cells, cs_real_t);
+
+  for (int i = 0; i < n1-1; i++) {
+    for (int j = 0; j < n2-1; j++) {
+      cs_lnum_t k = (cs_lnum_t)i*(n2-1) + j;
+      v1[k] = 0.5*(t->x[0][i] + t->x[0][i+1]);
+      v2[k] = 0.5*(t->x[1][j] + t->x[1][j+1]);
+    }
+  }
+
+  _compute_backend_distributed(property, n_cells, v1, v2, f);
+
+  /* Scale relative error by a fraction of the maximum value so as
+     to avoid overestimation near zero crossings */
+
+  double f_max = 0.;
+  for (cs_lnum_t k = 0; k < (cs_lnum_t)n1*n2; k++)
+    f_max = CS_MAX(f_max, fabs(t->c[4*k]));
+  const double f_min = CS_MAX(1e-6*f_max, 1e-300);
+
+  t->abs_err = 0.;
+  t->rel_err = 0.;
+
+  for (int i = 0; i < n1-1; i++) {
+    for (int j = 0; j < n2-1; j++) {
+      cs_lnum_t k = (cs_lnum_t)i*(n2-1) + j;
+      double d = fabs(_table_interpolate(t, i, j, v1[k], v2[k]) - f[k]);
+      double r = d / CS_MAX(fabs(f[k]), f_min);
+      t->abs_err = CS_MAX(t->abs_err, d);
+      t->rel_err = CS_MAX(t->rel_err, r);
+      if (cell_err != NULL)
+        cell_err[k] = r;
+    }
+  }
+
+  BFT_FREE(f);
+  BFT_FREE(v2);
+  BFT_FREE(v1);
+}
+
+/*----------------------------------------------------------------------------
+ * Select intervals of an axis to refine.
+ *
+ * Intervals whose error exceeds the tolerance are selected, with a
+ * threshold raised if needed so that the number of nodes does not
+ * exceed the allowed maximum. If no threshold is found after
+ * CS_PHYS_PROP_TABLE_N_THRESHOLD_MAX increases (which may only occur with
+ * non-finite errors), no interval is selected.
+ *
+ * parameters:
+ *   n_intervals <-- number of intervals
+ *   n_max_add   <-- maximum number of added nodes
+ *   tolerance   <-- relative tolerance
+ *   err         <-- maximum error for each interval
+ *   refine      --> refinement flag for each interval
+ *
+ * returns:
+ *   number of intervals to refine
+ *----------------------------------------------------------------------------*/
+
+static int
+_table_select_refine(int               n_intervals,
+                     int               n_max_add,
+                     double            tolerance,
+                     const cs_real_t   err[],
+                     bool              refine[])
+{
+  int n_refine = 0;
+  double threshold = tolerance;
+
+  assert(tolerance > 0);
+
+  for (int it = 0; it < CS_PHYS_PROP_TABLE_N_THRESHOLD_MAX; it++) {
+    n_refine = 0;
+    for (int i = 0; i < n_intervals; i++) {
+      refine[i] = (err[i] > threshold) ? true : false;
+      if (refine[i])
+        n_refine++;
+    }
+    if (n_refine <= n_max_add)
+      return n_refine;
+    threshold *= 2;
+  }
+
+  for (int i = 0; i < n_intervals; i++)
+    refine[i] = false;
+
+  return 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Build a property table by adaptive refinement.
+ *
+ * Starting from a coarse uniform grid, intervals for which the estimated
+ * interpolation error at cell centers exceeds the tolerance are split,
+ * until the tolerance is met or the maximum number of nodes is reached.
+ *
+ * parameters:
+ *   property   <-- property type
+ *   range      <-- var1 and var2 ranges
+ *   n_max      <-- maximum number of nodes per axis
+ *   tolerance  <-- relative tolerance
+ *
+ * returns:
+ *   pointer to new property table
+ *----------------------------------------------------------------------------*/
+
+static cs_phys_prop_table_t *
+_table_build(cs_phys_prop_type_t  property,
+             const double         range[4],
+             int                  n_max,
+             double               tolerance)
+{
+  cs_phys_prop_table_t *t;
+  BFT_MALLOC(t, 1, cs_phys_prop_table_t);
+
+  /* Initial uniform grid */
+
+  for (int k = 0; k < 2; k++) {
+    int n = CS_MIN(CS_PHYS_PROP_TABLE_N_INIT, n_max);
+    t->n_nodes[k] = n;
+    BFT_MALLOC(t->x[k], n, cs_real_t);
+    for (int i = 0; i < n; i++)
+      t->x[k][i] = range[2*k] + (range[2*k+1] - range[2*k]) * i / (n-1);
+  }
+
+  int n1 = t->n_nodes[0], n2 = t->n_nodes[1];
+
+  BFT_MALLOC(t->c, 4*n1*n2, cs_real_t);
+
+  {
+    cs_real_t *v1, *v2, *f;
+    BFT_MALLOC(v1, n1*n2, cs_real_t);
+    BFT_MALLOC(v2, n1*n2, cs_real_t);
+    BFT_MALLOC(f, n1*n2, cs_real_t);
+    for (int i = 0; i < n1; i++) {
+      for (int j = 0; j < n2; j++) {
+        v1[i*n2 + j] = t->x[0][i];
+        v2[i*n2 + j] = t->x[1][j];
+      }
+    }
+    _compute_backend_distributed(property, n1*n2, v1, v2, f);
+    for (int k = 0; k < n1*n2; k++)
+      t->c[4*k] = f[k];
+    BFT_FREE(f);
+    BFT_FREE(v2);
+    BFT_FREE(v1);
+  }
+
+  /* Refinement loop */
+
+  while (true) {
+
+    _table_compute_derivatives(t);
+
+    cs_real_t *cell_err, *err[2];
+    bool *refine[2];
+    BFT_MALLOC(cell_err, (n1-1)*(n2-1), cs_real_t);
+
+    _table_error(t, property, cell_err);
+
+    if (t->rel_err <= tolerance) {
+      BFT_FREE(cell_err);
+      break;
+    }
+
+    for (int k = 0; k < 2; k++) {
+      int n_i = t->n_nodes[k] - 1;
+      BFT_MALLOC(err[k], n_i, cs_real_t);
+      BFT_MALLOC(refine[k], n_i, bool);
+      for (int i = 0; i < n_i; i++)
+        err[k][i] = 0.;
+    }
+
+    for (int i = 0; i < n1-1; i++) {
+      for (int j = 0; j < n2-1; j++) {
+        double e = cell_err[i*(n2-1) + j];
+        err[0][i] = CS_MAX(err[0][i], e);
+        err[1][j] = CS_MAX(err[1][j], e);
+      }
+    }
+
+    BFT_FREE(cell_err);
+
+    int n_refine[2];
+    for (int k = 0; k < 2; k++)
+      n_refine[k] = _table_select_refine(t->n_nodes[k] - 1,
+                                         n_max - t->n_nodes[k],
+                                         tolerance,
+                                         err[k],
+                                         refine[k]);
+
+    if (n_refine[0] + n_refine[1] == 0) {
+      for (int k = 0; k < 2; k++) {
+        BFT_FREE(err[k]);
+        BFT_FREE(refine[k]);
+      }
+      break;
+    }
+
+    /* Build refined axes, with mapping from old to new node ids */
+
+    int *o2n[2];
+    cs_real_t *x[2];
+
+    for (int k = 0; k < 2; k++) {
+      int n = t->n_nodes[k];
+      BFT_MALLOC(o2n[k], n, int);
+      BFT_MALLOC(x[k], n + n_refine[k], cs_real_t);
+      int l = 0;
+      for (int i = 0; i < n; i++) {
+        o2n[k][i] = l;
+        x[k][l++] = t->x[k][i];
+        if (i < n-1) {
+          if (refine[k][i])
+            x[k][l++] = 0.5*(t->x[k][i] + t->x[k][i+1]);
+        }
+      }
+      BFT_FREE(err[k]);
+      BFT_FREE(refine[k]);
+    }
+
+    const int m1 = n1 + n_refine[0], m2 = n2 + n_refine[1];
+
+    cs_real_t *c;
+    bool *is_old;
+    BFT_MALLOC(c, 4*m1*m2, cs_real_t);
+    BFT_MALLOC(is_old, m1*m2, bool);
+
+    for (int k = 0; k < m1*m2; k++)
+      is_old[k] = false;
+
+    for (int i = 0; i < n1; i++) {
+      for (int j = 0; j < n2; j++) {
+        int k = o2n[0][i]*m2 + o2n[1][j];
+        c[4*k] = t->c[4*(i*n2 + j)];
+        is_old[k] = true;
+      }
+    }
+
+    /* Evaluate new nodes */
+
+    int n_new = m1*m2 - n1*n2;
+
+    cs_real_t *v1, *v2, *f;
+    BFT_MALLOC(v1, n_new, cs_real_t);
+    BFT_MALLOC(v2, n_new, cs_real_t);
+    BFT_MALLOC(f, n_new, cs_real_t);
+
+    n_new = 0;
+    for (int i = 0; i < m1; i++) {
+      for (int j = 0; j < m2; j++) {
+        if (! is_old[i*m2 + j]) {
+          v1[n_new] = x[0][i];
+          v2[n_new] = x[1][j];
+          n_new++;
+        }
+      }
+    }
+
+    _compute_backend_distributed(property, n_new, v1, v2, f);
+
+    n_new = 0;
+    for (int k = 0; k < m1*m2; k++) {
+      if (! is_old[k])
+        c[4*k] = f[n_new++];
+    }
+
+    BFT_FREE(f);
+    BFT_FREE(v2);
+    BFT_FREE(v1);
+    BFT_FREE(is_old);
+
+    for (int k = 0; k < 2; k++) {
+      BFT_FREE(o2n[k]);
+      BFT_FREE(t->x[k]);
+      t->x[k] = x[k];
+    }
+    BFT_FREE(t->c);
+    t->c = c;
+
+    t->n_nodes[0] = m1;
+    t->n_nodes[1] = m2;
+    n1 = m1;
+    n2 = m2;
+
+  }
+
+  return t;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy a property table.
+ *
+ * parameters:
+ *   t <-> pointer to property table
+ *----------------------------------------------------------------------------*/
+
+static void
+_table_destroy(cs_phys_prop_table_t  **t)
+{
+  cs_phys_prop_table_t *_t = *t;
+
+  if (_t != NULL) {
+    BFT_FREE(_t->x[0]);
+    BFT_FREE(_t->x[1]);
+    BFT_FREE(_t->c);
+    BFT_FREE(*t);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy all property tables.
+ *----------------------------------------------------------------------------*/
+
+static void
+_tables_destroy(void)
+{
+  if (_phys_prop_tables_init) {
+    for (int i = 0; i < CS_PHYS_PROP_N_TYPES; i++)
+      _table_destroy(&(_phys_prop_tables[i]));
+    _phys_prop_tables_init = false;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Build the cache file name associated with a property table.
+ *
+ * parameters:
+ *   cache_dir <-- cache directory
+ *   property  <-- property type
+ *
+ * returns:
+ *   pointer to allocated file name
+ *----------------------------------------------------------------------------*/
+
+static char *
+_table_cache_file_name(const char           *cache_dir,
+                       cs_phys_prop_type_t   property)
+{
+  const cs_thermal_table_t *tt = cs_glob_thermal_table;
+
+  char *file_name = NULL;
+  size_t l =   strlen(cache_dir) + strlen(tt->material)
+             + strlen(tt->method) + 64;
+
+  BFT_MALLOC(file_name, l, char);
+
+  snprintf(file_name, l, "%s%c%s_%s_%s_%d.table",
+           cache_dir, DIR_SEPARATOR, tt->material, tt->method,
+           _thermo_plane_name[tt->thermo_plane], (int)property);
+  file_name[l-1] = '\0';
+
+  /* Replace characters which are not safe for file names */
+
+  for (char *p = file_name + strlen(cache_dir) + 1; *p != '\0'; p++) {
+    if (! (   (*p >= 'a' && *p <= 'z') || (*p >= 'A' && *p <= 'Z')
+           || (*p >= '0' && *p <= '9') || *p == '.' || *p == '-'))
+      *p = '_';
+  }
+
+  return file_name;
+}
+
+/*----------------------------------------------------------------------------
+ * Initialize a property table cache file header.
+ *
+ * parameters:
+ *   property  <-- property type
+ *   range     <-- var1 and var2 ranges
+ *   n_max     <-- maximum number of nodes per axis
+ *   tolerance <-- relative tolerance
+ *   h         --> header
+ *----------------------------------------------------------------------------*/
+
+static void
+_table_header_init(cs_phys_prop_type_t           property,
+                   const double                  range[4],
+                   int                           n_max,
+                   double                        tolerance,
+                   cs_phys_prop_table_header_t  *h)
+{
+  const cs_thermal_table_t *tt = cs_glob_thermal_table;
+
+  memset(h, 0, sizeof(cs_phys_prop_table_header_t));
+
+  strcpy(h->magic, _table_magic);
+  strncpy(h->material, tt->material, 63);
+  strncpy(h->method, tt->method, 63);
+  h->thermo_plane = tt->thermo_plane;
+  h->property = property;
+  h->n_max = n_max;
+  for (int i = 0; i < 4; i++)
+    h->range[i] = range[i];
+  h->tolerance = tolerance;
+}
+
+/*----------------------------------------------------------------------------
+ * Check if a property table cache file header matches a reference header.
+ *
+ * Fields are compared one by one, so that structure padding is ignored;
+ * the number of nodes is not compared.
+ *
+ * parameters:
+ *   h     <-- header read from file
+ *   h_ref <-- expected header
+ *
+ * returns:
+ *   true if headers match, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_table_header_match(const cs_phys_prop_table_header_t  *h,
+                    const cs_phys_prop_table_header_t  *h_ref)
+{
+  if (   strncmp(h->magic, h_ref->magic, sizeof(h->magic)) != 0
+      || strncmp(h->material, h_ref->material, sizeof(h->material)) != 0
+      || strncmp(h->method, h_ref->method, sizeof(h->method)) != 0)
+    return false;
+
+  if (   h->thermo_plane != h_ref->thermo_plane
+      || h->property != h_ref->property
+      || h->n_max != h_ref->n_max)
+    return false;
+
+  /* Exact comparison of floating-point values */
+
+  if (   memcmp(h->range, h_ref->range, sizeof(h->range)) != 0
+      || memcmp(&(h->tolerance), &(h_ref->tolerance), sizeof(double)) != 0)
+    return false;
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Read a property table from a cache file.
+ *
+ * parameters:
+ *   file_name <-- cache file name
+ *   h_ref     <-- expected header (except for number of nodes)
+ *
+ * returns:
+ *   pointer to property table, or NULL if not available or not matching
+ *----------------------------------------------------------------------------*/
+
+static cs_phys_prop_table_t *
+_table_read(const char                         *file_name,
+            const cs_phys_prop_table_header_t  *h_ref)
+{
+  cs_phys_prop_table_t *t = NULL;
+  cs_phys_prop_table_header_t h;
+
+  FILE *f = fopen(file_name, "rb");
+  if (f == NULL)
+    return t;
+
+  size_t n_read = fread(&h, sizeof(cs_phys_prop_table_header_t), 1, f);
+
+  if (n_read == 1) {
+    int n1 = h.n_nodes[0], n2 = h.n_nodes[1];
+    if (   _table_header_match(&h, h_ref)
+        && n1 > 1 && n2 > 1 && n1 <= h.n_max && n2 <= h.n_max) {
+      BFT_MALLOC(t, 1, cs_phys_prop_table_t);
+      t->n_nodes[0] = n1;
+      t->n_nodes[1] = n2;
+      BFT_MALLOC(t->x[0], n1, cs_real_t);
+      BFT_MALLOC(t->x[1], n2, cs_real_t);
+      BFT_MALLOC(t->c, 4*n1*n2, cs_real_t);
+      size_t n_vals = 2 + n1 + n2 + 4*n1*n2;
+      n_read = 0;
+      n_read += fread(&(t->abs_err), sizeof(double), 1, f);
+      n_read += fread(&(t->rel_err), sizeof(double), 1, f);
+      n_read += fread(t->x[0], sizeof(cs_real_t), n1, f);
+      n_read += fread(t->x[1], sizeof(cs_real_t), n2, f);
+      n_read += fread(t->c, sizeof(cs_real_t), 4*n1*n2, f);
+      if (n_read != n_vals)
+        _table_destroy(&t);
+    }
+  }
+
+  fclose(f);
+
+  return t;
+}
+
+/*----------------------------------------------------------------------------
+ * Write a property table to a cache file.
+ *
+ * parameters:
+ *   file_name <-- cache file name
+ *   h_ref     <-- header (except for number of nodes)
+ *   t         <-- pointer to property table
+ *----------------------------------------------------------------------------*/
+
+static void
+_table_write(const char                         *file_name,
+             const cs_phys_prop_table_header_t  *h_ref,
+             const cs_phys_prop_table_t         *t)
+{
+  cs_phys_prop_table_header_t h = *h_ref;
+  const int n1 = t->n_nodes[0], n2 = t->n_nodes[1];
+
+  h.n_nodes[0] = n1;
+  h.n_nodes[1] = n2;
+
+  FILE *f = fopen(file_name, "wb");
+  if (f == NULL) {
+    cs_base_warn(__FILE__, __LINE__);
+    bft_printf(_("Unable to write property table cache file:\n"
+                 "  \"%s\".\n"), file_name);
+    return;
+  }
+
+  size_t n_vals = 3 + n1 + n2 + 4*n1*n2;
+  size_t n_written = 0;
+  n_written += fwrite(&h, sizeof(cs_phys_prop_table_header_t), 1, f);
+  n_written += fwrite(&(t->abs_err), sizeof(double), 1, f);
+  n_written += fwrite(&(t->rel_err), sizeof(double), 1, f);
+  n_written += fwrite(t->x[0], sizeof(cs_real_t), n1, f);
+  n_written += fwrite(t->x[1], sizeof(cs_real_t), n2, f);
+  n_written += fwrite(t->c, sizeof(cs_real_t), 4*n1*n2, f);
+
+  fclose(f);
+
+  if (n_written != n_vals) {
+    cs_base_warn(__FILE__, __LINE__);
+    bft_printf(_("Error writing property table cache file:\n"
+                 "  \"%s\".\n"), file_name);
+    remove(file_name);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Broadcast a property table from rank 0 to other ranks.
+ *
+ * parameters:
+ *   t <-> pointer to property table (NULL on input for ranks other
+ *         than 0 or if not available)
+ *
+ * returns:
+ *   pointer to property table on all ranks, or NULL if not available
+ *----------------------------------------------------------------------------*/
+
+static cs_phys_prop_table_t *
+_table_bcast(cs_phys_prop_table_t  *t)
+{
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    int n_nodes[2] = {0, 0};
+    if (t != NULL) {
+      n_nodes[0] = t->n_nodes[0];
+      n_nodes[1] = t->n_nodes[1];
+    }
+    cs_parall_bcast(0, 2, CS_INT_TYPE, n_nodes);
+
+    if (n_nodes[0] == 0)
+      return NULL;
+
+    if (cs_glob_rank_id > 0) {
+      BFT_MALLOC(t, 1, cs_phys_prop_table_t);
+      t->n_nodes[0] = n_nodes[0];
+      t->n_nodes[1] = n_nodes[1];
+      BFT_MALLOC(t->x[0], n_nodes[0], cs_real_t);
+      BFT_MALLOC(t->x[1], n_nodes[1], cs_real_t);
+      BFT_MALLOC(t->c, 4*n_nodes[0]*n_nodes[1], cs_real_t);
+    }
+
+    double err[2] = {t->abs_err, t->rel_err};
+    cs_parall_bcast(0, 2, CS_DOUBLE, err);
+    t->abs_err = err[0];
+    t->rel_err = err[1];
+
+    cs_parall_bcast(0, n_nodes[0], CS_REAL_TYPE, t->x[0]);
+    cs_parall_bcast(0, n_nodes[1], CS_REAL_TYPE, t->x[1]);
+    cs_parall_bcast(0, 4*n_nodes[0]*n_nodes[1], CS_REAL_TYPE, t->c);
+
+  }
+
+#endif
+
+  return t;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute a physical property using an interpolation table.
+ *
+ * Values outside the table's range are computed using the backend.
+ *
+ * parameters:
+ *   t        <-- pointer to property table
+ *   property <-- property queried
+ *   n_vals   <-- number of values
+ *   var1     <-- values on first plane axis
+ *   var2     <-- values on second plane axis
+ *   val      --> resulting property values
+ *----------------------------------------------------------------------------*/
+
+static void
+_table_compute(const cs_phys_prop_table_t  *t,
+               cs_phys_prop_type_t          property,
+               cs_lnum_t                    n_vals,
+               const cs_real_t              var1[],
+               const cs_real_t              var2[],
+               cs_real_t                    val[])
+{
+  const int n1 = t->n_nodes[0], n2 = t->n_nodes[1];
+  const cs_real_t v1_min = t->x[0][0], v1_max = t->x[0][n1-1];
+  const cs_real_t v2_min = t->x[1][0], v2_max = t->x[1][n2-1];
+
+  cs_lnum_t n_out = 0;
+
+# pragma omp parallel for reduction(+:n_out) if(n_vals > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_vals; ii++) {
+    const cs_real_t v1 = var1[ii], v2 = var2[ii];
+    if (v1 < v1_min || v1 > v1_max || v2 < v2_min || v2 > v2_max) {
+      n_out += 1;
+      continue;
+    }
+    int i = _table_interval(n1, t->x[0], v1);
+    int j = _table_interval(n2, t->x[1], v2);
+    val[ii] = _table_interpolate(t, i, j, v1, v2);
+  }
+
+  if (n_out == 0)
+    return;
+
+  /* Values out of table range */
+
+  cs_lnum_t *out_id;
+  cs_real_t *v1_out, *v2_out, *val_out;
+  BFT_MALLOC(out_id, n_out, cs_lnum_t);
+  BFT_MALLOC(v1_out, n_out, cs_real_t);
+  BFT_MALLOC(v2_out, n_out, cs_real_t);
+  BFT_MALLOC(val_out, n_out, cs_real_t);
+
+  n_out = 0;
+  for (cs_lnum_t ii = 0; ii < n_vals; ii++) {
+    const cs_real_t v1 = var1[ii], v2 = var2[ii];
+    if (v1 < v1_min || v1 > v1_max || v2 < v2_min || v2 > v2_max) {
+      out_id[n_out] = ii;
+      v1_out[n_out] = v1;
+      v2_out[n_out] = v2;
+      n_out++;
+    }
+  }
+
+  _compute_backend(property, n_out, v1_out, v2_out, val_out);
+
+  for (cs_lnum_t k = 0; k < n_out; k++)
+    val[out_id[k]] = val_out[k];
+
+  BFT_FREE(val_out);
+  BFT_FREE(v2_out);
+  BFT_FREE(v1_out);
+  BFT_FREE(out_id);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*=============================================================================
@@ -195,6 +1181,10 @@ _thermal_table_create(void)
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Define thermal table.
+ *
+ * If the material, method, thermodynamic plane or temperature scale of
+ * a previously defined thermal table is changed, interpolation tables
+ * built by \ref cs_thermal_table_tabulate are discarded.
  */
 /*----------------------------------------------------------------------------*/
 
@@ -210,12 +1200,17 @@ cs_thermal_table_set(const char                        *material,
   if (cs_glob_thermal_table == NULL)
     cs_glob_thermal_table = _thermal_table_create();
 
+  /* Keep previous definition to check if interpolation tables are valid */
+
+  cs_thermal_table_t tt_prev = *cs_glob_thermal_table;
+
   BFT_MALLOC(cs_glob_thermal_table->material,  strlen(material) +1,  char);
   strcpy(cs_glob_thermal_table->material,  material);
 
   if (strcmp(method, "freesteam") == 0 ||
       strcmp(material, "user_material") == 0) {
     BFT_MALLOC(cs_glob_thermal_table->method,    strlen(method) +1,    char);
+    strcpy(cs_glob_thermal_table->method, method);
     if (strcmp(method, "freesteam") == 0)
       cs_glob_thermal_table->type = 1;
     else
@@ -223,6 +1218,7 @@ cs_thermal_table_set(const char                        *material,
   }
   else if (strcmp(method, "CoolProp") == 0) {
     BFT_MALLOC(cs_glob_thermal_table->method,    strlen(method) +1,    char);
+    strcpy(cs_glob_thermal_table->method, method);
     cs_glob_thermal_table->type = 3;
 #if defined(HAVE_COOLPROP)
 #if defined(HAVE_PLUGINS)
@@ -277,6 +1273,17 @@ cs_thermal_table_set(const char                        *material,
   }
   cs_glob_thermal_table->thermo_plane = thermo_plane;
   cs_glob_thermal_table->temp_scale = temp_scale;
+
+  if (tt_prev.material != NULL) {
+    if (   strcmp(tt_prev.material, cs_glob_thermal_table->material) != 0
+        || strcmp(tt_prev.method, cs_glob_thermal_table->method) != 0
+        || tt_prev.thermo_plane != thermo_plane
+        || tt_prev.temp_scale != temp_scale)
+      _tables_destroy();
+  }
+
+  BFT_FREE(tt_prev.material);
+  BFT_FREE(tt_prev.method);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -308,6 +1315,151 @@ cs_thermal_table_finalize(void)
     BFT_FREE(cs_glob_thermal_table->method);
     BFT_FREE(cs_glob_thermal_table);
   }
+
+  _tables_destroy();
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build an interpolation table for a given property of the
+ *        current thermal table.
+ *
+ * Property values are then interpolated from this table (using bicubic
+ * Hermite interpolation) by \ref cs_phys_prop_compute, instead of calling
+ * the thermal table's method (freesteam, EOS, CoolProp, ...), except
+ * for values outside the table's range.
+ *
+ * The table is built by adaptive refinement, so that the estimated
+ * relative interpolation error is lower than the given tolerance, or
+ * the maximum number of nodes per axis is reached. The estimated
+ * errors are logged.
+ *
+ * Ranges are defined in the same units as the values passed to
+ * \ref cs_phys_prop_compute for the thermal table's thermodynamic plane.
+ *
+ * If a cache directory is given, the table is read from that directory
+ * if it was built with the same settings by a previous computation,
+ * and is saved to that directory otherwise.
+ *
+ * This function is collective, and must be called after
+ * \ref cs_thermal_table_set.
+ *
+ * \param[in]  property    property tabulated
+ * \param[in]  var1_range  minimum and maximum values on first plane axis
+ * \param[in]  var2_range  minimum and maximum values on second plane axis
+ * \param[in]  n_max       maximum number of nodes per axis
+ * \param[in]  tolerance   target relative interpolation error (> 0)
+ * \param[in]  cache_dir   cache directory, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_thermal_table_tabulate(cs_phys_prop_type_t   property,
+                          const cs_real_t       var1_range[2],
+                          const cs_real_t       var2_range[2],
+                          int                   n_max,
+                          double                tolerance,
+                          const char           *cache_dir)
+{
+  const cs_thermal_table_t *tt = cs_glob_thermal_table;
+
+  if (tt == NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: the thermal table must be defined first."), __func__);
+
+  if (tt->type < 1 || tt->type > 3)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: no method is available to compute properties\n"
+                "for material \"%s\"."), __func__, tt->material);
+
+  if (   var1_range[1] <= var1_range[0] || var2_range[1] <= var2_range[0]
+      || n_max < 2)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: invalid table definition for property \"%s\"."),
+              __func__, _(_phys_prop_name[property]));
+
+  if (! (tolerance > 0))
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: the tolerance for property \"%s\" must be\n"
+                "strictly positive (%g given)."),
+              __func__, _(_phys_prop_name[property]), tolerance);
+
+  if (! _phys_prop_tables_init) {
+    for (int i = 0; i < CS_PHYS_PROP_N_TYPES; i++)
+      _phys_prop_tables[i] = NULL;
+    _phys_prop_tables_init = true;
+  }
+
+  _table_destroy(&(_phys_prop_tables[property]));
+
+  double t0 = cs_timer_wtime();
+
+  /* Ranges in units used by the backend (see cs_phys_prop_compute) */
+
+  double range[4] = {var1_range[0], var1_range[1],
+                     var2_range[0], var2_range[1]};
+
+  if (tt->temp_scale == 2) {
+    range[2] += 273.15;
+    range[3] += 273.15;
+  }
+
+  /* Try reading from cache */
+
+  cs_phys_prop_table_t *t = NULL;
+  cs_phys_prop_table_header_t h;
+  char *file_name = NULL;
+
+  _table_header_init(property, range, n_max, tolerance, &h);
+
+  if (cache_dir != NULL) {
+    file_name = _table_cache_file_name(cache_dir, property);
+    if (cs_glob_rank_id < 1)
+      t = _table_read(file_name, &h);
+    t = _table_bcast(t);
+  }
+
+  bool from_cache = (t != NULL) ? true : false;
+
+  /* Build and save table otherwise */
+
+  if (t == NULL) {
+    t = _table_build(property, range, n_max, tolerance);
+    if (cache_dir != NULL && cs_glob_rank_id < 1) {
+      if (cs_file_mkdir_default(cache_dir) == 0)
+        _table_write(file_name, &h, t);
+    }
+  }
+
+  _phys_prop_tables[property] = t;
+
+  double t1 = cs_timer_wtime();
+
+  cs_log_printf
+    (CS_LOG_SETUP,
+     _("\n"
+       "Interpolation table for %s (%s plane):\n"
+       "  %s\n"
+       "  var1 range:              [%g, %g]\n"
+       "  var2 range:              [%g, %g]\n"
+       "  nodes:                   %d x %d\n"
+       "  estimated max. abs. err: %12.5e\n"
+       "  estimated max. rel. err: %12.5e (tolerance %12.5e)\n"
+       "  %s time:              %12.3f s\n"),
+     _(_phys_prop_name[property]), _thermo_plane_name[tt->thermo_plane],
+     (from_cache) ? file_name : _("built from thermal table method"),
+     range[0], range[1], range[2], range[3],
+     t->n_nodes[0], t->n_nodes[1],
+     t->abs_err, t->rel_err, tolerance,
+     (from_cache) ? _("read ") : _("build"), t1 - t0);
+
+  if (t->rel_err > tolerance)
+    cs_log_printf
+      (CS_LOG_SETUP,
+       _("  Warning: tolerance not reached with at most %d nodes per axis.\n"),
+       n_max);
+
+  BFT_FREE(file_name);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -379,37 +1531,17 @@ cs_phys_prop_compute(cs_phys_prop_type_t          property,
     }
   }
 
-  /* Compute proper */
+  /* Compute property, using interpolation table if available */
+
+  const cs_phys_prop_table_t *pt = NULL;
+  if (_phys_prop_tables_init)
+    pt = _phys_prop_tables[property];
+
+  if (pt != NULL)
+    _table_compute(pt, property, _n_vals, var1_c, var2_c, val);
+  else
+    _compute_backend(property, _n_vals, var1_c, var2_c, val);
 
-  if (cs_glob_thermal_table->type == 1) {
-    cs_phys_prop_freesteam(cs_glob_thermal_table->thermo_plane,
-                           property,
-                           _n_vals,
-                           var1_c,
-                           var2_c,
-                           val);
-  }
-#if defined(HAVE_EOS)
-  else if (cs_glob_thermal_table->type == 2) {
-    _cs_phys_prop_eos(cs_glob_thermal_table->thermo_plane,
-                      property,
-                      _n_vals,
-                      var1_c,
-                      var2_c,
-                      val);
-  }
-#endif
-#if defined(HAVE_COOLPROP)
-  else if (cs_glob_thermal_table->type == 3) {
-    _cs_phys_prop_coolprop(cs_glob_thermal_table->material,
-                           cs_glob_thermal_table->thermo_plane,
-                           property,
-                           _n_vals,
-                           var1_c,
-                           var2_c,
-                           val);
-  }
-#endif
   BFT_FREE(_var1_c);
   BFT_FREE(_var2_c);
 
@@ -89,6 +89,36 @@ cs_thermal_table_set(const char                        *material,
 void
 cs_thermal_table_finalize(void);
 
+/*----------------------------------------------------------------------------
+ * Build an interpolation table for a given property of the current
+ * thermal table.
+ *
+ * Property values are then interpolated from this table by
+ * cs_phys_prop_compute, except for values outside the table's range.
+ *
+ * If a cache directory is given, the table is read from that directory
+ * if it was built with the same settings by a previous computation,
+ * and is saved to that directory otherwise.
+ *
+ * This function is collective.
+ *
+ * parameters:
+ *   property    <-- property tabulated
+ *   var1_range  <-- minimum and maximum values on first plane axis
+ *   var2_range  <-- minimum and maximum values on second plane axis
+ *   n_max       <-- maximum number of nodes per axis
+ *   tolerance   <-- target relative interpolation error (> 0)
+ *   cache_dir   <-- cache directory, or NULL
+ *----------------------------------------------------------------------------*/
+
+void
+cs_thermal_table_tabulate(cs_phys_prop_type_t   property,
+                          const cs_real_t       var1_range[2],
+                          const cs_real_t       var2_range[2],
+                          int                   n_max,
+                          double                tolerance,
+                          const char           *cache_dir);
+
 /*----------------------------------------------------------------------------
  * Compute a physical property.
  *
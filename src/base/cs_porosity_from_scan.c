@@ -59,11 +59,13 @@
 
 #include "cs_base.h"
 #include "cs_boundary_conditions.h"
+#include "cs_block_dist.h"
 #include "cs_boundary_zone.h"
 #include "cs_coupling.h"
 #include "cs_domain.h"
 #include "cs_field.h"
 #include "cs_field_pointer.h"
+#include "cs_file.h"
 #include "cs_geom.h"
 #include "cs_halo.h"
 #include "cs_halo_perio.h"
@@ -102,6 +104,10 @@ BEGIN_C_DECLS
  * Local Macro Definitions
  *============================================================================*/
 
+/* Maximum number of points read per rank in each pass for binary files */
+
+#define _CHUNK_SIZE  (1 << 22)
+
 /*=============================================================================
  * Local Type Definitions
  *============================================================================*/
@@ -142,72 +148,296 @@ cs_f_porosity_from_scan_get_pointer(bool  **compute_porosity_from_scan);
  *============================================================================*/
 
 /*----------------------------------------------------------------------------
- * Function
+ * Apply the transformation matrix to scanned points, and update their
+ * bounding box.
  *
  * parameters:
+ *   n_points     <-- number of points
+ *   point_coords <-> point coordinates
+ *   min_vec      <-> bounding box minimum coordinates
+ *   max_vec      <-> bounding box maximum coordinates
  *----------------------------------------------------------------------------*/
 
 static void
-_count_from_file(const cs_mesh_t *m,
-                 const cs_mesh_quantities_t *mq) {
+_transform_points(cs_lnum_t    n_points,
+                  cs_real_3_t  point_coords[],
+                  cs_real_t    min_vec[3],
+                  cs_real_t    max_vec[3])
+{
+  for (cs_lnum_t i = 0; i < n_points; i++) {
 
-  char line[512];
+    cs_real_4_t xyz = {point_coords[i][0],
+                       point_coords[i][1],
+                       point_coords[i][2],
+                       1.};
 
-  cs_real_t *restrict cell_f_vol = mq->cell_f_vol;
+    /* Translation and rotation */
+    for (int j = 0; j < 3; j++) {
+      point_coords[i][j] = 0.;
+      for (int k = 0; k < 4; k++)
+        point_coords[i][j]
+          += _porosity_from_scan_opt.transformation_matrix[j][k] * xyz[k];
+
+      /* Compute bounding box*/
+      min_vec[j] = CS_MIN(min_vec[j], point_coords[i][j]);
+      max_vec[j] = CS_MAX(max_vec[j], point_coords[i][j]);
+    }
 
-  /* Open file */
-  bft_printf(_("\n\n  Compute the porosity from a scan points file:\n    %s\n\n"),
-             _porosity_from_scan_opt.file_name);
+  }
+}
 
-  bft_printf(_("  Transformation       %12.5g %12.5g %12.5g %12.5g\n"
-               "  matrix:              %12.5g %12.5g %12.5g %12.5g\n"
-               "                       %12.5g %12.5g %12.5g %12.5g\n"
-               "    (last column is translation vector)\n\n"),
-             _porosity_from_scan_opt.transformation_matrix[0][0],
-             _porosity_from_scan_opt.transformation_matrix[0][1],
-             _porosity_from_scan_opt.transformation_matrix[0][2],
-             _porosity_from_scan_opt.transformation_matrix[0][3],
-             _porosity_from_scan_opt.transformation_matrix[1][0],
-             _porosity_from_scan_opt.transformation_matrix[1][1],
-             _porosity_from_scan_opt.transformation_matrix[1][2],
-             _porosity_from_scan_opt.transformation_matrix[1][3],
-             _porosity_from_scan_opt.transformation_matrix[2][0],
-             _porosity_from_scan_opt.transformation_matrix[2][1],
-             _porosity_from_scan_opt.transformation_matrix[2][2],
-             _porosity_from_scan_opt.transformation_matrix[2][3]);
+/*----------------------------------------------------------------------------
+ * Output scanned points (and their colors if present) with an FVM writer.
+ *
+ * This function is collective; each rank outputs its local points.
+ *
+ * parameters:
+ *   n_scan       <-- scan id
+ *   n_points     <-- local number of points
+ *   gnum_shift   <-- global number of local points shift
+ *   point_coords <-- point coordinates
+ *   colors       <-- point colors (RGB in [0, 1] interlaced), or NULL
+ *----------------------------------------------------------------------------*/
+
+static void
+_postprocess_points(int                n_scan,
+                    cs_lnum_t          n_points,
+                    cs_gnum_t          gnum_shift,
+                    const cs_real_3_t  point_coords[],
+                    const float        colors[])
+{
+  char *fvm_name;
+  if (_porosity_from_scan_opt.output_name == NULL) {
+    BFT_MALLOC(fvm_name,
+               strlen(_porosity_from_scan_opt.file_name) + 3 + 1,
+               char);
+    strcpy(fvm_name, _porosity_from_scan_opt.file_name);
+  } else {
+    BFT_MALLOC(fvm_name,
+               strlen(_porosity_from_scan_opt.output_name) + 3 + 1,
+               char);
+    strcpy(fvm_name, _porosity_from_scan_opt.output_name);
+  }
+  char suffix[13];
+  sprintf(suffix, "_%02d", n_scan);
+  strcat(fvm_name, suffix);
+
+  /* Build FVM mesh from scanned points */
+  fvm_nodal_t *pts_mesh = fvm_nodal_create(fvm_name, 3);
+
+  cs_gnum_t *vtx_gnum = NULL;
+
+  if (n_points > 0) {
+    /* Update the points set structure */
+    fvm_nodal_define_vertex_list(pts_mesh, n_points, NULL);
+    fvm_nodal_set_shared_vertices(pts_mesh, (const cs_coord_t *)point_coords);
+
+    BFT_MALLOC(vtx_gnum, n_points, cs_gnum_t);
+    for (cs_lnum_t i = 0; i < n_points; i++)
+      vtx_gnum[i] = gnum_shift + i + 1;
+  }
+  fvm_nodal_init_io_num(pts_mesh, vtx_gnum, 0);
+
+  /* Free if allocated */
+  BFT_FREE(vtx_gnum);
+
+  /* Create default writer */
+  fvm_writer_t *writer = fvm_writer_init(fvm_name,
+                                         "postprocessing",
+                                         cs_post_get_default_format(),
+                                         cs_post_get_default_format_options(),
+                                         FVM_WRITER_FIXED_MESH);
+
+  fvm_writer_export_nodal(writer, pts_mesh);
+
+  if (colors != NULL) {
+
+    const void *var_ptr[1] = {colors};
 
-  FILE* file = fopen(_porosity_from_scan_opt.file_name, "rt");
-  if (file == NULL)
-    bft_error(__FILE__,__LINE__, 0, _("Porosity from scan: Could not open file."));
+    fvm_writer_export_field(writer,
+                            pts_mesh,
+                            "color",
+                            FVM_WRITER_PER_NODE,
+                            3,
+                            CS_INTERLACE,
+                            0,
+                            0,
+                            CS_FLOAT,
+                            -1,
+                            0.0,
+                            (const void * *)var_ptr);
+
+  }
+
+  /* Free and destroy */
+  fvm_writer_finalize(writer);
+  pts_mesh = fvm_nodal_destroy(pts_mesh);
+  BFT_FREE(fvm_name);
+}
+
+/*----------------------------------------------------------------------------
+ * Locate a batch of scanned points in the mesh and count them per cell.
+ *
+ * This function is collective. Each rank provides its own (possibly empty)
+ * set of points, which the locator distributes to the ranks whose
+ * local mesh extents contain them, so each point is counted at most once.
+ *
+ * parameters:
+ *   location_mesh <-- location mesh
+ *   n_points      <-- local number of points
+ *   point_coords  <-- point coordinates
+ *   nb_scan       <-> number of points per cell
+ *----------------------------------------------------------------------------*/
+
+static void
+_count_points(fvm_nodal_t        *location_mesh,
+              cs_lnum_t           n_points,
+              const cs_real_3_t   point_coords[],
+              cs_real_t           nb_scan[])
+{
+  /* Now build locator
+   * Locate points on this location mesh */
+  /*-------------------------------------*/
+
+  int options[PLE_LOCATOR_N_OPTIONS];
+  for (int i = 0; i < PLE_LOCATOR_N_OPTIONS; i++)
+    options[i] = 0;
+  options[PLE_LOCATOR_NUMBERING] = 0; /* base 0 numbering */
+
+#if defined(PLE_HAVE_MPI)
+  _locator = ple_locator_create(cs_glob_mpi_comm,
+                                cs_glob_n_ranks,
+                                0);
+#else
+  _locator = ple_locator_create();
+#endif
+
+  ple_locator_set_mesh(_locator,
+                       location_mesh,
+                       options,
+                       0., /* tolerance_base */
+                       0.1, /* tolerance */
+                       3, /* dim */
+                       n_points,
+                       NULL,
+                       NULL, /* point_tag */
+                       (const cs_real_t *)point_coords,
+                       NULL, /* distance */
+                       cs_coupling_mesh_extents,
+                       cs_coupling_point_in_mesh_p);
+
+  /* Shift from 1-base to 0-based locations */
+  ple_locator_shift_locations(_locator, -1);
+
+  /* dump locator */
+#if 0
+  ple_locator_dump(_locator);
+#endif
+
+  /* Get the element ids (list of points on the local rank) */
+  cs_lnum_t n_points_loc = ple_locator_get_n_dist_points(_locator);
+
+#if 0
+  bft_printf("ple_locator_get_n_dist_points = %d, n_points = %d\n",
+             n_points_loc, n_points);
+#endif
+
+  const cs_lnum_t *elt_ids = ple_locator_get_dist_locations(_locator);
+
+  for (cs_lnum_t i = 0; i < n_points_loc; i++) {
+    if (elt_ids[i] >= 0) /* Found */
+      nb_scan[elt_ids[i]] += 1.;
+  }
+
+  /* Free memory */
+  _locator = ple_locator_destroy(_locator);
+}
+
+/*----------------------------------------------------------------------------
+ * Check whether the scan points file uses the Code_Saturne binary format.
+ *
+ * The file header is checked on the first rank, and the result broadcast.
+ *
+ * returns:
+ *   true if the file is a binary file, false for a text file
+ *----------------------------------------------------------------------------*/
+
+static bool
+_is_binary_file(void)
+{
+  int retval = 0;
+
+  if (cs_glob_rank_id < 1) {
+
+    const char magic[] = "Code_Saturne I/O, BE, R0";
+    char header[sizeof(magic)];
+
+    FILE* file = fopen(_porosity_from_scan_opt.file_name, "rb");
+    if (file == NULL)
+      bft_error(__FILE__,__LINE__, 0,
+                _("Porosity from scan: Could not open file."));
+
+    size_t n = fread(header, 1, sizeof(magic) - 1, file);
+    if (n == sizeof(magic) - 1 && strncmp(header, magic, n) == 0)
+      retval = 1;
+
+    fclose(file);
+
+  }
+
+  cs_parall_bcast(0, 1, CS_INT_TYPE, &retval);
+
+  return (retval != 0);
+}
+
+/*----------------------------------------------------------------------------
+ * Read scanned points from a text file and count them per cell.
+ *
+ * The file is read by the first rank only; points are then distributed
+ * to other ranks by the locator.
+ *
+ * parameters:
+ *   location_mesh <-- location mesh
+ *   nb_scan       <-> number of points per cell
+ *   min_vec_tot   <-> global bounding box minimum coordinates
+ *   max_vec_tot   <-> global bounding box maximum coordinates
+ *----------------------------------------------------------------------------*/
+
+static void
+_count_from_text_file(fvm_nodal_t  *location_mesh,
+                      cs_real_t     nb_scan[],
+                      cs_real_t     min_vec_tot[3],
+                      cs_real_t     max_vec_tot[3])
+{
+  char line[512];
+
+  FILE* file = NULL;
 
   int n_points = 0;
   int n_read_points = 0;
-  cs_real_3_t min_vec_tot = { HUGE_VAL,  HUGE_VAL,  HUGE_VAL};
-  cs_real_3_t max_vec_tot = {-HUGE_VAL, -HUGE_VAL, -HUGE_VAL};
 
-  if (fscanf(file, "%d\n", &n_read_points) != 1)
-    bft_error(__FILE__,__LINE__, 0, _("Porosity from scan: Could not read the number of lines."));
+  if (cs_glob_rank_id < 1) {
 
-  bft_printf(_("  Porosity from scan: %d points to be read.\n\n"), n_read_points);
+    file = fopen(_porosity_from_scan_opt.file_name, "rt");
+    if (file == NULL)
+      bft_error(__FILE__,__LINE__, 0, _("Porosity from scan: Could not open file."));
 
-  /* Pointer to field */
-  cs_field_t *f_nb_scan = cs_field_by_name_try("nb_scan_points");
+    if (fscanf(file, "%d\n", &n_read_points) != 1)
+      bft_error(__FILE__,__LINE__, 0, _("Porosity from scan: Could not read the number of lines."));
 
+  }
 
-  /* Location mesh where points will be localized */
-  fvm_nodal_t *location_mesh =
-    cs_mesh_connect_cells_to_nodal(m,
-                                   "pts_location_mesh",
-                                   false, // no family info
-                                   m->n_cells,
-                                   NULL);
+  cs_parall_bcast(0, 1, CS_INT_TYPE, &n_read_points);
 
-  fvm_nodal_make_vertices_private(location_mesh);
+  bft_printf(_("  Porosity from scan: %d points to be read.\n\n"), n_read_points);
 
   /* Read multiple scan file
    * ----------------------- */
   for (int n_scan = 0; n_read_points != 0; n_scan++) {
-    n_points = n_read_points;
+
+    /* Only the first rank reads points */
+    n_points = (cs_glob_rank_id < 1) ? n_read_points : 0;
+
     cs_real_3_t *point_coords;
     float *colors;
     BFT_MALLOC(point_coords, n_points, cs_real_3_t);
@@ -219,28 +449,14 @@ _count_from_file(const cs_mesh_t *m,
     /* Read points */
     for (int i = 0; i < n_points; i++ ) {
       int num, green, red, blue;
-      cs_real_4_t xyz;
-      for (int j = 0; j < 3; j++)
-        point_coords[i][j] = 0.;
 
-      if (fscanf(file, "%lf", &(xyz[0])) != 1)
+      if (fscanf(file, "%lf", &(point_coords[i][0])) != 1)
         bft_error(__FILE__,__LINE__, 0, _("Porosity from scan: Error while reading dataset. Line %d\n"), i);
-      if (fscanf(file, "%lf", &(xyz[1])) != 1)
+      if (fscanf(file, "%lf", &(point_coords[i][1])) != 1)
         bft_error(__FILE__,__LINE__, 0, _("Porosity from scan: Error while reading dataset."));
-      if (fscanf(file, "%lf", &(xyz[2])) != 1)
+      if (fscanf(file, "%lf", &(point_coords[i][2])) != 1)
         bft_error(__FILE__,__LINE__, 0, _("Porosity from scan: Error while reading dataset."));
 
-      /* Translation and rotation */
-      xyz[3] = 1.;
-      for (int j = 0; j < 3; j++) {
-        for (int k = 0; k < 4; k++)
-          point_coords[i][j] += _porosity_from_scan_opt.transformation_matrix[j][k] * xyz[k];
-
-        /* Compute bounding box*/
-        min_vec[j] = CS_MIN(min_vec[j], point_coords[i][j]);
-        max_vec[j] = CS_MAX(max_vec[j], point_coords[i][j]);
-      }
-
       /* Intensities */
       if (fscanf(file, "%d", &num) != 1)
         bft_error(__FILE__,__LINE__, 0, _("Porosity from scan: Error while reading dataset."));
@@ -263,11 +479,18 @@ _count_from_file(const cs_mesh_t *m,
       colors[3*i + 2] = blue/255.;
     }
 
+    /* Translation and rotation */
+    _transform_points(n_points, point_coords, min_vec, max_vec);
+
     /* Check EOF was correctly reached */
-    if (fgets(line, sizeof(line), file) != NULL)
-      n_read_points = strtol(line, NULL, 10);
-    else
-      n_read_points = 0;
+    if (cs_glob_rank_id < 1) {
+      if (fgets(line, sizeof(line), file) != NULL)
+        n_read_points = strtol(line, NULL, 10);
+      else
+        n_read_points = 0;
+    }
+
+    cs_parall_bcast(0, 1, CS_INT_TYPE, &n_read_points);
 
     /* Bounding box*/
     bft_printf(_("  Bounding box [%f, %f, %f], [%f, %f, %f].\n\n"),
@@ -280,155 +503,344 @@ _count_from_file(const cs_mesh_t *m,
       max_vec_tot[j] = CS_MAX(max_vec[j], max_vec_tot[j]);
     }
 
-
     if (n_read_points > 0)
       bft_printf(_("  Porosity from scan: %d additional points to be read.\n\n"),
                  n_read_points);
 
     /* FVM meshes for writers */
-    if (_porosity_from_scan_opt.postprocess_points) {
-      char *fvm_name;
-      if (_porosity_from_scan_opt.output_name == NULL) {
-        BFT_MALLOC(fvm_name,
-                   strlen(_porosity_from_scan_opt.file_name) + 3 + 1,
-                   char);
-        strcpy(fvm_name, _porosity_from_scan_opt.file_name);
-      } else {
-        BFT_MALLOC(fvm_name,
-                   strlen(_porosity_from_scan_opt.output_name) + 3 + 1,
-                   char);
-        strcpy(fvm_name, _porosity_from_scan_opt.output_name);
-      }
-      char suffix[13];
-      sprintf(suffix, "_%02d", n_scan);
-      strcat(fvm_name, suffix);
+    if (_porosity_from_scan_opt.postprocess_points)
+      _postprocess_points(n_scan,
+                          n_points,
+                          0,
+                          (const cs_real_3_t *)point_coords,
+                          colors);
+
+    /* Locate and count points */
+    _count_points(location_mesh,
+                  n_points,
+                  (const cs_real_3_t *)point_coords,
+                  nb_scan);
 
-      /* Build FVM mesh from scanned points */
-      fvm_nodal_t *pts_mesh = fvm_nodal_create(fvm_name, 3);
+    /* Free memory */
+    BFT_FREE(point_coords);
+    BFT_FREE(colors);
 
-      /* Only the first rank writes points for now */
-      cs_gnum_t *vtx_gnum = NULL;
+  } /* End loop on multiple scans */
 
-      if (cs_glob_rank_id < 1) {
-        /* Update the points set structure */
-        fvm_nodal_define_vertex_list(pts_mesh, n_points, NULL);
-        fvm_nodal_set_shared_vertices(pts_mesh, (cs_coord_t *)point_coords);
+  if (cs_glob_rank_id < 1) {
+    if (fclose(file) != 0)
+      bft_error(__FILE__,__LINE__, 0, _("Porosity from scan: Could not close the file."));
+  }
+}
 
-        BFT_MALLOC(vtx_gnum, n_points, cs_gnum_t);
-        for (cs_lnum_t i = 0; i < n_points; i++)
-          vtx_gnum[i] = i + 1;
+/*----------------------------------------------------------------------------
+ * Read a slab of a point coordinates or colors section from a binary file.
+ *
+ * Slabs start at a multiple of _CHUNK_SIZE points, so the file position
+ * remains aligned with the section body alignment.
+ *
+ * parameters:
+ *   inp        <-> pointer to kernel IO structure
+ *   sec_id     <-- id of section in index
+ *   slab_start <-- number of points preceding slab in section
+ *   gnum_range <-- start and past-the-end global numbers of local block
+ *                  (1 to n numbering, relative to slab start)
+ *   vals       --> read values (3 per point)
+ *----------------------------------------------------------------------------*/
 
+static void
+_read_slab(cs_io_t          *inp,
+           size_t            sec_id,
+           cs_gnum_t         slab_start,
+           const cs_gnum_t   gnum_range[2],
+           void             *vals)
+{
+  cs_io_sec_header_t h;
 
-      }
-      fvm_nodal_init_io_num(pts_mesh, vtx_gnum, 0);
+  cs_io_set_indexed_position(inp, &h, sec_id);
+
+  if (slab_start > 0) {
+    cs_file_off_t offset = cs_io_get_offset(inp);
+    offset += slab_start * 3 * cs_datatype_size[h.type_read];
+    cs_io_set_offset(inp, offset);
+  }
+
+  cs_io_read_block(&h, gnum_range[0], gnum_range[1], vals, inp);
+}
+
+/*----------------------------------------------------------------------------
+ * Read scanned points from a binary file and count them per cell.
+ *
+ * The file uses the Code_Saturne binary I/O format (see \ref cs_io),
+ * with "Point cloud, R0" as magic string. Each "point_coords" section
+ * (3 real values per point) defines a scan, and may be followed by a
+ * "point_colors" section (3 real values in [0, 1] per point).
+ *
+ * Points are read by blocks on all ranks, in passes of at most
+ * _CHUNK_SIZE points per active rank, so that memory use remains bounded
+ * for very large scans.
+ *
+ * parameters:
+ *   location_mesh <-- location mesh
+ *   nb_scan       <-> number of points per cell
+ *   min_vec_tot   <-> global bounding box minimum coordinates
+ *   max_vec_tot   <-> global bounding box maximum coordinates
+ *----------------------------------------------------------------------------*/
+
+static void
+_count_from_binary_file(fvm_nodal_t  *location_mesh,
+                        cs_real_t     nb_scan[],
+                        cs_real_t     min_vec_tot[3],
+                        cs_real_t     max_vec_tot[3])
+{
+  cs_io_t *inp = NULL;
+  cs_file_access_t method;
 
-      /* Free if allocated */
-      BFT_FREE(vtx_gnum);
+  int block_rank_step = 1, min_block_size = 0;
 
-      /* Create default writer */
-      fvm_writer_t *writer = fvm_writer_init(fvm_name,
-                                             "postprocessing",
-                                             cs_post_get_default_format(),
-                                             cs_post_get_default_format_options(),
-                                             FVM_WRITER_FIXED_MESH);
+#if defined(HAVE_MPI)
+  {
+    MPI_Info           hints;
+    MPI_Comm           block_comm, comm;
+    cs_file_get_default_access(CS_FILE_MODE_READ, &method, &hints);
+    cs_file_get_default_comm(&block_rank_step, &min_block_size,
+                             &block_comm, &comm);
+    inp = cs_io_initialize_with_index(_porosity_from_scan_opt.file_name,
+                                      "Point cloud, R0",
+                                      method,
+                                      CS_IO_ECHO_NONE,
+                                      hints,
+                                      block_comm,
+                                      comm);
+  }
+#else
+  {
+    cs_file_get_default_access(CS_FILE_MODE_READ, &method);
+    inp = cs_io_initialize_with_index(_porosity_from_scan_opt.file_name,
+                                      "Point cloud, R0",
+                                      method,
+                                      CS_IO_ECHO_NONE);
+  }
+#endif
 
+  const size_t n_sections = cs_io_get_index_size(inp);
 
-      fvm_writer_export_nodal(writer, pts_mesh);
+  int n_scan = 0;
 
-      const void *var_ptr[1] = {NULL};
+  for (size_t s_id = 0; s_id < n_sections; s_id++) {
 
-      var_ptr[0] = colors;
+    if (strcmp(cs_io_get_indexed_sec_name(inp, s_id), "point_coords") != 0)
+      continue;
 
-      fvm_writer_export_field(writer,
-                              pts_mesh,
-                              "color",
-                              FVM_WRITER_PER_NODE,
-                              3,
-                              CS_INTERLACE,
-                              0,
-                              0,
-                              CS_FLOAT,
-                              -1,
-                              0.0,
-                              (const void * *)var_ptr);
+    cs_io_sec_header_t h = cs_io_get_indexed_sec_header(inp, s_id);
+    cs_io_assert_cs_real(&h, inp);
 
+    if (h.n_location_vals != 3 || h.n_vals % 3 != 0)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Porosity from scan: section \"%s\" of file \"%s\"\n"
+                  "should contain 3 values per point."),
+                h.sec_name, _porosity_from_scan_opt.file_name);
 
-      /* Free and destroy */
-      fvm_writer_finalize(writer);
-      pts_mesh = fvm_nodal_destroy(pts_mesh);
+    const cs_gnum_t n_g_points = h.n_vals / 3;
+
+    /* Optional colors immediately follow coordinates */
+
+    size_t c_id = s_id + 1;
+    bool have_colors = false;
+
+    if (c_id < n_sections) {
+      if (strcmp(cs_io_get_indexed_sec_name(inp, c_id), "point_colors") == 0) {
+        cs_io_sec_header_t hc = cs_io_get_indexed_sec_header(inp, c_id);
+        cs_io_assert_cs_real(&hc, inp);
+        if (hc.n_vals != h.n_vals || hc.n_location_vals != 3)
+          bft_error(__FILE__, __LINE__, 0,
+                    _("Porosity from scan: section \"%s\" of file \"%s\"\n"
+                      "does not match the previous point coordinates."),
+                    hc.sec_name, _porosity_from_scan_opt.file_name);
+        have_colors = true;
+      }
     }
 
-    /* Now build locator
-     * Locate points on this location mesh */
-    /*-------------------------------------*/
+    bft_printf(_("  Porosity from scan: %llu points to be read.\n\n"),
+               (unsigned long long)n_g_points);
 
-    int options[PLE_LOCATOR_N_OPTIONS];
-    for (int i = 0; i < PLE_LOCATOR_N_OPTIONS; i++)
-      options[i] = 0;
-    options[PLE_LOCATOR_NUMBERING] = 0; /* base 0 numbering */
+    /* Points are read by successive slabs, each slab being distributed
+       by blocks over ranks; all ranks use the same number of passes */
 
-#if defined(PLE_HAVE_MPI)
-    _locator = ple_locator_create(cs_glob_mpi_comm,
-                                  cs_glob_n_ranks,
-                                  0);
-#else
-    _locator = ple_locator_create();
-#endif
+    const int n_block_ranks
+      = (cs_glob_n_ranks + block_rank_step - 1) / block_rank_step;
+    const cs_gnum_t slab_size = (cs_gnum_t)_CHUNK_SIZE * n_block_ranks;
+    const cs_gnum_t n_passes = (n_g_points + slab_size - 1) / slab_size;
 
-    ple_locator_set_mesh(_locator,
-                         location_mesh,
-                         options,
-                         0., /* tolerance_base */
-                         0.1, /* tolerance */
-                         3, /* dim */
-                         n_points,
-                         NULL,
-                         NULL, /* point_tag */
-                         (cs_real_t *)point_coords,
-                         NULL, /* distance */
-                         cs_coupling_mesh_extents,
-                         cs_coupling_point_in_mesh_p);
-
-    /* Shift from 1-base to 0-based locations */
-    ple_locator_shift_locations(_locator, -1);
-
-    /* dump locator */
-#if 0
-    ple_locator_dump(_locator);
-#endif
+    cs_block_dist_info_t bi
+      = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                    cs_glob_n_ranks,
+                                    block_rank_step,
+                                    min_block_size / (3*sizeof(double)),
+                                    CS_MIN(n_g_points, slab_size));
 
-    /* Get the element ids (list of points on the local rank) */
-    cs_lnum_t n_points_loc = ple_locator_get_n_dist_points(_locator);
+    const cs_lnum_t chunk_size = bi.gnum_range[1] - bi.gnum_range[0];
 
-#if 0
-    bft_printf("ple_locator_get_n_dist_points = %d, n_points = %d\n",
-               n_points_loc, n_points);
-#endif
+    cs_real_3_t *point_coords;
+    cs_real_t *color_vals = NULL;
+    float *colors = NULL;
+    BFT_MALLOC(point_coords, chunk_size, cs_real_3_t);
+    if (have_colors) {
+      BFT_MALLOC(color_vals, 3*chunk_size, cs_real_t);
+      BFT_MALLOC(colors, 3*chunk_size, float);
+    }
+
+    cs_real_3_t min_vec = { HUGE_VAL,  HUGE_VAL,  HUGE_VAL};
+    cs_real_3_t max_vec = {-HUGE_VAL, -HUGE_VAL, -HUGE_VAL};
+
+    if (_porosity_from_scan_opt.postprocess_points && n_passes > 1)
+      bft_printf(_("  Porosity from scan: scan %d read in %llu passes;\n"
+                   "  points are not postprocessed.\n\n"),
+                 n_scan, (unsigned long long)n_passes);
+
+    for (cs_gnum_t pass_id = 0; pass_id < n_passes; pass_id++) {
+
+      const cs_gnum_t slab_start = pass_id*slab_size;
+
+      if (pass_id > 0)
+        bi = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                         cs_glob_n_ranks,
+                                         block_rank_step,
+                                         min_block_size / (3*sizeof(double)),
+                                         CS_MIN(n_g_points - slab_start,
+                                                slab_size));
 
-    const cs_lnum_t *elt_ids = ple_locator_get_dist_locations(_locator);
+      cs_lnum_t n_points = bi.gnum_range[1] - bi.gnum_range[0];
+      assert(n_points <= chunk_size);
 
-    for (int i = 0; i < n_points_loc; i++) {
-      if (elt_ids[i] >= 0) { /* Found */
-        /* Could be improved with a prallel reading */
-        f_nb_scan->val[elt_ids[i]] += 1./cs_glob_n_ranks;
+      _read_slab(inp, s_id, slab_start, bi.gnum_range, point_coords);
+
+      if (have_colors) {
+        _read_slab(inp, c_id, slab_start, bi.gnum_range, color_vals);
+        for (cs_lnum_t i = 0; i < 3*n_points; i++)
+          colors[i] = color_vals[i];
       }
+
+      /* Translation and rotation */
+      _transform_points(n_points, point_coords, min_vec, max_vec);
+
+      /* FVM meshes for writers */
+      if (_porosity_from_scan_opt.postprocess_points && n_passes == 1)
+        _postprocess_points(n_scan,
+                            n_points,
+                            bi.gnum_range[0] - 1,
+                            (const cs_real_3_t *)point_coords,
+                            colors);
+
+      /* Locate and count points */
+      _count_points(location_mesh,
+                    n_points,
+                    (const cs_real_3_t *)point_coords,
+                    nb_scan);
+
     }
 
-    /* Free memory */
-    _locator = ple_locator_destroy(_locator);
     BFT_FREE(point_coords);
+    BFT_FREE(color_vals);
     BFT_FREE(colors);
 
+    /* Bounding box*/
+    cs_parall_min(3, CS_REAL_TYPE, min_vec);
+    cs_parall_max(3, CS_REAL_TYPE, max_vec);
+
+    bft_printf(_("  Bounding box [%f, %f, %f], [%f, %f, %f].\n\n"),
+        min_vec[0], min_vec[1], min_vec[2],
+        max_vec[0], max_vec[1], max_vec[2]);
+
+    /* Update global bounding box */
+    for (int j = 0; j < 3; j++) {
+      min_vec_tot[j] = CS_MIN(min_vec[j], min_vec_tot[j]);
+      max_vec_tot[j] = CS_MAX(max_vec[j], max_vec_tot[j]);
+    }
+
+    n_scan++;
+
   } /* End loop on multiple scans */
 
+  if (n_scan == 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Porosity from scan: no \"point_coords\" section"
+                " in file \"%s\"."),
+              _porosity_from_scan_opt.file_name);
+
+  cs_io_finalize(&inp);
+}
+
+/*----------------------------------------------------------------------------
+ * Count scanned points per cell, and deduce the fluid volume of cells.
+ *
+ * Scanned points are read from a text or binary file, depending on
+ * the file's contents.
+ *
+ * parameters:
+ *   m  <-- pointer to mesh
+ *   mq <-> pointer to mesh quantities
+ *----------------------------------------------------------------------------*/
+
+static void
+_count_from_file(const cs_mesh_t *m,
+                 const cs_mesh_quantities_t *mq) {
+
+  cs_real_t *restrict cell_f_vol = mq->cell_f_vol;
+
+  /* Open file */
+  bft_printf(_("\n\n  Compute the porosity from a scan points file:\n    %s\n\n"),
+             _porosity_from_scan_opt.file_name);
+
+  bft_printf(_("  Transformation       %12.5g %12.5g %12.5g %12.5g\n"
+               "  matrix:              %12.5g %12.5g %12.5g %12.5g\n"
+               "                       %12.5g %12.5g %12.5g %12.5g\n"
+               "    (last column is translation vector)\n\n"),
+             _porosity_from_scan_opt.transformation_matrix[0][0],
+             _porosity_from_scan_opt.transformation_matrix[0][1],
+             _porosity_from_scan_opt.transformation_matrix[0][2],
+             _porosity_from_scan_opt.transformation_matrix[0][3],
+             _porosity_from_scan_opt.transformation_matrix[1][0],
+             _porosity_from_scan_opt.transformation_matrix[1][1],
+             _porosity_from_scan_opt.transformation_matrix[1][2],
+             _porosity_from_scan_opt.transformation_matrix[1][3],
+             _porosity_from_scan_opt.transformation_matrix[2][0],
+             _porosity_from_scan_opt.transformation_matrix[2][1],
+             _porosity_from_scan_opt.transformation_matrix[2][2],
+             _porosity_from_scan_opt.transformation_matrix[2][3]);
+
+  cs_real_3_t min_vec_tot = { HUGE_VAL,  HUGE_VAL,  HUGE_VAL};
+  cs_real_3_t max_vec_tot = {-HUGE_VAL, -HUGE_VAL, -HUGE_VAL};
+
+  /* Pointer to field */
+  cs_field_t *f_nb_scan = cs_field_by_name_try("nb_scan_points");
+
+  /* Location mesh where points will be localized */
+  fvm_nodal_t *location_mesh =
+    cs_mesh_connect_cells_to_nodal(m,
+                                   "pts_location_mesh",
+                                   false, // no family info
+                                   m->n_cells,
+                                   NULL);
+
+  fvm_nodal_make_vertices_private(location_mesh);
+
+  if (_is_binary_file())
+    _count_from_binary_file(location_mesh,
+                            f_nb_scan->val,
+                            min_vec_tot,
+                            max_vec_tot);
+  else
+    _count_from_text_file(location_mesh,
+                          f_nb_scan->val,
+                          min_vec_tot,
+                          max_vec_tot);
+
   /* Bounding box*/
   bft_printf(_("  Global bounding box [%f, %f, %f], [%f, %f, %f].\n\n"),
       min_vec_tot[0], min_vec_tot[1], min_vec_tot[2],
       max_vec_tot[0], max_vec_tot[1], max_vec_tot[2]);
 
-  if (fclose(file) != 0)
-    bft_error(__FILE__,__LINE__, 0, _("Porosity from scan: Could not close the file."));
-
   /* Nodal mesh is not needed anymore */
   location_mesh = fvm_nodal_destroy(location_mesh);
 
@@ -516,6 +928,11 @@ cs_f_porosity_from_scan_get_pointer(bool **compute_porosity_from_scan)
  * \brief This function set the file name of points for the computation of the
  * porosity from scan.
  *
+ * The file may be either a text file, or a Code_Saturne binary file
+ * (with "Point cloud, R0" as magic string), in which each "point_coords"
+ * section defines a scan, optionally followed by a "point_colors" section.
+ * Binary files are read in parallel, by blocks.
+ *
  * \param[in] file_name  name of the file.
  */
 /*----------------------------------------------------------------------------*/
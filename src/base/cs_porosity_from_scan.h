@@ -103,6 +103,11 @@ extern cs_porosity_from_scan_opt_t *cs_glob_porosity_from_scan_opt;
  * \brief This function set the file name of points for the computation of the
  * porosity from scan.
  *
+ * The file may be either a text file, or a Code_Saturne binary file
+ * (with "Point cloud, R0" as magic string), in which each "point_coords"
+ * section defines a scan, optionally followed by a "point_colors" section.
+ * Binary files are read in parallel, by blocks.
+ *
  * \param[in] file_name  name of the file.
  */
 /*----------------------------------------------------------------------------*/
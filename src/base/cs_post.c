@@ -3325,6 +3325,8 @@ _check_non_transient(const cs_post_writer_t  *writer,
  * - \c \b MEDCoupling (in-memory structure, to be used from other code)
  * - \c \b plot (comma or whitespace separated 2d plot files)
  * - \c \b time_plot (comma or whitespace separated time plot files)
+ * - \c \b compressed (EnSight Gold geometry with lossy-compressed variable
+ *         files, to be converted using \c cs_compressed_to_ensight)
  *
  * The format name is case-sensitive, so \c \b ensight or \c \b cgns are also valid.
  *
@@ -3353,6 +3355,15 @@ _check_non_transient(const cs_post_writer_t  *writer,
  *         pyramids), so that any post-processing tool can recognize them.
  * - \c \b separate_meshes to multiple meshes and associated fields to
  *         separate outputs.
+ * - \c \b error=\em x relative error bound for compressed values,
+ *         based on the range of each component (for \c \b compressed,
+ *         default: 1e-4).
+ * - \c \b abs_error=\em x absolute error bound for compressed values
+ *         (for \c \b compressed).
+ * - \c \b stride=\em n to only output the values of every \em n-th element
+ *         or vertex, in output numbering order, other values being
+ *         undefined (for \c \b compressed; this is not a spatial
+ *         sub-sampling).
  *
  * Note that the white-spaces in the beginning or in the end of the
  * character strings given as arguments here are suppressed automatically.
@@ -55,12 +55,15 @@
 #include "cs_block_dist.h"
 #include "cs_file.h"
 #include "cs_interface.h"
+#include "cs_log.h"
 #include "cs_mesh.h"
 #include "cs_mesh_from_builder.h"
 #include "cs_mesh_group.h"
+#include "cs_mesh_import_gmsh.h"
 #include "cs_parall.h"
 #include "cs_partition.h"
 #include "cs_io.h"
+#include "cs_timer.h"
 
 /*----------------------------------------------------------------------------
  *  Header for the current file
@@ -91,6 +94,8 @@ typedef struct {
   const char  *const *old_group_names;
   const char  *const *new_group_names;
 
+  cs_mesh_import_gmsh_t  *gmsh;   /* Data built from Gmsh file, or NULL */
+
   /* Single allocation for all data */
 
   size_t              data_size;
@@ -125,6 +130,19 @@ typedef struct {
 
 } _mesh_reader_t;
 
+/* Sections handled by a given read pass */
+/* -------------------------------------- */
+
+typedef enum {
+
+  _READ_ALL,        /* All sections */
+  _READ_ADJACENCY,  /* Cell and face -> cell data, group classes,
+                       and periodicity */
+  _READ_VERTICES    /* Face -> vertices connectivity and vertex
+                       coordinates */
+
+} _read_pass_t;
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
@@ -709,6 +727,21 @@ _read_dimensions(cs_mesh_t          *mesh,
 
   bft_printf(_(" Reading metadata from file: \"%s\"\n"), f->filename);
 
+  /* Gmsh files are read directly (group classes being already
+     shifted), and faces built, at this stage */
+
+  if (cs_mesh_import_gmsh_check_file(f->filename)) {
+    int n_groups_prev = mesh->n_groups;
+    f->gmsh = cs_mesh_import_gmsh_create(f->filename, mesh, mb);
+    if (f->n_group_renames > 0)
+      _mesh_groups_rename(mesh,
+                          n_groups_prev,
+                          f->n_group_renames,
+                          f->old_group_names,
+                          f->new_group_names);
+    return;
+  }
+
 #if defined(HAVE_MPI)
   pp_in = cs_io_initialize(f->filename,
                            "Face-based mesh definition, R0",
@@ -1333,13 +1366,79 @@ _transform_perio_matrix(const double  matrix[],
   _combine_tr_matrixes(_m, _tmp_m, perio_matrix);
 }
 
+/*----------------------------------------------------------------------------
+ * Transfer mesh data built from a Gmsh file to the mesh builder.
+ *
+ * parameters:
+ *   f    <-> pointer to mesh file info
+ *   mesh <-> pointer to mesh structure
+ *   mb   <-> pointer to mesh builder structure
+ *   mr   <-> pointer to mesh reader structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_gmsh_data(_mesh_file_info_t  *f,
+                cs_mesh_t          *mesh,
+                cs_mesh_builder_t  *mb,
+                _mesh_reader_t     *mr)
+{
+  cs_lnum_t n_read[4];
+
+  const cs_gnum_t g_shift[3] = {mr->n_g_cells_read,
+                                mr->n_g_faces_read,
+                                mr->n_g_vertices_read};
+  const cs_lnum_t l_shift[4] = {mr->n_cells_read,
+                                mr->n_faces_read,
+                                mr->n_faces_connect_read,
+                                mr->n_vertices_read};
+
+  bft_printf(_(" Transferring mesh data from file: \"%s\"\n"), f->filename);
+
+  cs_mesh_import_gmsh_transfer(f->gmsh, mb, g_shift, l_shift, n_read);
+
+  /* Transform coordinates if necessary */
+
+  if (f->matrix != NULL) {
+    _transform_coords(n_read[3],
+                      mb->vertex_coords + mr->n_vertices_read*3,
+                      f->matrix);
+    mesh->modified = 1;
+  }
+
+  mr->n_cells_read += n_read[0];
+  mr->n_faces_read += n_read[1];
+  mr->n_faces_connect_read += n_read[2];
+  mr->n_vertices_read += n_read[3];
+
+  cs_gnum_t n_g_read[4] = {n_read[0], n_read[1], n_read[2], n_read[3]};
+  cs_parall_counter(n_g_read, 4);
+
+  mr->n_g_cells_read += n_g_read[0];
+  mr->n_g_faces_read += n_g_read[1];
+  mr->n_g_faces_connect_read += n_g_read[2];
+  mr->n_g_vertices_read += n_g_read[3];
+
+  cs_mesh_import_gmsh_destroy(&(f->gmsh));
+}
+
 /*----------------------------------------------------------------------------
  * Read pre-processor mesh data for a given mesh and finalize input.
  *
+ * Sections not matching the given pass are skipped; when reading in
+ * several passes, the mesh reader's face counters must be reset before
+ * the _READ_VERTICES pass, as face-based sections are read in both.
+ *
+ * When the _READ_VERTICES pass reads a single file, face -> vertices
+ * connectivity and vertex coordinates reads may only be started
+ * (see cs_io_iread_block), in which case the input is kept open and
+ * assigned to the mesh builder, so that these reads may be completed
+ * by cs_mesh_builder_complete_input as late as possible.
+ *
  * parameters:
  *   file_id <-- id of file handled by mesh builder
  *   mesh    <-> pointer to mesh structure
  *   mr      <-> pointer to mesh reader structure
+ *   pass    <-- sections handled by this read pass
  *   echo    <-- echo (verbosity) level
  *----------------------------------------------------------------------------*/
 
@@ -1348,6 +1447,7 @@ _read_data(int                 file_id,
            cs_mesh_t          *mesh,
            cs_mesh_builder_t  *mb,
            _mesh_reader_t     *mr,
+           _read_pass_t        pass,
            long                echo)
 {
   cs_int_t  perio_id, perio_type;
@@ -1376,11 +1476,21 @@ _read_data(int                 file_id,
   cs_gnum_t face_vtx_range[2] = {0, 0};
   _mesh_file_info_t  *f = NULL;
 
+  /* Arrays are reallocated for each file, so reads may only complete
+     later when they are all from a single file */
+
+  const bool nb_read = (pass == _READ_VERTICES && mr->n_files == 1);
+
   const char  *unexpected_msg = N_("Section of type <%s> on <%s>\n"
                                    "unexpected or of incorrect size.");
 
   f = mr->file_info + file_id;
 
+  if (f->gmsh != NULL) {
+    _read_gmsh_data(f, mesh, mb, mr);
+    return;
+  }
+
 #if defined(HAVE_MPI)
   {
     MPI_Info           hints;
@@ -1466,9 +1576,23 @@ _read_data(int                 file_id,
                   _("Section of type <%s> on <%s>\n"
                     "unexpected."), header.sec_name, cs_io_get_name(pp_in));
 
+      bool vtx_section
+        = (   strncmp(header.sec_name, "face_vertices_index",
+                      CS_IO_NAME_LEN) == 0
+           || strncmp(header.sec_name, "face_vertices",
+                      CS_IO_NAME_LEN) == 0
+           || strncmp(header.sec_name, "vertex_coords",
+                      CS_IO_NAME_LEN) == 0);
+
+      /* Sections handled by another pass */
+
+      if (   (pass == _READ_ADJACENCY && vtx_section)
+          || (pass == _READ_VERTICES && !vtx_section))
+        cs_io_skip(&header, pp_in);
+
       /* Face-cells connectivity */
 
-      if (strncmp(header.sec_name, "face_cells", CS_IO_NAME_LEN) == 0) {
+      else if (strncmp(header.sec_name, "face_cells", CS_IO_NAME_LEN) == 0) {
 
         /* Compute range for current file  */
         _data_range(&header,
@@ -1608,9 +1732,12 @@ _read_data(int                 file_id,
         n_faces = n_vals_cur;
         val_offset_cur = mr->n_faces_read;
 
-        /* Allocate for first file read */
-        if (mb->face_r_gen == NULL)
+        /* Allocate for first file read (files with no refinement
+           generation info only contain base faces) */
+        if (mb->face_r_gen == NULL) {
           BFT_MALLOC(mb->face_r_gen, n_vals, char);
+          memset(mb->face_r_gen, 0, n_vals);
+        }
 
         /* Read data */
         cs_io_read_block(&header, gnum_range_cur[0], gnum_range_cur[1],
@@ -1706,11 +1833,16 @@ _read_data(int                 file_id,
 
         /* Read data */
         cs_io_set_cs_gnum(&header, pp_in);
-        cs_io_read_block(&header, face_vtx_range[0], face_vtx_range[1],
-                         mb->face_vertices + val_offset_cur, pp_in);
+        if (nb_read)
+          cs_io_iread_block(&header, face_vtx_range[0], face_vtx_range[1],
+                            mb->face_vertices + val_offset_cur, pp_in);
+        else
+          cs_io_read_block(&header, face_vtx_range[0], face_vtx_range[1],
+                           mb->face_vertices + val_offset_cur, pp_in);
 
         /* Shift referenced vertex numbers in case of appended data */
         if (mr->n_g_vertices_read > 0) {
+          assert(nb_read == false);
           cs_lnum_t ii;
           for (ii = 0; ii < n_vals_cur; ii++) {
             if (mb->face_vertices[val_offset_cur + ii] != 0)
@@ -1746,8 +1878,12 @@ _read_data(int                 file_id,
 
         /* Read data */
         cs_io_assert_cs_real(&header, pp_in);
-        cs_io_read_block(&header, gnum_range_cur[0], gnum_range_cur[1],
-                         mb->vertex_coords + val_offset_cur, pp_in);
+        if (nb_read && f->matrix == NULL)
+          cs_io_iread_block(&header, gnum_range_cur[0], gnum_range_cur[1],
+                            mb->vertex_coords + val_offset_cur, pp_in);
+        else
+          cs_io_read_block(&header, gnum_range_cur[0], gnum_range_cur[1],
+                           mb->vertex_coords + val_offset_cur, pp_in);
 
         /* Transform coordinates if necessary */
 
@@ -1859,8 +1995,13 @@ _read_data(int                 file_id,
   /* Finalize pre-processor input */
   /*------------------------------*/
 
-  f->offset = 0;
-  cs_io_finalize(&pp_in);
+  if (pass != _READ_ADJACENCY)
+    f->offset = 0;
+
+  if (nb_read)
+    mb->vertex_input = pp_in;
+  else
+    cs_io_finalize(&pp_in);
 }
 
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
@@ -1916,6 +2057,10 @@ CS_PROCF(ledevi, LEDEVI)(cs_int_t   *iperio,
  * The first time this function is called,  this default is overriden by the
  * defined file, and all subsequent calls define additional meshes to read.
  *
+ * Files with a ".msh" extension are read directly as Gmsh (4.1 binary)
+ * files, bypassing the Preprocessor; other files should be Preprocessor
+ * output files.
+ *
  * parameters:
  *   file_name       <-- name of file to read
  *   n_group_renames <-- number of groups to rename
@@ -1997,6 +2142,8 @@ cs_preprocessor_data_add_file(const char     *file_name,
   f->old_group_names = NULL;
   f->new_group_names = NULL;
 
+  f->gmsh = NULL;
+
   if (n_group_renames > 0) {
 
     _old_group_names = (char **)(f->data + data_size);
@@ -2052,6 +2199,8 @@ cs_preprocessor_check_perio(void)
   _n_max_mesh_files = 0;
 
   for (int i = 0; i < _n_mesh_files; i++) {
+    if (cs_mesh_import_gmsh_check_file((_mesh_file_info + i)->filename))
+      continue;
     retval = _read_perio_info((_mesh_file_info + i)->filename);
     perio_flag = CS_MAX(retval, perio_flag);
   }
@@ -2182,17 +2331,70 @@ cs_preprocessor_data_read_mesh(cs_mesh_t          *mesh,
   else
     _set_block_ranges(mesh, mesh_builder);
 
-  for (file_id = 0; file_id < mr->n_files; file_id++)
-    _read_data(file_id, mesh, mesh_builder, mr, echo);
-
   if (mr->n_files > 1)
     mesh->modified = 1;
 
-  /* Partition data */
+  /* When partitioning only requires face -> cell adjacency, read face ->
+     vertex connectivity and vertex coordinates only once partitioning
+     is done, so that these arrays do not add to the partitioner's
+     memory footprint. With a single input file, these reads may then
+     still be in progress while cell and face -> cell data is distributed
+     (they are completed by cs_mesh_from_builder when needed, so that
+     time is included in the distribution time). Gmsh files are
+     transferred in a single step, so they are always read in a
+     single pass. */
+
+  bool split_read = false;
+
+  if (   cs_glob_n_ranks > 1
+      && pre_partitioned == false
+      && cs_partition_uses_geometry(partition_stage) == false) {
+    split_read = true;
+    for (file_id = 0; file_id < mr->n_files; file_id++) {
+      if ((mr->file_info + file_id)->gmsh != NULL)
+        split_read = false;
+    }
+  }
+
+  double t[5];
+  t[0] = cs_timer_wtime();
+
+  if (split_read) {
+
+    for (file_id = 0; file_id < mr->n_files; file_id++)
+      _read_data(file_id, mesh, mesh_builder, mr, _READ_ADJACENCY, echo);
+
+    t[1] = cs_timer_wtime();
 
-  if (! pre_partitioned)
     cs_partition(mesh, mesh_builder, partition_stage);
 
+    t[2] = cs_timer_wtime();
+
+    mr->n_faces_read = 0;
+    mr->n_g_faces_read = 0;
+
+    for (file_id = 0; file_id < mr->n_files; file_id++)
+      _read_data(file_id, mesh, mesh_builder, mr, _READ_VERTICES, echo);
+
+  }
+  else {
+
+    for (file_id = 0; file_id < mr->n_files; file_id++)
+      _read_data(file_id, mesh, mesh_builder, mr, _READ_ALL, echo);
+
+    t[1] = cs_timer_wtime();
+
+    /* Partition data */
+
+    if (! pre_partitioned)
+      cs_partition(mesh, mesh_builder, partition_stage);
+
+    t[2] = cs_timer_wtime();
+
+  }
+
+  t[3] = cs_timer_wtime();
+
   bft_printf("\n");
 
   /* Now send data to the correct rank */
@@ -2200,6 +2402,21 @@ cs_preprocessor_data_read_mesh(cs_mesh_t          *mesh,
 
   cs_mesh_from_builder(mesh, mesh_builder);
 
+  t[4] = cs_timer_wtime();
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\nMesh input:\n\n"
+                  "  reading:                    %.3g s\n"
+                  "  partitioning:               %.3g s\n"),
+                t[1]-t[0], t[2]-t[1]);
+  if (split_read)
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("  reading vertex data:        %.3g s\n"),
+                  t[3]-t[2]);
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("  distribution:               %.3g s\n"),
+                t[4]-t[3]);
+
   /* Free temporary memory */
 
   _mesh_reader_destroy(&mr);
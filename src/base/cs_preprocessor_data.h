@@ -75,6 +75,10 @@ CS_PROCF(ledevi, LEDEVI)(cs_int_t  *iperio,
  * The first time this function is called,  this default is overriden by the
  * defined file, and all subsequent calls define additional meshes to read.
  *
+ * Files with a ".msh" extension are read directly as Gmsh (4.1 binary)
+ * files, bypassing the Preprocessor; other files should be Preprocessor
+ * output files.
+ *
  * parameters:
  *   file_name       <-- name of file to read
  *   n_group_renames <-- number of groups to rename
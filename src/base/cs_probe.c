@@ -50,6 +50,7 @@
 #include "cs_map.h"
 #include "cs_math.h"
 #include "cs_mesh.h"
+#include "cs_mesh_box_index.h"
 #include "cs_mesh_connect.h"
 #include "cs_mesh_location.h"
 #include "cs_mesh_quantities.h"
@@ -435,6 +436,74 @@ _build_local_probe_set(cs_probe_set_t  *pset)
   pset->s_coords = s;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Restrict a list of location elements to those whose bounding box
+ *        may contain a probe of a given set.
+ *
+ * The persistent mesh bounding box index is used, so that the location
+ * mesh only needs to be built for elements close to probes.
+ *
+ * \param[in]       pset         pointer to a cs_probe_set_t structure
+ * \param[in]       on_boundary  true for boundary faces, false for cells
+ * \param[in, out]  n_elts       number of selected elements
+ * \param[in, out]  elt_list     list of selected elements (1 to n), or NULL
+ *                               for all elements (allocated if needed)
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_restrict_location_elts(const cs_probe_set_t   *pset,
+                        bool                    on_boundary,
+                        cs_lnum_t              *n_elts,
+                        cs_lnum_t             **elt_list)
+{
+  const cs_mesh_box_index_t *bi
+    = cs_mesh_box_index_get((on_boundary) ?
+                            CS_MESH_LOCATION_BOUNDARY_FACES :
+                            CS_MESH_LOCATION_CELLS);
+
+  const cs_lnum_t n_idx_elts = cs_mesh_box_index_get_n_elts(bi);
+  const double tolerance[2] = {0., pset->tolerance};
+
+  char *elt_flag;
+  BFT_MALLOC(elt_flag, n_idx_elts, char);
+
+  cs_lnum_t n_marked
+    = cs_mesh_box_index_mark_elts(bi,
+                                  tolerance,
+                                  pset->n_probes,
+                                  (const cs_real_3_t *)(pset->coords),
+                                  elt_flag);
+
+  cs_lnum_t *_elt_list = *elt_list;
+
+  if (_elt_list == NULL) {
+    if (n_marked < n_idx_elts) {
+      /* Keep a non-NULL list even if empty (NULL would select all) */
+      BFT_MALLOC(_elt_list, CS_MAX(n_marked, 1), cs_lnum_t);
+      cs_lnum_t j = 0;
+      for (cs_lnum_t i = 0; i < n_idx_elts; i++) {
+        if (elt_flag[i])
+          _elt_list[j++] = i+1;
+      }
+      *n_elts = j;
+    }
+  }
+  else {
+    cs_lnum_t j = 0;
+    for (cs_lnum_t i = 0; i < *n_elts; i++) {
+      if (elt_flag[_elt_list[i] - 1])
+        _elt_list[j++] = _elt_list[i];
+    }
+    *n_elts = j;
+  }
+
+  BFT_FREE(elt_flag);
+
+  *elt_list = _elt_list;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1065,6 +1134,11 @@ cs_probe_set_locate(cs_probe_set_t     *pset,
         }
       } /* Need to define a list of faces ? */
 
+      _restrict_location_elts(pset,
+                              on_boundary,
+                              &n_select_elements,
+                              &selected_elements);
+
       _location_mesh = cs_mesh_connect_faces_to_nodal(mesh,
                                                       "probe_location_mesh",
                                                       false, // no family info
@@ -1085,6 +1159,11 @@ cs_probe_set_locate(cs_probe_set_t     *pset,
         }
       } /* Need to define a list of cells ? */
 
+      _restrict_location_elts(pset,
+                              on_boundary,
+                              &n_select_elements,
+                              &selected_elements);
+
       _location_mesh = cs_mesh_connect_cells_to_nodal(mesh,
                                                       "probe_location_mesh",
                                                       false, // no family info
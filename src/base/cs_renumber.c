@@ -98,6 +98,7 @@ extern "C" {
 #include "cs_parall.h"
 #include "cs_post.h"
 #include "cs_sort.h"
+#include "cs_timer.h"
 #include "cs_prototypes.h"
 
 /*----------------------------------------------------------------------------
@@ -222,6 +223,9 @@ static bool _cells_adjacent_to_halo_last = false;
 static bool _i_faces_adjacent_to_halo_last = false;
 static cs_renumber_ordering_t _i_faces_base_ordering = CS_RENUMBER_ADJACENT_LOW;
 
+static bool _autotune = false;
+static double _autotune_t_measure = 0.05;
+
 static cs_renumber_cells_type_t _cells_algorithm[] = {CS_RENUMBER_CELLS_NONE,
                                                       CS_RENUMBER_CELLS_NONE};
 
@@ -3079,7 +3083,7 @@ _renum_b_faces_for_vectorizing(cs_mesh_t  *mesh,
 }
 
 /*----------------------------------------------------------------------------
- * Log statistics for bandwidth and profile.
+ * Compute bandwidth and profile of a face -> cells adjacency.
  *
  * Bandwidth ist the maximum distance between two adjacent vertices (cells),
  * with distance measured by the difference of vertex (cell) ids.
@@ -3087,40 +3091,43 @@ _renum_b_faces_for_vectorizing(cs_mesh_t  *mesh,
  * Profile is the sum of all the maximum distances between the i-th vertex
  * and any of its neighbors with an index j > i (as the matrix structure
  * is symmetric, this simplifies to the sum of the maximum distances between
- * a vertex and any of its neighbors).
+ * a vertex and any of its neighbors), divided by the number of vertices.
  *
  * parameters:
- *   mesh      <-- associated mesh
- *   title     <-- title or name of mesh or matrix
+ *   n_cells      <-- number of cells
+ *   n_cells_ext  <-- number of cells with ghosts
+ *   n_faces      <-- number of interior faces
+ *   face_cells   <-- interior face -> cells connectivity
+ *   bandwidth    --> matrix bandwidth
+ *   profile      --> matrix profile / lines
  *----------------------------------------------------------------------------*/
 
 static void
-_log_bandwidth_info(const cs_mesh_t  *mesh,
-                    const char       *title)
+_bandwidth_profile(cs_lnum_t           n_cells,
+                   cs_lnum_t           n_cells_ext,
+                   cs_lnum_t           n_faces,
+                   const cs_lnum_2_t   face_cells[],
+                   cs_lnum_t          *bandwidth,
+                   cs_gnum_t          *profile)
 {
-  cs_lnum_t cell_id, face_id;
-
-  cs_lnum_t bandwidth = 0;
-  cs_gnum_t profile = 0;
+  cs_lnum_t _bandwidth = 0;
+  cs_gnum_t _profile = 0;
   cs_lnum_t *max_distance = NULL;
 
-  const cs_lnum_2_t *restrict i_face_cells
-    = (const cs_lnum_2_t *restrict)mesh->i_face_cells;
-
-  BFT_MALLOC(max_distance, mesh->n_cells_with_ghosts, cs_lnum_t);
+  BFT_MALLOC(max_distance, n_cells_ext, cs_lnum_t);
 
-  for (cell_id = 0; cell_id < mesh->n_cells_with_ghosts; cell_id++)
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells_ext; cell_id++)
     max_distance[cell_id] = 0;
 
-  for (face_id = 0; face_id < mesh->n_i_faces; face_id++) {
+  for (cs_lnum_t face_id = 0; face_id < n_faces; face_id++) {
 
-    cs_lnum_t cid0 = i_face_cells[face_id][0];
-    cs_lnum_t cid1 = i_face_cells[face_id][1];
+    cs_lnum_t cid0 = face_cells[face_id][0];
+    cs_lnum_t cid1 = face_cells[face_id][1];
 
     cs_lnum_t distance = CS_ABS(cid1 - cid0);
 
-    if (distance > bandwidth)
-      bandwidth = distance;
+    if (distance > _bandwidth)
+      _bandwidth = distance;
 
     if (distance > max_distance[cid0])
       max_distance[cid0] = distance;
@@ -3129,13 +3136,40 @@ _log_bandwidth_info(const cs_mesh_t  *mesh,
       max_distance[cid1] = distance;
   }
 
-  for (cell_id = 0; cell_id < mesh->n_cells; cell_id++)
-    profile += max_distance[cell_id];
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
+    _profile += max_distance[cell_id];
 
-  profile /= mesh->n_cells;
+  if (n_cells > 0)
+    _profile /= n_cells;
 
   BFT_FREE(max_distance);
 
+  *bandwidth = _bandwidth;
+  *profile = _profile;
+}
+
+/*----------------------------------------------------------------------------
+ * Log statistics for bandwidth and profile.
+ *
+ * parameters:
+ *   mesh      <-- associated mesh
+ *   title     <-- title or name of mesh or matrix
+ *----------------------------------------------------------------------------*/
+
+static void
+_log_bandwidth_info(const cs_mesh_t  *mesh,
+                    const char       *title)
+{
+  cs_lnum_t bandwidth = 0;
+  cs_gnum_t profile = 0;
+
+  _bandwidth_profile(mesh->n_cells,
+                     mesh->n_cells_with_ghosts,
+                     mesh->n_i_faces,
+                     (const cs_lnum_2_t *)mesh->i_face_cells,
+                     &bandwidth,
+                     &profile);
+
 #if defined(HAVE_MPI)
 
   if (cs_glob_n_ranks > 1) {
@@ -4818,6 +4852,562 @@ _renumber_vertices_by_face_adjacency(cs_mesh_t  *mesh,
 
 }
 
+/*----------------------------------------------------------------------------
+ * Build interior face -> cells connectivity for autotuning measures.
+ *
+ * Cells are renumbered using the given renumbering array, and faces are
+ * either renumbered using the given face renumbering array, or ordered
+ * lexicographically by adjacent cell ids (which is the base ordering
+ * used by interior face renumbering algorithms).
+ *
+ * parameters:
+ *   mesh          <-- pointer to mesh structure
+ *   new_to_old_c  <-- new to old cells renumbering, or NULL
+ *   new_to_old_i  <-- new to old interior faces renumbering, or NULL
+ *   face_cells    --> interior face -> cells connectivity (size: n_i_faces)
+ *----------------------------------------------------------------------------*/
+
+static void
+_autotune_face_cells(const cs_mesh_t  *mesh,
+                     const cs_lnum_t   new_to_old_c[],
+                     const cs_lnum_t   new_to_old_i[],
+                     cs_lnum_2_t       face_cells[])
+{
+  const cs_lnum_t n_cells = mesh->n_cells;
+  const cs_lnum_t n_cells_ext = mesh->n_cells_with_ghosts;
+  const cs_lnum_t n_i_faces = mesh->n_i_faces;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)mesh->i_face_cells;
+
+  if (new_to_old_i != NULL) {
+#   pragma omp parallel for if (n_i_faces > CS_THR_MIN)
+    for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+      face_cells[f_id][0] = i_face_cells[new_to_old_i[f_id]][0];
+      face_cells[f_id][1] = i_face_cells[new_to_old_i[f_id]][1];
+    }
+    return;
+  }
+
+  cs_lnum_t *old_to_new_c, *faces_keys, *order;
+
+  BFT_MALLOC(old_to_new_c, n_cells_ext, cs_lnum_t);
+  BFT_MALLOC(faces_keys, n_i_faces*2, cs_lnum_t);
+  BFT_MALLOC(order, n_i_faces, cs_lnum_t);
+
+  if (new_to_old_c != NULL) {
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+      old_to_new_c[new_to_old_c[c_id]] = c_id;
+  }
+  else {
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+      old_to_new_c[c_id] = c_id;
+  }
+  for (cs_lnum_t c_id = n_cells; c_id < n_cells_ext; c_id++)
+    old_to_new_c[c_id] = c_id;
+
+# pragma omp parallel for if (n_i_faces > CS_THR_MIN)
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    cs_lnum_t c_id_0 = old_to_new_c[i_face_cells[f_id][0]];
+    cs_lnum_t c_id_1 = old_to_new_c[i_face_cells[f_id][1]];
+    if (c_id_0 < c_id_1) {
+      faces_keys[f_id*2]     = c_id_0;
+      faces_keys[f_id*2 + 1] = c_id_1;
+    }
+    else {
+      faces_keys[f_id*2]     = c_id_1;
+      faces_keys[f_id*2 + 1] = c_id_0;
+    }
+  }
+
+  cs_order_lnum_allocated_s(NULL, faces_keys, 2, order, n_i_faces);
+
+# pragma omp parallel for if (n_i_faces > CS_THR_MIN)
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    cs_lnum_t o_id = order[f_id];
+    face_cells[f_id][0] = old_to_new_c[i_face_cells[o_id][0]];
+    face_cells[f_id][1] = old_to_new_c[i_face_cells[o_id][1]];
+  }
+
+  BFT_FREE(order);
+  BFT_FREE(faces_keys);
+  BFT_FREE(old_to_new_c);
+}
+
+/*----------------------------------------------------------------------------
+ * Apply a representative face-based kernel for autotuning measures.
+ *
+ * Kernels are simplified versions of a cell gradient computation using
+ * the Green-Gauss method (kernel_id 0), of a native matrix-vector product
+ * (kernel_id 1), and of a convection-diffusion balance (kernel_id 2).
+ *
+ * parameters:
+ *   kernel_id    <-- kernel id (0: gradient, 1: SpMV, 2: balance)
+ *   n_cells      <-- number of cells
+ *   n_cells_ext  <-- number of cells with ghosts
+ *   n_threads    <-- number of threads in face group index
+ *   n_groups     <-- number of groups in face group index
+ *   group_index  <-- face group/thread index
+ *   face_cells   <-- interior face -> cells connectivity
+ *   f_val        <-- face values (size: 4*n_faces)
+ *   c_val        <-- cell values (size: n_cells_ext)
+ *   c_res        <-> cell results (size: 3*n_cells_ext)
+ *----------------------------------------------------------------------------*/
+
+static void
+_autotune_kernel(int                kernel_id,
+                 cs_lnum_t          n_cells,
+                 cs_lnum_t          n_cells_ext,
+                 int                n_threads,
+                 int                n_groups,
+                 const cs_lnum_t    group_index[],
+                 const cs_lnum_2_t  face_cells[],
+                 const cs_real_t    f_val[],
+                 const cs_real_t    c_val[],
+                 cs_real_t          c_res[])
+{
+  cs_real_3_t *restrict c_res_3 = (cs_real_3_t *restrict)c_res;
+
+  if (kernel_id == 0) {
+
+#   pragma omp parallel for if (n_cells_ext > CS_THR_MIN)
+    for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
+      c_res_3[c_id][0] = 0.;
+      c_res_3[c_id][1] = 0.;
+      c_res_3[c_id][2] = 0.;
+    }
+
+    for (int g_id = 0; g_id < n_groups; g_id++) {
+#     pragma omp parallel for
+      for (int t_id = 0; t_id < n_threads; t_id++) {
+        for (cs_lnum_t f_id = group_index[(t_id*n_groups + g_id)*2];
+             f_id < group_index[(t_id*n_groups + g_id)*2 + 1];
+             f_id++) {
+          cs_lnum_t c_id_0 = face_cells[f_id][0];
+          cs_lnum_t c_id_1 = face_cells[f_id][1];
+          cs_real_t w = f_val[f_id*4];
+          cs_real_t pfac = w*c_val[c_id_0] + (1.-w)*c_val[c_id_1];
+          for (cs_lnum_t j = 0; j < 3; j++) {
+            c_res_3[c_id_0][j] += pfac*f_val[f_id*4 + 1 + j];
+            c_res_3[c_id_1][j] -= pfac*f_val[f_id*4 + 1 + j];
+          }
+        }
+      }
+    }
+
+  }
+
+  else if (kernel_id == 1) {
+
+#   pragma omp parallel for if (n_cells > CS_THR_MIN)
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+      c_res[c_id] = 4.*c_val[c_id];
+
+    for (int g_id = 0; g_id < n_groups; g_id++) {
+#     pragma omp parallel for
+      for (int t_id = 0; t_id < n_threads; t_id++) {
+        for (cs_lnum_t f_id = group_index[(t_id*n_groups + g_id)*2];
+             f_id < group_index[(t_id*n_groups + g_id)*2 + 1];
+             f_id++) {
+          cs_lnum_t c_id_0 = face_cells[f_id][0];
+          cs_lnum_t c_id_1 = face_cells[f_id][1];
+          cs_real_t xa = f_val[f_id*4 + 1];
+          c_res[c_id_0] += xa*c_val[c_id_1];
+          c_res[c_id_1] += xa*c_val[c_id_0];
+        }
+      }
+    }
+
+  }
+
+  else {
+
+#   pragma omp parallel for if (n_cells_ext > CS_THR_MIN)
+    for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++)
+      c_res[c_id] = 0.;
+
+    for (int g_id = 0; g_id < n_groups; g_id++) {
+#     pragma omp parallel for
+      for (int t_id = 0; t_id < n_threads; t_id++) {
+        for (cs_lnum_t f_id = group_index[(t_id*n_groups + g_id)*2];
+             f_id < group_index[(t_id*n_groups + g_id)*2 + 1];
+             f_id++) {
+          cs_lnum_t c_id_0 = face_cells[f_id][0];
+          cs_lnum_t c_id_1 = face_cells[f_id][1];
+          cs_real_t m = f_val[f_id*4 + 2];
+          cs_real_t flux =   CS_MAX(m, 0.)*c_val[c_id_0]
+                           + CS_MIN(m, 0.)*c_val[c_id_1]
+                           + f_val[f_id*4 + 3]*(c_val[c_id_0]-c_val[c_id_1]);
+          c_res[c_id_0] -= flux;
+          c_res[c_id_1] += flux;
+        }
+      }
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Measure the cost of representative face-based kernels for a given
+ * interior face -> cells connectivity and face group index.
+ *
+ * As for matrix tuning, each kernel is run until the minimum measure time
+ * is reached on all ranks.
+ *
+ * parameters:
+ *   n_cells      <-- number of cells
+ *   n_cells_ext  <-- number of cells with ghosts
+ *   n_faces      <-- number of interior faces
+ *   n_threads    <-- number of threads in face group index
+ *   n_groups     <-- number of groups in face group index
+ *   group_index  <-- face group/thread index, or NULL
+ *   face_cells   <-- interior face -> cells connectivity
+ *   t_measure    <-- minimum time for each measure
+ *   cost         --> time per run of each kernel (size: 3)
+ *----------------------------------------------------------------------------*/
+
+static void
+_autotune_measure(cs_lnum_t          n_cells,
+                  cs_lnum_t          n_cells_ext,
+                  cs_lnum_t          n_faces,
+                  int                n_threads,
+                  int                n_groups,
+                  const cs_lnum_t    group_index[],
+                  const cs_lnum_2_t  face_cells[],
+                  double             t_measure,
+                  double             cost[3])
+{
+  cs_lnum_t _group_index[2] = {0, n_faces};
+  cs_real_t *f_val, *c_val, *c_res;
+
+  if (group_index == NULL) {
+    n_threads = 1;
+    n_groups = 1;
+    group_index = _group_index;
+  }
+
+  BFT_MALLOC(f_val, n_faces*4, cs_real_t);
+  BFT_MALLOC(c_val, n_cells_ext, cs_real_t);
+  BFT_MALLOC(c_res, n_cells_ext*3, cs_real_t);
+
+  /* Values are arbitrary, but initialized consistently with the
+     face and cell numberings so that measures are reproducible */
+
+# pragma omp parallel for if (n_faces > CS_THR_MIN)
+  for (cs_lnum_t f_id = 0; f_id < n_faces; f_id++) {
+    f_val[f_id*4]     = 0.5;
+    f_val[f_id*4 + 1] = -1.;
+    f_val[f_id*4 + 2] = (f_id % 2) ? 1. : -1.;
+    f_val[f_id*4 + 3] = 0.1;
+  }
+
+# pragma omp parallel for if (n_cells_ext > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++)
+    c_val[c_id] = 1.;
+
+  for (int k_id = 0; k_id < 3; k_id++) {
+
+    double wt0 = cs_timer_wtime(), wt1 = wt0;
+    int run_id = 0, n_runs = 1;
+
+    while (run_id < n_runs) {
+      while (run_id < n_runs) {
+        _autotune_kernel(k_id,
+                         n_cells,
+                         n_cells_ext,
+                         n_threads,
+                         n_groups,
+                         group_index,
+                         face_cells,
+                         f_val,
+                         c_val,
+                         c_res);
+        run_id++;
+      }
+      wt1 = cs_timer_wtime();
+      double wt_r0 = wt1 - wt0;
+
+      cs_parall_max(1, CS_DOUBLE, &wt_r0);
+
+      if (wt_r0 < t_measure)
+        n_runs *= 2;
+    }
+
+    cost[k_id] = (wt1 - wt0) / n_runs;
+
+  }
+
+  BFT_FREE(c_res);
+  BFT_FREE(c_val);
+  BFT_FREE(f_val);
+}
+
+/*----------------------------------------------------------------------------
+ * Log autotuning measures for a renumbering candidate.
+ *
+ * Bandwidth and costs are the maximum values over all ranks.
+ *
+ * parameters:
+ *   name         <-- candidate algorithm name
+ *   n_cells      <-- number of cells
+ *   n_cells_ext  <-- number of cells with ghosts
+ *   n_faces      <-- number of interior faces
+ *   face_cells   <-- interior face -> cells connectivity
+ *   cost         <-- time per run of each kernel, or negative if
+ *                    the candidate is not available
+ *----------------------------------------------------------------------------*/
+
+static void
+_autotune_log(const char         *name,
+              cs_lnum_t           n_cells,
+              cs_lnum_t           n_cells_ext,
+              cs_lnum_t           n_faces,
+              const cs_lnum_2_t   face_cells[],
+              const double        cost[3])
+{
+  cs_lnum_t bandwidth = 0;
+  cs_gnum_t profile = 0;
+
+  if (cost[0] < 0) {
+    bft_printf(_("   %-38s    (failed)\n"), _(name));
+    return;
+  }
+
+  _bandwidth_profile(n_cells, n_cells_ext, n_faces, face_cells,
+                     &bandwidth, &profile);
+
+  cs_gnum_t _bandwidth = bandwidth;
+  cs_parall_max(1, CS_GNUM_TYPE, &_bandwidth);
+
+  bft_printf("   %-38s %10llu %10.3e %10.3e %10.3e\n",
+             _(name), (unsigned long long)_bandwidth,
+             cost[0], cost[1], cost[2]);
+}
+
+/*----------------------------------------------------------------------------
+ * Select the cells numbering algorithm based on the measured cost of
+ * representative face-based kernels.
+ *
+ * All locality renumbering algorithms available in this build are tried;
+ * for each candidate, interior faces are ordered by adjacent cell ids, and
+ * the candidate leading to the lowest cumulated kernel cost (maximum over
+ * ranks) is kept.
+ *
+ * parameters:
+ *   mesh <-- pointer to global mesh structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_autotune_cells_algorithm(cs_mesh_t  *mesh)
+{
+  const cs_renumber_cells_type_t candidates[]
+    = {CS_RENUMBER_CELLS_NONE,
+       CS_RENUMBER_CELLS_MORTON,
+       CS_RENUMBER_CELLS_HILBERT,
+       CS_RENUMBER_CELLS_RCM,
+#if defined(HAVE_METIS) || defined(HAVE_PARMETIS)
+       CS_RENUMBER_CELLS_METIS_PART,
+       CS_RENUMBER_CELLS_METIS_ORDER,
+#endif
+#if defined(HAVE_SCOTCH) || defined(HAVE_PTSCOTCH)
+       CS_RENUMBER_CELLS_SCOTCH_PART,
+       CS_RENUMBER_CELLS_SCOTCH_ORDER,
+#endif
+      };
+
+  const int n_candidates = sizeof(candidates) / sizeof(candidates[0]);
+
+  const cs_lnum_t n_cells = mesh->n_cells;
+  const cs_lnum_t n_cells_ext = mesh->n_cells_with_ghosts;
+  const cs_lnum_t n_i_faces = mesh->n_i_faces;
+
+  int best_id = -1;
+  double best_cost = HUGE_VAL;
+
+  cs_lnum_t *new_to_old_c;
+  cs_lnum_2_t *face_cells;
+
+  BFT_MALLOC(new_to_old_c, n_cells_ext, cs_lnum_t);
+  BFT_MALLOC(face_cells, n_i_faces, cs_lnum_2_t);
+
+  bft_printf
+    (_("\n Autotuning of cells renumbering\n"
+       " (bandwidth and time per run, in s, of representative kernels):\n\n"
+       "   %-38s %10s %10s %10s %10s\n"),
+     _("algorithm"), _("bandwidth"), _("gradient"), _("SpMV"), _("balance"));
+
+  for (int i = 0; i < n_candidates; i++) {
+
+    double cost[3] = {0, 0, 0};
+    int retval = 0;
+
+    if (candidates[i] != CS_RENUMBER_CELLS_NONE)
+      retval = _cells_locality_renumbering(mesh,
+                                           candidates[i],
+                                           new_to_old_c);
+
+    /* Ensure consistent measures and choice across ranks */
+
+    cs_parall_min(1, CS_INT_TYPE, &retval);
+
+    if (retval < 0) {
+      cost[0] = -1;
+    }
+    else {
+      _autotune_face_cells(mesh,
+                           (candidates[i] != CS_RENUMBER_CELLS_NONE) ?
+                           new_to_old_c : NULL,
+                           NULL,
+                           face_cells);
+
+      _autotune_measure(n_cells, n_cells_ext, n_i_faces,
+                        1, 1, NULL,
+                        (const cs_lnum_2_t *)face_cells,
+                        _autotune_t_measure,
+                        cost);
+
+      /* Use the slowest rank's timings, so all ranks select
+         the same algorithm */
+
+      cs_parall_max(3, CS_DOUBLE, cost);
+
+      double c_sum = cost[0] + cost[1] + cost[2];
+      if (c_sum < best_cost) {
+        best_cost = c_sum;
+        best_id = i;
+      }
+    }
+
+    _autotune_log(_cell_renum_name[candidates[i]],
+                  n_cells, n_cells_ext, n_i_faces,
+                  (const cs_lnum_2_t *)face_cells,
+                  cost);
+
+  }
+
+  BFT_FREE(face_cells);
+  BFT_FREE(new_to_old_c);
+
+  if (best_id > -1) {
+    _cells_algorithm[1] = candidates[best_id];
+    bft_printf(_("\n   selected: %s\n"),
+               _(_cell_renum_name[_cells_algorithm[1]]));
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Select the interior faces numbering algorithm for threads based on the
+ * measured cost of representative face-based kernels.
+ *
+ * Only algorithms building thread groups are compared; faces are assumed
+ * to be already ordered by adjacent cell ids.
+ *
+ * parameters:
+ *   mesh         <-- pointer to global mesh structure
+ *   n_i_threads  <-- number of threads required for interior faces
+ *----------------------------------------------------------------------------*/
+
+static void
+_autotune_i_faces_algorithm(cs_mesh_t  *mesh,
+                            int         n_i_threads)
+{
+  const cs_renumber_i_faces_type_t candidates[]
+    = {CS_RENUMBER_I_FACES_BLOCK,
+       CS_RENUMBER_I_FACES_MULTIPASS};
+
+  const int n_candidates = sizeof(candidates) / sizeof(candidates[0]);
+
+  const cs_lnum_t n_cells = mesh->n_cells;
+  const cs_lnum_t n_cells_ext = mesh->n_cells_with_ghosts;
+  const cs_lnum_t n_i_faces = mesh->n_i_faces;
+
+  int best_id = -1;
+  double best_cost = HUGE_VAL;
+
+  cs_lnum_t *new_to_old_i;
+  cs_lnum_2_t *face_cells;
+
+  BFT_MALLOC(new_to_old_i, n_i_faces, cs_lnum_t);
+  BFT_MALLOC(face_cells, n_i_faces, cs_lnum_2_t);
+
+  bft_printf
+    (_("\n Autotuning of interior faces renumbering for %d threads\n"
+       " (bandwidth and time per run, in s, of representative kernels):\n\n"
+       "   %-38s %10s %10s %10s %10s\n"),
+     n_i_threads,
+     _("algorithm"), _("bandwidth"), _("gradient"), _("SpMV"), _("balance"));
+
+  for (int i = 0; i < n_candidates; i++) {
+
+    double cost[3] = {0, 0, 0};
+    cs_lnum_t n_i_groups = 1, n_i_no_adj_halo_groups = 0;
+    cs_lnum_t *i_group_index = NULL;
+    int retval = 0;
+
+    for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++)
+      new_to_old_i[f_id] = f_id;
+
+    if (candidates[i] == CS_RENUMBER_I_FACES_BLOCK)
+      retval = _renum_i_faces_no_share_cell_in_block(mesh,
+                                                     n_i_threads,
+                                                     1014, /* default */
+                                                     new_to_old_i,
+                                                     &n_i_groups,
+                                                     &i_group_index);
+    else
+      retval = _renum_face_multipass(mesh,
+                                     n_i_threads,
+                                     new_to_old_i,
+                                     &n_i_groups,
+                                     &n_i_no_adj_halo_groups,
+                                     &i_group_index);
+
+    int _retval = (retval == 0) ? 0 : -1;
+    cs_parall_min(1, CS_INT_TYPE, &_retval);
+
+    if (_retval < 0) {
+      cost[0] = -1;
+    }
+    else {
+      _autotune_face_cells(mesh, NULL, new_to_old_i, face_cells);
+
+      _autotune_measure(n_cells, n_cells_ext, n_i_faces,
+                        n_i_threads, n_i_groups, i_group_index,
+                        (const cs_lnum_2_t *)face_cells,
+                        _autotune_t_measure,
+                        cost);
+
+      /* Use the slowest rank's timings, so all ranks select
+         the same algorithm */
+
+      cs_parall_max(3, CS_DOUBLE, cost);
+
+      double c_sum = cost[0] + cost[1] + cost[2];
+      if (c_sum < best_cost) {
+        best_cost = c_sum;
+        best_id = i;
+      }
+    }
+
+    BFT_FREE(i_group_index);
+
+    _autotune_log(_i_face_renum_name[candidates[i]],
+                  n_cells, n_cells_ext, n_i_faces,
+                  (const cs_lnum_2_t *)face_cells,
+                  cost);
+
+  }
+
+  BFT_FREE(face_cells);
+  BFT_FREE(new_to_old_i);
+
+  if (best_id > -1) {
+    _i_faces_algorithm = candidates[best_id];
+    bft_printf(_("\n   selected: %s\n"),
+               _(_i_face_renum_name[_i_faces_algorithm]));
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Renumber cells for locality and possible computation/communication
  * overlap.
@@ -4838,6 +5428,11 @@ _renumber_cells(cs_mesh_t  *mesh)
 
   mesh->cell_numbering = cs_numbering_create_default(mesh->n_cells);
 
+  /* Optionally select numbering algorithm based on measured performance */
+
+  if (_autotune)
+    _autotune_cells_algorithm(mesh);
+
   BFT_MALLOC(new_to_old_c, mesh->n_cells_with_ghosts, cs_lnum_t);
 
   /* When do we reorder cells by adjacent halo ?
@@ -4965,6 +5560,15 @@ _renumber_i_faces(cs_mesh_t  *mesh)
      For some algorithms (such as multipass), this lexicographical ordering is
      included, so for better efficiency, it is not called twice. */
 
+  /* Optionally select threading algorithm based on measured performance */
+
+  if (   _autotune && n_i_threads > 1
+      && (   _i_faces_algorithm == CS_RENUMBER_I_FACES_BLOCK
+          || _i_faces_algorithm == CS_RENUMBER_I_FACES_MULTIPASS)) {
+    _renumber_i_faces_by_cell_adjacency(mesh);
+    _autotune_i_faces_algorithm(mesh, n_i_threads);
+  }
+
   /* Adjust block size depending on the number of faces and threads */
 
   switch (_i_faces_algorithm) {
@@ -5553,6 +6157,49 @@ _renumber_b_test(cs_mesh_t  *mesh)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Move face -> cells connectivity arrays so that their memory is first
+ * touched using the thread partition defined by the final face numbering.
+ *
+ * Those arrays are allocated and initialized serially when the mesh is
+ * loaded, so with OpenMP and multiple NUMA domains, they would otherwise
+ * be placed on the domain of the main thread.
+ *
+ * parameters:
+ *   mesh  <->  pointer to global mesh structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_first_touch_face_cells(cs_mesh_t  *mesh)
+{
+  if (_cs_renumber_n_threads < 2)
+    return;
+
+  if (mesh->i_face_cells != NULL) {
+    cs_lnum_2_t *i_face_cells;
+    BFT_MALLOC(i_face_cells, mesh->n_i_faces, cs_lnum_2_t);
+    cs_numbering_first_touch(mesh->i_face_numbering,
+                             mesh->n_i_faces,
+                             sizeof(cs_lnum_2_t),
+                             mesh->i_face_cells,
+                             i_face_cells);
+    BFT_FREE(mesh->i_face_cells);
+    mesh->i_face_cells = i_face_cells;
+  }
+
+  if (mesh->b_face_cells != NULL) {
+    cs_lnum_t *b_face_cells;
+    BFT_MALLOC(b_face_cells, mesh->n_b_faces, cs_lnum_t);
+    cs_numbering_first_touch(mesh->b_face_numbering,
+                             mesh->n_b_faces,
+                             sizeof(cs_lnum_t),
+                             mesh->b_face_cells,
+                             b_face_cells);
+    BFT_FREE(mesh->b_face_cells);
+    mesh->b_face_cells = b_face_cells;
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Renumber mesh elements for vectorization or OpenMP depending on code
  * options and target machine.
@@ -5580,6 +6227,9 @@ _renumber_mesh(cs_mesh_t  *mesh)
       return;
     }
 
+    if (strcmp(p, "auto") == 0)
+      _autotune = true;
+
 #if defined(HAVE_IBM_RENUMBERING_LIB)
     if (strcmp(p, "IBM") == 0) {
       bft_printf("\n Use IBM Mesh renumbering.\n\n");
@@ -5768,6 +6418,53 @@ cs_renumber_get_min_subset_size(cs_lnum_t  *min_i_subset_size,
     *min_b_subset_size = _min_b_subset_size;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or deactivate autotuning of mesh renumbering.
+ *
+ * When activated, all cells locality renumbering algorithms available
+ * in this build (and interior faces threading algorithms, when using
+ * multiple threads) are tried, the cost of representative face-based
+ * kernels (gradient, matrix-vector product, convection-diffusion balance)
+ * is measured for each, and the fastest is selected instead of the
+ * algorithm defined by \ref cs_renumber_set_algorithm.
+ *
+ * Autotuning may also be activated by setting the CS_RENUMBER environment
+ * variable to "auto".
+ *
+ * \param[in]  autotune   true to activate autotuning, false otherwise
+ * \param[in]  t_measure  minimum measure time for each kernel, in seconds
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_renumber_set_autotune(bool    autotune,
+                         double  t_measure)
+{
+  _autotune = autotune;
+  if (t_measure > 0)
+    _autotune_t_measure = t_measure;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Query autotuning settings for mesh renumbering.
+ *
+ * \param[out]  autotune   true if autotuning is active, or NULL
+ * \param[out]  t_measure  minimum measure time for each kernel, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_renumber_get_autotune(bool    *autotune,
+                         double  *t_measure)
+{
+  if (autotune != NULL)
+    *autotune = _autotune;
+  if (t_measure != NULL)
+    *t_measure = _autotune_t_measure;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Select the algorithm for mesh renumbering.
@@ -5897,6 +6594,8 @@ cs_renumber_mesh(cs_mesh_t  *mesh)
   _renumber_i_test(mesh);
   _renumber_b_test(mesh);
 
+  _first_touch_face_cells(mesh);
+
   if (mesh->verbosity > 0)
     _log_bandwidth_info(mesh, _("volume mesh"));
 }
@@ -5933,6 +6632,8 @@ cs_renumber_cells(cs_mesh_t  *mesh)
         mesh->cell_numbering = cs_numbering_create_default(mesh->n_cells);
       return;
     }
+    else if (strcmp(p, "auto") == 0)
+      _autotune = true;
   }
 
   /* Apply renumbering */
@@ -5983,6 +6684,8 @@ cs_renumber_i_faces(cs_mesh_t  *mesh)
         mesh->i_face_numbering = cs_numbering_create_default(mesh->n_i_faces);
       return;
     }
+    else if (strcmp(p, "auto") == 0)
+      _autotune = true;
   }
 
   /* Apply renumbering */
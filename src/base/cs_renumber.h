@@ -150,6 +150,42 @@ void
 cs_renumber_get_min_subset_size(cs_lnum_t  *min_i_subset_size,
                                 cs_lnum_t  *min_b_subset_size);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or deactivate autotuning of mesh renumbering.
+ *
+ * When activated, all cells locality renumbering algorithms available
+ * in this build (and interior faces threading algorithms, when using
+ * multiple threads) are tried, the cost of representative face-based
+ * kernels (gradient, matrix-vector product, convection-diffusion balance)
+ * is measured for each, and the fastest is selected instead of the
+ * algorithm defined by \ref cs_renumber_set_algorithm.
+ *
+ * Autotuning may also be activated by setting the CS_RENUMBER environment
+ * variable to "auto".
+ *
+ * \param[in]  autotune   true to activate autotuning, false otherwise
+ * \param[in]  t_measure  minimum measure time for each kernel, in seconds
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_renumber_set_autotune(bool    autotune,
+                         double  t_measure);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Query autotuning settings for mesh renumbering.
+ *
+ * \param[out]  autotune   true if autotuning is active, or NULL
+ * \param[out]  t_measure  minimum measure time for each kernel, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_renumber_get_autotune(bool    *autotune,
+                         double  *t_measure);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Select the algorithm for mesh renumbering.
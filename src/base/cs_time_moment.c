@@ -107,6 +107,15 @@ BEGIN_C_DECLS
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
+/*=============================================================================
+ * Local macro definitions
+ *============================================================================*/
+
+/* Block size for fused moment updates (elements handled by a thread
+   for all moments of a given location before moving to the next block) */
+
+#define CS_TIME_MOMENT_BLOCK_SIZE 256
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
@@ -204,6 +213,24 @@ typedef struct {
 
 } cs_time_moment_restart_info_t;
 
+/* Moment update descriptor (for fused updates) */
+/*----------------------------------------------*/
+
+typedef struct {
+
+  int                     m_id;         /* Associated moment id */
+  int                     x_id;         /* Associated data values id */
+
+  cs_lnum_t               wa_stride;    /* Weight stride (0 if global) */
+  const cs_real_t        *w;            /* Current weight values */
+  const cs_real_t        *wa_sum;       /* Accumulated weight values */
+
+  cs_real_t              *val;          /* Moment values */
+  cs_real_t              *m;            /* Associated mean values for
+                                           variances, NULL for means */
+
+} cs_time_moment_update_t;
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -228,6 +255,13 @@ static  cs_time_moment_restart_info_t *_restart_info = NULL;
 
 static double _t_prev_iter = 0.;
 
+/* Update statistics: number of passes over moment data and estimated
+   memory traffic, for the fused algorithm (0) and for an equivalent
+   update handling moments one by one (1) */
+
+static unsigned long long  _n_update_passes[2] = {0, 0};
+static double              _update_bytes[2] = {0, 0};
+
 static const cs_real_t *_p_dt = NULL; /* Mapped cell time step */
 
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
@@ -1442,6 +1476,215 @@ _ensure_init_moment(cs_time_moment_t  *mt)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Update a mean moment for a given element range.
+ *
+ * parameters:
+ *   s_id <-- start id of element range
+ *   e_id <-- past-the-end id of element range
+ *   dim  <-- moment dimension
+ *   mu   <-> moment update descriptor
+ *   x    <-- current data values
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_update_mean_range(cs_lnum_t                       s_id,
+                   cs_lnum_t                       e_id,
+                   cs_lnum_t                       dim,
+                   const cs_time_moment_update_t  *mu,
+                   const cs_real_t                *restrict x)
+{
+  const cs_real_t *restrict w = mu->w;
+  const cs_real_t *restrict wa_sum = mu->wa_sum;
+  const cs_lnum_t wa_stride = mu->wa_stride;
+
+  cs_real_t *restrict val = mu->val;
+
+  for (cs_lnum_t j = s_id*dim; j < e_id*dim; j++) {
+    const cs_lnum_t k = (j*wa_stride) / dim;
+    val[j] += (x[j] - val[j]) * (w[k] / (w[k] + wa_sum[k]));
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Update a simple variance moment and its associated mean for a given
+ * element range.
+ *
+ * parameters:
+ *   s_id <-- start id of element range
+ *   e_id <-- past-the-end id of element range
+ *   dim  <-- moment dimension
+ *   mu   <-> moment update descriptor
+ *   x    <-- current data values
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_update_variance_range(cs_lnum_t                       s_id,
+                       cs_lnum_t                       e_id,
+                       cs_lnum_t                       dim,
+                       const cs_time_moment_update_t  *mu,
+                       const cs_real_t                *restrict x)
+{
+  const cs_real_t *restrict w = mu->w;
+  const cs_real_t *restrict wa_sum = mu->wa_sum;
+  const cs_lnum_t wa_stride = mu->wa_stride;
+
+  cs_real_t *restrict val = mu->val;
+  cs_real_t *restrict m = mu->m;
+
+  for (cs_lnum_t j = s_id*dim; j < e_id*dim; j++) {
+    const cs_lnum_t k = (j*wa_stride) / dim;
+    double wa_sum_n = w[k] + wa_sum[k];
+    double delta = x[j] - m[j];
+    double r = delta * (w[k] / wa_sum_n);
+    double m_n = m[j] + r;
+    val[j] = (val[j]*wa_sum[k] + (w[k]*delta*(x[j]-m_n))) / wa_sum_n;
+    m[j] += r;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Update a variance-covariance moment (of 3-component data) and its
+ * associated mean for a given element range.
+ *
+ * parameters:
+ *   s_id <-- start id of element range
+ *   e_id <-- past-the-end id of element range
+ *   mu   <-> moment update descriptor
+ *   x    <-- current data values
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_update_covariance_range(cs_lnum_t                       s_id,
+                         cs_lnum_t                       e_id,
+                         const cs_time_moment_update_t  *mu,
+                         const cs_real_t                *restrict x)
+{
+  const cs_real_t *restrict w = mu->w;
+  const cs_real_t *restrict wa_sum = mu->wa_sum;
+  const cs_lnum_t wa_stride = mu->wa_stride;
+
+  cs_real_t *restrict val = mu->val;
+  cs_real_t *restrict m = mu->m;
+
+  for (cs_lnum_t je = s_id; je < e_id; je++) {
+    double delta[3], delta_n[3], r[3], m_n[3];
+    const cs_lnum_t k = je*wa_stride;
+    const double wa_sum_n = w[k] + wa_sum[k];
+    for (cs_lnum_t l = 0; l < 3; l++) {
+      cs_lnum_t jl = je*6 + l, jml = je*3 + l;
+      delta[l]   = x[jml] - m[jml];
+      r[l] = delta[l] * (w[k] / wa_sum_n);
+      m_n[l] = m[jml] + r[l];
+      delta_n[l] = x[jml] - m_n[l];
+      val[jl] =   (val[jl]*wa_sum[k] + (w[k]*delta[l]*delta_n[l]))
+                / wa_sum_n;
+    }
+    /* Covariance terms.
+       Note we could have a symmetric formula using
+         0.5*(delta[i]*delta_n[j] + delta[j]*delta_n[i])
+       instead of
+         delta[i]*delta_n[j]
+       but unit tests in cs_moment_test.c do not seem to favor
+       one variant over the other; we use the simplest one.
+    */
+    cs_lnum_t j3 = je*6 + 3, j4 = je*6 + 4, j5 = je*6 + 5;
+    val[j3] =   (val[j3]*wa_sum[k] + (w[k]*delta[0]*delta_n[1]))
+              / wa_sum_n;
+    val[j4] =   (val[j4]*wa_sum[k] + (w[k]*delta[1]*delta_n[2]))
+              / wa_sum_n;
+    val[j5] =   (val[j5]*wa_sum[k] + (w[k]*delta[0]*delta_n[2]))
+              / wa_sum_n;
+    for (cs_lnum_t l = 0; l < 3; l++)
+      m[je*3 + l] += r[l];
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Check if the data values of a moment may depend on moment values.
+ *
+ * Data defined by field ids depends on moments only if one of these
+ * fields is a moment field; data defined by other functions is assumed
+ * to possibly depend on moment values.
+ *
+ * parameters:
+ *   mt <-- pointer to moment
+ *
+ * returns:
+ *   true if data may depend on moment values, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_data_reads_moments(const cs_time_moment_t  *mt)
+{
+  if (mt->data_func != _sd_moment_data)
+    return true;
+
+  const int *msd = mt->data_input;
+  const int stride = 2 + msd[1];
+  const int n_fields = msd[2];
+
+  for (int i = 0; i < n_fields; i++) {
+    const int f_id = msd[3 + stride*i];
+    for (int j = 0; j < _n_moments; j++) {
+      if (_moment[j].f_id == f_id)
+        return true;
+    }
+  }
+
+  return false;
+}
+
+/*----------------------------------------------------------------------------
+ * Update all moments sharing a given location in a single fused pass.
+ *
+ * Elements are handled by blocks, so that for a given block, the
+ * current data values and weights shared by several moments are
+ * still in cache when updating each of these moments. Moments are
+ * updated in the order given, so results are identical to those of
+ * separate updates.
+ *
+ * parameters:
+ *   location_id <-- associated mesh location id
+ *   n_mu        <-- number of moment updates for this location
+ *   mu          <-- moment update descriptors
+ *   x_vals      <-- current data values, by data id
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_location_fused(int                             location_id,
+                       int                             n_mu,
+                       const cs_time_moment_update_t   mu[],
+                       cs_real_t                *const x_vals[])
+{
+  const cs_lnum_t n_elts = cs_mesh_location_get_n_elts(location_id)[0];
+  const cs_lnum_t block_size = CS_TIME_MOMENT_BLOCK_SIZE;
+  const cs_lnum_t n_blocks = (n_elts + block_size - 1) / block_size;
+
+  #pragma omp parallel for if (n_elts > CS_THR_MIN)
+  for (cs_lnum_t b_id = 0; b_id < n_blocks; b_id++) {
+
+    const cs_lnum_t s_id = b_id*block_size;
+    const cs_lnum_t e_id = CS_MIN(s_id + block_size, n_elts);
+
+    for (int i = 0; i < n_mu; i++) {
+
+      const cs_time_moment_update_t *_mu = mu + i;
+      const cs_time_moment_t *mt = _moment + _mu->m_id;
+      const cs_real_t *x = x_vals[_mu->x_id];
+
+      if (mt->type == CS_TIME_MOMENT_MEAN)
+        _update_mean_range(s_id, e_id, mt->dim, _mu, x);
+      else if (mt->dim == 6)
+        _update_covariance_range(s_id, e_id, _mu, x);
+      else
+        _update_variance_range(s_id, e_id, mt->dim, _mu, x);
+
+    }
+
+  }
+}
+
 /*============================================================================
  * Fortran wrapper function definitions
  *============================================================================*/
@@ -1478,18 +1721,41 @@ cs_f_time_moment_field_id(int m_num)
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Destroy all moments management metadata.
+ *
+ * Cumulative moment update statistics are logged to the performance log.
  */
 /*----------------------------------------------------------------------------*/
 
 void
 cs_time_moment_destroy_all(void)
 {
+  /* Cumulative update statistics (local to each rank) */
+
+  if (_n_update_passes[1] > 0) {
+
+    const double gib = 1024.*1024.*1024.;
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("\n"
+                    "Temporal moment updates (fused, unfused estimate):\n"
+                    "  passes over data:  %12llu %12llu\n"
+                    "  GiB moved:         %12.4g %12.4g\n"),
+                  _n_update_passes[0], _n_update_passes[1],
+                  _update_bytes[0]/gib, _update_bytes[1]/gib);
+
+  }
+
   _free_all_moments();
   _free_all_wa();
   _free_all_sd_defs();
 
   _p_dt = NULL;
   _restart_info_checked = false;
+
+  for (int i = 0; i < 2; i++) {
+    _n_update_passes[i] = 0;
+    _update_bytes[i] = 0;
+  }
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2022,7 +2288,12 @@ cs_time_moment_update_all(void)
       wa_cur_data[i] = NULL;
   }
 
-  /* Loop on variances first */
+  /* Build list of moments to update, variances first (as updating
+     a variance also updates the associated mean) */
+
+  int n_mu = 0;
+  cs_time_moment_update_t *mu;
+  BFT_MALLOC(mu, _n_moments, cs_time_moment_update_t);
 
   for (int m_type = CS_TIME_MOMENT_VARIANCE;
        m_type >= (int)CS_TIME_MOMENT_MEAN;
@@ -2037,121 +2308,200 @@ cs_time_moment_update_all(void)
           && (int)(mt->type) == m_type
           && (mwa->nt_start > -1 && mwa->nt_start <= ts->nt_cur)) {
 
-        /* Current and accumulated weight */
+        cs_time_moment_update_t *_mu = mu + n_mu;
+        n_mu++;
 
-        cs_lnum_t  wa_stride;
-        cs_real_t *restrict wa_sum, *restrict x;
+        _mu->m_id = i;
+        _mu->x_id = -1;
 
-        cs_real_t *const restrict w = wa_cur_data[mt->wa_id];
+        /* Current and accumulated weight */
+
+        _mu->w = wa_cur_data[mt->wa_id];
 
         if (mwa->location_id == CS_MESH_LOCATION_NONE) {
-          wa_sum = &(mwa->val0);
-          wa_stride = 0;
+          _mu->wa_sum = &(mwa->val0);
+          _mu->wa_stride = 0;
         }
         else {
-          wa_sum = mwa->val;
-          wa_stride = 1;
+          _mu->wa_sum = mwa->val;
+          _mu->wa_stride = 1;
         }
 
-        /* Current value */
-
-        const cs_lnum_t n_elts
-          = cs_mesh_location_get_n_elts(mt->location_id)[0];
-        const cs_lnum_t nd = n_elts * mt->dim;
-
-        BFT_MALLOC(x, nd, cs_real_t);
-
-        mt->data_func(mt->data_input, x);
+        /* Moment values */
 
         _ensure_init_moment(mt);
 
-        cs_real_t *restrict val = mt->val;
-        if (mt->f_id > -1) {
-          cs_field_t *f = cs_field_by_id(mt->f_id);
-          val = f->val;
-        }
+        _mu->val = mt->val;
+        if (mt->f_id > -1)
+          _mu->val = cs_field_by_id(mt->f_id)->val;
+
+        _mu->m = NULL;
 
         if (mt->type == CS_TIME_MOMENT_VARIANCE) {
 
           assert(mt->l_id > -1);
+          assert(mt->dim != 6 || mt->data_dim == 3);
 
           cs_time_moment_t *mt_mean = _moment + mt->l_id;
 
           _ensure_init_moment(mt_mean);
-          cs_real_t *restrict m = mt_mean->val;
-          if (mt_mean->f_id > -1) {
-            cs_field_t *f_mean = cs_field_by_id(mt_mean->f_id);
-            m = f_mean->val;
-          }
+          _mu->m = mt_mean->val;
+          if (mt_mean->f_id > -1)
+            _mu->m = cs_field_by_id(mt_mean->f_id)->val;
 
-          if (mt->dim == 6) { /* variance-covariance matrix */
-            assert(mt->data_dim == 3);
-            for (cs_lnum_t je = 0; je < n_elts; je++) {
-              double delta[3], delta_n[3], r[3], m_n[3];
-              const cs_lnum_t k = je*wa_stride;
-              const double wa_sum_n = w[k] + wa_sum[k];
-              for (cs_lnum_t l = 0; l < 3; l++) {
-                cs_lnum_t jl = je*6 + l, jml = je*3 + l;
-                delta[l]   = x[jml] - m[jml];
-                r[l] = delta[l] * (w[k] / wa_sum_n);
-                m_n[l] = m[jml] + r[l];
-                delta_n[l] = x[jml] - m_n[l];
-                val[jl] =   (val[jl]*wa_sum[k] + (w[k]*delta[l]*delta_n[l]))
-                          / wa_sum_n;
-              }
-              /* Covariance terms.
-                 Note we could have a symmetric formula using
-                   0.5*(delta[i]*delta_n[j] + delta[j]*delta_n[i])
-                 instead of
-                   delta[i]*delta_n[j]
-                 but unit tests in cs_moment_test.c do not seem to favor
-                 one variant over the other; we use the simplest one.
-              */
-              cs_lnum_t j3 = je*6 + 3, j4 = je*6 + 4, j5 = je*6 + 5;
-              val[j3] =   (val[j3]*wa_sum[k] + (w[k]*delta[0]*delta_n[1]))
-                        / wa_sum_n;
-              val[j4] =   (val[j4]*wa_sum[k] + (w[k]*delta[1]*delta_n[2]))
-                        / wa_sum_n;
-              val[j5] =   (val[j5]*wa_sum[k] + (w[k]*delta[0]*delta_n[2]))
-                        / wa_sum_n;
-              for (cs_lnum_t l = 0; l < 3; l++)
-                m[je*3 + l] += r[l];
-            }
-          }
+          mt_mean->nt_cur = ts->nt_cur;
+        }
 
-          else { /* simple variance */
-            for (cs_lnum_t j = 0; j < nd; j++) {
-              const cs_lnum_t k = (j*wa_stride) / mt->dim;
-              double wa_sum_n = w[k] + wa_sum[k];
-              double delta = x[j] - m[j];
-              double r = delta * (w[k] / wa_sum_n);
-              double m_n = m[j] + r;
-              val[j] = (val[j]*wa_sum[k] + (w[k]*delta*(x[j]-m_n))) / wa_sum_n;
-              m[j] += r;
-            }
-          }
+        mt->nt_cur = ts->nt_cur;
 
-          mt_mean->nt_cur = ts->nt_cur;
+      } /* End of test if moment is active */
+
+    } /* End of loop on moments */
+
+  } /* End of loop on moment types */
+
+  /* Moments are handled by segments of the update list: a segment starts
+     at each moment whose data may depend on moment values, so that such
+     data is computed after all previous moments are updated, as when
+     moments were updated one at a time. Within a segment, other data
+     values are computed once for all moments sharing the same data
+     definition, and moments are updated in a single pass per location
+     (preserving their relative order). */
+
+  int n_x = 0;
+  int *x_m_id;
+  bool *x_shared;
+  cs_real_t **x_vals;
+  BFT_MALLOC(x_m_id, n_mu, int);
+  BFT_MALLOC(x_shared, n_mu, bool);
+  BFT_MALLOC(x_vals, n_mu, cs_real_t *);
+
+  int n_mu_l = 0;
+  cs_time_moment_update_t *mu_l;
+  BFT_MALLOC(mu_l, n_mu, cs_time_moment_update_t);
+
+  bool *mu_done, *x_used, *wa_used;
+  BFT_MALLOC(mu_done, n_mu, bool);
+  BFT_MALLOC(x_used, n_mu, bool);
+  BFT_MALLOC(wa_used, _n_moment_wa, bool);
+
+  for (int j = 0; j < n_mu; j++)
+    mu_done[j] = false;
+
+  int s_id = 0;
+
+  while (s_id < n_mu) {
+
+    int e_id = s_id + 1;
+    while (e_id < n_mu && !_data_reads_moments(_moment + mu[e_id].m_id))
+      e_id++;
+
+    /* Compute current data values for this segment */
+
+    for (int j = s_id; j < e_id; j++) {
+
+      const cs_time_moment_t *mt = _moment + mu[j].m_id;
+      const bool shared = !_data_reads_moments(mt);
+
+      for (int x_id = 0; shared && x_id < n_x; x_id++) {
+        const cs_time_moment_t *mt_x = _moment + x_m_id[x_id];
+        if (   x_shared[x_id]
+            && mt->location_id == mt_x->location_id
+            && mt->data_dim == mt_x->data_dim
+            && mt->data_func == mt_x->data_func
+            && mt->data_input == mt_x->data_input) {
+          mu[j].x_id = x_id;
+          break;
         }
+      }
+
+      if (mu[j].x_id < 0) {
+        const cs_lnum_t n_elts
+          = cs_mesh_location_get_n_elts(mt->location_id)[0];
+        BFT_MALLOC(x_vals[n_x], n_elts*mt->data_dim, cs_real_t);
+        mt->data_func(mt->data_input, x_vals[n_x]);
+        x_m_id[n_x] = mu[j].m_id;
+        x_shared[n_x] = shared;
+        mu[j].x_id = n_x;
+        n_x++;
+      }
 
-        else if (mt->type == CS_TIME_MOMENT_MEAN) {
+    }
 
-          for (cs_lnum_t j = 0; j < nd; j++) {
-            const cs_lnum_t k = (j*wa_stride) / mt->dim;
-            val[j] += (x[j] - val[j]) * (w[k] / (w[k] + wa_sum[k]));
-          }
+    /* Update moments of this segment by location, and update statistics */
+
+    for (int j = s_id; j < e_id; j++) {
+
+      if (mu_done[j])
+        continue;
+
+      const int location_id = _moment[mu[j].m_id].location_id;
+      const cs_lnum_t n_elts = cs_mesh_location_get_n_elts(location_id)[0];
+
+      for (int x_id = 0; x_id < n_x; x_id++)
+        x_used[x_id] = false;
+      for (int wa_id = 0; wa_id < _n_moment_wa; wa_id++)
+        wa_used[wa_id] = false;
+
+      n_mu_l = 0;
 
+      for (int k = j; k < e_id; k++) {
+
+        const cs_time_moment_t *mt = _moment + mu[k].m_id;
+        if (mt->location_id != location_id)
+          continue;
+
+        mu_l[n_mu_l++] = mu[k];
+        mu_done[k] = true;
+
+        /* Estimated memory traffic: data and weight reads,
+           moment (and mean) reads and writes; data is written
+           once, then read once per pass */
+
+        double m_bytes = 2.*n_elts*(mt->dim)*sizeof(cs_real_t);
+        if (mu[k].m != NULL)
+          m_bytes += 2.*n_elts*(mt->data_dim)*sizeof(cs_real_t);
+        double x_bytes = 2.*n_elts*(mt->data_dim)*sizeof(cs_real_t);
+        double w_bytes = 2.*n_elts*mu[k].wa_stride*sizeof(cs_real_t);
+
+        _update_bytes[0] += m_bytes;
+        _update_bytes[1] += m_bytes + x_bytes + w_bytes;
+        _n_update_passes[1] += 2;
+
+        if (x_used[mu[k].x_id] == false) {
+          x_used[mu[k].x_id] = true;
+          _update_bytes[0] += x_bytes;
+          _n_update_passes[0] += 1;
+        }
+        if (wa_used[mt->wa_id] == false) {
+          wa_used[mt->wa_id] = true;
+          _update_bytes[0] += w_bytes;
         }
 
-        mt->nt_cur = ts->nt_cur;
+      }
 
-        BFT_FREE(x);
+      _update_location_fused(location_id, n_mu_l, mu_l, x_vals);
 
-      } /* End of test if moment is active */
+      _n_update_passes[0] += 1;
 
-    } /* End of loop on moments */
+    }
 
-  } /* End of loop on moment types */
+    s_id = e_id;
+
+  }
+
+  BFT_FREE(wa_used);
+  BFT_FREE(x_used);
+  BFT_FREE(mu_done);
+  BFT_FREE(mu_l);
+
+  for (int x_id = 0; x_id < n_x; x_id++)
+    BFT_FREE(x_vals[x_id]);
+
+  BFT_FREE(x_vals);
+  BFT_FREE(x_shared);
+  BFT_FREE(x_m_id);
+  BFT_FREE(mu);
 
   /* Update and free weight data */
 
@@ -104,6 +104,8 @@ extern const char  *cs_time_moment_type_name[];
 
 /*----------------------------------------------------------------------------
  * Destroy all moments management metadata.
+ *
+ * Cumulative moment update statistics are logged to the performance log.
  *----------------------------------------------------------------------------*/
 
 void
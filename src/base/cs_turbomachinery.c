@@ -61,6 +61,7 @@
 #include "cs_matrix_default.h"
 #include "cs_mesh.h"
 #include "cs_mesh_adjacencies.h"
+#include "cs_mesh_box_index.h"
 #include "cs_mesh_coherency.h"
 #include "cs_mesh_location.h"
 #include "cs_mesh_quantities.h"
@@ -837,6 +838,7 @@ _update_mesh_coupling(double   t_cur_mob,
 
   /* Recompute geometric quantities related to the mesh */
 
+  cs_mesh_box_index_free();
   cs_mesh_quantities_compute(cs_glob_mesh, cs_glob_mesh_quantities);
 
   /* Update linear algebra APIs relative to mesh */
@@ -1126,6 +1128,7 @@ _update_mesh(bool     restart_mode,
 
   cs_gradient_free_quantities();
   cs_cell_to_vertex_free();
+  cs_mesh_box_index_free();
   cs_mesh_adjacencies_update_mesh();
 
   /* Update linear algebra APIs relative to mesh */
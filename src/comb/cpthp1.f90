@@ -83,211 +83,107 @@ double precision f1mc(*),f2mc(*) ! size ncharm or ncharm2
 
 ! Local variables
 
-integer          i , icha
+integer          icha , ige
+integer          ilo , ihi , imid
 
-double precision ychx10 , ychx20 , ehchx1 , ehchx2
-double precision den1   , den2
-double precision eh0 , eh1
+double precision ychx10 , ychx20
+double precision eh0 , eh1 , ehm
+double precision wchx1(ncharm) , wchx2(ncharm)
+double precision yg(ngazem)
 
 !===============================================================================
+! 0. FRACTIONS MASSIQUES DES ESPECES ELEMENTAIRES
+!===============================================================================
+
+! L'enthalpie du melange a TH(I) vaut sum(yg(:)*ehgaze(:,I)), les especes
+! CHx1m et CHx2m etant decomposees par charbon ; elle croit avec I, ce qui
+! permet de rechercher l'intervalle de temperature par dichotomie.
+
+ychx10 = zero
+ychx20 = zero
+do icha = 1, ncharb
+  wchx1(icha) = f1mc(icha)*a1(icha)*wmole(ichx1c(icha))             &
+              / ( a1(icha)*wmole(ichx1c(icha))+b1(icha)*wmole(ico))
+  wchx2(icha) = f2mc(icha)*a2(icha)*wmole(ichx2c(icha))             &
+              / ( a2(icha)*wmole(ichx2c(icha))+b2(icha)*wmole(ico))
+  ychx10 = ychx10 + wchx1(icha)
+  ychx20 = ychx20 + wchx2(icha)
+enddo
+
+do ige = 1, ngaze
+  yg(ige) = zero
+enddo
+
+if ( ychx10.gt.epzero ) then
+  do icha = 1, ncharb
+    yg(ichx1c(icha)) = yg(ichx1c(icha))                             &
+                     + xesp(ichx1)*wchx1(icha)/ychx10
+  enddo
+else
+  yg(ichx1) = yg(ichx1) + xesp(ichx1)
+endif
+if ( ychx20.gt.epzero ) then
+  do icha = 1, ncharb
+    yg(ichx2c(icha)) = yg(ichx2c(icha))                             &
+                     + xesp(ichx2)*wchx2(icha)/ychx20
+  enddo
+else
+  yg(ichx2) = yg(ichx2) + xesp(ichx2)
+endif
+
+yg(ico ) = yg(ico ) + xesp(ico )
+yg(io2 ) = yg(io2 ) + xesp(io2 )
+yg(ico2) = yg(ico2) + xesp(ico2)
+yg(ih2o) = yg(ih2o) + xesp(ih2o)
+yg(in2 ) = yg(in2 ) + xesp(in2 )
+
 !===============================================================================
 ! 1. CALCUL DE LA TEMPERATURE A PARTIR DE l'ENTHALPIE
 !===============================================================================
 
 if ( mode .eq. 1 ) then
 
-  i = npo
-
-! --- Calcul de l'enthalpie de l'espece gazeuse CHx1m
-!                                            et CHx2m a TH(NPO)
-  ehchx1 = zero
-  ehchx2 = zero
-  ychx10 = zero
-  ychx20 = zero
-  do icha = 1, ncharb
-    den1   = 1.d0                                                 &
-         / ( a1(icha)*wmole(ichx1c(icha))+b1(icha)*wmole(ico))
-    ychx10 = ychx10 + den1 *                                      &
-         ( f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-    ehchx1 = ehchx1 + den1 *                                      &
-         ( ehgaze(ichx1c(icha),i)*                                &
-         f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-    den2   = 1.d0                                                 &
-         / ( a2(icha)*wmole(ichx2c(icha))+b2(icha)*wmole(ico))
-    ychx20 = ychx20 + den2 *                                      &
-         ( f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
-    ehchx2 = ehchx2 + den2 *                                      &
-         ( ehgaze(ichx2c(icha),i)*                                &
-         f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
+  eh0 = zero
+  eh1 = zero
+  do ige = 1, ngaze
+    eh0 = eh0 + yg(ige)*ehgaze(ige,1)
+    eh1 = eh1 + yg(ige)*ehgaze(ige,npo)
   enddo
-  if ( ychx10.gt.epzero ) then
-    ehchx1 = ehchx1 / ychx10
-  else
-    ehchx1 = ehgaze(ichx1,i)
-  endif
-  if ( ychx20.gt.epzero ) then
-    ehchx2 = ehchx2 / ychx20
-  else
-    ehchx2 = ehgaze(ichx2,i)
-  endif
 
 ! --- Clipping eventuel de TP a TH(NPO) si EH > EH1
-
-  eh1 = xesp(ichx1)*ehchx1                                        &
-      + xesp(ichx2)*ehchx2                                        &
-      + xesp(ico  )*ehgaze(ico ,i)                                &
-      + xesp(io2  )*ehgaze(io2 ,i)                                &
-      + xesp(ico2 )*ehgaze(ico2,i)                                &
-      + xesp(ih2o )*ehgaze(ih2o,i)                                &
-      + xesp(in2  )*ehgaze(in2 ,i)
+!                          ou a TH(1)   si EH < EH0
 
   if ( eh .ge. eh1 ) then
-    tp = th(i)
-    goto 501
-  endif
-
-  i = 1
-
-! --- Calcul de l'enthalpie de l'espece gazeuse CHx1m
-!                                            et CHx2m a TH(1)
-  ehchx1 = zero
-  ehchx2 = zero
-  ychx10 = zero
-  ychx20 = zero
-  do icha = 1, ncharb
-    den1   = 1.d0                                                 &
-         / ( a1(icha)*wmole(ichx1c(icha))+b1(icha)*wmole(ico))
-    ychx10 = ychx10 + den1 *                                      &
-     ( f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-    ehchx1 = ehchx1 + den1 *                                      &
-     ( ehgaze(ichx1c(icha),i)*                                    &
-       f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-    den2   = 1.d0                                                 &
-         / ( a2(icha)*wmole(ichx2c(icha))+b2(icha)*wmole(ico))
-    ychx20 = ychx20 + den2 *                                      &
-     ( f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
-    ehchx2 = ehchx2 + den2 *                                      &
-     ( ehgaze(ichx2c(icha),i)*                                    &
-       f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
-  enddo
-  if ( ychx10.gt.epzero ) then
-    ehchx1 = ehchx1 / ychx10
-  else
-    ehchx1 = ehgaze(ichx1,i)
-  endif
-  if ( ychx20.gt.epzero ) then
-    ehchx2 = ehchx2 / ychx20
-  else
-    ehchx2 = ehgaze(ichx2,i)
-  endif
+    tp = th(npo)
 
-! --- Clipping eventuel de TP a TH(1) si EH < EH0
+  else if ( eh .le. eh0 ) then
+    tp = th(1)
 
-  eh0 = xesp(ichx1)*ehchx1                                        &
-      + xesp(ichx2)*ehchx2                                        &
-      + xesp(ico  )*ehgaze(ico ,i)                                &
-      + xesp(io2  )*ehgaze(io2 ,i)                                &
-      + xesp(ico2 )*ehgaze(ico2,i)                                &
-      + xesp(ih2o )*ehgaze(ih2o,i)                                &
-      + xesp(in2  )*ehgaze(in2 ,i)
+! --- Interpolation dans la table
 
-  if ( eh .le. eh0 ) then
-    tp= th(i)
-    goto 501
-  endif
+  else
 
+    ilo = 1
+    ihi = npo
+    do while ( ihi-ilo .gt. 1 )
+      imid = (ilo+ihi)/2
+      ehm = zero
+      do ige = 1, ngaze
+        ehm = ehm + yg(ige)*ehgaze(ige,imid)
+      enddo
+      if ( eh .ge. ehm ) then
+        ilo = imid
+        eh0 = ehm
+      else
+        ihi = imid
+        eh1 = ehm
+      endif
+    enddo
 
- 500    continue
-  i = i + 1
+    tp = th(ilo) + (eh-eh0) *                                       &
+                   (th(ihi)-th(ilo))/(eh1-eh0)
 
-! --- Calcul de l'enthalpie de l'espece gazeuse CHx1m
-!                                            et CHx2m pour TH(I-1)
-  ehchx1 = zero
-  ehchx2 = zero
-  ychx10 = zero
-  ychx20 = zero
-  do icha = 1, ncharb
-    den1   = 1.d0                                                 &
-           / ( a1(icha)*wmole(ichx1c(icha))+b1(icha)*wmole(ico))
-    ychx10 = ychx10 + den1 *                                      &
-      ( f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-    ehchx1 = ehchx1 + den1 *                                      &
-      ( ehgaze(ichx1c(icha),i-1)*                                 &
-        f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-    den2   = 1.d0                                                 &
-           / ( a2(icha)*wmole(ichx2c(icha))+b2(icha)*wmole(ico))
-    ychx20 = ychx20 + den2 *                                      &
-       ( f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
-    ehchx2 = ehchx2 + den2 *                                      &
-       ( ehgaze(ichx2c(icha),i-1)*                                &
-         f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
-  enddo
-  if ( ychx10.gt.epzero ) then
-    ehchx1 = ehchx1 / ychx10
-  else
-    ehchx1 = ehgaze(ichx1,i-1)
   endif
-  if ( ychx20.gt.epzero ) then
-    ehchx2 = ehchx2 / ychx20
-  else
-    ehchx2 = ehgaze(ichx2,i-1)
-  endif
-  eh0 = xesp(ichx1)*ehchx1                                        &
-      + xesp(ichx2)*ehchx2                                        &
-      + xesp(ico  )*ehgaze(ico ,i-1)                              &
-      + xesp(io2  )*ehgaze(io2 ,i-1)                              &
-      + xesp(ico2 )*ehgaze(ico2,i-1)                              &
-      + xesp(ih2o )*ehgaze(ih2o,i-1)                              &
-      + xesp(in2  )*ehgaze(in2 ,i-1)
-
-! --- Calcul de l'enthalpie de l'espece gazeuse CHx1m
-!                                            et CHx2m pour TH(I)
-  ehchx1 = zero
-  ehchx2 = zero
-  ychx10 = zero
-  ychx20 = zero
-  do icha = 1, ncharb
-    den1   = 1.d0                                                 &
-           / ( a1(icha)*wmole(ichx1c(icha))+b1(icha)*wmole(ico))
-    ychx10 = ychx10 + den1 *                                      &
-      ( f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-    ehchx1 = ehchx1 + den1 *                                      &
-      ( ehgaze(ichx1c(icha),i)*                                   &
-        f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-    den2   = 1.d0                                                 &
-           / ( a2(icha)*wmole(ichx2c(icha))+b2(icha)*wmole(ico))
-    ychx20 = ychx20 + den2 *                                      &
-       ( f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
-    ehchx2 = ehchx2 + den2 *                                      &
-       ( ehgaze(ichx2c(icha),i)*                                  &
-         f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
-  enddo
-  if ( ychx10.gt.epzero ) then
-    ehchx1 = ehchx1 / ychx10
-  else
-    ehchx1 = ehgaze(ichx1,i)
-  endif
-  if ( ychx20.gt.epzero ) then
-    ehchx2 = ehchx2 / ychx20
-  else
-    ehchx2 = ehgaze(ichx2,i)
-  endif
-
-  eh1 = xesp(ichx1)*ehchx1                                        &
-      + xesp(ichx2)*ehchx2                                        &
-      + xesp(ico  )*ehgaze(ico ,i)                                &
-      + xesp(io2  )*ehgaze(io2 ,i)                                &
-      + xesp(ico2 )*ehgaze(ico2,i)                                &
-      + xesp(ih2o )*ehgaze(ih2o,i)                                &
-      + xesp(in2  )*ehgaze(in2 ,i)
-
-  if ( eh .ge. eh0  .and. eh .le. eh1  ) then
-    tp = th(i-1) + (eh-eh0) *                                     &
-                 (th(i)-th(i-1))/(eh1-eh0)
-    goto 501
-  endif
-  goto 500
- 501    continue
 
 !===============================================================================
 ! 1. CALCUL DE L'ENTHALPIE A PARTIR DE LA TEMPERATURE
@@ -295,196 +191,46 @@ if ( mode .eq. 1 ) then
 
 else if ( mode .eq. -1 ) then
 
-  i = npo
-
-! --- Calcul en Max
-
-  if ( tp .ge. th(i) ) then
-    ehchx1 = zero
-    ehchx2 = zero
-    ychx10 = zero
-    ychx20 = zero
-    do icha = 1, ncharb
-      den1   = 1.d0                                               &
-           / ( a1(icha)*wmole(ichx1c(icha))+b1(icha)*wmole(ico))
-      ychx10 = ychx10 + den1 *                                    &
-           ( f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-      ehchx1 = ehchx1 + den1 *                                    &
-           ( ehgaze(ichx1c(icha),i)*                              &
-           f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-      den2   = 1.d0                                               &
-           / ( a2(icha)*wmole(ichx2c(icha))+b2(icha)*wmole(ico))
-      ychx20 = ychx20 + den2 *                                    &
-           ( f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
-      ehchx2 = ehchx2 + den2 *                                    &
-           ( ehgaze(ichx2c(icha),i)*                              &
-           f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
+! --- Clipping en Max et en Min
+
+  if ( tp .ge. th(npo) ) then
+    eh = zero
+    do ige = 1, ngaze
+      eh = eh + yg(ige)*ehgaze(ige,npo)
     enddo
-    if ( ychx10.gt.epzero ) then
-      ehchx1 = ehchx1 / ychx10
-    else
-      ehchx1 = ehgaze(ichx1,i)
-    endif
-    if ( ychx20.gt.epzero ) then
-      ehchx2 = ehchx2 / ychx20
-    else
-      ehchx2 = ehgaze(ichx2,i)
-    endif
-    eh = xesp(ichx1)*ehchx1                                       &
-       + xesp(ichx2)*ehchx2                                       &
-       + xesp(ico  )*ehgaze(ico ,i)                               &
-       + xesp(io2  )*ehgaze(io2 ,i)                               &
-       + xesp(ico2 )*ehgaze(ico2,i)                               &
-       + xesp(ih2o )*ehgaze(ih2o,i)                               &
-       + xesp(in2  )*ehgaze(in2 ,i)
-    goto 601
-  endif
 
-! Clipping en Min
-
-  i = 1
-
-  if ( tp .le. th(i) ) then
-    ehchx1 = zero
-    ehchx2 = zero
-    ychx10 = zero
-    ychx20 = zero
-    do icha = 1, ncharb
-      den1   = 1.d0                                               &
-           / ( a1(icha)*wmole(ichx1c(icha))+b1(icha)*wmole(ico))
-      ychx10 = ychx10 + den1 *                                    &
-           ( f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-      ehchx1 = ehchx1 + den1 *                                    &
-           ( ehgaze(ichx1c(icha),i)*                              &
-           f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-      den2   = 1.d0                                               &
-           / ( a2(icha)*wmole(ichx2c(icha))+b2(icha)*wmole(ico))
-      ychx20 = ychx20 + den2 *                                    &
-           ( f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
-      ehchx2 = ehchx2 + den2 *                                    &
-           ( ehgaze(ichx2c(icha),i)*                              &
-           f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
+  else if ( tp .le. th(1) ) then
+    eh = zero
+    do ige = 1, ngaze
+      eh = eh + yg(ige)*ehgaze(ige,1)
     enddo
-    if ( ychx10.gt.epzero ) then
-      ehchx1 = ehchx1 / ychx10
-    else
-      ehchx1 = ehgaze(ichx1,i)
-    endif
-    if ( ychx20.gt.epzero ) then
-      ehchx2 = ehchx2 / ychx20
-    else
-      ehchx2 = ehgaze(ichx2,i)
-    endif
-
-! --- Clipping eventuel de TP a TH(1) si EH < EH0
-
-    eh = xesp(ichx1)*ehchx1                                       &
-       + xesp(ichx2)*ehchx2                                       &
-       + xesp(ico  )*ehgaze(ico ,i)                               &
-       + xesp(io2  )*ehgaze(io2 ,i)                               &
-       + xesp(ico2 )*ehgaze(ico2,i)                               &
-       + xesp(ih2o )*ehgaze(ih2o,i)                               &
-       + xesp(in2  )*ehgaze(in2 ,i)
-    goto 601
-  endif
 
-! Interpolation dans la table
-
-  i = 1
- 600    continue
-
-  i = i + 1
-  if ( tp .le. th(i) ) then
-
-! --- Calcul de l'enthalpie de l'espece gazeuse TH(I-1)
-
-    ehchx1 = zero
-    ehchx2 = zero
-    ychx10 = zero
-    ychx20 = zero
-    do icha = 1, ncharb
-      den1   = 1.d0                                               &
-             / ( a1(icha)*wmole(ichx1c(icha))+b1(icha)*wmole(ico))
-      ychx10 = ychx10 + den1 *                                    &
-        ( f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-      ehchx1 = ehchx1 + den1 *                                    &
-        ( ehgaze(ichx1c(icha),i-1)*                               &
-          f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-      den2   = 1.d0                                               &
-             / ( a2(icha)*wmole(ichx2c(icha))+b2(icha)*wmole(ico))
-      ychx20 = ychx20 + den2 *                                    &
-         ( f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
-      ehchx2 = ehchx2 + den2 *                                    &
-         ( ehgaze(ichx2c(icha),i-1)*                              &
-           f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
+! --- Interpolation dans la table
+
+  else
+
+    ilo = 1
+    ihi = npo
+    do while ( ihi-ilo .gt. 1 )
+      imid = (ilo+ihi)/2
+      if ( tp .le. th(imid) ) then
+        ihi = imid
+      else
+        ilo = imid
+      endif
     enddo
-    if ( ychx10.gt.epzero ) then
-      ehchx1 = ehchx1 / ychx10
-    else
-      ehchx1 = ehgaze(ichx1,i-1)
-    endif
-    if ( ychx20.gt.epzero ) then
-      ehchx2 = ehchx2 / ychx20
-    else
-      ehchx2 = ehgaze(ichx2,i-1)
-    endif
-
-    eh0 = xesp(ichx1)*ehchx1                                      &
-        + xesp(ichx2)*ehchx2                                      &
-        + xesp(ico  )*ehgaze(ico ,i-1)                            &
-        + xesp(io2  )*ehgaze(io2 ,i-1)                            &
-        + xesp(ico2 )*ehgaze(ico2,i-1)                            &
-        + xesp(ih2o )*ehgaze(ih2o,i-1)                            &
-        + xesp(in2  )*ehgaze(in2 ,i-1)
-
-! --- Calcul de l'enthalpie de l'espece gazeuse TH(I)
-
-    ehchx1 = zero
-    ehchx2 = zero
-    ychx10 = zero
-    ychx20 = zero
-    do icha = 1, ncharb
-      den1   = 1.d0                                               &
-             / ( a1(icha)*wmole(ichx1c(icha))+b1(icha)*wmole(ico))
-      ychx10 = ychx10 + den1 *                                    &
-        ( f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-      ehchx1 = ehchx1 + den1 *                                    &
-        ( ehgaze(ichx1c(icha),i)*                                 &
-          f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-      den2   = 1.d0                                               &
-             / ( a2(icha)*wmole(ichx2c(icha))+b2(icha)*wmole(ico))
-      ychx20 = ychx20 + den2 *                                    &
-         ( f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
-      ehchx2 = ehchx2 + den2 *                                    &
-         ( ehgaze(ichx2c(icha),i)*                                &
-           f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
+
+    eh0 = zero
+    eh1 = zero
+    do ige = 1, ngaze
+      eh0 = eh0 + yg(ige)*ehgaze(ige,ilo)
+      eh1 = eh1 + yg(ige)*ehgaze(ige,ihi)
     enddo
-    if ( ychx10.gt.epzero ) then
-      ehchx1 = ehchx1 / ychx10
-    else
-      ehchx1 = ehgaze(ichx1,i)
-    endif
-    if ( ychx20.gt.epzero ) then
-      ehchx2 = ehchx2 / ychx20
-    else
-      ehchx2 = ehgaze(ichx2,i)
-    endif
-
-    eh1 = xesp(ichx1)*ehchx1                                      &
-        + xesp(ichx2)*ehchx2                                      &
-        + xesp(ico  )*ehgaze(ico ,i)                              &
-        + xesp(io2  )*ehgaze(io2 ,i)                              &
-        + xesp(ico2 )*ehgaze(ico2,i)                              &
-        + xesp(ih2o )*ehgaze(ih2o,i)                              &
-        + xesp(in2  )*ehgaze(in2 ,i)
-
-    eh =  eh0                                                     &
-           + (eh1-eh0)*(tp-th(i-1))/(th(i)-th(i-1))
-    goto 601
-  endif
-  goto 600
 
- 601    continue
+    eh =  eh0                                                       &
+        + (eh1-eh0)*(tp-th(ilo))/(th(ihi)-th(ilo))
+
+  endif
 
 else
   write(nfecra,1000) mode
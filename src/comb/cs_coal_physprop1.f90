@@ -262,8 +262,8 @@ deallocate(tpdf)
 ! 2.Calculation of average concentrations
 !===============================================================================
 
-! Calculation of F8MC = sum(F8M(icha))
-! Calculation of F9MC = sum(F9M(icha))
+!$omp parallel do private(ii, icha, zchx10, zchx20, f1mc, f2mc, den1, den2) &
+!$omp          if(ncel > thr_n_min)
 do iel = 1, ncel
 
   do ii=1,ngazg
@@ -271,10 +271,6 @@ do iel = 1, ncel
     af2(iel,ii) = 0.d0
   enddo
 
-enddo
-
-do iel = 1, ncel
-
   zchx10 = zero
   zchx20 = zero
   cx1m(iel) = zero
@@ -380,6 +376,7 @@ do ice = 1, ngazg
   call field_get_val_s(iym1(ice), cpro_ym1(ice)%p)
 enddo
 
+!$omp parallel do private(ice) if(ncel > thr_n_min)
 do iel = 1, ncel
   do ice = 1, ngazg
 
@@ -406,6 +403,7 @@ call field_get_val_s(immel,cpro_mmel)
 
 call cs_coal_thfieldconv1(MESH_LOCATION_CELLS, enth, cpro_temp1)
 
+!$omp parallel do private(wmolme) if(ncel > thr_n_min)
 do iel = 1, ncel
   wmolme = cpro_cyf1(iel)/wmchx1(iel)                         &
          + cpro_cyf2(iel)/wmchx2(iel)                         &
@@ -497,6 +495,7 @@ call field_get_val_s(ibcarbone,cpro_bcarbone)
 call field_get_val_s(iboxygen,cpro_boxygen)
 call field_get_val_s(ibhydrogen,cpro_bhydrogen)
 
+!$omp parallel do if(ncel > thr_n_min)
 do iel=1,ncel
   cpro_bcarbone(iel) = cpro_x1(iel)                                &
             *( cpro_cyf1(iel)*wmolat(iatc)/wmchx1(iel)             &
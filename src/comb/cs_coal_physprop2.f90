@@ -150,6 +150,11 @@ do icla = 1, nclacp
   call field_get_val_s(idiam2(icla),cpro_diam2)
   xashcl = xashch(ichcor(icla))
 
+  !$omp parallel do private(xck, xch, xnp, xuash, dch, dck, ro2ini, roh2o)  &
+  !$omp          reduction(+: n1, n2, n3, n4, n5, n6, n7, n8)                &
+  !$omp          reduction(max: x2max, dchmax, dckmax, romax)                &
+  !$omp          reduction(min: x2min, dchmin, dckmin, romin)                &
+  !$omp          if(ncel > thr_n_min)
   do iel = 1, ncel
     xck    = cvar_xckcl(iel)
     xch    = cvar_xchcl(iel)
@@ -63,6 +63,7 @@ use cpincl
 use ppincl
 use ppcpfu
 use mesh
+use parall
 use field
 use cs_c_bindings
 use pointe
@@ -80,11 +81,13 @@ double precision tp(*)
 
 ! Local variables
 
-integer          i, iel, ielt, nelt, icha
+integer          iel, ielt, nelt, icha, ige
+integer          ilo, ihi, imid
 
-double precision ychx10 , ychx20 , ehchx1 , ehchx2
-double precision den1   , den2 , eh0 , eh1
+double precision ychx10 , ychx20 , eh0 , eh1, ehm
 double precision f1mc(ncharm), f2mc(ncharm)
+double precision wchx1(ncharm), wchx2(ncharm)
+double precision yg(ngazem)
 
 double precision, dimension(:), pointer :: x1
 double precision, dimension(:), pointer :: fuel1, fuel2, fuel3, fuel4, fuel5
@@ -115,6 +118,7 @@ if (location_id .eq. MESH_LOCATION_CELLS) then
 else if (location_id .eq. MESH_LOCATION_BOUNDARY_FACES) then
   nelt = nfabor
 else
+  nelt = 0
   call csexit(1)
 endif
 
@@ -127,83 +131,35 @@ do icha = 1, ncharb
   call field_get_val_s(ivarfl(isca(if2m(icha))), cvar_f2m(icha)%p)
 enddo
 
-i = npo-1
+! --- Mass fraction of CHx1 and CHx2 in light and heavy volatiles
+!     (depends only on the coal)
 
-do ielt = 1, nelt
-
-  if (location_id .eq. MESH_LOCATION_CELLS) then
-    iel = ielt
-  else
-    iel = ifabor(ielt)
-  endif
-
-! --- Calculation of enthalpy of the gaseous species CHx1m
-!                                            and CHx2m at TH(NPO)
-  ehchx1 = zero
-  ehchx2 = zero
-  ychx10 = zero
-  ychx20 = zero
-  do icha = 1, ncharb
-
-    f1mc(icha) = cvar_f1m(icha)%p(iel) / x1(iel)
-    f2mc(icha) = cvar_f2m(icha)%p(iel) / x1(iel)
-
-    den1   = 1.d0                                                  &
-         / ( a1(icha)*wmole(ichx1c(icha))                          &
-            +b1(icha)*wmole(ico)                                   &
-            +c1(icha)*wmole(ih2o)                                  &
-            +d1(icha)*wmole(ih2s)                                  &
-            +e1(icha)*wmole(ihcn)                                  &
-            +f1(icha)*wmole(inh3) )
-    ychx10 = ychx10                                                &
-            +den1*(f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-    ehchx1 = ehchx1                                                &
-            +den1*( ehgaze(ichx1c(icha),i+1)                       &
-                   *f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-    den2   = 1.d0                                                  &
-         / ( a2(icha)*wmole(ichx2c(icha))                          &
-            +b2(icha)*wmole(ico)                                   &
-            +c2(icha)*wmole(ih2o)                                  &
-            +d2(icha)*wmole(ih2s)                                  &
-            +e2(icha)*wmole(ihcn)                                  &
-            +f2(icha)*wmole(inh3) )
-    ychx20 = ychx20                                                &
-            +den2 *(f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
-    ehchx2 = ehchx2 + den2 *                                       &
-         ( ehgaze(ichx2c(icha),i+1)                                &
-          *f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
-  enddo
-  if (ychx10.gt.epzero) then
-    ehchx1 = ehchx1 / ychx10
-  else
-    ehchx1 = ehgaze(ichx1,i+1)
-  endif
-  if (ychx20.gt.epzero) then
-    ehchx2 = ehchx2 / ychx20
-  else
-    ehchx2 = ehgaze(ichx2,i+1)
-  endif
-
-  ! --- Eventual clipping of temperature at TH(NPO) if EH > EH1
-
-  eh1 = fuel1(iel)*ehchx1                                  &
-       +fuel2(iel)*ehchx2                                  &
-       +fuel3(iel)*ehgaze(ico ,i+1)                        &
-       +fuel4(iel)*ehgaze(ih2s,i+1)                        &
-       +fuel5(iel)*ehgaze(ihy ,i+1)                        &
-       +fuel6(iel)*ehgaze(ihcn,i+1)                        &
-       +fuel7(iel)*ehgaze(inh3,i+1)                        &
-       +oxyd(iel) *ehgaze(io2 ,i+1)                        &
-       +prod1(iel)*ehgaze(ico2,i+1)                        &
-       +prod2(iel)*ehgaze(ih2o,i+1)                        &
-       +prod3(iel)*ehgaze(iso2,i+1)                        &
-       +xiner(iel)*ehgaze(in2 ,i+1)
-
-  if (eh(ielt).ge.eh1) tp(ielt) = th(i+1)
+do icha = 1, ncharb
+  wchx1(icha) = a1(icha)*wmole(ichx1c(icha))                      &
+              / ( a1(icha)*wmole(ichx1c(icha))                    &
+                 +b1(icha)*wmole(ico)                             &
+                 +c1(icha)*wmole(ih2o)                            &
+                 +d1(icha)*wmole(ih2s)                            &
+                 +e1(icha)*wmole(ihcn)                            &
+                 +f1(icha)*wmole(inh3) )
+  wchx2(icha) = a2(icha)*wmole(ichx2c(icha))                      &
+              / ( a2(icha)*wmole(ichx2c(icha))                    &
+                 +b2(icha)*wmole(ico)                             &
+                 +c2(icha)*wmole(ih2o)                            &
+                 +d2(icha)*wmole(ih2s)                            &
+                 +e2(icha)*wmole(ihcn)                            &
+                 +f2(icha)*wmole(inh3) )
 enddo
 
-i = 1
+! --- For each element, the gas mixture enthalpy at TH(I) is
+!     sum(yg(:)*ehgaze(:,I)), where yg are the mass fractions of the
+!     elementary gas species (CHx1m and CHx2m being split per coal).
+!     This enthalpy increases with I, so the temperature interval is
+!     found by bisection.
 
+!$omp parallel do private(iel, icha, ige, ilo, ihi, imid, ychx10, ychx20,  &
+!$omp                     eh0, eh1, ehm, f1mc, f2mc, yg)                    &
+!$omp          if(nelt > thr_n_min)
 do ielt = 1, nelt
 
   if (location_id .eq. MESH_LOCATION_CELLS) then
@@ -212,203 +168,92 @@ do ielt = 1, nelt
     iel = ifabor(ielt)
   endif
 
-  ! --- Calculation of enthalpy of the gaseous species CHx1m
-  !                                            and CHx2m at TH(1)
-  ehchx1 = zero
-  ehchx2 = zero
   ychx10 = zero
   ychx20 = zero
   do icha = 1, ncharb
     f1mc(icha) = cvar_f1m(icha)%p(iel) / x1(iel)
     f2mc(icha) = cvar_f2m(icha)%p(iel) / x1(iel)
-    den1   = 1.d0                                                    &
-         / ( a1(icha)*wmole(ichx1c(icha))                            &
-            +b1(icha)*wmole(ico)                                     &
-            +c1(icha)*wmole(ih2o)                                    &
-            +d1(icha)*wmole(ih2s)                                    &
-            +e1(icha)*wmole(ihcn)                                    &
-            +f1(icha)*wmole(inh3) )
-    ychx10 = ychx10                                                  &
-            +den1*(f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-    ehchx1 = ehchx1                                                  &
-            +den1*( ehgaze(ichx1c(icha),i)                           &
-                   *f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-    den2   = 1.d0                                                     &
-         / ( a2(icha)*wmole(ichx2c(icha))                             &
-            +b2(icha)*wmole(ico)                                      &
-            +c2(icha)*wmole(ih2o)                                     &
-            +d2(icha)*wmole(ih2s)                                     &
-            +e2(icha)*wmole(ihcn)                                     &
-            +f2(icha)*wmole(inh3) )
-    ychx20 = ychx20                                                   &
-            +den2*(f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
-    ehchx2 = ehchx2                                                   &
-            +den2*( ehgaze(ichx2c(icha),i)                            &
-                   *f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
+    ychx10 = ychx10 + wchx1(icha)*f1mc(icha)
+    ychx20 = ychx20 + wchx2(icha)*f2mc(icha)
+  enddo
+
+  do ige = 1, ngaze
+    yg(ige) = zero
   enddo
+
   if (ychx10.gt.epzero) then
-    ehchx1 = ehchx1 / ychx10
+    do icha = 1, ncharb
+      yg(ichx1c(icha)) = yg(ichx1c(icha))                          &
+                       + fuel1(iel)*wchx1(icha)*f1mc(icha)/ychx10
+    enddo
   else
-    ehchx1 = ehgaze(ichx1,i)
+    yg(ichx1) = yg(ichx1) + fuel1(iel)
   endif
   if (ychx20.gt.epzero) then
-    ehchx2 = ehchx2 / ychx20
+    do icha = 1, ncharb
+      yg(ichx2c(icha)) = yg(ichx2c(icha))                          &
+                       + fuel2(iel)*wchx2(icha)*f2mc(icha)/ychx20
+    enddo
   else
-    ehchx2 = ehgaze(ichx2,i)
+    yg(ichx2) = yg(ichx2) + fuel2(iel)
   endif
 
-  ! --- Eventual clipping of temperature at TH(1) if EH < EH0
-
-  eh0  = fuel1(iel)*ehchx1                                  &
-        +fuel2(iel)*ehchx2                                  &
-        +fuel3(iel)*ehgaze(ico ,i)                          &
-        +fuel4(iel)*ehgaze(ih2s,i)                          &
-        +fuel5(iel)*ehgaze(ihy ,i)                          &
-        +fuel6(iel)*ehgaze(ihcn,i)                          &
-        +fuel7(iel)*ehgaze(inh3,i)                          &
-        +oxyd(iel) *ehgaze(io2 ,i)                          &
-        +prod1(iel)*ehgaze(ico2,i)                          &
-        +prod2(iel)*ehgaze(ih2o,i)                          &
-        +prod3(iel)*ehgaze(iso2,i)                          &
-        +xiner(iel)*ehgaze(in2 ,i)
-
-  if (eh(ielt) .le. eh0 ) tp(ielt)= th(i)
-
-enddo
-
+  yg(ico ) = yg(ico ) + fuel3(iel)
+  yg(ih2s) = yg(ih2s) + fuel4(iel)
+  yg(ihy ) = yg(ihy ) + fuel5(iel)
+  yg(ihcn) = yg(ihcn) + fuel6(iel)
+  yg(inh3) = yg(inh3) + fuel7(iel)
+  yg(io2 ) = yg(io2 ) + oxyd(iel)
+  yg(ico2) = yg(ico2) + prod1(iel)
+  yg(ih2o) = yg(ih2o) + prod2(iel)
+  yg(iso2) = yg(iso2) + prod3(iel)
+  yg(in2 ) = yg(in2 ) + xiner(iel)
+
+  ! --- Enthalpies at TH(1) and TH(NPO)
+
+  eh0 = zero
+  eh1 = zero
+  do ige = 1, ngaze
+    eh0 = eh0 + yg(ige)*ehgaze(ige,1)
+    eh1 = eh1 + yg(ige)*ehgaze(ige,npo)
+  enddo
 
-do i = 1, npo-1
+  ! --- Eventual clipping of temperature at TH(NPO) if EH > EH1
+  !     or at TH(1) if EH < EH0
+
+  if (eh(ielt).ge.eh1) then
+    tp(ielt) = th(npo)
+
+  else if (eh(ielt).le.eh0) then
+    tp(ielt) = th(1)
+
+  else if (eh(ielt).gt.eh0 .and. eh(ielt).lt.eh1) then
+
+    ilo = 1
+    ihi = npo
+    do while (ihi-ilo.gt.1)
+      imid = (ilo+ihi)/2
+      ehm = zero
+      do ige = 1, ngaze
+        ehm = ehm + yg(ige)*ehgaze(ige,imid)
+      enddo
+      if (eh(ielt).ge.ehm) then
+        ilo = imid
+        eh0 = ehm
+      else
+        ihi = imid
+        eh1 = ehm
+      endif
+    enddo
 
-  do ielt = 1, nelt
+    tp(ielt) = th(ilo) + (eh(ielt)-eh0) * (th(ihi)-th(ilo))/(eh1-eh0)
 
-    if (location_id .eq. MESH_LOCATION_CELLS) then
-      iel = ielt
-    else
-      iel = ifabor(ielt)
-    endif
+  endif
 
-    ! --- Calculation of enthalpy of the gaseous species CHx1m
-    !                                            and CHx2m for TH(I)
-    ehchx1 = zero
-    ehchx2 = zero
-    ychx10 = zero
-    ychx20 = zero
-    do icha = 1, ncharb
-      f1mc(icha) = cvar_f1m(icha)%p(iel) / x1(iel)
-      f2mc(icha) = cvar_f2m(icha)%p(iel) / x1(iel)
-    enddo
-    do icha = 1, ncharb
-      den1   = 1.d0                                                 &
-             / ( a1(icha)*wmole(ichx1c(icha))                       &
-                +b1(icha)*wmole(ico)                                &
-                +c1(icha)*wmole(ih2o)                               &
-                +d1(icha)*wmole(ih2s)                               &
-                +e1(icha)*wmole(ihcn)                               &
-                +f1(icha)*wmole(inh3) )
-      ychx10 = ychx10                                               &
-              +den1*f1mc(icha)*a1(icha)*wmole(ichx1c(icha))
-      ehchx1 = ehchx1                                               &
-              +den1*( ehgaze(ichx1c(icha),i)                        &
-                     *f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-      den2   = 1.d0                                                 &
-             / ( a2(icha)*wmole(ichx2c(icha))                       &
-                +b2(icha)*wmole(ico)                                &
-                +c2(icha)*wmole(ih2o)                               &
-                +d2(icha)*wmole(ih2s)                               &
-                +e2(icha)*wmole(ihcn)                               &
-                +f2(icha)*wmole(inh3) )
-      ychx20 = ychx20                                               &
-              +den2*(f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
-      ehchx2 = ehchx2                                               &
-              +den2*( ehgaze(ichx2c(icha),i)                        &
-                     *f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
-    enddo
-    if (ychx10.gt.epzero) then
-      ehchx1 = ehchx1 / ychx10
-    else
-      ehchx1 = ehgaze(ichx1,i)
-    endif
-    if (ychx20.gt.epzero) then
-      ehchx2 = ehchx2 / ychx20
-    else
-      ehchx2 = ehgaze(ichx2,i)
-    endif
-    eh0 = fuel1(iel)*ehchx1                                  &
-         +fuel2(iel)*ehchx2                                  &
-         +fuel3(iel)*ehgaze(ico ,i)                          &
-         +fuel4(iel)*ehgaze(ih2s,i)                          &
-         +fuel5(iel)*ehgaze(ihy ,i)                          &
-         +fuel6(iel)*ehgaze(ihcn,i)                          &
-         +fuel7(iel)*ehgaze(inh3,i)                          &
-         +oxyd(iel) *ehgaze(io2 ,i)                          &
-         +prod1(iel)*ehgaze(ico2,i)                          &
-         +prod2(iel)*ehgaze(ih2o,i)                          &
-         +prod3(iel)*ehgaze(iso2,i)                          &
-         +xiner(iel)*ehgaze(in2 ,i)
-
-    ! --- Calculation of enthalpy of the gaseous species CHx1m
-    !                                            and CHx2m for TH(I+1)
-    ehchx1 = zero
-    ehchx2 = zero
-    ychx10 = zero
-    ychx20 = zero
-    do icha = 1, ncharb
-      den1   = 1.d0                                                   &
-           / ( a1(icha)*wmole(ichx1c(icha))                           &
-              +b1(icha)*wmole(ico)                                    &
-              +c1(icha)*wmole(ih2o)                                   &
-              +d1(icha)*wmole(ih2s)                                   &
-              +e1(icha)*wmole(ihcn)                                   &
-              +f1(icha)*wmole(inh3) )
-      ychx10 = ychx10                                                 &
-              +den1*f1mc(icha)*a1(icha)*wmole(ichx1c(icha))
-      ehchx1 = ehchx1                                                 &
-              +den1*( ehgaze(ichx1c(icha),i+1)                        &
-                     *f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-      den2   = 1.d0                                                   &
-             / ( a2(icha)*wmole(ichx2c(icha))                         &
-                +b2(icha)*wmole(ico)                                  &
-                +c2(icha)*wmole(ih2o)                                 &
-                +d2(icha)*wmole(ih2s)                                 &
-                +e2(icha)*wmole(ihcn)                                 &
-                +f2(icha)*wmole(inh3) )
-      ychx20 = ychx20                                                 &
-              +den2*f2mc(icha)*a2(icha)*wmole(ichx2c(icha))
-      ehchx2 = ehchx2                                                 &
-              +den2*( ehgaze(ichx2c(icha),i+1)                        &
-                     *f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
-    enddo
-    if (ychx10.gt.epzero) then
-      ehchx1 = ehchx1 / ychx10
-    else
-      ehchx1 = ehgaze(ichx1,i+1)
-    endif
-    if (ychx20.gt.epzero) then
-      ehchx2 = ehchx2 / ychx20
-    else
-      ehchx2 = ehgaze(ichx2,i+1)
-    endif
-
-    eh1 = fuel1(iel)*ehchx1                                    &
-         +fuel2(iel)*ehchx2                                    &
-         +fuel3(iel)*ehgaze(ico ,i+1)                          &
-         +fuel4(iel)*ehgaze(ih2s,i+1)                          &
-         +fuel5(iel)*ehgaze(ihy ,i+1)                          &
-         +fuel6(iel)*ehgaze(ihcn,i+1)                          &
-         +fuel7(iel)*ehgaze(inh3,i+1)                          &
-         +oxyd(iel) *ehgaze(io2 ,i+1)                          &
-         +prod1(iel)*ehgaze(ico2,i+1)                          &
-         +prod2(iel)*ehgaze(ih2o,i+1)                          &
-         +prod3(iel)*ehgaze(iso2,i+1)                          &
-         +xiner(iel)*ehgaze(in2 ,i+1)
-
-    if (eh(ielt).ge.eh0 .and. eh(ielt).le.eh1) then
-      tp(ielt)= th(i) + (  eh(ielt)-eh0)                       &
-                         * (th(i+1)-th(i))/(eh1-eh0)
-    endif
-  enddo
 enddo
 
+deallocate(cvar_f1m, cvar_f2m)
+
 !----
 ! End
 !----
@@ -53,6 +53,7 @@ use ppthch
 use coincl
 use cpincl
 use ppincl
+use parall
 use field
 
 !===============================================================================
@@ -65,13 +66,13 @@ integer          ncelet, ncel
 
 ! Local variables
 
-integer          i      , icla   , icha   , iel
+integer          icla   , icha   , iel
 integer          ihflt2
+integer          isch   , isck   , isash  , iswat
+integer          ilo    , ihi    , imid
 double precision h2     , x2     , xch    , xck
 double precision xash   , xnp    , xtes   , xwat
-
-integer          iok1
-double precision , dimension ( : )     , allocatable :: eh0,eh1
+double precision eh0    , eh1    , ehm
 
 double precision, dimension(:), pointer :: cvar_xchcl, cvar_xckcl, cvar_xnpcl
 double precision, dimension(:), pointer :: cvar_xwtcl
@@ -87,27 +88,12 @@ ihflt2 = 1
 ! 1. Preliminary calculations
 !===============================================================================
 
-!===============================================================================
-! Deallocation dynamic arrays
-!----
-allocate(eh0(1:ncel),eh1(1:ncel),STAT=iok1)
-!----
-if ( iok1 > 0 ) THEN
-  write(nfecra,*) ' Memory allocation error inside: '
-  write(nfecra,*) '    cs_coal_thfieldconv2         '
-  call csexit(1)
-endif
-!===============================================================================
-
-! --- Tables initialization
-eh0( : ) = zero
-eh1( : ) = zero
-
 ! --- Initialization from T2 to T1
 
 call field_get_val_s(itemp1,cpro_temp1)
 do icla = 1, nclacp
   call field_get_val_s(itemp2(icla),cpro_temp2)
+  !$omp parallel do if(ncel > thr_n_min)
   do iel = 1, ncel
     cpro_temp2(iel) = cpro_temp1(iel)
   enddo
@@ -125,6 +111,7 @@ if ( ihflt2.eq.0 ) then
     call field_get_val_s(ivarfl(isca(ih2(icla))), cvar_h2cl)
     call field_get_val_s(itemp2(icla),cpro_temp2)
     icha = ichcor(icla)
+    !$omp parallel do if(ncel > thr_n_min)
     do iel = 1, ncel
       cpro_temp2(iel) =                                       &
             (cvar_h2cl(iel)-h02ch(icha))                         &!FIXME divide by x2
@@ -147,40 +134,17 @@ else
     call field_get_val_s(ivarfl(isca(ih2(icla))), cvar_h2cl)
     call field_get_val_s(itemp2(icla),cpro_temp2)
 
-    i = npoc-1
-    do iel = 1, ncel
-      xch  = cvar_xchcl(iel)
-      xck  = cvar_xckcl(iel)
-      xnp  = cvar_xnpcl(iel)
-      xash = xmash(icla)*xnp
-      if ( ippmod(iccoal) .eq. 1 ) then
-        xwat = cvar_xwtcl(iel)
-      else
-        xwat = 0.d0
-      endif
-
-      x2   = xch + xck + xash + xwat
-
-      xtes = xmp0(icla)*xnp
-
-      if ( xtes.gt.epsicp .and. x2.gt.epsicp*100.d0 ) then
-
-        h2   = cvar_h2cl(iel)/x2
+    isch  = ich(ichcor(icla))
+    isck  = ick(ichcor(icla))
+    isash = iash(ichcor(icla))
+    iswat = iwat(ichcor(icla))
 
-        eh1(iel) = xch /x2 * ehsoli(ich(ichcor(icla) ),i+1)    &
-                  + xck /x2 * ehsoli(ick(ichcor(icla) ),i+1)    &
-                  + xash/x2 * ehsoli(iash(ichcor(icla)),i+1)    &
-                  + xwat/x2 * ehsoli(iwat(ichcor(icla)),i+1)
-        if ( h2.ge.eh1(iel) ) then
-          cpro_temp2(iel) = thc(i+1)
+    ! The solid enthalpy increases with THC(I), so the temperature
+    ! interval is found by bisection.
 
-        endif
-
-      endif
-
-    enddo
-
-    i = 1
+    !$omp parallel do private(xch, xck, xnp, xash, xwat, x2, xtes, h2,  &
+    !$omp                     eh0, eh1, ehm, ilo, ihi, imid)            &
+    !$omp          if(ncel > thr_n_min)
     do iel = 1, ncel
       xch  = cvar_xchcl(iel)
       xck  = cvar_xckcl(iel)
@@ -193,80 +157,61 @@ else
       endif
 
       x2   = xch + xck + xash + xwat
+
       xtes = xmp0(icla)*xnp
 
       if ( xtes.gt.epsicp .and. x2.gt.epsicp*100.d0 ) then
 
         h2   = cvar_h2cl(iel)/x2
 
+        eh0 = xch /x2 * ehsoli(isch ,1)                         &
+            + xck /x2 * ehsoli(isck ,1)                         &
+            + xash/x2 * ehsoli(isash,1)                         &
+            + xwat/x2 * ehsoli(iswat,1)
+
+        eh1 = xch /x2 * ehsoli(isch ,npoc)                      &
+            + xck /x2 * ehsoli(isck ,npoc)                      &
+            + xash/x2 * ehsoli(isash,npoc)                      &
+            + xwat/x2 * ehsoli(iswat,npoc)
+
+        if ( h2.ge.eh1 ) then
+          cpro_temp2(iel) = thc(npoc)
+
+        else if ( h2.le.eh0 ) then
+          cpro_temp2(iel) = thc(1)
+
+        else if ( h2.gt.eh0 .and. h2.lt.eh1 ) then
+
+          ilo = 1
+          ihi = npoc
+          do while (ihi-ilo.gt.1)
+            imid = (ilo+ihi)/2
+            ehm = xch /x2 * ehsoli(isch ,imid)                  &
+                + xck /x2 * ehsoli(isck ,imid)                  &
+                + xash/x2 * ehsoli(isash,imid)                  &
+                + xwat/x2 * ehsoli(iswat,imid)
+            if ( h2.ge.ehm ) then
+              ilo = imid
+              eh0 = ehm
+            else
+              ihi = imid
+              eh1 = ehm
+            endif
+          enddo
+
+          cpro_temp2(iel) = thc(ilo) + (h2-eh0) *                &
+                (thc(ihi)-thc(ilo))/(eh1-eh0)
 
-        eh0(iel) = xch /x2 * ehsoli(ich(ichcor(icla) ),i)      &
-                  + xck /x2 * ehsoli(ick(ichcor(icla) ),i)      &
-                  + xash/x2 * ehsoli(iash(ichcor(icla)),i)      &
-                  + xwat/x2 * ehsoli(iwat(ichcor(icla)),i)
-        if ( h2.le.eh0(iel) ) then
-          cpro_temp2(iel) = thc(i)
         endif
 
       endif
 
     enddo
 
-    do i = 1, npoc-1
-      do iel = 1, ncel
-        xch  = cvar_xchcl(iel)
-        xck  = cvar_xckcl(iel)
-        xnp  = cvar_xnpcl(iel)
-        xash = xmash(icla)*xnp
-        if ( ippmod(iccoal) .eq. 1 ) then
-          xwat = cvar_xwtcl(iel)
-        else
-          xwat = 0.d0
-        endif
-
-        x2   = xch + xck + xash + xwat
-        xtes = xmp0(icla)*xnp
-
-        if ( xtes.gt.epsicp .and. x2.gt.epsicp*100.d0 ) then
-
-          h2   = cvar_h2cl(iel)/x2
-
-          eh0(iel) = xch /x2 * ehsoli(ich(ichcor(icla) ),i  )  &
-                    + xck /x2 * ehsoli(ick(ichcor(icla) ),i  )  &
-                    + xash/x2 * ehsoli(iash(ichcor(icla)),i  )  &
-                    + xwat/x2 * ehsoli(iwat(ichcor(icla)),i  )
-
-          eh1(iel) = xch /x2 * ehsoli(ich(ichcor(icla) ),i+1)  &
-                    + xck /x2 * ehsoli(ick(ichcor(icla) ),i+1)  &
-                    + xash/x2 * ehsoli(iash(ichcor(icla)),i+1)  &
-                    + xwat/x2 * ehsoli(iwat(ichcor(icla)),i+1)
-
-          if ( h2.ge.eh0(iel) .and. h2.le.eh1(iel) ) then
-            cpro_temp2(iel) = thc(i) + (h2-eh0(iel)) *     &
-                  (thc(i+1)-thc(i))/(eh1(iel)-eh0(iel))
-          endif
-
-        endif
-
-      enddo
-    enddo
-
   enddo
 
 endif
 
-!===============================================================================
-! Deallocation dynamic arrays
-!----
-deallocate(eh0,eh1,STAT=iok1)
-!----
-if ( iok1 > 0 ) then
-  write(nfecra,*) ' Memory deallocation error inside: '
-  write(nfecra,*) '    cs_coal_thfieldconv2           '
-  call csexit(1)
-endif
-!===============================================================================
-
 !----
 ! End
 !----
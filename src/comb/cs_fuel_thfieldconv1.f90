@@ -64,6 +64,7 @@ use cs_fuel_incl
 use ppincl
 use ppcpfu
 use mesh
+use parall
 use field
 use cs_c_bindings
 
@@ -80,8 +81,11 @@ double precision tp(*)
 
 ! Local variables
 
-integer          ii, icel, ifac
-double precision eh0, eh1
+integer          iel, ielt, nelt, ige
+integer          ilo, ihi, imid
+double precision eh0, eh1, ehm
+
+double precision yg(ngazem)
 
 double precision, dimension(:), pointer :: fuel1, fuel2, fuel3, fuel4, fuel5
 double precision, dimension(:), pointer :: fuel6, fuel7, oxyd
@@ -103,182 +107,88 @@ call field_get_val_s(iym1(iso2), prod3)
 call field_get_val_s(iym1(in2 ), xiner)
 
 if (location_id .eq. MESH_LOCATION_CELLS) then
-
-  ii = npo-1
-  do icel = 1, ncel
-
-    ! --- Eventual clipping of temperature at TH(NPO) if EH > EH1
-
-    eh1 = fuel1(icel)*ehgaze(ifo0,ii+1)                       &
-         +fuel2(icel)*ehgaze(ifov,ii+1)                       &
-         +fuel3(icel)*ehgaze(ico ,ii+1)                       &
-         +fuel4(icel)*ehgaze(ih2s,ii+1)                       &
-         +fuel5(icel)*ehgaze(ihy ,ii+1)                       &
-         +fuel6(icel)*ehgaze(ihcn,ii+1)                       &
-         +fuel7(icel)*ehgaze(inh3,ii+1)                       &
-         +oxyd(icel) *ehgaze(io2 ,ii+1)                       &
-         +prod1(icel)*ehgaze(ico2,ii+1)                       &
-         +prod2(icel)*ehgaze(ih2o,ii+1)                       &
-         +prod3(icel)*ehgaze(iso2,ii+1)                       &
-         +xiner(icel)*ehgaze(in2 ,ii+1)
-    if (eh(icel) .ge. eh1) tp(icel) = th(ii+1)
-
-  enddo
-
-  ii = 1
-  do icel = 1, ncel
-
-    ! --- Eventual clipping of temperature at TH(1) if EH < EH0
-
-    eh0 = fuel1(icel)*ehgaze(ifo0,ii)                         &
-         +fuel2(icel)*ehgaze(ifov,ii)                         &
-         +fuel3(icel)*ehgaze(ico ,ii)                         &
-         +fuel4(icel)*ehgaze(ih2s,ii)                         &
-         +fuel5(icel)*ehgaze(ihy ,ii)                         &
-         +fuel6(icel)*ehgaze(ihcn,ii)                         &
-         +fuel7(icel)*ehgaze(inh3,ii)                         &
-         +oxyd(icel) *ehgaze(io2 ,ii)                         &
-         +prod1(icel)*ehgaze(ico2,ii)                         &
-         +prod2(icel)*ehgaze(ih2o,ii)                         &
-         +prod3(icel)*ehgaze(iso2,ii)                         &
-         +xiner(icel)*ehgaze(in2 ,ii)
-
-    if (eh(icel) .le. eh0) then
-      tp(icel) = th(1)
-    endif
-
-  enddo
-
-  do ii = 1, npo-1
-
-    do icel = 1, ncel
-
-      eh0 = fuel1(icel)*ehgaze(ifo0,ii)                       &
-           +fuel2(icel)*ehgaze(ifov,ii)                       &
-           +fuel3(icel)*ehgaze(ico ,ii)                       &
-           +fuel4(icel)*ehgaze(ih2s,ii)                       &
-           +fuel5(icel)*ehgaze(ihy ,ii)                       &
-           +fuel6(icel)*ehgaze(ihcn,ii)                       &
-           +fuel7(icel)*ehgaze(inh3,ii)                       &
-           +oxyd(icel) *ehgaze(io2 ,ii)                       &
-           +prod1(icel)*ehgaze(ico2,ii)                       &
-           +prod2(icel)*ehgaze(ih2o,ii)                       &
-           +prod3(icel)*ehgaze(iso2,ii)                       &
-           +xiner(icel)*ehgaze(in2 ,ii)
-
-      eh1 = fuel1(icel)*ehgaze(ifo0,ii+1)                     &
-           +fuel2(icel)*ehgaze(ifov,ii+1)                     &
-           +fuel3(icel)*ehgaze(ico ,ii+1)                     &
-           +fuel4(icel)*ehgaze(ih2s,ii+1)                     &
-           +fuel5(icel)*ehgaze(ihy ,ii+1)                     &
-           +fuel6(icel)*ehgaze(ihcn,ii+1)                     &
-           +fuel7(icel)*ehgaze(inh3,ii+1)                     &
-           +oxyd(icel) *ehgaze(io2 ,ii+1)                     &
-           +prod1(icel)*ehgaze(ico2,ii+1)                     &
-           +prod2(icel)*ehgaze(ih2o,ii+1)                     &
-           +prod3(icel)*ehgaze(iso2,ii+1)                     &
-           +xiner(icel)*ehgaze(in2 ,ii+1)
-
-      if (eh(icel) .ge. eh0 .and. eh(icel) .le. eh1) then
-        tp(icel) = th(ii) + (eh(icel)-eh0) * (th(ii+1)-th(ii)) / (eh1-eh0)
-      endif
-
-    enddo
-
-  enddo
-
+  nelt = ncel
 else if (location_id .eq. MESH_LOCATION_BOUNDARY_FACES) then
+  nelt = nfabor
+else
+  nelt = 0
+  call csexit(1)
+endif
 
-  ii = npo-1
-  do ifac = 1, nfabor
-
-    icel = ifabor(ifac)
+! --- For each element, the gas mixture enthalpy at TH(II) is
+!     sum(yg(:)*ehgaze(:,II)), where yg are the mass fractions of the
+!     elementary gas species. This enthalpy increases with II, so the
+!     temperature interval is found by bisection.
 
-    ! --- Eventual clipping of temperature at TH(NPO) if EH > EH1
+!$omp parallel do private(iel, ige, ilo, ihi, imid, eh0, eh1, ehm, yg)  &
+!$omp          if(nelt > thr_n_min)
+do ielt = 1, nelt
 
-    eh1 = fuel1(icel)*ehgaze(ifo0,ii+1)                       &
-         +fuel2(icel)*ehgaze(ifov,ii+1)                       &
-         +fuel3(icel)*ehgaze(ico ,ii+1)                       &
-         +fuel4(icel)*ehgaze(ih2s,ii+1)                       &
-         +fuel5(icel)*ehgaze(ihy ,ii+1)                       &
-         +fuel6(icel)*ehgaze(ihcn,ii+1)                       &
-         +fuel7(icel)*ehgaze(inh3,ii+1)                       &
-         +oxyd(icel) *ehgaze(io2 ,ii+1)                       &
-         +prod1(icel)*ehgaze(ico2,ii+1)                       &
-         +prod2(icel)*ehgaze(ih2o,ii+1)                       &
-         +prod3(icel)*ehgaze(iso2,ii+1)                       &
-         +xiner(icel)*ehgaze(in2 ,ii+1)
-    if (eh(ifac) .ge. eh1) tp(ifac) = th(ii+1)
+  if (location_id .eq. MESH_LOCATION_CELLS) then
+    iel = ielt
+  else
+    iel = ifabor(ielt)
+  endif
 
+  do ige = 1, ngaze
+    yg(ige) = zero
   enddo
 
-  ii = 1
-  do ifac = 1, nfabor
-
-    icel = ifabor(ifac)
-
-    ! --- Eventual clipping of temperature at TH(1) if EH < EH0
-
-    eh0 = fuel1(icel)*ehgaze(ifo0,ii)                         &
-         +fuel2(icel)*ehgaze(ifov,ii)                         &
-         +fuel3(icel)*ehgaze(ico ,ii)                         &
-         +fuel4(icel)*ehgaze(ih2s,ii)                         &
-         +fuel5(icel)*ehgaze(ihy ,ii)                         &
-         +fuel6(icel)*ehgaze(ihcn,ii)                         &
-         +fuel7(icel)*ehgaze(inh3,ii)                         &
-         +oxyd(icel) *ehgaze(io2 ,ii)                         &
-         +prod1(icel)*ehgaze(ico2,ii)                         &
-         +prod2(icel)*ehgaze(ih2o,ii)                         &
-         +prod3(icel)*ehgaze(iso2,ii)                         &
-         +xiner(icel)*ehgaze(in2 ,ii)
-
-    if (eh(ifac) .le. eh0) then
-      tp(ifac) = th(1)
-    endif
-
+  yg(ifo0) = yg(ifo0) + fuel1(iel)
+  yg(ifov) = yg(ifov) + fuel2(iel)
+  yg(ico ) = yg(ico ) + fuel3(iel)
+  yg(ih2s) = yg(ih2s) + fuel4(iel)
+  yg(ihy ) = yg(ihy ) + fuel5(iel)
+  yg(ihcn) = yg(ihcn) + fuel6(iel)
+  yg(inh3) = yg(inh3) + fuel7(iel)
+  yg(io2 ) = yg(io2 ) + oxyd(iel)
+  yg(ico2) = yg(ico2) + prod1(iel)
+  yg(ih2o) = yg(ih2o) + prod2(iel)
+  yg(iso2) = yg(iso2) + prod3(iel)
+  yg(in2 ) = yg(in2 ) + xiner(iel)
+
+  ! --- Enthalpies at TH(1) and TH(NPO)
+
+  eh0 = zero
+  eh1 = zero
+  do ige = 1, ngaze
+    eh0 = eh0 + yg(ige)*ehgaze(ige,1)
+    eh1 = eh1 + yg(ige)*ehgaze(ige,npo)
   enddo
 
-  do ii = 1, npo-1
-
-    do ifac = 1, nfabor
-
-      icel = ifabor(ifac)
-
-      eh0 = fuel1(icel)*ehgaze(ifo0,ii)                       &
-           +fuel2(icel)*ehgaze(ifov,ii)                       &
-           +fuel3(icel)*ehgaze(ico ,ii)                       &
-           +fuel4(icel)*ehgaze(ih2s,ii)                       &
-           +fuel5(icel)*ehgaze(ihy ,ii)                       &
-           +fuel6(icel)*ehgaze(ihcn,ii)                       &
-           +fuel7(icel)*ehgaze(inh3,ii)                       &
-           +oxyd(icel) *ehgaze(io2 ,ii)                       &
-           +prod1(icel)*ehgaze(ico2,ii)                       &
-           +prod2(icel)*ehgaze(ih2o,ii)                       &
-           +prod3(icel)*ehgaze(iso2,ii)                       &
-           +xiner(icel)*ehgaze(in2 ,ii)
-
-      eh1 = fuel1(icel)*ehgaze(ifo0,ii+1)                     &
-           +fuel2(icel)*ehgaze(ifov,ii+1)                     &
-           +fuel3(icel)*ehgaze(ico ,ii+1)                     &
-           +fuel4(icel)*ehgaze(ih2s,ii+1)                     &
-           +fuel5(icel)*ehgaze(ihy ,ii+1)                     &
-           +fuel6(icel)*ehgaze(ihcn,ii+1)                     &
-           +fuel7(icel)*ehgaze(inh3,ii+1)                     &
-           +oxyd(icel) *ehgaze(io2 ,ii+1)                     &
-           +prod1(icel)*ehgaze(ico2,ii+1)                     &
-           +prod2(icel)*ehgaze(ih2o,ii+1)                     &
-           +prod3(icel)*ehgaze(iso2,ii+1)                     &
-           +xiner(icel)*ehgaze(in2 ,ii+1)
-
-      if (eh(ifac) .ge. eh0 .and. eh(ifac) .le. eh1) then
-        tp(ifac) = th(ii) + (eh(ifac)-eh0) * (th(ii+1)-th(ii)) / (eh1-eh0)
+  ! --- Eventual clipping of temperature at TH(NPO) if EH > EH1
+  !     or at TH(1) if EH < EH0
+
+  if (eh(ielt) .ge. eh1) then
+    tp(ielt) = th(npo)
+
+  else if (eh(ielt) .le. eh0) then
+    tp(ielt) = th(1)
+
+  else if (eh(ielt) .gt. eh0 .and. eh(ielt) .lt. eh1) then
+
+    ilo = 1
+    ihi = npo
+    do while (ihi-ilo .gt. 1)
+      imid = (ilo+ihi)/2
+      ehm = zero
+      do ige = 1, ngaze
+        ehm = ehm + yg(ige)*ehgaze(ige,imid)
+      enddo
+      if (eh(ielt) .ge. ehm) then
+        ilo = imid
+        eh0 = ehm
+      else
+        ihi = imid
+        eh1 = ehm
       endif
-
     enddo
 
-  enddo
+    tp(ielt) = th(ilo) + (eh(ielt)-eh0) * (th(ihi)-th(ilo)) / (eh1-eh0)
 
-endif
+  endif
+
+enddo
 
 !----
 ! End
@@ -51,6 +51,7 @@ use entsor
 use ppppar
 use ppthch
 use ppincl
+use parall
 use field
 use cs_fuel_incl
 
@@ -83,6 +84,7 @@ double precision, dimension(:), pointer :: cpro_rom2, cpro_diam2
 call field_get_val_s(itemp1,cpro_temp1)
 do icla = 1, nclafu
   call field_get_val_s(itemp2(icla),cpro_temp2)
+  !$omp parallel do if(ncel > thr_n_min)
   do iel = 1, ncel
     cpro_temp2(iel) = cpro_temp1(iel)
   enddo
@@ -102,6 +104,9 @@ do icla = 1, nclafu
 
   mkfini = rho0fl*pi/6.d0*dinikf(icla)**3
 
+  !$omp parallel do private(rhofol, diamgt, masgut, mkgout, mfgout,  &
+  !$omp                     xsolid, eh2, mode)                       &
+  !$omp          if(ncel > thr_n_min)
   do iel = 1, ncel
 
     rhofol = cpro_rom2(iel)
@@ -43,6 +43,7 @@
 #include "bft_printf.h"
 #include "cs_mesh.h"
 
+#include "cs_part_to_block.h"
 #include "fvm_defs.h"
 #include "fvm_io_num.h"
 #include "fvm_tesselation.h"
@@ -264,6 +265,9 @@ _fvm_nodal_section_copy(const fvm_nodal_section_t *this_section)
   else
     new_section->global_element_num = NULL;
 
+  BFT_MALLOC(new_section->dist, 1, fvm_nodal_dist_t *);
+  *(new_section->dist) = NULL;
+
   return (new_section);
 }
 
@@ -834,6 +838,11 @@ fvm_nodal_section_create(const fvm_element_t  type)
 
   this_section->global_element_num = NULL;
 
+  /* Parallel output */
+
+  BFT_MALLOC(this_section->dist, 1, fvm_nodal_dist_t *);
+  *(this_section->dist) = NULL;
+
   return (this_section);
 }
 
@@ -882,6 +891,11 @@ fvm_nodal_section_destroy(fvm_nodal_section_t  * this_section)
   if (this_section->global_element_num != NULL)
     fvm_io_num_destroy(this_section->global_element_num);
 
+  /* Parallel output */
+
+  fvm_nodal_dist_destroy(this_section->dist);
+  BFT_FREE(this_section->dist);
+
   /* Main structure destroyed and NULL returned */
 
   BFT_FREE(this_section);
@@ -889,6 +903,38 @@ fvm_nodal_section_destroy(fvm_nodal_section_t  * this_section)
   return (this_section);
 }
 
+/*----------------------------------------------------------------------------
+ * Destroy a list of cached output distributions.
+ *
+ * parameters:
+ *   dist <-> pointer to first distribution in list (set to NULL)
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_nodal_dist_destroy(fvm_nodal_dist_t  **dist)
+{
+  fvm_nodal_dist_t  *_dist = *dist;
+
+  while (_dist != NULL) {
+
+    fvm_nodal_dist_t  *next = _dist->next;
+
+#if defined(HAVE_MPI)
+    if (_dist->d != NULL)
+      cs_part_to_block_destroy(&(_dist->d));
+#endif
+
+    BFT_FREE(_dist->sections);
+    BFT_FREE(_dist->types);
+    BFT_FREE(_dist->block_n_sub);
+    BFT_FREE(_dist);
+
+    _dist = next;
+  }
+
+  *dist = NULL;
+}
+
 /*----------------------------------------------------------------------------
  * Copy selected shared connectivity information to private connectivity
  * for a nodal mesh section.
@@ -1166,6 +1212,8 @@ fvm_nodal_create(const char  *name,
   this_nodal->_parent_vertex_num = NULL;
 
   this_nodal->global_vertex_num = NULL;
+  BFT_MALLOC(this_nodal->vertex_dist, 1, fvm_nodal_dist_t *);
+  *(this_nodal->vertex_dist) = NULL;
 
   this_nodal->sections = NULL;
 
@@ -1214,6 +1262,9 @@ fvm_nodal_destroy(fvm_nodal_t   *this_nodal)
   if (this_nodal->global_vertex_num != NULL)
     fvm_io_num_destroy(this_nodal->global_vertex_num);
 
+  fvm_nodal_dist_destroy(this_nodal->vertex_dist);
+  BFT_FREE(this_nodal->vertex_dist);
+
   for (i = 0; i < this_nodal->n_sections; i++)
     fvm_nodal_section_destroy(this_nodal->sections[i]);
 
@@ -1295,6 +1346,9 @@ fvm_nodal_copy(const fvm_nodal_t *this_nodal)
   else
     new_nodal->global_vertex_num = NULL;
 
+  BFT_MALLOC(new_nodal->vertex_dist, 1, fvm_nodal_dist_t *);
+  *(new_nodal->vertex_dist) = NULL;
+
   BFT_MALLOC(new_nodal->sections,
              new_nodal->n_sections,
              fvm_nodal_section_t *);
@@ -1358,6 +1412,8 @@ fvm_nodal_reduce(fvm_nodal_t  *this_nodal,
       this_nodal->global_vertex_num
         = fvm_io_num_destroy(this_nodal->global_vertex_num);
 
+    fvm_nodal_dist_destroy(this_nodal->vertex_dist);
+
   }
 
   if (this_nodal->gc_set != NULL)
@@ -1490,12 +1546,14 @@ fvm_nodal_init_io_num(fvm_nodal_t       *this_nodal,
                           this_nodal->n_vertices,
                           0);
     _remove_global_vertex_labels(this_nodal);
+    fvm_nodal_dist_destroy(this_nodal->vertex_dist);
   }
 
   else {
     for (i = 0; i < this_nodal->n_sections; i++) {
       section = this_nodal->sections[i];
       if (section->entity_dim == entity_dim) {
+        fvm_nodal_dist_destroy(section->dist);
         section->global_element_num
           = fvm_io_num_create(section->parent_element_num,
                               parent_global_numbers,
@@ -1533,6 +1591,7 @@ fvm_nodal_transfer_vertex_io_num(fvm_nodal_t    *this_nodal,
   this_nodal->global_vertex_num = *io_num;
   *io_num = NULL;
   _remove_global_vertex_labels(this_nodal);
+  fvm_nodal_dist_destroy(this_nodal->vertex_dist);
 }
 
 /*----------------------------------------------------------------------------
@@ -1624,6 +1683,7 @@ fvm_nodal_define_vertex_list(fvm_nodal_t  *this_nodal,
   }
 
   _remove_global_vertex_labels(this_nodal);
+  fvm_nodal_dist_destroy(this_nodal->vertex_dist);
 }
 
 /*----------------------------------------------------------------------------
@@ -1663,6 +1723,7 @@ fvm_nodal_set_shared_vertices(fvm_nodal_t       *this_nodal,
   _renumber_vertices(this_nodal);
 
   _remove_global_vertex_labels(this_nodal);
+  fvm_nodal_dist_destroy(this_nodal->vertex_dist);
 }
 
 /*----------------------------------------------------------------------------
@@ -1727,6 +1788,7 @@ fvm_nodal_transfer_vertices(fvm_nodal_t  *this_nodal,
   this_nodal->vertex_coords = _vertex_coords;
 
   _remove_global_vertex_labels(this_nodal);
+  fvm_nodal_dist_destroy(this_nodal->vertex_dist);
 
   return _vertex_coords;
 }
@@ -2323,6 +2385,9 @@ fvm_nodal_copy_edges(const char         *name,
   else
     new_nodal->global_vertex_num = NULL;
 
+  BFT_MALLOC(new_nodal->vertex_dist, 1, fvm_nodal_dist_t *);
+  *(new_nodal->vertex_dist) = NULL;
+
   /* Counting step */
 
   for (i = 0; i < this_nodal->n_sections; i++) {
@@ -160,6 +160,7 @@ _extrude_strided_section(fvm_nodal_section_t  * this_section,
 
     /* Remplace old global number with new */
 
+    fvm_nodal_dist_destroy(this_section->dist);
     fvm_io_num_destroy(this_section->global_element_num);
     this_section->global_element_num = fvm_io_num_create(NULL,
                                                          global_element_num,
@@ -332,6 +333,7 @@ fvm_nodal_extrude(fvm_nodal_t        *this_nodal,
 
     /* Remplace old global number with new */
 
+    fvm_nodal_dist_destroy(this_nodal->vertex_dist);
     fvm_io_num_destroy(this_nodal->global_vertex_num);
     this_nodal->global_vertex_num = fvm_io_num_create(NULL,
                                                       global_vertex_num,
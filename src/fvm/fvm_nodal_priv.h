@@ -33,7 +33,9 @@
  *  Local headers
  *----------------------------------------------------------------------------*/
 
+#include "cs_block_dist.h"
 #include "cs_mesh.h"
+#include "cs_part_to_block.h"
 #include "fvm_defs.h"
 #include "fvm_group.h"
 #include "fvm_nodal.h"
@@ -51,6 +53,48 @@ BEGIN_C_DECLS
  * Type definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Block distribution for parallel output of a given section (with the
+ * sections appended to it) or of the vertices of a nodal mesh.
+ *
+ * As this only depends on the mesh's global numbering, it may be kept
+ * from one field output to the next, and be shared by writers.
+ *----------------------------------------------------------------------------*/
+
+typedef struct _fvm_nodal_dist_t  fvm_nodal_dist_t;
+
+struct _fvm_nodal_dist_t {
+
+  /* Search keys */
+
+  int                          n_sections;  /* Number of sections output
+                                               together (0 for vertices) */
+  const void                 **sections;    /* Associated sections */
+  fvm_element_t               *types;       /* Associated output types
+                                               (differ from section type
+                                               for tesselated sections) */
+
+  cs_gnum_t           n_g_ents;             /* Global number of entities */
+  int                 min_rank_step;        /* Minimum rank step */
+  cs_lnum_t           min_block_size;       /* Minimum block size */
+
+#if defined(HAVE_MPI)
+  MPI_Comm            comm;                 /* Associated communicator */
+  cs_part_to_block_t *d;                    /* Part to block distributor */
+#endif
+
+  /* Distribution info */
+
+  cs_block_dist_info_t  bi;                 /* Block distribution info */
+  int                  *block_n_sub;        /* Number of sub-elements per
+                                               block element if tesselated,
+                                               or NULL */
+  cs_gnum_t             block_sub_range[2]; /* Output (sub-)entity range */
+
+  fvm_nodal_dist_t     *next;               /* Next distribution in list */
+
+};
+
 /*----------------------------------------------------------------------------
  * Structure defining a mesh section
  *----------------------------------------------------------------------------*/
@@ -145,6 +189,15 @@ typedef struct _fvm_nodal_section_t {
 
   fvm_io_num_t  *global_element_num;     /* Global element numbers */
 
+  /* Parallel output */
+  /*-----------------*/
+
+  fvm_nodal_dist_t  **dist;              /* Cached output distributions of
+                                            sections starting with this one
+                                            (list head allocated with the
+                                            section, so it may be updated
+                                            through a const pointer) */
+
 } fvm_nodal_section_t;
 
 /*----------------------------------------------------------------------------
@@ -201,6 +254,10 @@ struct _fvm_nodal_t {
 
   fvm_io_num_t  *global_vertex_num;     /* Global vertex numbering */
 
+  fvm_nodal_dist_t  **vertex_dist;      /* Cached vertex output
+                                           distributions (list head
+                                           allocated with the mesh) */
+
   /* Mesh connectivity */
   /*-------------------*/
 
@@ -257,6 +314,16 @@ fvm_nodal_section_create(const fvm_element_t  type);
 fvm_nodal_section_t *
 fvm_nodal_section_destroy(fvm_nodal_section_t  * this_section);
 
+/*----------------------------------------------------------------------------
+ * Destroy a list of cached output distributions.
+ *
+ * parameters:
+ *   dist <-> pointer to first distribution in list (set to NULL)
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_nodal_dist_destroy(fvm_nodal_dist_t  **dist);
+
 /*----------------------------------------------------------------------------
  * Copy selected shared connectivity information to private connectivity
  * for a nodal mesh section .
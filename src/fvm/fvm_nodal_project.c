@@ -386,6 +386,8 @@ _compact_mesh(fvm_nodal_t   *this_nodal,
   this_nodal->global_vertex_num = new_vtx_io_num;
   this_nodal->n_vertices = n_vertices_new;
 
+  fvm_nodal_dist_destroy(this_nodal->vertex_dist);
+
   BFT_FREE(old_to_new);
   BFT_FREE(new_to_old);
 
@@ -0,0 +1,1136 @@
+/*============================================================================
+ * Write a nodal representation associated with a mesh and associated
+ * variables to EnSight Gold geometry and lossy-compressed variable files
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <errno.h>
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+
+#include "fvm_defs.h"
+#include "fvm_nodal.h"
+#include "fvm_nodal_priv.h"
+#include "fvm_to_ensight.h"
+#include "fvm_to_ensight_case.h"
+#include "fvm_writer_helper.h"
+#include "fvm_writer_priv.h"
+
+#include "cs_file.h"
+#include "cs_log.h"
+#include "cs_parall.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "fvm_to_compressed.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
+
+/* Record types */
+
+#define _CZ_RECORD_PART      1
+#define _CZ_RECORD_SECTION   2
+
+/* Number of symbols sharing a Rice parameter, and maximum unary
+   prefix length (above which symbols are written in full) */
+
+#define _CZ_GROUP_SIZE      64
+#define _CZ_Q_MAX           24
+
+/* Maximum quantized value magnitude (so as to remain exact in double
+   precision) */
+
+#define _CZ_C_MAX      4.e15
+
+/*============================================================================
+ * Local Type Definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Compressed EnSight writer structure
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  char        *name;               /* Writer name */
+
+  int          rank;               /* Rank of current process in communicator */
+  int          n_ranks;            /* Number of processes in communicator */
+
+  double       rel_error;          /* Relative error bound */
+  double       abs_error;          /* Absolute error bound (if > 0) */
+  int          stride;             /* Output one value in stride, in
+                                      output order */
+
+  bool         discard_polygons;   /* Option to discard polygonal elements */
+  bool         discard_polyhedra;  /* Option to discard polyhedral elements */
+
+  bool         divide_polygons;    /* Option to tesselate polygonal elements */
+  bool         divide_polyhedra;   /* Option to tesselate polyhedral elements */
+
+  void        *ensight_writer;     /* Associated EnSight Gold writer, used
+                                      for geometry output */
+
+  fvm_to_ensight_case_t  *case_info;  /* Associated case structure
+                                         (shared with EnSight writer) */
+
+  double       raw_size;           /* Equivalent EnSight variable data size */
+  double       compressed_size;    /* Compressed variable data size */
+
+#if defined(HAVE_MPI)
+  int          min_rank_step;      /* Minimum rank step */
+  int          min_block_size;     /* Minimum block buffer size */
+  MPI_Comm     block_comm;         /* Associated MPI block communicator */
+  MPI_Comm     comm;               /* Associated MPI communicator */
+#endif
+
+} fvm_to_compressed_writer_t;
+
+/*----------------------------------------------------------------------------
+ * Bit stream (written most significant bit first)
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  size_t          size;            /* Current number of bytes */
+  size_t          max_size;        /* Allocated number of bytes */
+  unsigned char  *buf;             /* Byte buffer */
+
+  uint64_t        acc;             /* Bit accumulator */
+  int             n_acc;           /* Number of pending bits in accumulator */
+
+} _bit_stream_t;
+
+/*----------------------------------------------------------------------------
+ * Context structure for fvm_writer_field_helper_output_* functions.
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  fvm_to_compressed_writer_t  *writer;     /* Pointer to writer structure */
+  cs_file_t                   *f;          /* Pointer to file */
+  const char                  *type_name;  /* Current section type name */
+
+} _compressed_context_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static const char  *_ensight_type_name[FVM_N_ELEMENT_TYPES] = {"bar2",
+                                                               "tria3",
+                                                               "quad4",
+                                                               "nsided",
+                                                               "tetra4",
+                                                               "pyramid5",
+                                                               "penta6",
+                                                               "hexa8",
+                                                               "nfaced"};
+
+/* for symetric tensors, Code_Saturne assumes xx, yy, zz, xy, yz, xy,
+   xhere EnSight assumes xx, yy, zz, xy, xy, yz, so permutation is required */
+
+static const int _ensight_c_order_6[6] = {0, 1, 2, 3, 5, 4};
+
+static const char _cz_magic_string[]
+  = "Code_Saturne compressed EnSight variable";
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Write string to a compressed variable file, padded to 80 characters
+ *
+ * parameters:
+ *   f <-- file to write to
+ *   s <-- string to write
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_string(cs_file_t   *f,
+              const char  *s)
+{
+  char  buf[82];
+
+  strncpy(buf, s, 80);
+  buf[80] = '\0';
+  for (size_t i = strlen(buf); i < 80; i++)
+    buf[i] = '\0';
+
+  cs_file_write_global(f, buf, 1, 80);
+}
+
+/*----------------------------------------------------------------------------
+ * Write 32-bit integer to a compressed variable file
+ *
+ * parameters:
+ *   f <-- file to write to
+ *   n <-- integer value to write
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_int(cs_file_t  *f,
+           int32_t     n)
+{
+  cs_file_write_global(f, &n, sizeof(int32_t), 1);
+}
+
+/*----------------------------------------------------------------------------
+ * Write 64-bit unsigned integer to a compressed variable file
+ *
+ * parameters:
+ *   f <-- file to write to
+ *   n <-- integer value to write
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_uint64(cs_file_t  *f,
+              uint64_t    n)
+{
+  cs_file_write_global(f, &n, sizeof(uint64_t), 1);
+}
+
+/*----------------------------------------------------------------------------
+ * Append bits to a bit stream.
+ *
+ * parameters:
+ *   bs     <-> pointer to bit stream
+ *   value  <-- value whose lower bits are written
+ *   n_bits <-- number of bits to write (0 to 64)
+ *----------------------------------------------------------------------------*/
+
+static void
+_bit_stream_put(_bit_stream_t  *bs,
+                uint64_t        value,
+                int             n_bits)
+{
+  if (n_bits > 32) {
+    _bit_stream_put(bs, value >> 32, n_bits - 32);
+    n_bits = 32;
+  }
+
+  if (n_bits < 1)
+    return;
+
+  if (bs->size + 8 > bs->max_size) {
+    bs->max_size = CS_MAX(bs->max_size*2, 1024);
+    BFT_REALLOC(bs->buf, bs->max_size, unsigned char);
+  }
+
+  uint64_t mask = (((uint64_t)1) << n_bits) - 1;
+
+  bs->acc = (bs->acc << n_bits) | (value & mask);
+  bs->n_acc += n_bits;
+
+  while (bs->n_acc >= 8) {
+    bs->n_acc -= 8;
+    bs->buf[bs->size++] = (bs->acc >> bs->n_acc) & 0xff;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Flush pending bits of a bit stream, padding the last byte with zeroes.
+ *
+ * parameters:
+ *   bs <-> pointer to bit stream
+ *----------------------------------------------------------------------------*/
+
+static void
+_bit_stream_flush(_bit_stream_t  *bs)
+{
+  if (bs->n_acc > 0)
+    _bit_stream_put(bs, 0, 8 - bs->n_acc);
+}
+
+/*----------------------------------------------------------------------------
+ * Cost in bits of a Rice-coded symbol.
+ *
+ * parameters:
+ *   u <-- symbol value
+ *   k <-- Rice parameter
+ *
+ * returns:
+ *   number of bits required
+ *----------------------------------------------------------------------------*/
+
+static inline size_t
+_rice_cost(uint64_t  u,
+           int       k)
+{
+  uint64_t q = u >> k;
+
+  if (q < _CZ_Q_MAX)
+    return q + 1 + k;
+  else
+    return _CZ_Q_MAX + 64;
+}
+
+/*----------------------------------------------------------------------------
+ * Append a Rice-coded symbol to a bit stream.
+ *
+ * Quotients of _CZ_Q_MAX or more are written as an escape prefix
+ * followed by the full 64-bit symbol.
+ *
+ * parameters:
+ *   bs <-> pointer to bit stream
+ *   u  <-- symbol value
+ *   k  <-- Rice parameter
+ *----------------------------------------------------------------------------*/
+
+static void
+_rice_put(_bit_stream_t  *bs,
+          uint64_t        u,
+          int             k)
+{
+  uint64_t q = u >> k;
+
+  if (q < _CZ_Q_MAX) {
+    _bit_stream_put(bs, ((((uint64_t)1) << q) - 1) << 1, q + 1);
+    _bit_stream_put(bs, u, k);
+  }
+  else {
+    _bit_stream_put(bs, (((uint64_t)1) << _CZ_Q_MAX) - 1, _CZ_Q_MAX);
+    _bit_stream_put(bs, u, 64);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Encode a series of values with a given absolute error bound.
+ *
+ * Each value is predicted by the previous reconstructed value, and the
+ * prediction residual is quantized with a step of twice the error bound.
+ * The bound is checked on the reconstructed value rounded to single
+ * precision, as written by the decompression utility. Values which cannot
+ * be quantized within the bound (or are not finite) are stored exactly,
+ * using a zero symbol followed by their 64-bit representation; their
+ * error is then that of single precision rounding only. Symbols are then
+ * Rice-coded, using one parameter per group of _CZ_GROUP_SIZE symbols.
+ *
+ * parameters:
+ *   n_values <-- number of values
+ *   values   <-- values to encode
+ *   eps      <-- absolute error bound
+ *   bs       <-> pointer to bit stream
+ *----------------------------------------------------------------------------*/
+
+static void
+_encode_values(cs_lnum_t       n_values,
+               const double    values[],
+               double          eps,
+               _bit_stream_t  *bs)
+{
+  uint64_t *u;
+  BFT_MALLOC(u, n_values, uint64_t);
+
+  /* Prediction and quantization */
+
+  const double step = 2.*eps;
+
+  double pred = 0.;
+
+  for (cs_lnum_t i = 0; i < n_values; i++) {
+
+    const double v = values[i];
+    const double r = v - pred;
+
+    u[i] = 0;
+
+    if (isfinite(v)) {
+      if (eps > 0) {
+        double q = r / step;
+        if (fabs(q) < _CZ_C_MAX) {
+          int64_t c = llround(q);
+          double recon = pred + (double)c*step;
+          if (fabs((double)((float)recon) - v) <= eps) {
+            uint64_t z = (c < 0) ? ~(((uint64_t)c) << 1) : ((uint64_t)c) << 1;
+            u[i] = z + 1;
+            pred = recon;
+          }
+        }
+      }
+      else if (fabs(r) <= 0.)
+        u[i] = 1;
+    }
+
+    if (u[i] == 0)
+      pred = isfinite(v) ? v : 0.;
+
+  }
+
+  /* Rice coding by groups */
+
+  for (cs_lnum_t s_id = 0; s_id < n_values; s_id += _CZ_GROUP_SIZE) {
+
+    cs_lnum_t e_id = CS_MIN(s_id + _CZ_GROUP_SIZE, n_values);
+
+    int k_min = 0;
+    size_t cost_min = 0;
+
+    for (int k = 0; k < 64; k++) {
+      size_t cost = 0;
+      for (cs_lnum_t i = s_id; i < e_id; i++)
+        cost += _rice_cost(u[i], k);
+      if (k == 0 || cost < cost_min) {
+        k_min = k;
+        cost_min = cost;
+      }
+    }
+
+    _bit_stream_put(bs, k_min, 6);
+
+    for (cs_lnum_t i = s_id; i < e_id; i++) {
+      _rice_put(bs, u[i], k_min);
+      if (u[i] == 0) {
+        uint64_t raw;
+        memcpy(&raw, values + i, sizeof(double));
+        _bit_stream_put(bs, raw, 64);
+      }
+    }
+
+  }
+
+  _bit_stream_flush(bs);
+
+  BFT_FREE(u);
+}
+
+/*----------------------------------------------------------------------------
+ * Output function for field values.
+ *
+ * This function is passed to fvm_writer_field_helper_output_* functions.
+ *
+ * Each call handles one component of a section group; the associated
+ * section record is written with the first component.
+ *
+ * Each rank compresses its own block of values into a chunk, and chunks
+ * are written contiguously, in rank order.
+ *
+ * parameters:
+ *   context      <-> pointer to writer and field context
+ *   datatype     <-- output datatype
+ *   dimension    <-- output field dimension
+ *   component_id <-- output component id (if non-interleaved)
+ *   block_start  <-- start global number of element for current block
+ *   block_end    <-- past-the-end global number of element for current block
+ *   buffer       <-> associated output buffer
+ *----------------------------------------------------------------------------*/
+
+static void
+_field_output(void           *context,
+              cs_datatype_t   datatype,
+              int             dimension,
+              int             component_id,
+              cs_gnum_t       block_start,
+              cs_gnum_t       block_end,
+              void           *buffer)
+{
+  CS_UNUSED(datatype);
+
+  _compressed_context_t *c = context;
+
+  fvm_to_compressed_writer_t  *w = c->writer;
+  cs_file_t                   *f = c->f;
+
+  const double *values = buffer;
+  const cs_lnum_t n_values = block_end - block_start;
+  const cs_gnum_t stride = w->stride;
+
+  assert(datatype == CS_DOUBLE);
+
+  /* Global counts and value range */
+
+  double v_range[2] = {HUGE_VAL, HUGE_VAL};
+  unsigned long long n_g_values = (block_end > 1) ? block_end - 1 : 0;
+
+  for (cs_lnum_t i = 0; i < n_values; i++) {
+    if (isfinite(values[i])) {
+      v_range[0] = CS_MIN(v_range[0], values[i]);
+      v_range[1] = CS_MIN(v_range[1], -values[i]);
+    }
+  }
+
+#if defined(HAVE_MPI)
+  if (w->n_ranks > 1) {
+    double l_range[2] = {v_range[0], v_range[1]};
+    MPI_Allreduce(l_range, v_range, 2, MPI_DOUBLE, MPI_MIN, w->comm);
+    unsigned long long _n_g_values = n_g_values;
+    MPI_Allreduce(&_n_g_values, &n_g_values, 1, MPI_UNSIGNED_LONG_LONG,
+                  MPI_MAX, w->comm);
+  }
+#endif
+
+  /* Section record */
+
+  if (component_id == 0) {
+    _write_int(f, _CZ_RECORD_SECTION);
+    _write_string(f, c->type_name);
+    _write_uint64(f, n_g_values);
+    _write_int(f, dimension);
+    _write_int(f, w->stride);
+  }
+
+  /* Error bound */
+
+  double eps = 0.;
+  if (w->abs_error > 0)
+    eps = w->abs_error;
+  else if (v_range[0] <= -v_range[1])
+    eps = w->rel_error * (-v_range[1] - v_range[0]);
+
+  /* Values are converted to single precision on decompression, so the
+     bound may not be lower than the associated rounding error */
+
+  if (v_range[0] <= -v_range[1]) {
+    double v_max = CS_MAX(fabs(v_range[0]), fabs(v_range[1]));
+    eps = CS_MAX(eps, FLT_EPSILON*v_max);
+  }
+
+  cs_file_write_global(f, &eps, sizeof(double), 1);
+
+  /* Compress local block (values at stride multiples only) */
+
+  unsigned char *chunk = NULL;
+  unsigned long long chunk_size = 0;
+
+  if (n_values > 0) {
+
+    cs_gnum_t s_id = block_start - 1, e_id = block_end - 1;
+    cs_gnum_t j0 = ((s_id + stride - 1) / stride) * stride;
+    cs_lnum_t n_samples = 0;
+
+    double *s_values;
+    BFT_MALLOC(s_values, n_values, double);
+
+    for (cs_gnum_t j = j0; j < e_id; j += stride)
+      s_values[n_samples++] = values[j - s_id];
+
+    _bit_stream_t bs = {.size = 0, .max_size = 0, .buf = NULL,
+                        .acc = 0, .n_acc = 0};
+
+    _encode_values(n_samples, s_values, eps, &bs);
+
+    BFT_FREE(s_values);
+
+    uint64_t c_header[3] = {s_id, n_values, bs.size};
+
+    chunk_size = sizeof(c_header) + bs.size;
+    BFT_MALLOC(chunk, chunk_size, unsigned char);
+    memcpy(chunk, c_header, sizeof(c_header));
+    if (bs.size > 0)
+      memcpy(chunk + sizeof(c_header), bs.buf, bs.size);
+
+    BFT_FREE(bs.buf);
+
+  }
+
+  /* Write chunks contiguously */
+
+  unsigned long long chunk_end = chunk_size, total_size = chunk_size;
+
+#if defined(HAVE_MPI)
+  if (w->n_ranks > 1) {
+    MPI_Scan(&chunk_size, &chunk_end, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM,
+             w->comm);
+    MPI_Allreduce(&chunk_size, &total_size, 1, MPI_UNSIGNED_LONG_LONG,
+                  MPI_SUM, w->comm);
+  }
+#endif
+
+  _write_uint64(f, total_size);
+
+  cs_file_write_block_buffer(f,
+                             chunk,
+                             1,
+                             1,
+                             chunk_end - chunk_size + 1,
+                             chunk_end + 1);
+
+  BFT_FREE(chunk);
+
+  w->raw_size += (double)n_g_values * sizeof(float);
+  w->compressed_size += (double)total_size + sizeof(double)
+                        + sizeof(uint64_t);
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Initialize FVM to compressed EnSight file writer.
+ *
+ * Meshes are written in EnSight Gold binary format, while variables are
+ * written to ".cz" files using error-bounded lossy compression; these may
+ * be converted to EnSight Gold variable files using the
+ * cs_compressed_to_ensight utility.
+ *
+ * Options are:
+ *   error=<value>       relative error bound, based on the value range of
+ *                       each component over each output section
+ *                       (default: 1e-4)
+ *   abs_error=<value>   absolute error bound (overrides relative bound)
+ *   stride=<n>          only output the values of every n-th element or
+ *                       vertex, in output (numbering) order; this is not a
+ *                       spatial sub-sampling, and values in between are
+ *                       marked as undefined when converted to EnSight format
+ *   discard_polygons    do not output polygons or related values
+ *   discard_polyhedra   do not output polyhedra or related values
+ *   divide_polygons     tesselate polygons with triangles
+ *   divide_polyhedra    tesselate polyhedra with tetrahedra and pyramids
+ *                       (adding a vertex near each polyhedron's center)
+ *
+ * As EnSight variables are stored in single precision, the error bound
+ * is raised if needed to FLT_EPSILON times the largest magnitude of the
+ * section's values, so that it also holds for the converted values.
+ * The bound actually used is stored with each section.
+ *
+ * parameters:
+ *   name           <-- base output case name.
+ *   path           <-- optional directory name for output, or NULL.
+ *   options        <-- whitespace separated, lowercase options list
+ *   time_dependecy <-- indicates if and how meshes will change with time
+ *   comm           <-- associated MPI communicator.
+ *
+ * returns:
+ *   pointer to opaque compressed writer structure.
+ *----------------------------------------------------------------------------*/
+
+#if defined(HAVE_MPI)
+void *
+fvm_to_compressed_init_writer(const char             *name,
+                              const char             *path,
+                              const char             *options,
+                              fvm_writer_time_dep_t   time_dependency,
+                              MPI_Comm                comm)
+#else
+void *
+fvm_to_compressed_init_writer(const char             *name,
+                              const char             *path,
+                              const char             *options,
+                              fvm_writer_time_dep_t   time_dependency)
+#endif
+{
+  fvm_to_compressed_writer_t  *this_writer = NULL;
+
+  /* Initialize writer */
+
+  BFT_MALLOC(this_writer, 1, fvm_to_compressed_writer_t);
+
+  BFT_MALLOC(this_writer->name, strlen(name) + 1, char);
+  strcpy(this_writer->name, name);
+
+  this_writer->rel_error = 1.e-4;
+  this_writer->abs_error = 0.;
+  this_writer->stride = 1;
+
+  this_writer->discard_polygons = false;
+  this_writer->discard_polyhedra = false;
+  this_writer->divide_polygons = false;
+  this_writer->divide_polyhedra = false;
+
+  this_writer->raw_size = 0.;
+  this_writer->compressed_size = 0.;
+
+  this_writer->rank = 0;
+  this_writer->n_ranks = 1;
+
+#if defined(HAVE_MPI)
+  {
+    int mpi_flag, rank, n_ranks, min_rank_step, min_block_size;
+    MPI_Comm w_block_comm, w_comm;
+    this_writer->min_rank_step = 1;
+    this_writer->min_block_size = 1024*1024*8;
+    this_writer->block_comm = MPI_COMM_NULL;
+    this_writer->comm = MPI_COMM_NULL;
+    MPI_Initialized(&mpi_flag);
+    if (mpi_flag && comm != MPI_COMM_NULL) {
+      this_writer->comm = comm;
+      MPI_Comm_rank(this_writer->comm, &rank);
+      MPI_Comm_size(this_writer->comm, &n_ranks);
+      this_writer->rank = rank;
+      this_writer->n_ranks = n_ranks;
+      cs_file_get_default_comm(&min_rank_step, &min_block_size,
+                               &w_block_comm, &w_comm);
+      if (comm == w_comm) {
+        this_writer->min_rank_step = min_rank_step;
+        this_writer->min_block_size = min_block_size;
+        this_writer->block_comm = w_block_comm;
+      }
+      this_writer->comm = comm;
+    }
+  }
+#endif /* defined(HAVE_MPI) */
+
+  /* Parse options */
+
+  if (options != NULL) {
+
+    int i1, i2, l_opt;
+    int l_tot = strlen(options);
+
+    i1 = 0; i2 = 0;
+    while (i1 < l_tot) {
+
+      for (i2 = i1; i2 < l_tot && options[i2] != ' '; i2++);
+      l_opt = i2 - i1;
+
+      if ((l_opt > 6) && (strncmp(options + i1, "error=", 6) == 0)) {
+        if (sscanf(options + i1 + 6, "%lg", &(this_writer->rel_error)) != 1)
+          bft_error(__FILE__, __LINE__, 0,
+                    _("Compressed writer \"%s\": incorrect option \"%.*s\"."),
+                    name, l_opt, options + i1);
+      }
+      else if (   (l_opt > 10)
+               && (strncmp(options + i1, "abs_error=", 10) == 0)) {
+        if (sscanf(options + i1 + 10, "%lg", &(this_writer->abs_error)) != 1)
+          bft_error(__FILE__, __LINE__, 0,
+                    _("Compressed writer \"%s\": incorrect option \"%.*s\"."),
+                    name, l_opt, options + i1);
+      }
+      else if ((l_opt > 7) && (strncmp(options + i1, "stride=", 7) == 0)) {
+        if (   sscanf(options + i1 + 7, "%d", &(this_writer->stride)) != 1
+            || this_writer->stride < 1)
+          bft_error(__FILE__, __LINE__, 0,
+                    _("Compressed writer \"%s\": incorrect option \"%.*s\"."),
+                    name, l_opt, options + i1);
+      }
+
+      else if (   (l_opt == 16)
+               && (strncmp(options + i1, "discard_polygons", l_opt) == 0))
+        this_writer->discard_polygons = true;
+      else if (   (l_opt == 17)
+               && (strncmp(options + i1, "discard_polyhedra", l_opt) == 0))
+        this_writer->discard_polyhedra = true;
+
+      else if (   (l_opt == 15)
+               && (strncmp(options + i1, "divide_polygons", l_opt) == 0))
+        this_writer->divide_polygons = true;
+      else if (   (l_opt == 16)
+               && (strncmp(options + i1, "divide_polyhedra", l_opt) == 0))
+        this_writer->divide_polyhedra = true;
+
+      for (i1 = i2 + 1; i1 < l_tot && options[i1] == ' '; i1++);
+
+    }
+
+  }
+
+  /* Geometry is handled by an EnSight Gold writer (in binary mode),
+     whose case structure is shared */
+
+  {
+    char e_options[128] = "binary";
+
+    if (this_writer->discard_polygons)
+      strcat(e_options, " discard_polygons");
+    if (this_writer->discard_polyhedra)
+      strcat(e_options, " discard_polyhedra");
+    if (this_writer->divide_polygons)
+      strcat(e_options, " divide_polygons");
+    if (this_writer->divide_polyhedra)
+      strcat(e_options, " divide_polyhedra");
+
+#if defined(HAVE_MPI)
+    this_writer->ensight_writer
+      = fvm_to_ensight_init_writer(name, path, e_options, time_dependency,
+                                   comm);
+#else
+    this_writer->ensight_writer
+      = fvm_to_ensight_init_writer(name, path, e_options, time_dependency);
+#endif
+  }
+
+  this_writer->case_info
+    = fvm_to_ensight_get_case(this_writer->ensight_writer);
+
+  /* Return writer */
+
+  return this_writer;
+}
+
+/*----------------------------------------------------------------------------
+ * Finalize FVM to compressed EnSight file writer.
+ *
+ * parameters:
+ *   this_writer_p <-- pointer to opaque compressed writer structure.
+ *
+ * returns:
+ *   NULL pointer.
+ *----------------------------------------------------------------------------*/
+
+void *
+fvm_to_compressed_finalize_writer(void  *this_writer_p)
+{
+  fvm_to_compressed_writer_t  *this_writer
+                             = (fvm_to_compressed_writer_t *)this_writer_p;
+
+  if (this_writer->compressed_size > 0)
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("\n"
+                    "Compressed writer \"%s\":\n"
+                    "  equivalent EnSight variable data: %12.5g MiB\n"
+                    "  compressed variable data:         %12.5g MiB\n"
+                    "  compression ratio:                %12.5g\n"),
+                  this_writer->name,
+                  this_writer->raw_size / (1024.*1024.),
+                  this_writer->compressed_size / (1024.*1024.),
+                  this_writer->raw_size / this_writer->compressed_size);
+
+  this_writer->ensight_writer
+    = fvm_to_ensight_finalize_writer(this_writer->ensight_writer);
+
+  BFT_FREE(this_writer->name);
+
+  BFT_FREE(this_writer);
+
+  return NULL;
+}
+
+/*----------------------------------------------------------------------------
+ * Associate new time step with a compressed EnSight geometry.
+ *
+ * parameters:
+ *   this_writer_p <-- pointer to associated writer
+ *   time_step     <-- time step number
+ *   time_value    <-- time_value number
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_compressed_set_mesh_time(void          *this_writer_p,
+                                const int      time_step,
+                                const double   time_value)
+{
+  fvm_to_compressed_writer_t  *this_writer
+                             = (fvm_to_compressed_writer_t *)this_writer_p;
+
+  fvm_to_ensight_set_mesh_time(this_writer->ensight_writer,
+                               time_step,
+                               time_value);
+}
+
+/*----------------------------------------------------------------------------
+ * Indicate if elements of a given type in a mesh associated with a given
+ * compressed EnSight file writer need to be tesselated.
+ *
+ * parameters:
+ *   this_writer_p <-- pointer to associated writer
+ *   mesh          <-- pointer to nodal mesh structure that should be written
+ *   element_type  <-- element type we are interested in
+ *
+ * returns:
+ *   1 if tesselation of the given element type is needed, 0 otherwise
+ *----------------------------------------------------------------------------*/
+
+int
+fvm_to_compressed_needs_tesselation(void               *this_writer_p,
+                                    const fvm_nodal_t  *mesh,
+                                    fvm_element_t       element_type)
+{
+  fvm_to_compressed_writer_t  *this_writer
+                             = (fvm_to_compressed_writer_t *)this_writer_p;
+
+  return fvm_to_ensight_needs_tesselation(this_writer->ensight_writer,
+                                          mesh,
+                                          element_type);
+}
+
+/*----------------------------------------------------------------------------
+ * Write nodal mesh to a compressed EnSight file set.
+ *
+ * The mesh itself is written uncompressed, in EnSight Gold binary format.
+ *
+ * parameters:
+ *   this_writer_p <-- pointer to associated writer
+ *   mesh          <-- pointer to nodal mesh structure that should be written
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_compressed_export_nodal(void               *this_writer_p,
+                               const fvm_nodal_t  *mesh)
+{
+  fvm_to_compressed_writer_t  *this_writer
+                             = (fvm_to_compressed_writer_t *)this_writer_p;
+
+  fvm_to_ensight_export_nodal(this_writer->ensight_writer, mesh);
+}
+
+/*----------------------------------------------------------------------------
+ * Write field associated with a nodal mesh to a compressed variable file.
+ *
+ * Assigning a negative value to the time step indicates a time-independent
+ * field (in which case the time_value argument is unused).
+ *
+ * parameters:
+ *   this_writer_p    <-- pointer to associated writer
+ *   mesh             <-- pointer to associated nodal mesh structure
+ *   name             <-- variable name
+ *   location         <-- variable definition location (nodes or elements)
+ *   dimension        <-- variable dimension (0: constant, 1: scalar,
+ *                        3: vector, 6: sym. tensor, 9: asym. tensor)
+ *   interlace        <-- indicates if variable in memory is interlaced
+ *   n_parent_lists   <-- indicates if variable values are to be obtained
+ *                        directly through the local entity index (when 0) or
+ *                        through the parent entity numbers (when 1 or more)
+ *   parent_num_shift <-- parent number to value array index shifts;
+ *                        size: n_parent_lists
+ *   datatype         <-- indicates the data type of (source) field values
+ *   time_step        <-- number of the current time step
+ *   time_value       <-- associated time value
+ *   field_values     <-- array of associated field value arrays
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_compressed_export_field(void                  *this_writer_p,
+                               const fvm_nodal_t     *mesh,
+                               const char            *name,
+                               fvm_writer_var_loc_t   location,
+                               int                    dimension,
+                               cs_interlace_t         interlace,
+                               int                    n_parent_lists,
+                               const cs_lnum_t        parent_num_shift[],
+                               cs_datatype_t          datatype,
+                               int                    time_step,
+                               double                 time_value,
+                               const void      *const field_values[])
+{
+  int   output_dim, part_num;
+  fvm_to_ensight_case_file_info_t  file_info;
+
+  const fvm_writer_section_t  *export_section = NULL;
+  fvm_writer_field_helper_t  *helper = NULL;
+  fvm_writer_section_t  *export_list = NULL;
+  fvm_to_compressed_writer_t  *w = (fvm_to_compressed_writer_t *)this_writer_p;
+
+  /* Initialization */
+  /*----------------*/
+
+  /* Dimension */
+
+  output_dim = dimension;
+  if (dimension == 2)
+    output_dim = 3;
+  else if (dimension > 3 && dimension != 6 && dimension != 9)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Data of dimension %d not handled"), dimension);
+
+  const int *comp_order = (dimension == 6) ? _ensight_c_order_6 : NULL;
+
+  /* Get part number */
+
+  part_num = fvm_to_ensight_case_get_part_num(w->case_info,
+                                              mesh->name);
+  if (part_num == 0)
+    part_num = fvm_to_ensight_case_add_part(w->case_info,
+                                            mesh->name);
+
+  /* Open compressed variable file; the name referenced by the case file
+     is that of the decompressed variable file */
+
+  file_info = fvm_to_ensight_case_get_var_file(w->case_info,
+                                               name,
+                                               output_dim,
+                                               location,
+                                               time_step,
+                                               time_value);
+
+  cs_file_t *f = NULL;
+
+  {
+    char *file_name;
+    BFT_MALLOC(file_name, strlen(file_info.name) + 4, char);
+    sprintf(file_name, "%s.cz", file_info.name);
+
+    cs_file_mode_t mode = (file_info.queried) ?
+      CS_FILE_MODE_APPEND : CS_FILE_MODE_WRITE;
+    cs_file_access_t method;
+
+#if defined(HAVE_MPI)
+    MPI_Info hints;
+    cs_file_get_default_access(CS_FILE_MODE_WRITE, &method, &hints);
+    f = cs_file_open(file_name, mode, method, hints, w->block_comm, w->comm);
+#else
+    cs_file_get_default_access(CS_FILE_MODE_WRITE, &method);
+    f = cs_file_open(file_name, mode, method);
+#endif
+
+    BFT_FREE(file_name);
+  }
+
+  if (file_info.queried == false) {
+
+    char buf[81] = "";
+
+    /* New files start with identification, byte order check,
+       and description line */
+
+    _write_string(f, _cz_magic_string);
+    _write_int(f, 1);
+
+#if HAVE_SNPRINTF
+    if (time_step > -1)
+      snprintf(buf, 80, "%s (time values: %d, %g)",
+               name, time_step, time_value);
+    else
+      strncpy(buf, name, 80);
+#else
+    strncpy(buf, name, 80);
+#endif
+    buf[80] = '\0';
+    _write_string(f, buf);
+  }
+
+  /* Initialize writer helper */
+  /*--------------------------*/
+
+  /* Build list of sections that are used here, in order of output */
+
+  export_list = fvm_writer_export_list(mesh,
+                                       fvm_nodal_get_max_entity_dim(mesh),
+                                       true,
+                                       false,
+                                       w->discard_polygons,
+                                       w->discard_polyhedra,
+                                       w->divide_polygons,
+                                       w->divide_polyhedra);
+
+  helper = fvm_writer_field_helper_create(mesh,
+                                          export_list,
+                                          output_dim,
+                                          CS_NO_INTERLACE,
+                                          CS_DOUBLE,
+                                          location);
+
+#if defined(HAVE_MPI)
+
+  if (w->n_ranks > 1)
+    fvm_writer_field_helper_init_g(helper,
+                                   w->min_rank_step,
+                                   w->min_block_size,
+                                   w->comm);
+
+#endif
+
+  /* Part record */
+
+  _write_int(f, _CZ_RECORD_PART);
+  _write_int(f, part_num);
+
+  _compressed_context_t c = {.writer = w, .f = f, .type_name = NULL};
+
+  /* Per node variable */
+  /*-------------------*/
+
+  if (location == FVM_WRITER_PER_NODE) {
+
+    c.type_name = "coordinates";
+
+    fvm_writer_field_helper_output_n(helper,
+                                     &c,
+                                     mesh,
+                                     dimension,
+                                     interlace,
+                                     comp_order,
+                                     n_parent_lists,
+                                     parent_num_shift,
+                                     datatype,
+                                     field_values,
+                                     _field_output);
+
+  }
+
+  /* Per element variable */
+  /*----------------------*/
+
+  else if (location == FVM_WRITER_PER_ELEMENT) {
+
+    export_section = export_list;
+
+    while (export_section != NULL) {
+
+      c.type_name = _ensight_type_name[export_section->type];
+
+      export_section = fvm_writer_field_helper_output_e(helper,
+                                                        &c,
+                                                        export_section,
+                                                        dimension,
+                                                        interlace,
+                                                        comp_order,
+                                                        n_parent_lists,
+                                                        parent_num_shift,
+                                                        datatype,
+                                                        field_values,
+                                                        _field_output);
+
+    } /* End of loop on sections */
+
+  } /* End for per element variable */
+
+  /* Free helper structures */
+  /*------------------------*/
+
+  fvm_writer_field_helper_destroy(&helper);
+
+  BFT_FREE(export_list);
+
+  /* Close variable file and update case file */
+  /*------------------------------------------*/
+
+  f = cs_file_free(f);
+
+  fvm_to_ensight_case_write_case(w->case_info, w->rank);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,217 @@
+#ifndef __FVM_TO_COMPRESSED_H__
+#define __FVM_TO_COMPRESSED_H__
+
+/*============================================================================
+ * Write a nodal representation associated with a mesh and associated
+ * variables to EnSight Gold geometry and lossy-compressed variable files
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "fvm_defs.h"
+#include "fvm_nodal.h"
+#include "fvm_writer.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Initialize FVM to compressed EnSight file writer.
+ *
+ * Meshes are written in EnSight Gold binary format, while variables are
+ * written to ".cz" files using error-bounded lossy compression; these may
+ * be converted to EnSight Gold variable files using the
+ * cs_compressed_to_ensight utility.
+ *
+ * Options are:
+ *   error=<value>       relative error bound, based on the value range of
+ *                       each component over each output section
+ *                       (default: 1e-4)
+ *   abs_error=<value>   absolute error bound (overrides relative bound)
+ *   stride=<n>          only output the values of every n-th element or
+ *                       vertex, in output (numbering) order; this is not a
+ *                       spatial sub-sampling, and values in between are
+ *                       marked as undefined when converted to EnSight format
+ *   discard_polygons    do not output polygons or related values
+ *   discard_polyhedra   do not output polyhedra or related values
+ *   divide_polygons     tesselate polygons with triangles
+ *   divide_polyhedra    tesselate polyhedra with tetrahedra and pyramids
+ *                       (adding a vertex near each polyhedron's center)
+ *
+ * As EnSight variables are stored in single precision, the error bound
+ * is raised if needed to FLT_EPSILON times the largest magnitude of the
+ * section's values, so that it also holds for the converted values.
+ * The bound actually used is stored with each section.
+ *
+ * parameters:
+ *   name           <-- base output case name.
+ *   path           <-- optional directory name for output, or NULL.
+ *   options        <-- whitespace separated, lowercase options list
+ *   time_dependecy <-- indicates if and how meshes will change with time
+ *   comm           <-- associated MPI communicator.
+ *
+ * returns:
+ *   pointer to opaque compressed writer structure.
+ *----------------------------------------------------------------------------*/
+
+#if defined(HAVE_MPI)
+
+void *
+fvm_to_compressed_init_writer(const char             *name,
+                              const char             *path,
+                              const char             *options,
+                              fvm_writer_time_dep_t   time_dependency,
+                              MPI_Comm                comm);
+
+#else
+
+void *
+fvm_to_compressed_init_writer(const char             *name,
+                              const char             *path,
+                              const char             *options,
+                              fvm_writer_time_dep_t   time_dependency);
+
+#endif
+
+/*----------------------------------------------------------------------------
+ * Finalize FVM to compressed EnSight file writer.
+ *
+ * parameters:
+ *   this_writer_p <-- pointer to opaque compressed writer structure.
+ *
+ * returns:
+ *   NULL pointer.
+ *----------------------------------------------------------------------------*/
+
+void *
+fvm_to_compressed_finalize_writer(void  *this_writer_p);
+
+/*----------------------------------------------------------------------------
+ * Associate new time step with a compressed EnSight geometry.
+ *
+ * parameters:
+ *   this_writer_p <-- pointer to associated writer
+ *   time_step     <-- time step number
+ *   time_value    <-- time_value number
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_compressed_set_mesh_time(void          *this_writer_p,
+                                const int      time_step,
+                                const double   time_value);
+
+/*----------------------------------------------------------------------------
+ * Indicate if elements of a given type in a mesh associated with a given
+ * compressed EnSight file writer need to be tesselated.
+ *
+ * parameters:
+ *   this_writer_p <-- pointer to associated writer
+ *   mesh          <-- pointer to nodal mesh structure that should be written
+ *   element_type  <-- element type we are interested in
+ *
+ * returns:
+ *   1 if tesselation of the given element type is needed, 0 otherwise
+ *----------------------------------------------------------------------------*/
+
+int
+fvm_to_compressed_needs_tesselation(void               *this_writer_p,
+                                    const fvm_nodal_t  *mesh,
+                                    fvm_element_t       element_type);
+
+/*----------------------------------------------------------------------------
+ * Write nodal mesh to a compressed EnSight file set.
+ *
+ * The mesh itself is written uncompressed, in EnSight Gold binary format.
+ *
+ * parameters:
+ *   this_writer_p <-- pointer to associated writer
+ *   mesh          <-- pointer to nodal mesh structure that should be written
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_compressed_export_nodal(void               *this_writer_p,
+                               const fvm_nodal_t  *mesh);
+
+/*----------------------------------------------------------------------------
+ * Write field associated with a nodal mesh to a compressed variable file.
+ *
+ * Assigning a negative value to the time step indicates a time-independent
+ * field (in which case the time_value argument is unused).
+ *
+ * parameters:
+ *   this_writer_p    <-- pointer to associated writer
+ *   mesh             <-- pointer to associated nodal mesh structure
+ *   name             <-- variable name
+ *   location         <-- variable definition location (nodes or elements)
+ *   dimension        <-- variable dimension (0: constant, 1: scalar,
+ *                        3: vector, 6: sym. tensor, 9: asym. tensor)
+ *   interlace        <-- indicates if variable in memory is interlaced
+ *   n_parent_lists   <-- indicates if variable values are to be obtained
+ *                        directly through the local entity index (when 0) or
+ *                        through the parent entity numbers (when 1 or more)
+ *   parent_num_shift <-- parent number to value array index shifts;
+ *                        size: n_parent_lists
+ *   datatype         <-- indicates the data type of (source) field values
+ *   time_step        <-- number of the current time step
+ *   time_value       <-- associated time value
+ *   field_values     <-- array of associated field value arrays
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_compressed_export_field(void                  *this_writer_p,
+                               const fvm_nodal_t     *mesh,
+                               const char            *name,
+                               fvm_writer_var_loc_t   location,
+                               int                    dimension,
+                               cs_interlace_t         interlace,
+                               int                    n_parent_lists,
+                               const cs_lnum_t        parent_num_shift[],
+                               cs_datatype_t          datatype,
+                               int                    time_step,
+                               double                 time_value,
+                               const void      *const field_values[]);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __FVM_TO_COMPRESSED_H__ */
@@ -2684,6 +2684,28 @@ fvm_to_ensight_finalize_writer(void  *this_writer_p)
   return NULL;
 }
 
+/*----------------------------------------------------------------------------
+ * Return the case structure associated with an EnSight Gold file writer.
+ *
+ * This allows writers which delegate geometry output to an EnSight Gold
+ * writer to add their own variable files to the same case.
+ *
+ * parameters:
+ *   this_writer_p <-- pointer to opaque Ensight Gold writer structure.
+ *
+ * returns:
+ *   pointer to associated EnSight case structure
+ *----------------------------------------------------------------------------*/
+
+fvm_to_ensight_case_t *
+fvm_to_ensight_get_case(void  *this_writer_p)
+{
+  fvm_to_ensight_writer_t  *this_writer
+                             = (fvm_to_ensight_writer_t *)this_writer_p;
+
+  return this_writer->case_info;
+}
+
 /*----------------------------------------------------------------------------
  * Associate new time step with an EnSight geometry.
  *
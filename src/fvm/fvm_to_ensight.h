@@ -36,6 +36,7 @@
 
 #include "fvm_defs.h"
 #include "fvm_nodal.h"
+#include "fvm_to_ensight_case.h"
 #include "fvm_writer.h"
 
 /*----------------------------------------------------------------------------*/
@@ -109,6 +110,22 @@ fvm_to_ensight_init_writer(const char             *name,
 void *
 fvm_to_ensight_finalize_writer(void  *this_writer_p);
 
+/*----------------------------------------------------------------------------
+ * Return the case structure associated with an EnSight Gold file writer.
+ *
+ * This allows writers which delegate geometry output to an EnSight Gold
+ * writer to add their own variable files to the same case.
+ *
+ * parameters:
+ *   this_writer_p <-- pointer to opaque Ensight Gold writer structure.
+ *
+ * returns:
+ *   pointer to associated EnSight case structure
+ *----------------------------------------------------------------------------*/
+
+fvm_to_ensight_case_t *
+fvm_to_ensight_get_case(void  *this_writer_p);
+
 /*----------------------------------------------------------------------------
  * Associate new time step with an EnSight geometry.
  *
@@ -68,6 +68,7 @@
 #include "fvm_to_ccm.h"
 #include "fvm_to_cgns.h"
 #include "fvm_to_med.h"
+#include "fvm_to_compressed.h"
 #include "fvm_to_ensight.h"
 #include "fvm_to_histogram.h"
 #include "fvm_to_plot.h"
@@ -107,9 +108,9 @@ BEGIN_C_DECLS
 
 /* Number and status of defined formats */
 
-static const int _fvm_writer_n_formats = 10;
+static const int _fvm_writer_n_formats = 11;
 
-static fvm_writer_format_t _fvm_writer_format_list[10] = {
+static fvm_writer_format_t _fvm_writer_format_list[11] = {
 
   /* Built-in EnSight Gold writer */
   {
@@ -422,6 +423,28 @@ static fvm_writer_format_t _fvm_writer_format_list[10] = {
     NULL,
     NULL
 #endif
+  },
+
+  /* Built-in compressed EnSight writer */
+  {
+    "compressed",
+    "",
+    (  FVM_WRITER_FORMAT_HAS_POLYGON
+     | FVM_WRITER_FORMAT_HAS_POLYHEDRON),
+    FVM_WRITER_TRANSIENT_CONNECT,
+    0,                                    /* dynamic library count */
+    NULL,                                 /* dynamic library */
+    NULL,                                 /* dynamic library name */
+    NULL,                                 /* dynamic library prefix */
+    NULL,                                 /* n_version_strings_func */
+    NULL,                                 /* version_string_func */
+    fvm_to_compressed_init_writer,        /* init_func */
+    fvm_to_compressed_finalize_writer,    /* finalize_func */
+    fvm_to_compressed_set_mesh_time,      /* set_mesh_time_func */
+    fvm_to_compressed_needs_tesselation,  /* needs_tesselation_func */
+    fvm_to_compressed_export_nodal,       /* export_nodal_func */
+    fvm_to_compressed_export_field,       /* export_field_func */
+    NULL                                  /* flush_func */
   }
 
 };
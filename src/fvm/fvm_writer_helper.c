@@ -305,93 +305,123 @@ _extra_vertex_get_gnum(const fvm_nodal_t  *mesh,
 }
 
 /*----------------------------------------------------------------------------
- * Output per-element field values in parallel mode.
- *
- * Note that if the output data is not interleaved, for multidimensional data,
- * the output function is called once per component, using the same buffer.
- * This is a good fit for most options, but if a format requires writing
- * additional buffering may be required in the context.
+ * Search for a cached output distribution in a list.
  *
  * parameters:
- *   helper           <-> pointer to helper structure
- *   context          <-> pointer to writer context
- *   export_section   <-- pointer to section helper structure
- *   src_dim          <-- dimension of source data
- *   src_interlace    <-- indicates if field in memory is interlaced
- *   comp_order       <-- field component reordering array, or NULL
- *   n_parent_lists   <-- indicates if field values are to be obtained
- *                        directly through the local entity index (when 0) or
- *                        through the parent entity numbers (when 1 or more)
- *   parent_num_shift <-- parent list to common number index shifts;
- *                        size: n_parent_lists
- *   datatype         <-- indicates the data type of (source) field values
- *   field_values     <-- array of associated field value arrays
- *   output_func      <-- pointer to output function
+ *   dist           <-- first distribution in list
+ *   n_sections     <-- number of sections output together (0 for vertices)
+ *   sections       <-- associated sections
+ *   types          <-- associated output types
+ *   n_g_ents       <-- global number of entities
+ *   min_rank_step  <-- minimum step between output ranks
+ *   min_block_size <-- minimum block size
+ *   comm           <-- associated communicator
  *
  * returns:
- *   pointer to next section helper structure in list
+ *   pointer to matching distribution, or NULL
  *----------------------------------------------------------------------------*/
 
-#if defined(__INTEL_COMPILER) && defined(__KNC__)
-#pragma optimization_level 1 /* Crash with O2 on KNC with icc 14.0.0 20130728 */
-#endif
-
-static const fvm_writer_section_t *
-_field_helper_output_eg(fvm_writer_field_helper_t          *helper,
-                        void                               *context,
-                        const fvm_writer_section_t         *export_section,
-                        int                                 src_dim,
-                        cs_interlace_t                      src_interlace,
-                        const int                          *comp_order,
-                        int                                 n_parent_lists,
-                        const cs_lnum_t                     parent_num_shift[],
-                        cs_datatype_t                       datatype,
-                        const void                   *const field_values[],
-                        fvm_writer_field_output_t          *output_func)
+static fvm_nodal_dist_t *
+_find_dist(fvm_nodal_dist_t     *dist,
+           int                   n_sections,
+           const void           *sections[],
+           const fvm_element_t   types[],
+           cs_gnum_t             n_g_ents,
+           int                   min_rank_step,
+           cs_lnum_t             min_block_size,
+           MPI_Comm              comm)
 {
-  fvm_writer_field_helper_t *h = helper;
+  for (fvm_nodal_dist_t *di = dist; di != NULL; di = di->next) {
 
-  cs_block_dist_info_t  bi;
-  cs_part_to_block_t  *d = NULL;
+    if (   di->n_sections != n_sections
+        || di->n_g_ents != n_g_ents
+        || di->min_rank_step != min_rank_step
+        || di->min_block_size != min_block_size
+        || di->comm != comm)
+      continue;
 
-  int         n_sections = 0;
-  bool        have_tesselation = false;
-  cs_lnum_t   part_size = 0, block_size = 0;
-  cs_gnum_t   block_sub_size = 0, block_start = 0, block_end = 0;
-  cs_gnum_t   n_g_elements = 0;
+    int i;
+    for (i = 0; i < n_sections; i++) {
+      if (di->sections[i] != sections[i] || di->types[i] != types[i])
+        break;
+    }
+    if (i == n_sections)
+      return di;
 
-  int  *part_n_sub = NULL, *block_n_sub = NULL;
-  unsigned char  *part_values = NULL;
-  unsigned char  *block_values = NULL, *_block_values = NULL;
+  }
 
-  cs_gnum_t         *_g_elt_num = NULL;
-  const cs_gnum_t   *g_elt_num
-    = fvm_io_num_get_global_num(export_section->section->global_element_num);
+  return NULL;
+}
 
-  const fvm_writer_section_t  *current_section = NULL;
+/*----------------------------------------------------------------------------
+ * Return block distribution for output of a group of appended sections.
+ *
+ * As this distribution depends only on the sections' global numbering and
+ * tesselation, it is built on first use and cached with the first section,
+ * so that successive field outputs only need to move field values.
+ *
+ * parameters:
+ *   helper         <-- pointer to helper structure
+ *   export_section <-- pointer to first section helper structure
+ *   n_sections     <-- number of sections output together
+ *   part_size      <-- local number of elements
+ *   n_g_elements   <-- global number of elements
+ *   min_block_size <-- minimum block size
+ *
+ * returns:
+ *   pointer to distribution structure
+ *----------------------------------------------------------------------------*/
 
-  const size_t stride = (h->interlace == CS_INTERLACE) ? h->field_dim : 1;
-  const size_t elt_size = cs_datatype_size[h->datatype];
-  const size_t min_block_size =   h->min_block_size
-                                / (elt_size*stride);
+static const fvm_nodal_dist_t *
+_section_dist(const fvm_writer_field_helper_t  *helper,
+              const fvm_writer_section_t       *export_section,
+              int                               n_sections,
+              cs_lnum_t                         part_size,
+              cs_gnum_t                         n_g_elements,
+              cs_lnum_t                         min_block_size)
+{
+  const fvm_writer_field_helper_t *h = helper;
 
-  /* Loop on sections to count output size */
+  const void **sections;
+  fvm_element_t *types;
+  bool have_tesselation = false;
 
-  current_section = export_section;
-  do {
+  const fvm_writer_section_t  *current_section = NULL;
 
-    const fvm_nodal_section_t  *section = current_section->section;
+  const fvm_nodal_section_t  *first_section = export_section->section;
 
-    n_sections += 1;
-    n_g_elements += fvm_io_num_get_global_count(section->global_element_num);
-    part_size += fvm_io_num_get_local_count(section->global_element_num);
-    if (current_section->type != section->type)
-      have_tesselation = true;
+  BFT_MALLOC(sections, n_sections, const void *);
+  BFT_MALLOC(types, n_sections, fvm_element_t);
 
+  current_section = export_section;
+  for (int i = 0; i < n_sections; i++) {
+    sections[i] = current_section->section;
+    types[i] = current_section->type;
+    if (current_section->type != current_section->section->type)
+      have_tesselation = true;
     current_section = current_section->next;
+  }
 
-  } while (   current_section != NULL
-           && current_section->continues_previous == true);
+  fvm_nodal_dist_t *dist = _find_dist(*(first_section->dist),
+                                      n_sections,
+                                      sections,
+                                      types,
+                                      n_g_elements,
+                                      h->min_rank_step,
+                                      min_block_size,
+                                      h->comm);
+
+  if (dist != NULL) {
+    BFT_FREE(types);
+    BFT_FREE(sections);
+    return dist;
+  }
+
+  cs_gnum_t *_g_elt_num = NULL;
+  int *part_n_sub = NULL;
+
+  const cs_gnum_t *g_elt_num
+    = fvm_io_num_get_global_num(export_section->section->global_element_num);
 
   /* Build global numbering if necessary */
 
@@ -406,7 +436,7 @@ _field_helper_output_eg(fvm_writer_field_helper_t          *helper,
     /* loop on sections which should be appended */
 
     current_section = export_section;
-    do {
+    for (int i = 0; i < n_sections; i++) {
 
       const fvm_nodal_section_t  *section = current_section->section;
       const cs_lnum_t section_size
@@ -423,9 +453,7 @@ _field_helper_output_eg(fvm_writer_field_helper_t          *helper,
 
       current_section = current_section->next;
 
-
-    } while (   current_section != NULL
-             && current_section->continues_previous == true);
+    }
   }
 
   /* Build sub-element count if necessary */
@@ -437,7 +465,7 @@ _field_helper_output_eg(fvm_writer_field_helper_t          *helper,
     BFT_MALLOC(part_n_sub, part_size, int);
 
     current_section = export_section;
-    do {
+    for (int i = 0; i < n_sections; i++) {
 
       const fvm_nodal_section_t  *section = current_section->section;
       const cs_lnum_t section_size
@@ -458,47 +486,243 @@ _field_helper_output_eg(fvm_writer_field_helper_t          *helper,
 
       current_section = current_section->next;
 
-    } while (   current_section != NULL
-             && current_section->continues_previous == true);
+    }
   }
 
   /* Build distribution structures */
 
-  bi = cs_block_dist_compute_sizes(h->rank,
-                                   h->n_ranks,
-                                   h->min_rank_step,
-                                   min_block_size,
-                                   n_g_elements);
+  BFT_MALLOC(dist, 1, fvm_nodal_dist_t);
 
-  block_size = bi.gnum_range[1] - bi.gnum_range[0];
+  dist->n_sections = n_sections;
+  dist->sections = sections;
+  dist->types = types;
+  dist->n_g_ents = n_g_elements;
+  dist->min_rank_step = h->min_rank_step;
+  dist->min_block_size = min_block_size;
+  dist->comm = h->comm;
 
-  d = cs_part_to_block_create_by_gnum(h->comm, bi, part_size, g_elt_num);
+  dist->bi = cs_block_dist_compute_sizes(h->rank,
+                                         h->n_ranks,
+                                         h->min_rank_step,
+                                         min_block_size,
+                                         n_g_elements);
 
-  if (_g_elt_num != NULL)
-    cs_part_to_block_transfer_gnum(d, _g_elt_num);
+  const cs_lnum_t block_size = dist->bi.gnum_range[1] - dist->bi.gnum_range[0];
 
-  g_elt_num = NULL;
-  _g_elt_num = NULL;
+  dist->d = cs_part_to_block_create_by_gnum(h->comm,
+                                            dist->bi,
+                                            part_size,
+                                            g_elt_num);
+
+  if (_g_elt_num != NULL)
+    cs_part_to_block_transfer_gnum(dist->d, _g_elt_num);
 
   /* Distribute sub-element info in case of tesselation */
 
+  dist->block_n_sub = NULL;
+
   if (have_tesselation) {
 
-    BFT_MALLOC(block_n_sub, block_size, int);
+    cs_gnum_t block_sub_size = 0;
 
-    cs_part_to_block_copy_array(d,
+    BFT_MALLOC(dist->block_n_sub, block_size, int);
+
+    cs_part_to_block_copy_array(dist->d,
                                 CS_INT_TYPE,
                                 1,
                                 part_n_sub,
-                                block_n_sub);
+                                dist->block_n_sub);
     BFT_FREE(part_n_sub);
 
     for (cs_lnum_t j = 0; j < block_size; j++)
-      block_sub_size += block_n_sub[j];
+      block_sub_size += dist->block_n_sub[j];
+
+    cs_gnum_t block_end = 0;
+    MPI_Scan(&block_sub_size, &block_end, 1, CS_MPI_GNUM, MPI_SUM, h->comm);
+    block_end += 1;
+    dist->block_sub_range[0] = block_end - block_sub_size;
+    dist->block_sub_range[1] = block_end;
 
   }
-  else
-    block_sub_size = block_size;
+  else {
+    dist->block_sub_range[0] = dist->bi.gnum_range[0];
+    dist->block_sub_range[1] = dist->bi.gnum_range[1];
+  }
+
+  /* Prepend to section's list */
+
+  dist->next = *(first_section->dist);
+  *(first_section->dist) = dist;
+
+  return dist;
+}
+
+/*----------------------------------------------------------------------------
+ * Return block distribution for output of a mesh's vertices.
+ *
+ * As for sections, this distribution is built on first use and cached
+ * with the mesh.
+ *
+ * parameters:
+ *   helper         <-- pointer to helper structure
+ *   mesh           <-- pointer to nodal mesh structure
+ *   min_block_size <-- minimum block size
+ *
+ * returns:
+ *   pointer to distribution structure
+ *----------------------------------------------------------------------------*/
+
+static const fvm_nodal_dist_t *
+_vertex_dist(const fvm_writer_field_helper_t  *helper,
+             const fvm_nodal_t                *mesh,
+             cs_lnum_t                         min_block_size)
+{
+  const fvm_writer_field_helper_t *h = helper;
+
+  const cs_gnum_t n_g_vertices
+    =   fvm_io_num_get_global_count(mesh->global_vertex_num)
+      + h->n_g_vertices_add;
+
+  fvm_nodal_dist_t *dist = _find_dist(*(mesh->vertex_dist),
+                                      0,
+                                      NULL,
+                                      NULL,
+                                      n_g_vertices,
+                                      h->min_rank_step,
+                                      min_block_size,
+                                      h->comm);
+
+  if (dist != NULL)
+    return dist;
+
+  BFT_MALLOC(dist, 1, fvm_nodal_dist_t);
+
+  dist->n_sections = 0;
+  dist->sections = NULL;
+  dist->types = NULL;
+  dist->n_g_ents = n_g_vertices;
+  dist->min_rank_step = h->min_rank_step;
+  dist->min_block_size = min_block_size;
+  dist->comm = h->comm;
+
+  fvm_writer_vertex_part_to_block_create(h->min_rank_step,
+                                         min_block_size,
+                                         h->n_g_vertices_add,
+                                         h->n_vertices_add,
+                                         mesh,
+                                         &(dist->bi),
+                                         &(dist->d),
+                                         h->comm);
+
+  dist->block_n_sub = NULL;
+  dist->block_sub_range[0] = dist->bi.gnum_range[0];
+  dist->block_sub_range[1] = dist->bi.gnum_range[1];
+
+  dist->next = *(mesh->vertex_dist);
+  *(mesh->vertex_dist) = dist;
+
+  return dist;
+}
+
+/*----------------------------------------------------------------------------
+ * Output per-element field values in parallel mode.
+ *
+ * Note that if the output data is not interleaved, for multidimensional data,
+ * the output function is called once per component, using the same buffer.
+ * This is a good fit for most options, but if a format requires writing
+ * additional buffering may be required in the context.
+ *
+ * parameters:
+ *   helper           <-> pointer to helper structure
+ *   context          <-> pointer to writer context
+ *   export_section   <-- pointer to section helper structure
+ *   src_dim          <-- dimension of source data
+ *   src_interlace    <-- indicates if field in memory is interlaced
+ *   comp_order       <-- field component reordering array, or NULL
+ *   n_parent_lists   <-- indicates if field values are to be obtained
+ *                        directly through the local entity index (when 0) or
+ *                        through the parent entity numbers (when 1 or more)
+ *   parent_num_shift <-- parent list to common number index shifts;
+ *                        size: n_parent_lists
+ *   datatype         <-- indicates the data type of (source) field values
+ *   field_values     <-- array of associated field value arrays
+ *   output_func      <-- pointer to output function
+ *
+ * returns:
+ *   pointer to next section helper structure in list
+ *----------------------------------------------------------------------------*/
+
+#if defined(__INTEL_COMPILER) && defined(__KNC__)
+#pragma optimization_level 1 /* Crash with O2 on KNC with icc 14.0.0 20130728 */
+#endif
+
+static const fvm_writer_section_t *
+_field_helper_output_eg(fvm_writer_field_helper_t          *helper,
+                        void                               *context,
+                        const fvm_writer_section_t         *export_section,
+                        int                                 src_dim,
+                        cs_interlace_t                      src_interlace,
+                        const int                          *comp_order,
+                        int                                 n_parent_lists,
+                        const cs_lnum_t                     parent_num_shift[],
+                        cs_datatype_t                       datatype,
+                        const void                   *const field_values[],
+                        fvm_writer_field_output_t          *output_func)
+{
+  fvm_writer_field_helper_t *h = helper;
+
+  cs_part_to_block_t  *d = NULL;
+
+  int         n_sections = 0;
+  bool        have_tesselation = false;
+  cs_lnum_t   part_size = 0, block_size = 0;
+  cs_gnum_t   block_sub_size = 0, block_start = 0, block_end = 0;
+  cs_gnum_t   n_g_elements = 0;
+
+  const int  *block_n_sub = NULL;
+  unsigned char  *part_values = NULL;
+  unsigned char  *block_values = NULL, *_block_values = NULL;
+
+  const fvm_writer_section_t  *current_section = NULL;
+
+  const size_t stride = (h->interlace == CS_INTERLACE) ? h->field_dim : 1;
+  const size_t elt_size = cs_datatype_size[h->datatype];
+  const size_t min_block_size =   h->min_block_size
+                                / (elt_size*stride);
+
+  /* Loop on sections to count output size */
+
+  current_section = export_section;
+  do {
+
+    const fvm_nodal_section_t  *section = current_section->section;
+
+    n_sections += 1;
+    n_g_elements += fvm_io_num_get_global_count(section->global_element_num);
+    part_size += fvm_io_num_get_local_count(section->global_element_num);
+    if (current_section->type != section->type)
+      have_tesselation = true;
+
+    current_section = current_section->next;
+
+  } while (   current_section != NULL
+           && current_section->continues_previous == true);
+
+  /* Get (possibly cached) distribution structures */
+
+  const fvm_nodal_dist_t  *dist = _section_dist(h,
+                                                export_section,
+                                                n_sections,
+                                                part_size,
+                                                n_g_elements,
+                                                min_block_size);
+
+  d = dist->d;
+  block_n_sub = dist->block_n_sub;
+  block_size = dist->bi.gnum_range[1] - dist->bi.gnum_range[0];
+  block_start = dist->block_sub_range[0];
+  block_end = dist->block_sub_range[1];
+  block_sub_size = block_end - block_start;
 
   /* Number of loops on dimension and conversion output dimension */
 
@@ -516,15 +740,10 @@ _field_helper_output_eg(fvm_writer_field_helper_t          *helper,
                (  CS_MAX(part_size, (cs_lnum_t)block_sub_size)
                 * elt_size*convert_dim),
                unsigned char);
-    MPI_Scan(&block_sub_size, &block_end, 1, CS_MPI_GNUM, MPI_SUM, h->comm);
-    block_end += 1;
-    block_start = block_end - block_sub_size;
     _block_values = part_values;
   }
   else {
     BFT_MALLOC(part_values, part_size*elt_size*convert_dim, unsigned char);
-    block_start = bi.gnum_range[0];
-    block_end = bi.gnum_range[1];
     _block_values = block_values;
   }
 
@@ -629,11 +848,6 @@ _field_helper_output_eg(fvm_writer_field_helper_t          *helper,
   BFT_FREE(block_values);
   BFT_FREE(part_values);
 
-  cs_part_to_block_destroy(&d);
-
-  if (block_n_sub != NULL)
-    BFT_FREE(block_n_sub);
-
   /* Return pointer to next section */
 
   return current_section;
@@ -867,8 +1081,6 @@ _field_helper_output_ng(fvm_writer_field_helper_t        *helper,
 {
   fvm_writer_field_helper_t *h = helper;
 
-  cs_block_dist_info_t  bi;
-
   cs_lnum_t       part_size = 0, block_size = 0;
   unsigned char  *part_values = NULL, *block_values = NULL;
   cs_part_to_block_t  *d = NULL;
@@ -878,16 +1090,12 @@ _field_helper_output_ng(fvm_writer_field_helper_t        *helper,
   const size_t min_block_size =   h->min_block_size
                                 / (elt_size*stride);
 
-  /* Initialize distribution info */
+  /* Get (possibly cached) distribution info */
 
-  fvm_writer_vertex_part_to_block_create(h->min_rank_step,
-                                         min_block_size,
-                                         helper->n_g_vertices_add,
-                                         helper->n_vertices_add,
-                                         mesh,
-                                         &bi,
-                                         &d,
-                                         h->comm);
+  const fvm_nodal_dist_t  *dist = _vertex_dist(h, mesh, min_block_size);
+  const cs_block_dist_info_t  bi = dist->bi;
+
+  d = dist->d;
 
   part_size = cs_part_to_block_get_n_part_ents(d);
   block_size = bi.gnum_range[1] - bi.gnum_range[0];
@@ -959,7 +1167,7 @@ _field_helper_output_ng(fvm_writer_field_helper_t        *helper,
                                           convert_dim,
                                           0,
                                           n_extra_vertices,
-                                          h->interlace,
+                                          src_interlace,
                                           datatype,
                                           h->datatype,
                                           n_parent_lists,
@@ -1014,8 +1222,6 @@ _field_helper_output_ng(fvm_writer_field_helper_t        *helper,
 
   BFT_FREE(block_values);
   BFT_FREE(part_values);
-
-  cs_part_to_block_destroy(&d);
 }
 
 #endif /* defined(HAVE_MPI) */
@@ -1131,7 +1337,7 @@ _field_helper_output_nl(fvm_writer_field_helper_t        *helper,
                                           convert_dim,
                                           0,
                                           n_extra_vertices,
-                                          h->interlace,
+                                          src_interlace,
                                           datatype,
                                           h->datatype,
                                           n_parent_lists,
@@ -4079,6 +4079,10 @@ cs_gui_linear_solvers(void)
         sles_it_type = CS_SLES_P_SYM_GAUSS_SEIDEL;
       else if (cs_gui_strcmp(algo_choice, "PCR3"))
         sles_it_type = CS_SLES_PCR3;
+      else if (cs_gui_strcmp(algo_choice, "ca_gmres"))
+        sles_it_type = CS_SLES_CA_GMRES;
+      else if (cs_gui_strcmp(algo_choice, "ca_bi_cgstab"))
+        sles_it_type = CS_SLES_CA_BICGSTAB;
 
       /* If choice is "automatic" or unspecified, delay
          choice to cs_sles_default, so do nothing here */
@@ -103,6 +103,7 @@
 #include "cs_lagr_prototypes.h"
 #include "cs_lagr_agglo.h"
 #include "cs_lagr_fragmentation.h"
+#include "cs_lagr_parcel.h"
 
 #include "cs_random.h"
 
@@ -253,6 +254,12 @@ static cs_lagr_fragmentation_model_t _cs_glob_lagr_fragmentation_model
 cs_lagr_fragmentation_model_t *cs_glob_lagr_fragmentation_model
   = &_cs_glob_lagr_fragmentation_model;
 
+/* lagr parcel management structure and associated pointer */
+static cs_lagr_parcel_model_t _cs_glob_lagr_parcel_model
+  = {0, 0, 0.};
+cs_lagr_parcel_model_t *cs_glob_lagr_parcel_model
+  = &_cs_glob_lagr_parcel_model;
+
 /* lagr consolidation model structure and associated pointer */
 static cs_lagr_consolidation_model_t _cs_glob_lagr_consolidation_model
   = {0, 0, 0, 0};
@@ -973,106 +980,6 @@ _update_boundary_face_type(void)
   }
 }
 
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief Obtain the number of mesh cells occupied by at least one particle.
- *
- * \param[in]   p_set   pointer to particle data structure
- * \param[in]   start   start position in p_set
- * \param[in]   end     end position in p_set
- *
- * \return
- *   integer that gives the number of cells occupied by at least one particle
- *   in a particle sub-set
- */
-/*----------------------------------------------------------------------------*/
-
-static cs_lnum_t
-_get_n_occupied_cells(const cs_lagr_particle_set_t  *p_set,
-                      cs_lnum_t                      start,
-                      cs_lnum_t                      end)
-{
-  /*Initialization:
-    counter for number of cells that contain particles */
-  cs_lnum_t counter_particle_cells = 0;
-
-  /* Main loop to update the counter */
-  if (end - start > 1) {
-    counter_particle_cells = 1;
-    cs_lnum_t prev_cell_id
-      = cs_lagr_particles_get_lnum(p_set, start, CS_LAGR_CELL_ID);
-    cs_lnum_t curr_cell_id = prev_cell_id;
-    for (cs_lnum_t p = start + 1; p < end; ++p) {
-      curr_cell_id = cs_lagr_particles_get_lnum(p_set, p, CS_LAGR_CELL_ID);
-      if (prev_cell_id != curr_cell_id)
-        counter_particle_cells++;
-      prev_cell_id = curr_cell_id;
-    }
-  }
-  else if (p_set->n_particles == 1) {
-    counter_particle_cells = 1;
-  }
-
-  return counter_particle_cells;
-}
-
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief  Obtain the index of cells that are occupied by at least one
- *         particle and the list of indices of the particle set that contain
- *         the first element in a cell
- *
- * The two arrays that contain this information need to be pre-allocated to
- * size n_occupied_cells and n_occupied_cells+1 respectively.
- *
- * The value of particle_gaps at index i contains the first particle in
- * in cell[i+1]. The last element of particle_gaps contains the size of p_set.
- *
- * \param[in]   p_set              id of associated location
- * \param[in]   start              id of associated zone
- * \param[in]   end                id of requested class
- * \param[in]   n_occupied_cells   number of cells that are occupied by particles
- * \param[out]  occupied_cell_ids  occupied_cell ids
- * \param[out]  particle_gaps      preallocated list of size n_occupied_cells+1
- *                                 that will contain the starting indices of
- *                                 particles that are in the current cell
- */
-/*----------------------------------------------------------------------------*/
-
-static void
-_occupied_cells(cs_lagr_particle_set_t  *p_set,
-                cs_lnum_t                start,
-                cs_lnum_t                end,
-                cs_lnum_t                n_occupied_cells,
-                cs_lnum_t                occupied_cell_ids[],
-                cs_lnum_t                particle_gaps[])
-{
-  if (end - start >= 1) {
-    /* Initialization */
-    cs_lnum_t prev_cell_id
-      = cs_lagr_particles_get_lnum(p_set, start, CS_LAGR_CELL_ID);
-    cs_lnum_t curr_cell_id = prev_cell_id;
-    cs_lnum_t counter = 0;
-    occupied_cell_ids[0] = curr_cell_id;
-    particle_gaps[0] = 0;
-
-    counter = 1;
-
-    /* Update lists */
-    for (cs_lnum_t part = start + 1; part < end; ++part) {
-      curr_cell_id
-        = cs_lagr_particles_get_lnum(p_set, part, CS_LAGR_CELL_ID);
-      if (prev_cell_id != curr_cell_id) {
-        occupied_cell_ids[counter] = curr_cell_id;
-        particle_gaps[counter] = part;
-        counter++;
-      }
-      prev_cell_id = curr_cell_id;
-    }
-    particle_gaps[n_occupied_cells] = p_set->n_particles;
-  }
-}
-
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Obtain the number of particles to be deleted
@@ -1459,6 +1366,18 @@ cs_get_lagr_agglomeration_model(void)
   return &_cs_glob_lagr_agglomeration_model;
 }
 
+/*----------------------------------------------------------------------------
+ * Provide access to cs_lagr_parcel_model_t
+ *
+ * needed to initialize structure in user functions
+ *----------------------------------------------------------------------------*/
+
+cs_lagr_parcel_model_t *
+cs_get_lagr_parcel_model(void)
+{
+  return &_cs_glob_lagr_parcel_model;
+}
+
 /*----------------------------------------------------------------------------
  * Provide access to cs_lagr_consolidation_model_t
  *
@@ -2154,6 +2073,11 @@ cs_lagr_solve_time_step(const int         itypfb[],
           cs_lagr_particles_current_to_previous(p_set, ip);
 
         n_particles_prev = p_set->n_particles;
+
+        /* Group particles by cell (new particles are appended to the set
+           by injection); this also builds the cell -> particles index */
+
+        cs_lagr_particle_set_sort_by_cell(p_set);
       }
 
       /* Computation of the fluid's pressure and velocity gradient
@@ -2282,16 +2206,30 @@ cs_lagr_solve_time_step(const int         itypfb[],
       if (   cs_glob_lagr_model->agglomeration == 1
           || cs_glob_lagr_model->fragmentation == 1 ) {
 
-        n_occupied_cells
-          = _get_n_occupied_cells(p_set, 0, p_set->n_particles);
+        /* Particles are already sorted by cell (after injection
+           and tracking), so use the associated index */
+
+        const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+        const cs_lnum_t *c_p_idx = p_set->cell_particle_idx;
+
+        n_occupied_cells = 0;
+        for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+          if (c_p_idx[c_id+1] > c_p_idx[c_id])
+            n_occupied_cells++;
+        }
 
         BFT_MALLOC(occupied_cell_ids, n_occupied_cells, cs_lnum_t);
         BFT_MALLOC(particle_list, n_occupied_cells+1, cs_lnum_t);
 
-        _occupied_cells(p_set, 0, p_set->n_particles,
-                        n_occupied_cells,
-                        occupied_cell_ids,
-                        particle_list);
+        n_occupied_cells = 0;
+        for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+          if (c_p_idx[c_id+1] > c_p_idx[c_id]) {
+            occupied_cell_ids[n_occupied_cells] = c_id;
+            particle_list[n_occupied_cells] = c_p_idx[c_id];
+            n_occupied_cells++;
+          }
+        }
+        particle_list[n_occupied_cells] = c_p_idx[n_cells];
 
       }
 
@@ -2472,6 +2410,10 @@ cs_lagr_solve_time_step(const int         itypfb[],
 
         cs_lagr_tracking_particle_movement(vislen);
 
+        /* Re-sort particles which changed cells */
+
+        cs_lagr_particle_set_sort_by_cell(p_set);
+
       }
 
       /* Update residence time */
@@ -2616,6 +2558,13 @@ cs_lagr_solve_time_step(const int         itypfb[],
 
     }
 
+    /* Parcel management: merge or split particles to keep the number
+       of particles per cell within the target band */
+
+    if (   cs_glob_lagr_parcel_model->n_min_per_cell > 0
+        || cs_glob_lagr_parcel_model->n_max_per_cell > 0)
+      cs_lagr_parcel_management(p_set);
+
   }  /* end if number of particles > 0 */
 
   else if (cs_glob_time_step->nt_cur >= cs_glob_lagr_stat_options->idstnt)
@@ -486,6 +486,40 @@ typedef struct {
 
 } cs_lagr_fragmentation_model_t;
 
+/*! Parameters of parcel management (merging and splitting of particles)
+
+  Parcel management is off by default, and is activated by setting
+  \ref n_min_per_cell and/or \ref n_max_per_cell to a positive value
+  through \ref cs_glob_lagr_parcel_model in \ref cs_user_lagr_model
+  (see the "parcel_management" example). It is applied at the end of
+  each Lagrangian time step. */
+/* --------------------------------------------------------------------- */
+
+typedef struct {
+
+  /*! Minimum number of particles per cell. In cells with fewer
+    particles, the particle with the highest statistical weight is
+    repeatedly split in two particles of half weight, until this count
+    is reached or no split is allowed by \ref min_split_weight.
+    Deposited or fixed particles are counted but never split.
+    0 (default) disables splitting.
+    When both bounds are active, it must not exceed \ref n_max_per_cell. */
+  cs_lnum_t          n_min_per_cell;
+
+  /*! Maximum number of particles per cell. In cells with more
+    particles, pairs of particles of the same class with the closest
+    statistical weights are merged, conserving mass, momentum and
+    enthalpy, until this count is reached or no mergeable pair remains.
+    Ignored for non-spherical particles. 0 (default) disables merging. */
+  cs_lnum_t          n_max_per_cell;
+
+  /*! Minimum statistical weight of particles resulting from a split:
+    particles whose half weight would be lower are not split
+    (default 0.) */
+  cs_real_t          min_split_weight;
+
+} cs_lagr_parcel_model_t;
+
 /*! Parameters of the particle consolidation model */
 /* ----------------------------------------------- */
 
@@ -1031,6 +1065,7 @@ extern cs_lagr_shape_model_t                 *cs_glob_lagr_shape_model;
 
 extern cs_lagr_agglomeration_model_t         *cs_glob_lagr_agglomeration_model;
 extern cs_lagr_fragmentation_model_t         *cs_glob_lagr_fragmentation_model;
+extern cs_lagr_parcel_model_t                *cs_glob_lagr_parcel_model;
 
 extern cs_lagr_consolidation_model_t         *cs_glob_lagr_consolidation_model;
 extern cs_lagr_time_step_t                   *cs_glob_lagr_time_step;
@@ -1164,6 +1199,15 @@ cs_get_lagr_shape_model(void);
 cs_lagr_agglomeration_model_t *
 cs_get_lagr_agglomeration_model(void);
 
+/*----------------------------------------------------------------------------
+ * Provide access to cs_lagr_parcel_model_t
+ *
+ * needed to initialize structure in user functions
+ *----------------------------------------------------------------------------*/
+
+cs_lagr_parcel_model_t *
+cs_get_lagr_parcel_model(void);
+
 /*----------------------------------------------------------------------------
  * Provide access to cs_lagr_consolidation_model_t
  *
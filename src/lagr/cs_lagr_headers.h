@@ -45,6 +45,7 @@
 #include "cs_lagr_log.h"
 #include "cs_lagr_new.h"
 #include "cs_lagr_options.h"
+#include "cs_lagr_parcel.h"
 #include "cs_lagr_particle.h"
 #include "cs_lagr_poisson.h"
 #include "cs_lagr_post.h"
@@ -41,6 +41,7 @@
  *  Local headers
  *----------------------------------------------------------------------------*/
 
+#include "bft_error.h"
 #include "bft_mem.h"
 #include "bft_printf.h"
 
@@ -814,6 +815,23 @@ cs_lagr_option_definition(cs_int_t   *isuite,
 
   cs_parameters_error_barrier();
 
+  /* Parcel management: splitting and merging bounds must be consistent */
+
+  {
+    const cs_lagr_parcel_model_t *pm = cs_glob_lagr_parcel_model;
+
+    if (   pm->n_min_per_cell > 0 && pm->n_max_per_cell > 0
+        && pm->n_min_per_cell > pm->n_max_per_cell)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Lagrangian module: inconsistent parcel management bounds:\n"
+                  "  cs_glob_lagr_parcel_model->n_min_per_cell = %d\n"
+                  "  cs_glob_lagr_parcel_model->n_max_per_cell = %d\n"
+                  "n_min_per_cell must not be greater than n_max_per_cell,\n"
+                  "otherwise particles would be split and merged again\n"
+                  "at each time step."),
+                (int)pm->n_min_per_cell, (int)pm->n_max_per_cell);
+  }
+
   /* Initialization which must not be changed by the user
      ==================================================== */
 
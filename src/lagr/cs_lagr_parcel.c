@@ -0,0 +1,648 @@
+/*============================================================================
+ * Parcel management: merging and splitting of particles.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <assert.h>
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_base.h"
+#include "cs_math.h"
+#include "cs_mesh.h"
+#include "cs_random.h"
+
+#include "cs_lagr.h"
+#include "cs_lagr_particle.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_lagr_parcel.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+/* Parcel descriptor for merge and split operations in a given cell */
+
+typedef struct {
+
+  int        key[3];     /* class keys (statistical class, agglomeration
+                            class, coal id) */
+  int        flag;       /* 0: available, 1: used in current pass,
+                            -1: removed */
+  cs_real_t  w;          /* statistical weight */
+  cs_lnum_t  id;         /* particle id */
+
+} _parcel_t;
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Compare parcels by increasing statistical weight (qsort function).
+ *----------------------------------------------------------------------------*/
+
+static int
+_compare_parcels(const void  *x,
+                 const void  *y)
+{
+  const _parcel_t *p0 = x;
+  const _parcel_t *p1 = y;
+
+  if (p0->w < p1->w)
+    return -1;
+  else if (p0->w > p1->w)
+    return 1;
+  else if (p0->id < p1->id)
+    return -1;
+  else if (p0->id > p1->id)
+    return 1;
+
+  return 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Check if a particle may be merged or split.
+ *
+ * parameters:
+ *   p_set <-- pointer to particle set
+ *   p_id  <-- particle id
+ *
+ * returns:
+ *   true if the particle is neither deposited, fixed, nor to be deleted
+ *----------------------------------------------------------------------------*/
+
+static inline bool
+_is_free_parcel(const cs_lagr_particle_set_t  *p_set,
+                cs_lnum_t                      p_id)
+{
+  bool retval = false;
+
+  if (   !cs_lagr_particles_get_flag(p_set, p_id,
+                                     CS_LAGR_PART_DEPOSITION_FLAGS)
+      && cs_lagr_particles_get_real(p_set, p_id, CS_LAGR_STAT_WEIGHT) > 0)
+    retval = true;
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Initialize a parcel descriptor.
+ *
+ * parameters:
+ *   p_set  <-- pointer to particle set
+ *   p_id   <-- particle id
+ *   parcel --> parcel descriptor
+ *----------------------------------------------------------------------------*/
+
+static void
+_init_parcel(const cs_lagr_particle_set_t  *p_set,
+             cs_lnum_t                      p_id,
+             _parcel_t                     *parcel)
+{
+  const cs_lagr_attribute_t attr[3] = {CS_LAGR_STAT_CLASS,
+                                       CS_LAGR_AGGLO_CLASS_ID,
+                                       CS_LAGR_COAL_ID};
+
+  for (int i = 0; i < 3; i++) {
+    if (p_set->p_am->count[0][attr[i]] > 0)
+      parcel->key[i] = cs_lagr_particles_get_lnum(p_set, p_id, attr[i]);
+    else
+      parcel->key[i] = 0;
+  }
+
+  parcel->flag = 0;
+  parcel->w = cs_lagr_particles_get_real(p_set, p_id, CS_LAGR_STAT_WEIGHT);
+  parcel->id = p_id;
+}
+
+/*----------------------------------------------------------------------------
+ * Replace a real attribute of a particle by a weighted mean of its value
+ * and that of another particle.
+ *
+ * parameters:
+ *   p_set <-- pointer to particle set
+ *   s_id  <-- id of merged particle
+ *   d_id  <-- id of remaining particle
+ *   attr  <-- attribute
+ *   s_c   <-- weight of merged particle
+ *   d_c   <-- weight of remaining particle
+ *----------------------------------------------------------------------------*/
+
+static void
+_weighted_mean(cs_lagr_particle_set_t  *p_set,
+               cs_lnum_t                s_id,
+               cs_lnum_t                d_id,
+               cs_lagr_attribute_t      attr,
+               cs_real_t                s_c,
+               cs_real_t                d_c)
+{
+  int n = p_set->p_am->count[0][attr];
+
+  if (n < 1 || s_c + d_c <= 0)
+    return;
+
+  const cs_real_t *s = cs_lagr_particles_attr_const(p_set, s_id, attr);
+  cs_real_t *d = cs_lagr_particles_attr(p_set, d_id, attr);
+
+  for (int i = 0; i < n; i++)
+    d[i] = (s_c*s[i] + d_c*d[i]) / (s_c + d_c);
+}
+
+/*----------------------------------------------------------------------------
+ * Replace a diameter attribute of a particle by the diameter conserving
+ * the total volume of two particles.
+ *
+ * parameters:
+ *   p_set <-- pointer to particle set
+ *   s_id  <-- id of merged particle
+ *   d_id  <-- id of remaining particle
+ *   attr  <-- attribute
+ *   s_w   <-- statistical weight of merged particle
+ *   d_w   <-- statistical weight of remaining particle
+ *----------------------------------------------------------------------------*/
+
+static void
+_volume_mean(cs_lagr_particle_set_t  *p_set,
+             cs_lnum_t                s_id,
+             cs_lnum_t                d_id,
+             cs_lagr_attribute_t      attr,
+             cs_real_t                s_w,
+             cs_real_t                d_w)
+{
+  if (p_set->p_am->count[0][attr] < 1)
+    return;
+
+  cs_real_t s_d = cs_lagr_particles_get_real(p_set, s_id, attr);
+  cs_real_t d_d = cs_lagr_particles_get_real(p_set, d_id, attr);
+
+  cs_real_t v = (s_w*s_d*s_d*s_d + d_w*d_d*d_d*d_d) / (s_w + d_w);
+
+  cs_lagr_particles_set_real(p_set, d_id, attr, cbrt(v));
+}
+
+/*----------------------------------------------------------------------------
+ * Merge a particle into another one of the same class.
+ *
+ * The statistical weight of the remaining particle is the sum of both
+ * weights; total mass, momentum and enthalpy are conserved. Other
+ * attributes (including position) are those of the remaining particle.
+ *
+ * parameters:
+ *   p_set <-- pointer to particle set
+ *   s_id  <-- id of merged particle
+ *   d_id  <-- id of remaining particle
+ *----------------------------------------------------------------------------*/
+
+static void
+_merge_particles(cs_lagr_particle_set_t  *p_set,
+                 cs_lnum_t                s_id,
+                 cs_lnum_t                d_id)
+{
+  const cs_lagr_attribute_map_t *p_am = p_set->p_am;
+
+  cs_real_t s_w = cs_lagr_particles_get_real(p_set, s_id, CS_LAGR_STAT_WEIGHT);
+  cs_real_t d_w = cs_lagr_particles_get_real(p_set, d_id, CS_LAGR_STAT_WEIGHT);
+
+  cs_real_t s_wm = s_w * cs_lagr_particles_get_real(p_set, s_id, CS_LAGR_MASS);
+  cs_real_t d_wm = d_w * cs_lagr_particles_get_real(p_set, d_id, CS_LAGR_MASS);
+
+  /* Enthalpy (based on values before update of mass and heat capacity) */
+
+  if (p_am->count[0][CS_LAGR_TEMPERATURE] > 0) {
+    cs_real_t s_wmc = s_wm, d_wmc = d_wm;
+    if (p_am->count[0][CS_LAGR_CP] > 0) {
+      s_wmc *= cs_lagr_particles_get_real(p_set, s_id, CS_LAGR_CP);
+      d_wmc *= cs_lagr_particles_get_real(p_set, d_id, CS_LAGR_CP);
+    }
+    _weighted_mean(p_set, s_id, d_id, CS_LAGR_TEMPERATURE, s_wmc, d_wmc);
+    _weighted_mean(p_set, s_id, d_id, CS_LAGR_CP, s_wm, d_wm);
+  }
+
+  /* Momentum */
+
+  _weighted_mean(p_set, s_id, d_id, CS_LAGR_VELOCITY, s_wm, d_wm);
+  _weighted_mean(p_set, s_id, d_id, CS_LAGR_VELOCITY_SEEN, s_wm, d_wm);
+
+  /* Mass and volume */
+
+  _volume_mean(p_set, s_id, d_id, CS_LAGR_DIAMETER, s_w, d_w);
+  _volume_mean(p_set, s_id, d_id, CS_LAGR_SHRINKING_DIAMETER, s_w, d_w);
+  _volume_mean(p_set, s_id, d_id, CS_LAGR_INITIAL_DIAMETER, s_w, d_w);
+
+  _weighted_mean(p_set, s_id, d_id, CS_LAGR_MASS, s_w, d_w);
+  _weighted_mean(p_set, s_id, d_id, CS_LAGR_WATER_MASS, s_w, d_w);
+  _weighted_mean(p_set, s_id, d_id, CS_LAGR_COAL_MASS, s_w, d_w);
+  _weighted_mean(p_set, s_id, d_id, CS_LAGR_COKE_MASS, s_w, d_w);
+
+  _weighted_mean(p_set, s_id, d_id, CS_LAGR_RESIDENCE_TIME, s_w, d_w);
+
+  cs_lagr_particles_set_real(p_set, d_id, CS_LAGR_STAT_WEIGHT, s_w + d_w);
+}
+
+/*----------------------------------------------------------------------------
+ * Merge particles of a given cell until their number is not greater
+ * than a given target.
+ *
+ * At each pass, each available particle (in increasing weight order)
+ * is merged into the next available particle of the same class,
+ * so that particles of similar weights are merged first.
+ *
+ * parameters:
+ *   p_set    <-> pointer to particle set
+ *   s_id     <-- id of first particle in cell
+ *   e_id     <-- id of past-the-last particle in cell
+ *   n_target <-- maximum number of particles in cell
+ *   parcels  <-- work array (size: e_id - s_id)
+ *   merged   <-> flag for merged particles
+ *
+ * returns:
+ *   number of merged particles
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_merge_cell(cs_lagr_particle_set_t  *p_set,
+            cs_lnum_t                s_id,
+            cs_lnum_t                e_id,
+            cs_lnum_t                n_target,
+            _parcel_t                parcels[],
+            char                     merged[])
+{
+  cs_lnum_t n_excess = e_id - s_id - n_target;
+
+  if (n_excess < 1)
+    return 0;
+
+  cs_lnum_t n_merged = 0;
+  cs_lnum_t n = 0;
+
+  for (cs_lnum_t p_id = s_id; p_id < e_id; p_id++) {
+    if (_is_free_parcel(p_set, p_id))
+      _init_parcel(p_set, p_id, parcels + n++);
+  }
+
+  while (n_excess > 0) {
+
+    qsort(parcels, n, sizeof(_parcel_t), _compare_parcels);
+
+    cs_lnum_t n_pass_merged = 0;
+
+    for (cs_lnum_t i = 0; i < n && n_excess > 0; i++) {
+
+      if (parcels[i].flag != 0)
+        continue;
+
+      for (cs_lnum_t j = i+1; j < n; j++) {
+        if (   parcels[j].flag == 0
+            && parcels[j].key[0] == parcels[i].key[0]
+            && parcels[j].key[1] == parcels[i].key[1]
+            && parcels[j].key[2] == parcels[i].key[2]) {
+          _merge_particles(p_set, parcels[i].id, parcels[j].id);
+          merged[parcels[i].id] = 1;
+          parcels[i].flag = -1;
+          parcels[j].flag = 1;
+          parcels[j].w += parcels[i].w;
+          n_pass_merged++;
+          n_excess--;
+          break;
+        }
+      }
+
+    }
+
+    if (n_pass_merged == 0)
+      break;
+
+    n_merged += n_pass_merged;
+
+    /* Compact remaining parcels for next pass */
+
+    cs_lnum_t k = 0;
+    for (cs_lnum_t i = 0; i < n; i++) {
+      if (parcels[i].flag > -1) {
+        parcels[k] = parcels[i];
+        parcels[k].flag = 0;
+        k++;
+      }
+    }
+    n = k;
+
+  }
+
+  return n_merged;
+}
+
+/*----------------------------------------------------------------------------
+ * Split particles of a given cell until their number reaches a given target.
+ *
+ * The particle with highest statistical weight is split into two particles
+ * of half weight, as long as the resulting weight is not lower than
+ * the given minimum.
+ *
+ * If new_id < 0, particles are only counted, and the particle set is
+ * not modified; otherwise, new particles are copies of the split
+ * particle, placed at ids starting from new_id.
+ *
+ * parameters:
+ *   p_set    <-> pointer to particle set
+ *   s_id     <-- id of first particle in cell
+ *   e_id     <-- id of past-the-last particle in cell
+ *   n_target <-- minimum number of particles in cell
+ *   min_w    <-- minimum statistical weight of split particles
+ *   new_id   <-- id of first new particle, or -1
+ *   parcels  <-- work array (size: e_id - s_id + n_target)
+ *   merged   <-- flag for merged particles
+ *
+ * returns:
+ *   number of new particles
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_split_cell(cs_lagr_particle_set_t  *p_set,
+            cs_lnum_t                s_id,
+            cs_lnum_t                e_id,
+            cs_lnum_t                n_target,
+            cs_real_t                min_w,
+            cs_lnum_t                new_id,
+            _parcel_t                parcels[],
+            const char               merged[])
+{
+  cs_lnum_t n_cell = 0;
+  cs_lnum_t n = 0;
+
+  for (cs_lnum_t p_id = s_id; p_id < e_id; p_id++) {
+    if (merged[p_id])
+      continue;
+    n_cell++;
+    if (_is_free_parcel(p_set, p_id)) {
+      parcels[n].w = cs_lagr_particles_get_real(p_set, p_id,
+                                                CS_LAGR_STAT_WEIGHT);
+      parcels[n].id = p_id;
+      n++;
+    }
+  }
+
+  cs_lnum_t n_new = 0;
+
+  while (n_cell + n_new < n_target && n > 0) {
+
+    cs_lnum_t i_max = 0;
+    for (cs_lnum_t i = 1; i < n; i++) {
+      if (parcels[i].w > parcels[i_max].w)
+        i_max = i;
+    }
+
+    cs_real_t w = 0.5 * parcels[i_max].w;
+    if (w < min_w)
+      break;
+
+    parcels[i_max].w = w;
+    parcels[n].w = w;
+    parcels[n].id = -1;
+
+    if (new_id > -1) {
+      const size_t extents = p_set->p_am->extents;
+      cs_lnum_t p_id = parcels[i_max].id;
+      cs_lagr_particles_set_real(p_set, p_id, CS_LAGR_STAT_WEIGHT, w);
+      memcpy(p_set->p_buffer + extents*(new_id + n_new),
+             p_set->p_buffer + extents*p_id,
+             extents);
+      parcels[n].id = new_id + n_new;
+    }
+
+    n++;
+    n_new++;
+
+  }
+
+  return n_new;
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Merge and split particles so as to keep the number of parcels
+ *        per cell within the band defined by \ref cs_glob_lagr_parcel_model.
+ *
+ * In cells containing more than n_max_per_cell particles, pairs of
+ * particles of the same class (same statistical class, agglomeration class
+ * and coal id, when those attributes are present) and with close
+ * statistical weights are merged. The remaining particle's statistical
+ * weight is the sum of both weights, and its mass, velocity and
+ * temperature are averaged so as to conserve mass, momentum and enthalpy.
+ *
+ * In cells containing less than n_min_per_cell particles, the particles
+ * with highest statistical weights are split in two particles of half
+ * weight, while the resulting weight is not lower than min_split_weight.
+ *
+ * Deposited or otherwise fixed particles are neither merged nor split.
+ * Merging is disabled for non-spherical particles.
+ *
+ * The particle set is sorted by cell on exit.
+ *
+ * \param[in, out]  particles  associated particle set
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_parcel_management(cs_lagr_particle_set_t  *particles)
+{
+  const cs_lagr_parcel_model_t *pm = cs_glob_lagr_parcel_model;
+
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+  const cs_lnum_t n_particles = particles->n_particles;
+  const size_t extents = particles->p_am->extents;
+
+  const cs_lnum_t n_min = CS_MAX(pm->n_min_per_cell, 0);
+  const cs_lnum_t n_max
+    = (cs_glob_lagr_model->shape == 0) ? CS_MAX(pm->n_max_per_cell, 0) : 0;
+
+  if (n_min == 0 && n_max == 0)
+    return;
+
+  /* Group particles by cell */
+
+  cs_lagr_particle_set_sort_by_cell(particles);
+
+  const cs_lnum_t *c_p_idx = particles->cell_particle_idx;
+
+  cs_lnum_t n_max_cell_particles = 0;
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    n_max_cell_particles = CS_MAX(n_max_cell_particles,
+                                  c_p_idx[c_id+1] - c_p_idx[c_id]);
+
+  const cs_lnum_t parcels_size = n_max_cell_particles + n_min;
+
+  char *merged;
+  BFT_MALLOC(merged, n_particles, char);
+  for (cs_lnum_t i = 0; i < n_particles; i++)
+    merged[i] = 0;
+
+  cs_lnum_t *split_idx;
+  BFT_MALLOC(split_idx, n_cells + 1, cs_lnum_t);
+  split_idx[0] = 0;
+
+  /* Merge particles in over-populated cells, and count
+     particles to add in under-populated cells */
+
+  cs_lnum_t n_merged = 0;
+
+# pragma omp parallel reduction(+:n_merged) if (n_cells > CS_THR_MIN)
+  {
+    _parcel_t *parcels;
+    BFT_MALLOC(parcels, parcels_size, _parcel_t);
+
+#   pragma omp for
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+
+      cs_lnum_t s_id = c_p_idx[c_id], e_id = c_p_idx[c_id+1];
+
+      split_idx[c_id+1] = 0;
+
+      if (n_max > 0)
+        n_merged += _merge_cell(particles, s_id, e_id, n_max,
+                                parcels, merged);
+
+      if (n_min > 0 && e_id - s_id < n_min)
+        split_idx[c_id+1] = _split_cell(particles, s_id, e_id, n_min,
+                                        pm->min_split_weight, -1,
+                                        parcels, merged);
+
+    }
+
+    BFT_FREE(parcels);
+  }
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    split_idx[c_id+1] += split_idx[c_id];
+
+  /* Split particles in under-populated cells, adding new particles
+     at the end of the set */
+
+  cs_lnum_t n_new = split_idx[n_cells];
+
+  if (n_new > 0) {
+    if (   cs_lagr_particle_set_resize(n_particles + n_new) < 0
+        || n_particles + n_new > particles->n_particles_max)
+      n_new = 0;
+  }
+
+  if (n_new > 0) {
+
+#   pragma omp parallel if (n_cells > CS_THR_MIN)
+    {
+      _parcel_t *parcels;
+      BFT_MALLOC(parcels, parcels_size, _parcel_t);
+
+#     pragma omp for
+      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+        if (split_idx[c_id+1] > split_idx[c_id])
+          _split_cell(particles, c_p_idx[c_id], c_p_idx[c_id+1], n_min,
+                      pm->min_split_weight, n_particles + split_idx[c_id],
+                      parcels, merged);
+      }
+
+      BFT_FREE(parcels);
+    }
+
+    /* New random values for sampling */
+
+    if (particles->p_am->count[0][CS_LAGR_RANDOM_VALUE] > 0) {
+      cs_real_t *r;
+      BFT_MALLOC(r, n_new, cs_real_t);
+      cs_random_uniform(n_new, r);
+      for (cs_lnum_t i = 0; i < n_new; i++)
+        cs_lagr_particles_set_real(particles, n_particles + i,
+                                   CS_LAGR_RANDOM_VALUE, r[i]);
+      BFT_FREE(r);
+    }
+
+  }
+
+  BFT_FREE(split_idx);
+
+  /* Remove merged particles (their weight is transferred to others) */
+
+  if (n_merged > 0) {
+
+    cs_lnum_t count = 0;
+
+    for (cs_lnum_t i = 0; i < n_particles + n_new; i++) {
+      if (i < n_particles && merged[i])
+        continue;
+      if (count < i)
+        memcpy(particles->p_buffer + extents*count,
+               particles->p_buffer + extents*i,
+               extents);
+      count++;
+    }
+
+    assert(count == n_particles + n_new - n_merged);
+
+    particles->n_part_merged += n_merged;
+
+  }
+
+  BFT_FREE(merged);
+
+  particles->n_particles = n_particles + n_new - n_merged;
+
+  /* New particles were added at the end of the set */
+
+  cs_lagr_particle_set_sort_by_cell(particles);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
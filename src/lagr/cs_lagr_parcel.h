@@ -0,0 +1,78 @@
+#ifndef __CS_LAGR_PARCEL_H__
+#define __CS_LAGR_PARCEL_H__
+
+/*============================================================================
+ * Parcel management: merging and splitting of particles.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_lagr_particle.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Merge and split particles so as to keep the number of parcels
+ *        per cell within the band defined by \ref cs_glob_lagr_parcel_model.
+ *
+ * In cells containing more than n_max_per_cell particles, pairs of
+ * particles of the same class (same statistical class, agglomeration class
+ * and coal id, when those attributes are present) and with close
+ * statistical weights are merged. The remaining particle's statistical
+ * weight is the sum of both weights, and its mass, velocity and
+ * temperature are averaged so as to conserve mass, momentum and enthalpy.
+ *
+ * In cells containing less than n_min_per_cell particles, the particles
+ * with highest statistical weights are split in two particles of half
+ * weight, while the resulting weight is not lower than min_split_weight.
+ *
+ * Deposited or otherwise fixed particles are neither merged nor split.
+ * Merging is disabled for non-spherical particles.
+ *
+ * The particle set is sorted by cell on exit.
+ *
+ * \param[in, out]  particles  associated particle set
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_parcel_management(cs_lagr_particle_set_t  *particles);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_LAGR_PARCEL_H__ */
@@ -52,6 +52,7 @@
 
 #include "cs_base.h"
 #include "cs_math.h"
+#include "cs_mesh.h"
 #include "cs_order.h"
 #include "cs_parall.h"
 #include "cs_random.h"
@@ -509,6 +510,8 @@ _create_particle_set(cs_lnum_t                       n_particles_max,
 
   new_set->p_am = p_am;
 
+  new_set->cell_particle_idx = NULL;
+
   return new_set;
 }
 
@@ -526,6 +529,7 @@ _destroy_particle_set(cs_lagr_particle_set_t **set)
 
     cs_lagr_particle_set_t *_set = *set;
     BFT_FREE(_set->p_buffer);
+    BFT_FREE(_set->cell_particle_idx);
 
     BFT_FREE(*set);
   }
@@ -1175,6 +1179,99 @@ cs_lagr_particle_set_resize(cs_lnum_t  n_min_particles)
   return retval;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Sort particles of a set by cell id and update the associated
+ *        cell -> particles index.
+ *
+ * Particles are reordered using a stable counting sort, and only if they
+ * are not already sorted, so calling this function on a set which is
+ * already ordered (or was only partially disordered by particle movement)
+ * is cheap. Particles which are not located in a cell (negative cell id)
+ * are placed at the end of the set, after cell_particle_idx[n_cells].
+ *
+ * The index remains valid only until particles are added, removed,
+ * or moved to another cell. It is currently used by agglomeration and
+ * fragmentation only; other cell-based particle loops (statistics,
+ * two-way coupling) still loop on particles.
+ *
+ * \param[in, out]  particles  associated particle set
+ *
+ * \return  1 if particles were reordered, 0 otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_lagr_particle_set_sort_by_cell(cs_lagr_particle_set_t  *particles)
+{
+  int retval = 0;
+
+  if (particles == NULL)
+    return retval;
+
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+  const cs_lnum_t n_particles = particles->n_particles;
+  const size_t extents = particles->p_am->extents;
+
+  if (particles->cell_particle_idx == NULL)
+    BFT_MALLOC(particles->cell_particle_idx, n_cells + 1, cs_lnum_t);
+
+  cs_lnum_t *c_p_idx = particles->cell_particle_idx;
+
+  for (cs_lnum_t i = 0; i < n_cells + 1; i++)
+    c_p_idx[i] = 0;
+
+  /* Count particles per cell, and check if already sorted */
+
+  bool is_sorted = true;
+  cs_lnum_t prev_key = 0;
+
+  for (cs_lnum_t i = 0; i < n_particles; i++) {
+    cs_lnum_t cell_id
+      = cs_lagr_particles_get_lnum(particles, i, CS_LAGR_CELL_ID);
+    cs_lnum_t key = (cell_id > -1) ? cell_id : n_cells;
+    if (key < prev_key)
+      is_sorted = false;
+    prev_key = key;
+    if (cell_id > -1)
+      c_p_idx[cell_id + 1] += 1;
+  }
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    c_p_idx[i+1] += c_p_idx[i];
+
+  if (is_sorted)
+    return retval;
+
+  /* Reorder particles */
+
+  cs_lnum_t *p_pos;
+  BFT_MALLOC(p_pos, n_cells + 1, cs_lnum_t);
+  memcpy(p_pos, c_p_idx, (n_cells + 1)*sizeof(cs_lnum_t));
+
+  unsigned char *p_buffer;
+  BFT_MALLOC(p_buffer, particles->n_particles_max * extents, unsigned char);
+
+  for (cs_lnum_t i = 0; i < n_particles; i++) {
+    cs_lnum_t cell_id
+      = cs_lagr_particles_get_lnum(particles, i, CS_LAGR_CELL_ID);
+    cs_lnum_t key = (cell_id > -1) ? cell_id : n_cells;
+    memcpy(p_buffer + extents*p_pos[key],
+           particles->p_buffer + extents*i,
+           extents);
+    p_pos[key] += 1;
+  }
+
+  BFT_FREE(p_pos);
+
+  BFT_FREE(particles->p_buffer);
+  particles->p_buffer = p_buffer;
+
+  retval = 1;
+
+  return retval;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Set reallocation factor for particle sets.
@@ -244,6 +244,12 @@ typedef struct {
                                                    (p_am + i for time n-i) */
   unsigned char                  *p_buffer;   /*!< Particles data buffer */
 
+  cs_lnum_t                      *cell_particle_idx; /*!< cell -> particles
+                                                          index (size:
+                                                          n_cells + 1) after
+                                                          last sort by cell,
+                                                          or NULL */
+
 } cs_lagr_particle_set_t;
 
 /*=============================================================================
@@ -1384,6 +1390,29 @@ cs_lagr_particle_source_term_const(void                           *particle,
 int
 cs_lagr_particle_set_resize(cs_lnum_t  n_min_particles);
 
+/*----------------------------------------------------------------------------
+ * Sort particles of a set by cell id and update the associated
+ * cell -> particles index.
+ *
+ * Particles are reordered (stably) only if they are not already sorted;
+ * those not located in a cell (negative cell id) are placed at the end
+ * of the set, after cell_particle_idx[n_cells].
+ *
+ * The index remains valid only until particles are added, removed,
+ * or moved to another cell. It is currently used by agglomeration and
+ * fragmentation only; other cell-based particle loops (statistics,
+ * two-way coupling) still loop on particles.
+ *
+ * parameters:
+ *   particles <-> associated particle set
+ *
+ * returns:
+ *   1 if particles were reordered, 0 otherwise
+ *----------------------------------------------------------------------------*/
+
+int
+cs_lagr_particle_set_sort_by_cell(cs_lagr_particle_set_t  *particles);
+
 /*----------------------------------------------------------------------------
  * Set reallocation factor for particle sets.
  *
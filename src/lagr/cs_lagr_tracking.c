@@ -54,6 +54,7 @@
 
 #include "fvm_periodicity.h"
 
+#include "cs_ale.h"
 #include "cs_base.h"
 #include "cs_boundary_zone.h"
 #include "cs_physical_constants.h"
@@ -167,10 +168,18 @@ typedef struct {
   cs_lnum_t  *transform_id;   /* In case of periodicity, transformation
                                  associated to a given halo cell */
 
-  /* Buffer used to exchange particle between communicating ranks */
+  /* Packing of exchanged particle data: only byte ranges containing
+     tracking info, attributes or source terms are exchanged */
+
+  int          n_pack_ranges;  /* Number of contiguous byte ranges */
+  size_t      *pack_range;     /* Start and size (in bytes) of ranges
+                                  (interleaved) */
+  size_t       packed_size;    /* Size of a packed particle */
+
+  /* Buffers used to exchange particle between communicating ranks */
 
   size_t      send_buf_size;  /* Current maximum send buffer size */
-  size_t      extents;        /* Extents for particle set */
+  size_t      recv_buf_size;  /* Current maximum receive buffer size */
 
   cs_lnum_t  *send_count;     /* number of particles to send to
                                  each communicating rank */
@@ -181,8 +190,15 @@ typedef struct {
   cs_lnum_t  *recv_shift;
 
   unsigned char  *send_buf;
+  unsigned char  *recv_buf;
+
+  int         continue_flag[2];  /* Local and global flags indicating
+                                    particles change domain */
 
 #if defined(HAVE_MPI)
+  int           n_count_requests;  /* Number of persistent requests */
+  MPI_Request  *count_request;     /* Persistent requests for counters */
+  MPI_Request   continue_request;  /* Request for global continue flag */
   MPI_Request  *request;
   MPI_Status   *status;
 #endif
@@ -202,6 +218,19 @@ typedef struct {
   cs_lnum_t  *cell_face_idx;
   cs_lnum_t  *cell_face_lst;
 
+  /* Precomputed face geometry for trajectory/face intersection tests;
+     sub-triangle values use the mesh face -> vertices index, as each
+     sub-triangle is defined by the face center and 2 successive vertices */
+
+  cs_real_t    *i_face_r2;          /* squared radius of interior face
+                                       bounding spheres (centered on cog) */
+  cs_real_t    *b_face_r2;          /* squared radius of boundary face
+                                       bounding spheres (centered on cog) */
+  cs_real_3_t  *i_face_tri_normal;  /* interior face sub-triangle normals
+                                       (not normalized) */
+  cs_real_3_t  *b_face_tri_normal;  /* boundary face sub-triangle normals
+                                       (not normalized) */
+
   cs_lagr_halo_t      *halo;   /* Lagrangian halo structure */
 
   cs_interface_set_t  *face_ifs;
@@ -218,12 +247,6 @@ static  cs_lagr_track_builder_t  *_particle_track_builder = NULL;
 
 static  int            _max_propagation_loops = 100;
 
-/* MPI datatype associated to each particle "structure" */
-
-#if defined(HAVE_MPI)
-static  MPI_Datatype  _cs_mpi_particle_type;
-#endif
-
 /* Global Lagragian module parameters and associated pointer
    Should move to cs_lagr.c */
 
@@ -321,151 +344,161 @@ _apply_vector_rotation(const cs_real_t   matrix[3][4],
   v[2] = matrix[2][0]*v_in[0] + matrix[2][1]*v_in[1] + matrix[2][2]*v_in[2];
 }
 
-#if defined(HAVE_MPI)
-
 /*----------------------------------------------------------------------------
- * Create a MPI_Datatype which maps main particle characteristics.
+ * Define byte ranges of particle data which are exchanged between ranks.
  *
- * parameters:
- *   am  <-- attributes map
+ * Tracking info, attributes (for all time values) and source terms are
+ * mapped, and contiguous ranges merged, so that padding is not exchanged
+ * and particles may be packed to contiguous buffers.
  *
- * returns:
- *   MPI_Datatype matching given attributes map
+ * parameters:
+ *   p_am      <-- particle attributes map
+ *   lag_halo  <-> pointer to a cs_lagr_halo_t structure
  *----------------------------------------------------------------------------*/
 
-static MPI_Datatype
-_define_particle_datatype(const cs_lagr_attribute_map_t  *p_am)
+static void
+_define_pack_ranges(const cs_lagr_attribute_map_t  *p_am,
+                    cs_lagr_halo_t                 *lag_halo)
 {
-  size_t i;
-  MPI_Datatype  new_type;
-  int           count;
-  cs_datatype_t *cs_type;
-  int           *blocklengths;
-  MPI_Datatype  *types;
-  MPI_Aint      *displacements;
-
-  size_t tot_extents = p_am->extents;
-
-  /* Mark bytes with associated type */
-
-  BFT_MALLOC(cs_type, tot_extents, cs_datatype_t);
+  int n_ranges = 0;
+  int n_max_ranges = 1 + (p_am->n_time_vals + 1)*CS_LAGR_N_ATTRIBUTES;
 
-  for (i = 0; i < tot_extents; i++)
-    cs_type[i] = CS_CHAR;
+  size_t *r_start, *r_size;
+  BFT_MALLOC(r_start, n_max_ranges, size_t);
+  BFT_MALLOC(r_size, n_max_ranges, size_t);
 
   /* Map tracking info */
 
-  size_t attr_start, attr_end;
-
-  attr_start = offsetof(cs_lagr_tracking_info_t, start_coords);
-  attr_end = attr_start + 3*sizeof(cs_real_t);
-  for (i = attr_start; i < attr_end; i++)
-    cs_type[i] = CS_REAL_TYPE;
-
-  attr_start = offsetof(cs_lagr_tracking_info_t, last_face_num);
-  attr_end = attr_start + sizeof(cs_lnum_t);
-  for (i = attr_start; i < attr_end; i++)
-    cs_type[i] = CS_LNUM_TYPE;
-
-  attr_start = offsetof(cs_lagr_tracking_info_t, last_face_num);
-  attr_end = attr_start + sizeof(int);
-  for (i = attr_start; i < attr_end; i++)
-    cs_type[i] = CS_INT_TYPE;
+  r_start[n_ranges] = 0;
+  r_size[n_ranges] = sizeof(cs_lagr_tracking_info_t);
+  n_ranges++;
 
   /* Map attributes */
 
   for (int j = 0; j < p_am->n_time_vals; j++) {
-
-    for (size_t attr = 0; attr < CS_LAGR_N_ATTRIBUTES; attr++) {
+    for (int attr = 0; attr < CS_LAGR_N_ATTRIBUTES; attr++) {
       if (p_am->count[j][attr] > 0) {
         assert(p_am->displ[j][attr] > -1);
-        size_t b_size
-          = p_am->count[j][attr] * cs_datatype_size[p_am->datatype[attr]];
-        for (i = 0; i < b_size; i++)
-          cs_type[p_am->displ[j][attr] + i] = p_am->datatype[attr];
+        r_start[n_ranges] = p_am->displ[j][attr];
+        r_size[n_ranges] =   p_am->count[j][attr]
+                           * cs_datatype_size[p_am->datatype[attr]];
+        n_ranges++;
       }
     }
-
   }
 
-  /* Count type groups */
+  /* Map source terms */
+
+  if (p_am->source_term_displ != NULL) {
+    for (int attr = 0; attr < CS_LAGR_N_ATTRIBUTES; attr++) {
+      if (p_am->source_term_displ[attr] > -1) {
+        r_start[n_ranges] = p_am->source_term_displ[attr];
+        r_size[n_ranges] = p_am->size[attr];
+        n_ranges++;
+      }
+    }
+  }
 
-  count = 0;
+  /* Order ranges by start (insertion sort, as ranges are mostly ordered) */
 
-  i = 0;
-  while (i < tot_extents) {
-    size_t j;
-    for (j = i; j < tot_extents; j++) {
-      if (cs_type[j] != cs_type[i])
-        break;
+  for (int i = 1; i < n_ranges; i++) {
+    size_t start = r_start[i], size = r_size[i];
+    int j = i - 1;
+    while (j >= 0 && r_start[j] > start) {
+      r_start[j+1] = r_start[j];
+      r_size[j+1] = r_size[j];
+      j--;
     }
-    count += 1;
-    i = j;
+    r_start[j+1] = start;
+    r_size[j+1] = size;
   }
 
-  /* Assign types */
+  /* Merge contiguous or overlapping ranges */
 
-  BFT_MALLOC(blocklengths, count, int);
-  BFT_MALLOC(types, count, MPI_Datatype);
-  BFT_MALLOC(displacements, count, MPI_Aint);
+  BFT_MALLOC(lag_halo->pack_range, n_ranges*2, size_t);
 
-  count = 0;
+  size_t *r = lag_halo->pack_range;
+  int n_merged = 0;
 
-  i = 0;
-  while (i < tot_extents) {
-    size_t j;
-    types[count] = cs_datatype_to_mpi[cs_type[i]];
-    displacements[count] = i;
-    for (j = i; j < tot_extents; j++) {
-      if (cs_type[j] != cs_type[i])
-        break;
+  for (int i = 0; i < n_ranges; i++) {
+    if (n_merged > 0 && r_start[i] <= r[2*n_merged-2] + r[2*n_merged-1]) {
+      size_t end = CS_MAX(r[2*n_merged-2] + r[2*n_merged-1],
+                          r_start[i] + r_size[i]);
+      r[2*n_merged-1] = end - r[2*n_merged-2];
+    }
+    else {
+      r[2*n_merged] = r_start[i];
+      r[2*n_merged+1] = r_size[i];
+      n_merged++;
     }
-    blocklengths[count] = (j-i) / cs_datatype_size[cs_type[i]];
-    count += 1;
-    i = j;
   }
 
-  /* Create new datatype */
+  BFT_FREE(r_start);
+  BFT_FREE(r_size);
 
-  MPI_Type_create_struct(count, blocklengths, displacements, types,
-                         &new_type);
+  BFT_REALLOC(lag_halo->pack_range, n_merged*2, size_t);
+  lag_halo->n_pack_ranges = n_merged;
 
-  MPI_Type_commit(&new_type);
-
-  BFT_FREE(displacements);
-  BFT_FREE(types);
-  BFT_FREE(blocklengths);
-  BFT_FREE(cs_type);
+  lag_halo->packed_size = 0;
+  for (int i = 0; i < n_merged; i++)
+    lag_halo->packed_size += lag_halo->pack_range[2*i+1];
+}
 
-  MPI_Type_commit(&new_type);
+/*----------------------------------------------------------------------------
+ * Pack particle data to a contiguous buffer.
+ *
+ * parameters:
+ *   lag_halo  <-- pointer to a cs_lagr_halo_t structure
+ *   particle  <-- pointer to particle data
+ *   buf       --> pointer to packed data
+ *----------------------------------------------------------------------------*/
 
-  return new_type;
+inline static void
+_pack_particle(const cs_lagr_halo_t  *lag_halo,
+               const unsigned char   *particle,
+               unsigned char         *buf)
+{
+  for (int i = 0; i < lag_halo->n_pack_ranges; i++) {
+    const size_t *r = lag_halo->pack_range + 2*i;
+    memcpy(buf, particle + r[0], r[1]);
+    buf += r[1];
+  }
 }
 
 /*----------------------------------------------------------------------------
- * Delete all the MPI_Datatypes related to particles.
+ * Unpack particle data from a contiguous buffer.
+ *
+ * parameters:
+ *   lag_halo  <-- pointer to a cs_lagr_halo_t structure
+ *   buf       <-- pointer to packed data
+ *   particle  --> pointer to particle data
  *----------------------------------------------------------------------------*/
 
-static void
-_delete_particle_datatypes(void)
+inline static void
+_unpack_particle(const cs_lagr_halo_t  *lag_halo,
+                 const unsigned char   *buf,
+                 unsigned char         *particle)
 {
-  MPI_Type_free(&_cs_mpi_particle_type);
+  for (int i = 0; i < lag_halo->n_pack_ranges; i++) {
+    const size_t *r = lag_halo->pack_range + 2*i;
+    memcpy(particle + r[0], buf, r[1]);
+    buf += r[1];
+  }
 }
-#endif /* HAVE_MPI */
 
 /*----------------------------------------------------------------------------
  * Create a cs_lagr_halo_t structure to deal with parallelism and
  * periodicity
  *
  * parameters:
- *   extents  <-- extents for particles of set
+ *   p_am  <-- particle attributes map
  *
  * returns:
  *   a new allocated cs_lagr_halo_t structure.
  *----------------------------------------------------------------------------*/
 
 static cs_lagr_halo_t *
-_create_lagr_halo(size_t  extents)
+_create_lagr_halo(const cs_lagr_attribute_map_t  *p_am)
 {
   cs_lnum_t  i, rank, tr_id, shift, start, end, n;
 
@@ -482,9 +515,10 @@ _create_lagr_halo(size_t  extents)
   assert(n_halo_cells == halo->index[2*halo->n_c_domains]);
   assert(n_halo_cells == mesh->n_ghost_cells);
 
-  lagr_halo->extents = extents;
   lagr_halo->n_cells = n_halo_cells;
 
+  _define_pack_ranges(p_am, lagr_halo);
+
   /* Allocate buffers to enable the exchange between communicating ranks */
 
   BFT_MALLOC(lagr_halo->send_shift, halo->n_c_domains, cs_lnum_t);
@@ -493,10 +527,17 @@ _create_lagr_halo(size_t  extents)
   BFT_MALLOC(lagr_halo->recv_count, halo->n_c_domains, cs_lnum_t);
 
   lagr_halo->send_buf_size = CS_LAGR_MIN_COMM_BUF_SIZE;
+  lagr_halo->recv_buf_size = CS_LAGR_MIN_COMM_BUF_SIZE;
 
   BFT_MALLOC(lagr_halo->send_buf,
-             lagr_halo->send_buf_size * extents,
+             lagr_halo->send_buf_size * lagr_halo->packed_size,
              unsigned char);
+  BFT_MALLOC(lagr_halo->recv_buf,
+             lagr_halo->recv_buf_size * lagr_halo->packed_size,
+             unsigned char);
+
+  lagr_halo->continue_flag[0] = 0;
+  lagr_halo->continue_flag[1] = 0;
 
 #if defined(HAVE_MPI)
   if (cs_glob_n_ranks > 1) {
@@ -506,6 +547,38 @@ _create_lagr_halo(size_t  extents)
     BFT_MALLOC(lagr_halo->request, request_size, MPI_Request);
     BFT_MALLOC(lagr_halo->status,  request_size, MPI_Status);
 
+    /* Persistent requests for exchange of counters with neighbor ranks,
+       as buffers are fixed */
+
+    const int  local_rank = cs_glob_rank_id;
+
+    BFT_MALLOC(lagr_halo->count_request, request_size, MPI_Request);
+    lagr_halo->n_count_requests = 0;
+
+    for (rank = 0; rank < halo->n_c_domains; rank++) {
+      if (halo->c_domain_rank[rank] != local_rank)
+        MPI_Recv_init(&(lagr_halo->recv_count[rank]),
+                      1,
+                      CS_MPI_INT,
+                      halo->c_domain_rank[rank],
+                      halo->c_domain_rank[rank],
+                      cs_glob_mpi_comm,
+                      &(lagr_halo->count_request
+                          [lagr_halo->n_count_requests++]));
+    }
+
+    for (rank = 0; rank < halo->n_c_domains; rank++) {
+      if (halo->c_domain_rank[rank] != local_rank)
+        MPI_Send_init(&(lagr_halo->send_count[rank]),
+                      1,
+                      CS_MPI_INT,
+                      halo->c_domain_rank[rank],
+                      local_rank,
+                      cs_glob_mpi_comm,
+                      &(lagr_halo->count_request
+                          [lagr_halo->n_count_requests++]));
+    }
+
   }
 #endif
 
@@ -605,12 +678,17 @@ _delete_lagr_halo(cs_lagr_halo_t   **halo)
 
 #if defined(HAVE_MPI)
     if (cs_glob_n_ranks > 1) {
+      for (int i = 0; i < h->n_count_requests; i++)
+        MPI_Request_free(&(h->count_request[i]));
+      BFT_FREE(h->count_request);
       BFT_FREE(h->request);
       BFT_FREE(h->status);
     }
 #endif
 
+    BFT_FREE(h->pack_range);
     BFT_FREE(h->send_buf);
+    BFT_FREE(h->recv_buf);
 
     BFT_FREE(*halo);
   }
@@ -618,44 +696,71 @@ _delete_lagr_halo(cs_lagr_halo_t   **halo)
 }
 
 /*----------------------------------------------------------------------------
- * Resize a halo's buffers.
+ * Resize a packed particle exchange buffer.
  *
  * parameters:
- *   lag_halo         <->  pointer to a cs_lagr_halo_t structure
- *   n_send_particles <-- number of particles to send
+ *   packed_size  <-- size of a packed particle
+ *   n_particles  <-- number of particles to exchange
+ *   buf_size     <-> current buffer size (in particles)
+ *   buf          <-> buffer
  *----------------------------------------------------------------------------*/
 
 static void
-_resize_lagr_halo(cs_lagr_halo_t  *lag_halo,
-                  cs_lnum_t        n_send_particles)
+_resize_lagr_halo_buffer(size_t           packed_size,
+                         cs_lnum_t        n_particles,
+                         size_t          *buf_size,
+                         unsigned char  **buf)
 {
-  cs_lnum_t n_halo = lag_halo->send_buf_size;
-
-  size_t tot_extents = lag_halo->extents;
+  cs_lnum_t n_halo = *buf_size;
 
   /* If increase is required */
 
-  if (n_halo < n_send_particles) {
+  if (n_halo < n_particles) {
     if (n_halo < CS_LAGR_MIN_COMM_BUF_SIZE)
       n_halo = CS_LAGR_MIN_COMM_BUF_SIZE;
-    while (n_halo < n_send_particles)
+    while (n_halo < n_particles)
       n_halo *= 2;
-    lag_halo->send_buf_size = n_halo;
-    BFT_REALLOC(lag_halo->send_buf, n_halo*tot_extents, unsigned char);
+    *buf_size = n_halo;
+    BFT_REALLOC(*buf, n_halo*packed_size, unsigned char);
   }
 
   /* If decrease is allowed, do it progressively, and with a wide
      margin, so as to avoid re-increasing later if possible */
 
-  else if (n_halo > n_send_particles*16) {
+  else if (n_halo > n_particles*16) {
     n_halo /= 8;
-    lag_halo->send_buf_size = n_halo;
-    BFT_REALLOC(lag_halo->send_buf, n_halo*tot_extents, unsigned char);
+    *buf_size = n_halo;
+    BFT_REALLOC(*buf, n_halo*packed_size, unsigned char);
   }
 
   /* Otherwise, keep current size */
 }
 
+/*----------------------------------------------------------------------------
+ * Resize a halo's buffers.
+ *
+ * parameters:
+ *   lag_halo         <->  pointer to a cs_lagr_halo_t structure
+ *   n_send_particles <-- number of particles to send
+ *   n_recv_particles <-- number of particles to receive
+ *----------------------------------------------------------------------------*/
+
+static void
+_resize_lagr_halo(cs_lagr_halo_t  *lag_halo,
+                  cs_lnum_t        n_send_particles,
+                  cs_lnum_t        n_recv_particles)
+{
+  _resize_lagr_halo_buffer(lag_halo->packed_size,
+                           n_send_particles,
+                           &(lag_halo->send_buf_size),
+                           &(lag_halo->send_buf));
+
+  _resize_lagr_halo_buffer(lag_halo->packed_size,
+                           n_recv_particles,
+                           &(lag_halo->recv_buf_size),
+                           &(lag_halo->recv_buf));
+}
+
 /*----------------------------------------------------------------------------
  * Define a cell -> face connectivity. Index begins with 0.
  *
@@ -736,20 +841,126 @@ _define_cell_face_connect(cs_lagr_track_builder_t   *builder)
   BFT_FREE(counter);
 }
 
+/*----------------------------------------------------------------------------
+ * Compute face geometry used for trajectory/face intersection tests
+ * for a given face set.
+ *
+ * parameters:
+ *   n_faces       <-- number of faces
+ *   face_vtx_idx  <-- face -> vertices index
+ *   face_vtx_lst  <-- face -> vertices connectivity
+ *   face_cog      <-- face centers
+ *   vtx_coord     <-- vertex coordinates
+ *   face_r2       --> squared radius of face bounding spheres
+ *   tri_normal    --> sub-triangle normals
+ *----------------------------------------------------------------------------*/
+
+static void
+_compute_face_geometry(cs_lnum_t            n_faces,
+                       const cs_lnum_t      face_vtx_idx[],
+                       const cs_lnum_t      face_vtx_lst[],
+                       const cs_real_t      face_cog[][3],
+                       const cs_real_t      vtx_coord[][3],
+                       cs_real_t            face_r2[],
+                       cs_real_t            tri_normal[][3])
+{
+  /* Relative enlargement of bounding spheres, so that rejection tests
+     are not sensitive to truncation errors */
+
+  const cs_real_t r_factor = (1. + 1.e-6) * (1. + 1.e-6);
+
+# pragma omp parallel for if(n_faces > CS_THR_MIN)
+  for (cs_lnum_t f_id = 0; f_id < n_faces; f_id++) {
+
+    const cs_lnum_t s_id = face_vtx_idx[f_id];
+    const cs_lnum_t n_vertices = face_vtx_idx[f_id+1] - s_id;
+    const cs_lnum_t *vertex_ids = face_vtx_lst + s_id;
+    const cs_real_t *cog = face_cog[f_id];
+
+    cs_real_t r2 = 0;
+
+    for (cs_lnum_t i = 0; i < n_vertices; i++) {
+
+      const cs_real_t *vtx_0 = vtx_coord[vertex_ids[i]];
+      const cs_real_t *vtx_1 = vtx_coord[vertex_ids[(i+1)%n_vertices]];
+
+      cs_real_3_t e0, e1;
+      for (int j = 0; j < 3; j++) {
+        e0[j] = vtx_0[j] - cog[j];
+        e1[j] = vtx_1[j] - cog[j];
+      }
+
+      /* Same formula as in the intersection test (e1^e0) */
+
+      tri_normal[s_id + i][0] = e1[1]*e0[2] - e1[2]*e0[1];
+      tri_normal[s_id + i][1] = e1[2]*e0[0] - e1[0]*e0[2];
+      tri_normal[s_id + i][2] = e1[0]*e0[1] - e1[1]*e0[0];
+
+      r2 = CS_MAX(r2, cs_math_3_square_norm(e0));
+
+    }
+
+    face_r2[f_id] = r2 * r_factor;
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Define (or update) face geometry used for trajectory/face intersection
+ * tests.
+ *
+ * parameters:
+ *   builder   <->  pointer to a cs_lagr_track_builder_t structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_define_face_geometry(cs_lagr_track_builder_t   *builder)
+{
+  const cs_mesh_t  *mesh = cs_glob_mesh;
+  const cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
+
+  const cs_real_3_t *vtx_coord = (const cs_real_3_t *)(mesh->vtx_coord);
+
+  if (builder->i_face_r2 == NULL) {
+    BFT_MALLOC(builder->i_face_r2, mesh->n_i_faces, cs_real_t);
+    BFT_MALLOC(builder->b_face_r2, mesh->n_b_faces, cs_real_t);
+    BFT_MALLOC(builder->i_face_tri_normal,
+               mesh->i_face_vtx_idx[mesh->n_i_faces], cs_real_3_t);
+    BFT_MALLOC(builder->b_face_tri_normal,
+               mesh->b_face_vtx_idx[mesh->n_b_faces], cs_real_3_t);
+  }
+
+  _compute_face_geometry(mesh->n_i_faces,
+                         mesh->i_face_vtx_idx,
+                         mesh->i_face_vtx_lst,
+                         (const cs_real_3_t *)(fvq->i_face_cog),
+                         vtx_coord,
+                         builder->i_face_r2,
+                         builder->i_face_tri_normal);
+
+  _compute_face_geometry(mesh->n_b_faces,
+                         mesh->b_face_vtx_idx,
+                         mesh->b_face_vtx_lst,
+                         (const cs_real_3_t *)(fvq->b_face_cog),
+                         vtx_coord,
+                         builder->b_face_r2,
+                         builder->b_face_tri_normal);
+}
+
 /*----------------------------------------------------------------------------
  * Initialize a cs_lagr_track_builder_t structure.
  *
  * parameters:
  *   n_particles_max <-- local max number of particles
- *   extents         <-- extents for particles of set
+ *   p_am            <-- particle attributes map
  *
  * returns:
  *   a new defined cs_lagr_track_builder_t structure
  *----------------------------------------------------------------------------*/
 
 static cs_lagr_track_builder_t *
-_init_track_builder(cs_lnum_t  n_particles_max,
-                    size_t     extents)
+_init_track_builder(cs_lnum_t                       n_particles_max,
+                    const cs_lagr_attribute_map_t  *p_am)
 {
   cs_mesh_t  *mesh = cs_glob_mesh;
 
@@ -764,11 +975,20 @@ _init_track_builder(cs_lnum_t  n_particles_max,
 
   _define_cell_face_connect(builder);
 
+  /* Precompute face geometry for intersection tests */
+
+  builder->i_face_r2 = NULL;
+  builder->b_face_r2 = NULL;
+  builder->i_face_tri_normal = NULL;
+  builder->b_face_tri_normal = NULL;
+
+  _define_face_geometry(builder);
+
   /* Define a cs_lagr_halo_t structure to deal with parallelism and
      periodicity */
 
   if (cs_glob_mesh->n_init_perio > 0 || cs_glob_n_ranks > 1)
-    builder->halo = _create_lagr_halo(extents);
+    builder->halo = _create_lagr_halo(p_am);
   else
     builder->halo = NULL;
 
@@ -814,6 +1034,11 @@ _destroy_track_builder(cs_lagr_track_builder_t  *builder)
   BFT_FREE(builder->cell_face_idx);
   BFT_FREE(builder->cell_face_lst);
 
+  BFT_FREE(builder->i_face_r2);
+  BFT_FREE(builder->b_face_r2);
+  BFT_FREE(builder->i_face_tri_normal);
+  BFT_FREE(builder->b_face_tri_normal);
+
   /* Destroy the cs_lagr_halo_t structure */
 
   _delete_lagr_halo(&(builder->halo));
@@ -2017,6 +2242,8 @@ _local_propagation(cs_lagr_particle_set_t         *particles,
       cs_lnum_t face_id, vtx_start, vtx_end, n_vertices;
       const cs_lnum_t *face_connect;
       const cs_real_t *face_cog;
+      const cs_real_3_t *tri_normal;
+      cs_real_t face_r2;
 
       /* Outward normal: always well oriented for external faces, depend on the
        * connectivity for internal faces */
@@ -2037,6 +2264,8 @@ _local_propagation(cs_lagr_particle_set_t         *particles,
 
         face_connect = mesh->i_face_vtx_lst + vtx_start;
         face_cog = i_face_cog[face_id];
+        tri_normal = builder->i_face_tri_normal + vtx_start;
+        face_r2 = builder->i_face_r2[face_id];
 
       }
       else {
@@ -2052,7 +2281,25 @@ _local_propagation(cs_lagr_particle_set_t         *particles,
 
         face_connect = mesh->b_face_vtx_lst + vtx_start;
         face_cog = b_face_cog[face_id];
+        tri_normal = builder->b_face_tri_normal + vtx_start;
+        face_r2 = builder->b_face_r2[face_id];
+
+      }
 
+      /* Quick rejection: if the (OD) line does not cross the face's
+         bounding sphere, it crosses none of its sub-triangles */
+
+      {
+        const cs_real_t d[3] = {next_location[0] - prev_location[0],
+                                next_location[1] - prev_location[1],
+                                next_location[2] - prev_location[2]};
+        const cs_real_t vgo[3] = {prev_location[0] - face_cog[0],
+                                  prev_location[1] - face_cog[1],
+                                  prev_location[2] - face_cog[2]};
+        cs_real_3_t c;
+        cs_math_3_cross_product(vgo, d, c);
+        if (cs_math_3_square_norm(c) > face_r2 * cs_math_3_square_norm(d))
+          continue;
       }
 
       /*
@@ -2062,15 +2309,17 @@ _local_propagation(cs_lagr_particle_set_t         *particles,
 
       int n_crossings[2] = {0, 0};
 
-      double t = cs_geom_segment_intersect_face(reorient_face,
-                                                n_vertices,
-                                                face_connect,
-                                                vtx_coord,
-                                                face_cog,
-                                                prev_location,
-                                                next_location,
-                                                n_crossings,
-                                                face_norm);
+      double t
+        = cs_geom_segment_intersect_face_with_normals(reorient_face,
+                                                      n_vertices,
+                                                      face_connect,
+                                                      vtx_coord,
+                                                      face_cog,
+                                                      tri_normal,
+                                                      prev_location,
+                                                      next_location,
+                                                      n_crossings,
+                                                      face_norm);
 
       n_in += n_crossings[0];
       n_out += n_crossings[1];
@@ -2270,6 +2519,8 @@ _local_propagation(cs_lagr_particle_set_t         *particles,
 /*----------------------------------------------------------------------------
  * Exchange counters on the number of particles to send and to receive
  *
+ * Persistent requests are used, as counter buffers are fixed.
+ *
  * parameters:
  *  halo        <--  pointer to a cs_halo_t structure
  *  lag_halo    <--  pointer to a cs_lagr_halo_t structure
@@ -2284,54 +2535,19 @@ _exchange_counter(const cs_halo_t  *halo,
 #if defined(HAVE_MPI)
   if (cs_glob_n_ranks > 1) {
 
-    int  rank;
-    int  request_count = 0;
     const int  local_rank = cs_glob_rank_id;
 
-    /* Receive data from distant ranks */
-
-    for (rank = 0; rank < halo->n_c_domains; rank++) {
-
-      if (halo->c_domain_rank[rank] != local_rank)
-        MPI_Irecv(&(lag_halo->recv_count[rank]),
-                  1,
-                  CS_MPI_INT,
-                  halo->c_domain_rank[rank],
-                  halo->c_domain_rank[rank],
-                  cs_glob_mpi_comm,
-                  &(lag_halo->request[request_count++]));
-      else
+    for (int rank = 0; rank < halo->n_c_domains; rank++) {
+      if (halo->c_domain_rank[rank] == local_rank)
         local_rank_id = rank;
-
-    }
-
-    /* We wait for posting all receives
-       (often recommended in the past, apparently not anymore) */
-
-#if 0
-    MPI_Barrier(cs_glob_mpi_comm)
-#endif
-
-    /* Send data to distant ranks */
-
-    for (rank = 0; rank < halo->n_c_domains; rank++) {
-
-      /* If this is not the local rank */
-
-      if (halo->c_domain_rank[rank] != local_rank)
-        MPI_Isend(&(lag_halo->send_count[rank]),
-                  1,
-                  CS_MPI_INT,
-                  halo->c_domain_rank[rank],
-                  local_rank,
-                  cs_glob_mpi_comm,
-                  &(lag_halo->request[request_count++]));
-
     }
 
-    /* Wait for all exchanges */
+    /* Start and wait for all exchanges */
 
-    MPI_Waitall(request_count, lag_halo->request, lag_halo->status);
+    MPI_Startall(lag_halo->n_count_requests, lag_halo->count_request);
+    MPI_Waitall(lag_halo->n_count_requests,
+                lag_halo->count_request,
+                lag_halo->status);
 
   }
 #endif /* defined(HAVE_MPI) */
@@ -2347,6 +2563,9 @@ _exchange_counter(const cs_halo_t  *halo,
 /*----------------------------------------------------------------------------
  * Exchange particles
  *
+ * Particles are exchanged as packed bytes, then unpacked to the particle
+ * set.
+ *
  * parameters:
  *  halo      <-- pointer to a cs_halo_t structure
  *  lag_halo  <-> pointer to a cs_lagr_halo_t structure
@@ -2366,7 +2585,8 @@ _exchange_particles(const cs_halo_t         *halo,
 {
   int local_rank_id = (cs_glob_n_ranks == 1) ? 0 : -1;
 
-  const size_t tot_extents = lag_halo->extents;
+  const size_t extents = particles->p_am->extents;
+  const size_t packed_size = lag_halo->packed_size;
 
   cs_lnum_t  n_recv_particles = 0;
 
@@ -2382,17 +2602,14 @@ _exchange_particles(const cs_halo_t         *halo,
 
     for (rank = 0; rank < halo->n_c_domains; rank++) {
 
-      cs_lnum_t shift =   particles->n_particles
-                        + lag_halo->recv_shift[rank];
-
       if (lag_halo->recv_count[rank] > 0) {
 
         if (halo->c_domain_rank[rank] != local_rank) {
-          void  *recv_buf = particles->p_buffer + tot_extents*shift;
-          n_recv_particles += lag_halo->recv_count[rank];
+          void  *recv_buf =   lag_halo->recv_buf
+                            + packed_size*lag_halo->recv_shift[rank];
           MPI_Irecv(recv_buf,
-                    lag_halo->recv_count[rank],
-                    _cs_mpi_particle_type,
+                    lag_halo->recv_count[rank]*packed_size,
+                    MPI_BYTE,
                     halo->c_domain_rank[rank],
                     halo->c_domain_rank[rank],
                     cs_glob_mpi_comm,
@@ -2421,10 +2638,10 @@ _exchange_particles(const cs_halo_t         *halo,
       if (   halo->c_domain_rank[rank] != local_rank
           && lag_halo->send_count[rank] > 0) {
         cs_lnum_t shift = lag_halo->send_shift[rank];
-        void  *send_buf = lag_halo->send_buf + tot_extents*shift;
+        void  *send_buf = lag_halo->send_buf + packed_size*shift;
         MPI_Isend(send_buf,
-                  lag_halo->send_count[rank],
-                  _cs_mpi_particle_type,
+                  lag_halo->send_count[rank]*packed_size,
+                  MPI_BYTE,
                   halo->c_domain_rank[rank],
                   local_rank,
                   cs_glob_mpi_comm,
@@ -2446,31 +2663,35 @@ _exchange_particles(const cs_halo_t         *halo,
   if (halo->n_transforms > 0) {
     if (local_rank_id > -1) {
 
-      cs_lnum_t  recv_shift =   particles->n_particles
-                              + lag_halo->recv_shift[local_rank_id];
+      cs_lnum_t  recv_shift = lag_halo->recv_shift[local_rank_id];
       cs_lnum_t  send_shift = lag_halo->send_shift[local_rank_id];
 
       assert(   lag_halo->recv_count[local_rank_id]
              == lag_halo->send_count[local_rank_id]);
 
-      n_recv_particles += lag_halo->send_count[local_rank_id];
-
-      for (cs_lnum_t i = 0; i < lag_halo->send_count[local_rank_id]; i++) {
-        memcpy(particles->p_buffer + tot_extents*(recv_shift + i),
-               lag_halo->send_buf + tot_extents*(send_shift + i),
-               tot_extents);
-      }
+      memcpy(lag_halo->recv_buf + packed_size*recv_shift,
+             lag_halo->send_buf + packed_size*send_shift,
+             packed_size*lag_halo->send_count[local_rank_id]);
     }
   }
 
-  /* Update particle count and weight */
+  for (int rank = 0; rank < halo->n_c_domains; rank++)
+    n_recv_particles += lag_halo->recv_count[rank];
+
+  /* Unpack particles and update particle count and weight */
 
   cs_real_t tot_weight = 0.;
 
+# pragma omp parallel for reduction(+:tot_weight) \
+                          if (n_recv_particles > CS_THR_MIN)
   for (cs_lnum_t i = 0; i < n_recv_particles; i++) {
 
     cs_lnum_t j = particles->n_particles + i;
 
+    _unpack_particle(lag_halo,
+                     lag_halo->recv_buf + packed_size*i,
+                     particles->p_buffer + extents*j);
+
     cs_real_t cur_part_stat_weight
       = cs_lagr_particles_get_real(particles, j, CS_LAGR_STAT_WEIGHT);
 
@@ -2487,6 +2708,10 @@ _exchange_particles(const cs_halo_t         *halo,
 /*----------------------------------------------------------------------------
  * Determine particle halo sizes
  *
+ * The global reduction determining whether particles change domain
+ * on any rank is also started here, so as to overlap it with the
+ * particle exchange.
+ *
  * parameters:
  *   mesh      <-- pointer to associated mesh
  *   lag_halo  <-> pointer to particle halo structure to update
@@ -2522,19 +2747,34 @@ _lagr_halo_count(const cs_mesh_t               *mesh,
 
       assert(ghost_id >= 0);
       lag_halo->send_count[lag_halo->rank[ghost_id]] += 1;
+      n_send_particles += 1;
 
     }
 
   } /* End of loop on particles */
 
+  /* Start global determination of continuation */
+
+  lag_halo->continue_flag[0] = (n_send_particles > 0) ? 1 : 0;
+  lag_halo->continue_flag[1] = lag_halo->continue_flag[0];
+
+#if defined(HAVE_MPI) && (MPI_VERSION >= 3)
+  if (cs_glob_n_ranks > 1)
+    MPI_Iallreduce(&(lag_halo->continue_flag[0]),
+                   &(lag_halo->continue_flag[1]),
+                   1,
+                   MPI_INT,
+                   MPI_MAX,
+                   cs_glob_mpi_comm,
+                   &(lag_halo->continue_request));
+#endif
+
   /* Exchange counters */
 
   _exchange_counter(halo, lag_halo);
 
-  for (i = 0; i < halo->n_c_domains; i++) {
+  for (i = 0; i < halo->n_c_domains; i++)
     n_recv_particles += lag_halo->recv_count[i];
-    n_send_particles += lag_halo->send_count[i];
-  }
 
   lag_halo->send_shift[0] = 0;
   lag_halo->recv_shift[0] = 0;
@@ -2552,7 +2792,39 @@ _lagr_halo_count(const cs_mesh_t               *mesh,
   /* Resize particle set and/or halo only if needed */
 
   cs_lagr_particle_set_resize(particles->n_particles + n_recv_particles);
-  _resize_lagr_halo(lag_halo, n_send_particles);
+  _resize_lagr_halo(lag_halo, n_send_particles, n_recv_particles);
+}
+
+/*----------------------------------------------------------------------------
+ * Complete global determination of whether particles change domain
+ * (started in _lagr_halo_count).
+ *
+ * parameters:
+ *   lag_halo  <-> pointer to particle halo structure
+ *
+ * returns:
+ *   1 if displacement needs to continue, 0 if finished
+ *----------------------------------------------------------------------------*/
+
+static int
+_lagr_halo_continue(cs_lagr_halo_t  *lag_halo)
+{
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+#if (MPI_VERSION >= 3)
+    MPI_Wait(&(lag_halo->continue_request), MPI_STATUS_IGNORE);
+#else
+    MPI_Allreduce(&(lag_halo->continue_flag[0]),
+                  &(lag_halo->continue_flag[1]),
+                  1,
+                  MPI_INT,
+                  MPI_MAX,
+                  cs_glob_mpi_comm);
+#endif
+  }
+#endif
+
+  return lag_halo->continue_flag[1];
 }
 
 /*----------------------------------------------------------------------------
@@ -2753,9 +3025,9 @@ _sync_particle_set(cs_lagr_particle_set_t  *particles)
 
       } /* End of periodicity treatment */
 
-      memcpy(lag_halo->send_buf + extents*shift,
-             particles->p_buffer + extents*i,
-             extents);
+      _pack_particle(lag_halo,
+                     particles->p_buffer + extents*i,
+                     lag_halo->send_buf + lag_halo->packed_size*shift);
 
       lag_halo->send_count[rank] += 1;
 
@@ -2811,10 +3083,12 @@ _sync_particle_set(cs_lagr_particle_set_t  *particles)
 
   /* Exchange particles, then update set */
 
-  if (halo != NULL)
+  if (halo != NULL) {
     _exchange_particles(halo, lag_halo, particles);
-
-  cs_parall_max(1, CS_INT_TYPE, &continue_displacement);
+    continue_displacement = _lagr_halo_continue(lag_halo);
+  }
+  else
+    cs_parall_max(1, CS_INT_TYPE, &continue_displacement);
 
   return continue_displacement;
 }
@@ -2836,7 +3110,13 @@ _initialize_displacement(cs_lagr_particle_set_t  *particles)
   if (_particle_track_builder == NULL)
     _particle_track_builder
       = _init_track_builder(particles->n_particles_max,
-                            particles->p_am->extents);
+                            particles->p_am);
+
+  /* Update precomputed face geometry if the mesh moves */
+
+  else if (   cs_glob_ale != 0
+           || cs_turbomachinery_get_model() == CS_TURBOMACHINERY_TRANSIENT)
+    _define_face_geometry(_particle_track_builder);
 
   assert(am->lb >= sizeof(cs_lagr_tracking_info_t));
 
@@ -3057,14 +3337,6 @@ cs_lagr_tracking_initialize(void)
 
   for (cs_lnum_t i = 0; i < p_set->n_particles_max; i++)
     _tracking_info(p_set, i)->state = CS_LAGR_PART_TO_SYNC;
-
-  /* Create all useful MPI_Datatypes */
-
-#if defined(HAVE_MPI)
-  if (cs_glob_n_ranks > 1) {
-    _cs_mpi_particle_type = _define_particle_datatype(p_set->p_am);
-  }
-#endif
 }
 
 /*----------------------------------------------------------------------------*/
@@ -3374,12 +3646,6 @@ cs_lagr_tracking_finalize(void)
 
   if (cs_glob_lagr_model->roughness)
     cs_lagr_roughness_finalize();
-
-  /* Delete MPI_Datatypes */
-
-#if defined(HAVE_MPI)
-  if (cs_glob_n_ranks > 1)  _delete_particle_datatypes();
-#endif
 }
 
 /*----------------------------------------------------------------------------*/
@@ -3479,7 +3745,7 @@ cs_lagr_get_cell_face_connectivity(cs_lnum_t  **cell_face_idx,
     if (particles != NULL) {
       _particle_track_builder
         =_init_track_builder(particles->n_particles_max,
-                             particles->p_am->extents);
+                             particles->p_am);
       builder = _particle_track_builder;
       *cell_face_idx = builder->cell_face_idx;
       *cell_face_lst = builder->cell_face_lst;
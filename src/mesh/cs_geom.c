@@ -475,6 +475,222 @@ cs_geom_segment_intersect_face(int               orient,
   return retval;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Test if a line segment intersects a face, using precomputed
+ *        sub-triangle normals.
+ *
+ * This function is equivalent to \ref cs_geom_segment_intersect_face,
+ * with the same robustness properties (sign tests on edges shared by
+ * neighboring faces give consistent results), but the normals of the
+ * sub-triangles defined by the face center and successive vertices
+ * (e1^e0, with e0 and e1 the vectors from the face center to vertices
+ * i and i+1) are provided by the caller, and the tests which do not
+ * depend on each other are grouped in a first loop on vertices, so
+ * as to allow vectorization.
+ *
+ * \param[in]      orient         if -1 or 1, multiplies face_normal to check
+ *                                for segment
+ * \param[in]      n_vertices     number of face vertices
+ * \param[in]      vertex_ids     ids of face vertices
+ * \param[in]      vtx_coord      vertex coordinates
+ * \param[in]      face_cog       coordinates of face center
+ * \param[in]      tri_normal     face sub-triangle normals (not normalized)
+ * \param[in]      sx0            segment start coordinates
+ * \param[in]      sx1            segment end coordinates
+ * \param[out]     n_inout        number sub_face crossings
+ *                                 [0: in; 1: out]
+ * \param[in, out] face_norm      local face unit normal of the crossed sub
+ *                                 triangle (if entering with something
+ *                                 different from NULL)
+ *
+ * \return
+ *   2 if the segment does not go through the face's plane, or minimum
+ *   relative distance (in terms of segment length)
+ *   of intersection point to face.
+ */
+/*----------------------------------------------------------------------------*/
+
+double
+cs_geom_segment_intersect_face_with_normals(int               orient,
+                                            cs_lnum_t         n_vertices,
+                                            const cs_lnum_t   vertex_ids[],
+                                            const cs_real_t   vtx_coord[][3],
+                                            const cs_real_t   face_cog[3],
+                                            const cs_real_t   tri_normal[][3],
+                                            const cs_real_t   sx0[3],
+                                            const cs_real_t   sx1[3],
+                                            int               n_inout[2],
+                                            cs_real_t        *face_norm)
+{
+  const double epsilon = 1.e-15;
+
+  double retval = 2.;
+
+  const cs_real_t disp[3] = {sx1[0] - sx0[0],
+                             sx1[1] - sx0[1],
+                             sx1[2] - sx0[2]};
+  const cs_real_t vgo[3] = {sx0[0] - face_cog[0],
+                            sx0[1] - face_cog[1],
+                            sx0[2] - face_cog[2]};
+
+  int n_intersects = 0;
+
+  /* Local buffers (most faces have few vertices) */
+
+  int _p_sign[16];
+  double _od_p[16];
+
+  int *p_sign = _p_sign;
+  double *od_p = _od_p;
+
+  if (n_vertices > 16) {
+    BFT_MALLOC(p_sign, n_vertices, int);
+    BFT_MALLOC(od_p, n_vertices, double);
+  }
+
+  /* Side of the (OD) line relative to edges from face center to vertices,
+     and projection of the displacement on sub-triangle normals
+     (see cs_geom_segment_intersect_face) */
+
+  for (cs_lnum_t i = 0; i < n_vertices; i++) {
+
+    const cs_real_t *vtx = vtx_coord[vertex_ids[i]];
+
+    const cs_real_t e[3] = {vtx[0] - face_cog[0],
+                            vtx[1] - face_cog[1],
+                            vtx[2] - face_cog[2]};
+
+    const cs_real_t p[3] = {e[1]*vgo[2] - e[2]*vgo[1],
+                            e[2]*vgo[0] - e[0]*vgo[2],
+                            e[0]*vgo[1] - e[1]*vgo[0]};
+
+    p_sign[i] = (cs_math_3_dot_product(disp, p) > 0 ? 1 : -1);
+    od_p[i] = cs_math_3_dot_product(disp, tri_normal[i]);
+
+  }
+
+  /* Loop on sub-triangles */
+
+  for (cs_lnum_t i = 0; i < n_vertices; i++) {
+
+    const cs_lnum_t i1 = (i+1)%n_vertices;
+
+    const int sign_od_p = (od_p[i] > 0 ? 1 : -1);
+
+    const int u_sign = p_sign[i1] * sign_od_p;
+    const int v_sign = - p_sign[i] * sign_od_p;
+
+    if (u_sign < 0 || v_sign < 0)
+      continue;
+
+    /* 3rd edge, with vertices sorted so that it gives the same
+       answer for the same edge for another face */
+
+    cs_lnum_t vtx_id_0 = vertex_ids[i];
+    cs_lnum_t vtx_id_1 = vertex_ids[i1];
+
+    int reorient_edge = (vtx_id_0 < vtx_id_1 ? 1 : -1);
+
+    int w_sign;
+    if (reorient_edge == 1)
+      w_sign = _test_edge(sx0, sx1, vtx_coord[vtx_id_0], vtx_coord[vtx_id_1]);
+    else
+      w_sign = - _test_edge(sx0, sx1, vtx_coord[vtx_id_1], vtx_coord[vtx_id_0]);
+    w_sign *= sign_od_p;
+
+    if (w_sign > 0)
+      continue;
+
+    /* Line (OD) intersects the triangle */
+
+    const cs_real_t *pvec = tri_normal[i];
+
+    double og_p = - cs_math_3_dot_product(vgo, pvec);
+
+    int sign_og_p = (og_p > 0 ? 1 : -1);
+
+    bool in_segment = false;
+
+    if (sign_od_p == sign_og_p) {
+      if (orient == 0) {
+        if (sign_od_p == 1)
+          n_inout[0]++;
+        else
+          n_inout[1]++;
+        in_segment = (fabs(og_p) < fabs(od_p[i]));
+      }
+      else if (orient != sign_od_p) {
+        n_inout[1]++;
+        in_segment = (fabs(og_p) < fabs(od_p[i]));
+      }
+      else {
+        n_inout[0]++;
+        if (fabs(og_p) < fabs(od_p[i]))
+          n_intersects--;
+      }
+    }
+    else {
+      if (orient == 0) {
+        cs_real_t t = -1;
+        const cs_real_t *vtx = vtx_coord[vtx_id_0];
+        const cs_real_t e0[3] = {vtx[0] - face_cog[0],
+                                 vtx[1] - face_cog[1],
+                                 vtx[2] - face_cog[2]};
+        const double det = cs_math_3_norm(e0)*cs_math_3_norm(pvec);
+        if (fabs(od_p[i]) > epsilon * fabs(det))
+          t = og_p / od_p[i];
+        if (t < retval)
+          retval = t;
+        if (sign_od_p == -1)
+          n_inout[1]++;
+        else
+          n_inout[0]++;
+      }
+      else if (orient != sign_od_p)
+        n_inout[1]++;
+      else
+        n_inout[0]++;
+    }
+
+    /* Real intersection with 0 <= t < 1 */
+
+    if (in_segment) {
+      double t = 0.;
+      n_intersects++;
+
+      const cs_real_t *vtx = vtx_coord[vtx_id_0];
+      const cs_real_t e0[3] = {vtx[0] - face_cog[0],
+                               vtx[1] - face_cog[1],
+                               vtx[2] - face_cog[2]};
+      const double det = cs_math_3_norm(e0)*cs_math_3_norm(pvec);
+      if (fabs(od_p[i]) > epsilon * fabs(det))
+        t = og_p / od_p[i];
+
+      if (t < retval) {
+        retval = t;
+        if (face_norm != NULL)
+          cs_math_3_normalise(pvec, face_norm);
+      }
+    }
+
+  }
+
+  if (p_sign != _p_sign) {
+    BFT_FREE(p_sign);
+    BFT_FREE(od_p);
+  }
+
+  /* In case intersections were removed due to non-convex cases,
+     force retval to 2 (see cs_geom_segment_intersect_face) */
+
+  if ((n_intersects < 1) && retval < 1. && retval >= 0) {
+    retval = 2.;
+  }
+
+  return retval;
+}
+
 /*---------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -126,6 +126,54 @@ cs_geom_segment_intersect_face(int               orient,
                                int               n_crossings[2],
                                cs_real_t        *face_norm);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Test if a line segment intersects a face, using precomputed
+ *        sub-triangle normals.
+ *
+ * This function is equivalent to \ref cs_geom_segment_intersect_face,
+ * with the same robustness properties (sign tests on edges shared by
+ * neighboring faces give consistent results), but the normals of the
+ * sub-triangles defined by the face center and successive vertices
+ * (e1^e0, with e0 and e1 the vectors from the face center to vertices
+ * i and i+1) are provided by the caller, and the tests which do not
+ * depend on each other are grouped in a first loop on vertices, so
+ * as to allow vectorization.
+ *
+ * \param[in]      orient         if -1 or 1, multiplies face_normal to check
+ *                                for segment
+ * \param[in]      n_vertices     number of face vertices
+ * \param[in]      vertex_ids     ids of face vertices
+ * \param[in]      vtx_coord      vertex coordinates
+ * \param[in]      face_cog       coordinates of face center
+ * \param[in]      tri_normal     face sub-triangle normals (not normalized)
+ * \param[in]      sx0            segment start coordinates
+ * \param[in]      sx1            segment end coordinates
+ * \param[out]     n_crossings    number sub_face crossings
+ *                                 [0: in; 1: out]
+ * \param[in, out] face_norm      local face unit normal of the crossed sub
+ *                                 triangle (if entering with something
+ *                                 different from NULL)
+ *
+ * \return
+ *   2 if the segment does not go through the face's plane, or minimum
+ *   relative distance (in terms of segment length)
+ *   of intersection point to face.
+ */
+/*----------------------------------------------------------------------------*/
+
+double
+cs_geom_segment_intersect_face_with_normals(int               orient,
+                                            cs_lnum_t         n_vertices,
+                                            const cs_lnum_t   vertex_ids[],
+                                            const cs_real_t   vtx_coord[][3],
+                                            const cs_real_t   face_cog[3],
+                                            const cs_real_t   tri_normal[][3],
+                                            const cs_real_t   sx0[3],
+                                            const cs_real_t   sx1[3],
+                                            int               n_crossings[2],
+                                            cs_real_t        *face_norm);
+
 /*---------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -1420,6 +1420,49 @@ _set_advanced_param(cs_join_t   *join,
 
 }
 
+/*----------------------------------------------------------------------------
+ * Log the timing breakdown of the main joining stages to the joining log.
+ *
+ * parameters:
+ *   join   <-- pointer to a cs_join_t structure
+ *   log    <-- pointer to joining log file
+ *---------------------------------------------------------------------------*/
+
+static void
+_join_log_times(const cs_join_t  *this_join,
+                FILE             *log)
+{
+  const cs_join_stats_t  *stats = &(this_join->stats);
+
+  if (log == NULL)
+    return;
+
+  fprintf(log,
+          "\n"
+          "  Timing breakdown for joining %d (%d thread(s)):\n"
+          "    Face bounding boxes tree construction:          %10.3g\n"
+          "    Face bounding boxes neighborhood query:         %10.3g\n"
+          "    Sorting possible intersections between faces:   %10.3g\n"
+          "    Definition of local joining mesh:               %10.3g\n"
+          "    Edge intersections:                             %10.3g\n"
+          "    Creation of new vertices:                       %10.3g\n"
+          "    Merging vertices:                               %10.3g\n"
+          "    Updating structures with vertex merging:        %10.3g\n"
+          "    Split old faces and reconstruct new faces:      %10.3g\n",
+          this_join->param.num, cs_glob_n_threads,
+          stats->t_box_build.wall_nsec*1e-9,
+          stats->t_box_query.wall_nsec*1e-9,
+          stats->t_inter_sort.wall_nsec*1e-9,
+          stats->t_l_join_mesh.wall_nsec*1e-9,
+          stats->t_edge_inter.wall_nsec*1e-9,
+          stats->t_new_vtx.wall_nsec*1e-9,
+          stats->t_merge_vtx.wall_nsec*1e-9,
+          stats->t_u_merge_vtx.wall_nsec*1e-9,
+          stats->t_split_faces.wall_nsec*1e-9);
+
+  fflush(log);
+}
+
 /*----------------------------------------------------------------------------
  * Log statistics and timings for a given joining.
  *
@@ -1515,9 +1558,10 @@ _join_performance_log(const cs_join_t  *this_join)
 
   cs_log_printf
     (CS_LOG_PERFORMANCE,
-     _("  Associated times:\n"
+     _("  Associated times (%d thread(s)):\n"
        "    Face bounding boxes tree construction:          %10.3g\n"
        "    Face bounding boxes neighborhood query:         %10.3g\n"),
+     cs_glob_n_threads,
      stats->t_box_build.wall_nsec*1.e-9,
      stats->t_box_query.wall_nsec*1.e-9);
 
@@ -1901,6 +1945,7 @@ cs_join_all(bool  preprocess)
     /* Close log file if present */
 
     if (cs_glob_join_log != NULL) {
+      _join_log_times(this_join, cs_glob_join_log);
       if (fclose(cs_glob_join_log) != 0)
         bft_error(__FILE__, __LINE__, errno,
                   _("Error closing log file for joining: %d."),
@@ -391,6 +391,7 @@ _check_equiv(const cs_join_edges_t  *edges,
     cs_lnum_t  v1e2_id = edges->def[2*e2_id]-1;
     cs_lnum_t  v2e2_id = edges->def[2*e2_id+1]-1;
 
+#   pragma omp atomic
     _n_inter_tolerance_warnings++;
 
     if (verbosity > 3) {
@@ -3492,17 +3493,36 @@ cs_join_intersect_edges(cs_join_param_t         param,
   _inter_set = cs_join_inter_set_create(50);
   _vtx_eset = cs_join_eset_create(30);
 
-  /* Loop on edges */
+  /* Compute intersections for all possible pairs of edges.
+     Pairs are independent, so this loop is threaded; results are stored
+     per pair and added to the equivalence and intersection sets afterwards,
+     in the initial order, so the result does not depend on the number
+     of threads. Logging at high verbosity requires a serial loop. */
+
+  const cs_lnum_t  n_pairs = edge_edge_vis->index[edge_edge_vis->n_elts];
+
+  int  *pair_n_inter = NULL;
+  double  *pair_abs = NULL;
+
+  BFT_MALLOC(pair_n_inter, n_pairs, int);
+  BFT_MALLOC(pair_abs, 4*n_pairs, double);
 
+# pragma omp parallel for schedule(dynamic, 64) \
+  if (param.verbosity < 4 && n_pairs > CS_THR_MIN)
   for (i = 0; i < edge_edge_vis->n_elts; i++) {
 
     int  e1 = edge_edge_vis->g_elts[i]; /* This is a local number */
 
-    for (j = edge_edge_vis->index[i]; j < edge_edge_vis->index[i+1]; j++) {
+    for (cs_lnum_t l = edge_edge_vis->index[i];
+         l < edge_edge_vis->index[i+1];
+         l++) {
 
-      int  e2 = edge_edge_vis->g_list[j]; /* This is a local number */
+      int  e2 = edge_edge_vis->g_list[l]; /* This is a local number */
       int  e1_id = (e1 < e2 ? e1 - 1 : e2 - 1);
       int  e2_id = (e1 < e2 ? e2 - 1 : e1 - 1);
+      int  _n_inter = 0;
+      double  *_abs_e1 = pair_abs + 4*l;
+      double  *_abs_e2 = pair_abs + 4*l + 2;
 
       assert(e1 != e2);
 
@@ -3512,23 +3532,47 @@ cs_join_intersect_edges(cs_join_param_t         param,
         _edge_edge_3d_inter(mesh,
                             edges,
                             param.fraction,
-                            e1_id, abs_e1,
-                            e2_id, abs_e2,
+                            e1_id, _abs_e1,
+                            e2_id, _abs_e2,
                             parall_eps2,
                             param.verbosity,
                             logfile,
-                            &n_inter);
+                            &_n_inter);
 
       else if (param.icm == 2)
         _new_edge_edge_3d_inter(mesh,
                                 edges,
                                 param.fraction,
-                                e1_id, abs_e1,
-                                e2_id, abs_e2,
+                                e1_id, _abs_e1,
+                                e2_id, _abs_e2,
                                 parall_eps2,
                                 param.verbosity,
                                 logfile,
-                                &n_inter);
+                                &_n_inter);
+
+      pair_n_inter[l] = _n_inter;
+
+    } /* End of loop on entities intersecting elements */
+
+  } /* End of loop on elements in intersection list */
+
+  /* Loop on edges */
+
+  for (i = 0; i < edge_edge_vis->n_elts; i++) {
+
+    int  e1 = edge_edge_vis->g_elts[i]; /* This is a local number */
+
+    for (j = edge_edge_vis->index[i]; j < edge_edge_vis->index[i+1]; j++) {
+
+      int  e2 = edge_edge_vis->g_list[j]; /* This is a local number */
+      int  e1_id = (e1 < e2 ? e1 - 1 : e2 - 1);
+      int  e2_id = (e1 < e2 ? e2 - 1 : e1 - 1);
+
+      n_inter = pair_n_inter[j];
+      for (k = 0; k < n_inter; k++) {
+        abs_e1[k] = pair_abs[4*j + k];
+        abs_e2[k] = pair_abs[4*j + 2 + k];
+      }
 
       n_inter_detected += n_inter;
 
@@ -3592,6 +3636,9 @@ cs_join_intersect_edges(cs_join_param_t         param,
 
   } /* End of loop on elements in intersection list */
 
+  BFT_FREE(pair_n_inter);
+  BFT_FREE(pair_abs);
+
   n_real_inter = n_inter_detected - n_trivial_inter;
 
   if (n_inter_detected == 0)
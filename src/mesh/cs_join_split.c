@@ -1367,6 +1367,289 @@ _split_face(cs_lnum_t               fid,
   return NO_SPLIT_ERROR;
 }
 
+/*----------------------------------------------------------------------------
+ * Split a range of faces of the current rank's block into sub-faces.
+ *
+ * parameters:
+ *   param                <-- set of user-defined parameters
+ *   face_normal          <-- normal for each face of the mesh
+ *   w                    <-- cs_join_mesh_t structure
+ *   edges                <-- list of edges
+ *   e2f_idx              <-- "edge -> face" connect. index
+ *   e2f_lst              <-- "edge -> face" connect. list
+ *   n_faces              <-- number of faces in range
+ *   face_ids             <-- ids of faces in range
+ *   builder              <-> face_builder structure for this range
+ *   open_cycle           <-> faces with open cycle errors
+ *   edge_traversed_twice <-> faces with edges traversed twice
+ *   loop_limit           <-> faces split into too many sub-faces
+ *
+ * returns:
+ *   number of faces which could not be split
+ *---------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_split_face_range(cs_join_param_t          param,
+                  const cs_real_t          face_normal[],
+                  const cs_join_mesh_t    *w,
+                  const cs_join_edges_t   *edges,
+                  const cs_lnum_t         *e2f_idx,
+                  const cs_lnum_t         *e2f_lst,
+                  cs_lnum_t                n_faces,
+                  const cs_lnum_t          face_ids[],
+                  face_builder_t          *builder,
+                  cs_join_rset_t         **open_cycle,
+                  cs_join_rset_t         **edge_traversed_twice,
+                  cs_join_rset_t         **loop_limit)
+{
+  cs_lnum_t  j, face_s, subface_s;
+  cs_join_split_error_t  code;
+
+  cs_lnum_t  _n_problems = 0, n_face_problems = 0, n_max_face_vertices = 6;
+  cs_join_rset_t  *head_edges = NULL, *subface_edges = NULL;
+  cs_join_rset_t  *ext_edges = NULL, *int_edges = NULL;
+
+  /* Define buffers and structures to build the new faces */
+
+  head_edges = cs_join_rset_create(n_max_face_vertices);
+  subface_edges = cs_join_rset_create(n_max_face_vertices);
+  ext_edges = cs_join_rset_create(n_max_face_vertices);
+  int_edges = cs_join_rset_create(n_max_face_vertices);
+
+  for (cs_lnum_t block_id = 0; block_id < n_faces; block_id++) {
+
+    cs_lnum_t  fid = face_ids[block_id];
+
+    int  n_face_vertices = w->face_vtx_idx[fid+1] - w->face_vtx_idx[fid];
+
+    if (n_face_vertices > n_max_face_vertices) { /* Manage list size */
+
+      n_max_face_vertices = n_face_vertices;
+      cs_join_rset_resize(&head_edges, n_face_vertices);
+      cs_join_rset_resize(&subface_edges, n_face_vertices);
+      cs_join_rset_resize(&ext_edges, n_face_vertices);
+      cs_join_rset_resize(&int_edges, n_face_vertices);
+
+    }
+
+    /* Fill head_edges and ext_edges */
+
+    _define_head_and_ext_edges(fid,
+                               w, edges,
+                               head_edges, ext_edges,
+                               0); /* No permutation */
+
+    /* Store initial builder state in case of code > 0 */
+
+    face_s = builder->face_index[block_id];
+    subface_s = builder->subface_index->array[face_s];
+
+    /* Split the current face into subfaces */
+
+    code = _split_face(fid, block_id,
+                       param,
+                       face_normal,
+                       w, edges,
+                       e2f_idx, e2f_lst,
+                       builder,
+                       &head_edges, &subface_edges,
+                       &ext_edges, &int_edges);
+
+#if 0 && defined(DEBUG) && !defined(NDEBUG)
+    if (param.verbosity > 2 && code != NO_SPLIT_ERROR) {
+      fprintf(cs_glob_join_log,
+              "  Split face %d -> returned code: %d\n", fid+1, code);
+      _dump_face_builder(block_id, builder, cs_glob_join_log);
+    }
+#endif
+
+    if (code > NO_SPLIT_ERROR) { /* Manage error */
+
+      _n_problems++;
+
+      /* We change the starting edge for traversing edges to build
+         the new face. This may be enough to solve the problem when
+         the face is warped. */
+
+      while (_n_problems < n_face_vertices && code > NO_SPLIT_ERROR) {
+
+        /* Fill head_edges and ext_edges */
+
+        _define_head_and_ext_edges(fid,
+                                   w, edges,
+                                   head_edges, ext_edges,
+                                   _n_problems); /* permutation */
+
+        /* Retrieve initial builder state */
+
+        builder->face_index[block_id] = face_s;
+        builder->subface_index->array[face_s] = subface_s;
+        builder->subface_connect->n_elts = subface_s;
+
+        /* Split the current face into subfaces */
+
+        code = _split_face(fid, block_id,
+                           param,
+                           face_normal,
+                           w, edges,
+                           e2f_idx, e2f_lst,
+                           builder,
+                           &head_edges, &subface_edges,
+                           &ext_edges, &int_edges);
+
+        _n_problems++;
+
+      } /* End of while */
+
+      if (_n_problems >= n_face_vertices && code != NO_SPLIT_ERROR) {
+
+        n_face_problems++;
+
+        switch (code) {
+
+        case OPEN_CYCLE_ERROR:
+          cs_join_rset_resize(open_cycle, (*open_cycle)->n_elts);
+          (*open_cycle)->array[(*open_cycle)->n_elts] = fid + 1;
+          (*open_cycle)->n_elts += 1;
+          break;
+
+        case EDGE_TRAVERSED_TWICE_ERROR:
+          cs_join_rset_resize(edge_traversed_twice,
+                              (*edge_traversed_twice)->n_elts);
+          (*edge_traversed_twice)->array[(*edge_traversed_twice)->n_elts]
+            = fid + 1;
+          (*edge_traversed_twice)->n_elts += 1;
+          break;
+
+        case LOOP_LIMIT_ERROR:
+          cs_join_rset_resize(loop_limit, (*loop_limit)->n_elts);
+          (*loop_limit)->array[(*loop_limit)->n_elts] = fid + 1;
+          (*loop_limit)->n_elts += 1;
+          break;
+
+        case NO_SPLIT_ERROR: /* To avoid a warning */
+          assert(0);
+          break;
+
+        case MAX_SPLIT_ERROR: /* To avoid a warning */
+          assert(0);
+          break;
+
+        }
+
+        /* Keep the initial face connectivity */
+
+        builder->face_index[block_id] = face_s;
+        builder->face_index[block_id+1] = face_s + 1;
+
+        /* face -> subface connectivity index update */
+
+        cs_join_rset_resize(&(builder->subface_index), face_s+1);
+
+        builder->subface_index->n_elts = face_s + 1;
+        builder->subface_index->array[face_s] = subface_s;
+        builder->subface_index->array[face_s+1] = subface_s + n_face_vertices;
+
+        /* face -> subface connectivity list update */
+
+        cs_join_rset_resize(&(builder->subface_connect),
+                            subface_s + n_face_vertices);
+
+        builder->subface_connect->n_elts = subface_s + n_face_vertices;
+
+        for (j = 0; j < n_face_vertices; j++)
+          builder->subface_connect->array[subface_s + j]
+            = w->face_vtx_lst[j + w->face_vtx_idx[fid]] + 1;
+
+        if (param.verbosity > 2) {
+          fprintf(cs_glob_join_log,
+                  "\n Keep initial connectivity for face %d [%llu]:\n",
+                  fid+1, (unsigned long long)w->face_gnum[fid]);
+          _dump_face_builder(block_id, builder, cs_glob_join_log);
+        }
+
+      } /* End if n_current_face_problems >= n_face_vertices */
+
+      _n_problems = 0;
+
+    } /* End of error managing */
+
+  } /* End of loop on faces */
+
+  /* Delete lists */
+
+  cs_join_rset_destroy(&head_edges);
+  cs_join_rset_destroy(&subface_edges);
+  cs_join_rset_destroy(&ext_edges);
+  cs_join_rset_destroy(&int_edges);
+
+  return n_face_problems;
+}
+
+/*----------------------------------------------------------------------------
+ * Append the sub-faces built for a range of faces to a face builder.
+ *
+ * parameters:
+ *   builder    <-> face_builder structure for all faces
+ *   block_id_s <-- id of the first face of the range in builder
+ *   r_builder  <-- face_builder structure for the range
+ *---------------------------------------------------------------------------*/
+
+static void
+_append_face_builder(face_builder_t        *builder,
+                     cs_lnum_t              block_id_s,
+                     const face_builder_t  *r_builder)
+{
+  cs_lnum_t  i;
+
+  const cs_lnum_t  n_faces = r_builder->n_faces;
+  const cs_lnum_t  n_subfaces = r_builder->face_index[n_faces];
+  const cs_lnum_t  connect_size = r_builder->subface_index->array[n_subfaces];
+  const cs_lnum_t  subface_s = builder->face_index[block_id_s];
+  const cs_lnum_t  connect_s = builder->subface_index->array[subface_s];
+
+  assert(builder->subface_connect->n_elts == connect_s);
+
+  for (i = 1; i < n_faces + 1; i++)
+    builder->face_index[block_id_s + i] = subface_s + r_builder->face_index[i];
+
+  cs_join_rset_resize(&(builder->subface_index), subface_s + n_subfaces);
+
+  for (i = 1; i < n_subfaces + 1; i++)
+    builder->subface_index->array[subface_s + i]
+      = connect_s + r_builder->subface_index->array[i];
+
+  builder->subface_index->n_elts = subface_s + n_subfaces;
+
+  cs_join_rset_resize(&(builder->subface_connect), connect_s + connect_size);
+
+  memcpy(builder->subface_connect->array + connect_s,
+         r_builder->subface_connect->array,
+         connect_size*sizeof(cs_lnum_t));
+
+  builder->subface_connect->n_elts = connect_s + connect_size;
+}
+
+/*----------------------------------------------------------------------------
+ * Append the elements of a resizable set to another one.
+ *
+ * parameters:
+ *   set   <-> pointer to the set to complete
+ *   r_set <-- set to append
+ *---------------------------------------------------------------------------*/
+
+static void
+_append_rset(cs_join_rset_t        **set,
+             const cs_join_rset_t   *r_set)
+{
+  cs_join_rset_resize(set, (*set)->n_elts + r_set->n_elts);
+
+  for (cs_lnum_t i = 0; i < r_set->n_elts; i++)
+    (*set)->array[(*set)->n_elts + i] = r_set->array[i];
+
+  (*set)->n_elts += r_set->n_elts;
+}
+
 /*----------------------------------------------------------------------------
  * Compare two elements in an indexed list and returns true if element in
  * position i1 is strictly greater than element in position i2.
@@ -1845,18 +2128,16 @@ cs_join_split_faces(cs_join_param_t          param,
                     cs_join_mesh_t         **work,
                     cs_join_gset_t         **old2new_history)
 {
-  cs_lnum_t  fid, j, face_s, subface_s, block_id, vid;
+  cs_lnum_t  fid, j, vid;
   cs_gnum_t  vgnum;
-  cs_join_split_error_t  code;
   cs_block_dist_info_t  bi;
 
-  cs_lnum_t  _n_problems = 0, n_face_problems = 0, n_max_face_vertices = 6;
+  cs_lnum_t  n_face_problems = 0, n_block_faces = 0;
   cs_lnum_t  block_size = 0;
-  cs_lnum_t  *e2f_idx = NULL, *e2f_lst = NULL;
+  cs_lnum_t  *e2f_idx = NULL, *e2f_lst = NULL, *block_face_ids = NULL;
   cs_join_gset_t  *_old2new_history = NULL;
   cs_join_rset_t  *open_cycle = NULL, *edge_traversed_twice = NULL;
-  cs_join_rset_t  *loop_limit = NULL, *head_edges = NULL;
-  cs_join_rset_t  *subface_edges = NULL, *ext_edges = NULL, *int_edges = NULL;
+  cs_join_rset_t  *loop_limit = NULL;
   face_builder_t  *builder = NULL;
   cs_join_mesh_t  *w = *work;
 
@@ -1878,13 +2159,6 @@ cs_join_split_faces(cs_join_param_t          param,
   edge_traversed_twice = cs_join_rset_create(3);
   loop_limit = cs_join_rset_create(3);
 
-  /* Define buffers and structures to build the new faces */
-
-  head_edges = cs_join_rset_create(n_max_face_vertices);
-  subface_edges = cs_join_rset_create(n_max_face_vertices);
-  ext_edges = cs_join_rset_create(n_max_face_vertices);
-  int_edges = cs_join_rset_create(n_max_face_vertices);
-
   /* Compute block_size */
 
   bi = cs_block_dist_compute_sizes(local_rank,
@@ -1902,183 +2176,107 @@ cs_join_split_faces(cs_join_param_t          param,
      We only have to treat faces for the current rank's block because the
      initial face distribution assumes that the current rank can correctly
      split only faces in its block.
-     Main loop on faces.
   */
 
-  for (fid = 0, block_id = 0; fid < n_init_faces; fid++) {
+  BFT_MALLOC(block_face_ids, block_size, cs_lnum_t);
+
+  for (fid = 0; fid < n_init_faces; fid++) {
 
     int  block_rank = (w->face_gnum[fid] - 1)/(cs_gnum_t)(bi.block_size);
 
     if (block_rank == local_rank) { /* This face is a "main" face for the
                                        local rank */
+      assert(n_block_faces < block_size);
+      block_face_ids[n_block_faces++] = fid;
+    }
 
-      int  n_face_vertices = w->face_vtx_idx[fid+1] - w->face_vtx_idx[fid];
-
-      if (n_face_vertices > n_max_face_vertices) { /* Manage list size */
-
-        n_max_face_vertices = n_face_vertices;
-        cs_join_rset_resize(&head_edges, n_face_vertices);
-        cs_join_rset_resize(&subface_edges, n_face_vertices);
-        cs_join_rset_resize(&ext_edges, n_face_vertices);
-        cs_join_rset_resize(&int_edges, n_face_vertices);
-
-      }
-
-      /* Fill head_edges and ext_edges */
-
-      _define_head_and_ext_edges(fid,
-                                 w, edges,
-                                 head_edges, ext_edges,
-                                 0); /* No permutation */
-
-      /* Store initial builder state in case of code > 0 */
-
-      face_s = builder->face_index[block_id];
-      subface_s = builder->subface_index->array[face_s];
-
-      /* Split the current face into subfaces */
-
-      code = _split_face(fid, block_id,
-                         param,
-                         face_normal,
-                         w, edges,
-                         e2f_idx, e2f_lst,
-                         builder,
-                         &head_edges, &subface_edges,
-                         &ext_edges, &int_edges);
-
-#if 0 && defined(DEBUG) && !defined(NDEBUG)
-      if (param.verbosity > 2 && code != NO_SPLIT_ERROR) {
-        fprintf(cs_glob_join_log,
-                "  Split face %d -> returned code: %d\n", fid+1, code);
-        _dump_face_builder(block_id, builder, cs_glob_join_log);
-      }
-#endif
-
-      if (code > NO_SPLIT_ERROR) { /* Manage error */
-
-        _n_problems++;
-
-        /* We change the starting edge for traversing edges to build
-           the new face. This may be enough to solve the problem when
-           the face is warped. */
-
-        while (_n_problems < n_face_vertices && code > NO_SPLIT_ERROR) {
-
-          /* Fill head_edges and ext_edges */
-
-          _define_head_and_ext_edges(fid,
-                                     w, edges,
-                                     head_edges, ext_edges,
-                                     _n_problems); /* permutation */
-
-          /* Retrieve initial builder state */
-
-          builder->face_index[block_id] = face_s;
-          builder->subface_index->array[face_s] = subface_s;
-          builder->subface_connect->n_elts = subface_s;
-
-          /* Split the current face into subfaces */
-
-          code = _split_face(fid, block_id,
-                             param,
-                             face_normal,
-                             w, edges,
-                             e2f_idx, e2f_lst,
-                             builder,
-                             &head_edges, &subface_edges,
-                             &ext_edges, &int_edges);
-
-          _n_problems++;
-
-        } /* End of while */
-
-        if (_n_problems >= n_face_vertices && code != NO_SPLIT_ERROR) {
-
-          n_face_problems++;
-
-          switch (code) {
-
-          case OPEN_CYCLE_ERROR:
-            cs_join_rset_resize(&open_cycle, open_cycle->n_elts);
-            open_cycle->array[open_cycle->n_elts] = fid + 1;
-            open_cycle->n_elts += 1;
-            break;
-
-          case EDGE_TRAVERSED_TWICE_ERROR:
-            cs_join_rset_resize(&edge_traversed_twice,
-                                edge_traversed_twice->n_elts);
-            edge_traversed_twice->array[edge_traversed_twice->n_elts] = fid + 1;
-            edge_traversed_twice->n_elts += 1;
-            break;
-
-          case LOOP_LIMIT_ERROR:
-            cs_join_rset_resize(&loop_limit, loop_limit->n_elts);
-            loop_limit->array[loop_limit->n_elts] = fid + 1;
-            loop_limit->n_elts += 1;
-            break;
-
-          case NO_SPLIT_ERROR: /* To avoid a warning */
-            assert(0);
-            break;
-
-          case MAX_SPLIT_ERROR: /* To avoid a warning */
-            assert(0);
-            break;
-
-          }
-
-          /* Keep the initial face connectivity */
-
-          builder->face_index[block_id] = face_s;
-          builder->face_index[block_id+1] = face_s + 1;
-
-          /* face -> subface connectivity index update */
-
-          cs_join_rset_resize(&(builder->subface_index), face_s+1);
-
-          builder->subface_index->n_elts = face_s + 1;
-          builder->subface_index->array[face_s] = subface_s;
-          builder->subface_index->array[face_s+1] = subface_s + n_face_vertices;
-
-          /* face -> subface connectivity list update */
-
-          cs_join_rset_resize(&(builder->subface_connect),
-                              subface_s + n_face_vertices);
+  }
 
-          builder->subface_connect->n_elts = subface_s + n_face_vertices;
+  /*
+     Main loop on faces.
+     Faces are split independently, so contiguous ranges of faces are
+     handled by separate threads, each with its own builder. Results are
+     then appended in the initial face order, so they do not depend on the
+     number of threads. Logging at high verbosity requires a serial loop.
+  */
 
-          for (j = 0; j < n_face_vertices; j++)
-            builder->subface_connect->array[subface_s + j]
-              = w->face_vtx_lst[j + w->face_vtx_idx[fid]] + 1;
+  int  n_t = cs_glob_n_threads;
+
+  if (param.verbosity > 2 || n_block_faces < CS_THR_MIN)
+    n_t = 1;
+
+  if (n_t < 2)
+    n_face_problems = _split_face_range(param,
+                                        face_normal,
+                                        w,
+                                        edges,
+                                        e2f_idx, e2f_lst,
+                                        n_block_faces,
+                                        block_face_ids,
+                                        builder,
+                                        &open_cycle,
+                                        &edge_traversed_twice,
+                                        &loop_limit);
+
+  else {
+
+    cs_lnum_t  *t_n_problems = NULL;
+    face_builder_t  **t_builder = NULL;
+    cs_join_rset_t  **t_errors = NULL;
+
+    BFT_MALLOC(t_n_problems, n_t, cs_lnum_t);
+    BFT_MALLOC(t_builder, n_t, face_builder_t *);
+    BFT_MALLOC(t_errors, n_t*3, cs_join_rset_t *);
+
+#   pragma omp parallel for schedule(static, 1) num_threads(n_t)
+    for (int t_id = 0; t_id < n_t; t_id++) {
+
+      cs_lnum_t  s_id = ((cs_gnum_t)n_block_faces * t_id) / n_t;
+      cs_lnum_t  e_id = ((cs_gnum_t)n_block_faces * (t_id+1)) / n_t;
+
+      t_builder[t_id] = _create_face_builder(e_id - s_id);
+      for (int k = 0; k < 3; k++)
+        t_errors[t_id*3 + k] = cs_join_rset_create(3);
+
+      t_n_problems[t_id] = _split_face_range(param,
+                                             face_normal,
+                                             w,
+                                             edges,
+                                             e2f_idx, e2f_lst,
+                                             e_id - s_id,
+                                             block_face_ids + s_id,
+                                             t_builder[t_id],
+                                             t_errors + t_id*3,
+                                             t_errors + t_id*3 + 1,
+                                             t_errors + t_id*3 + 2);
 
-          if (param.verbosity > 2) {
-            fprintf(cs_glob_join_log,
-                    "\n Keep initial connectivity for face %d [%llu]:\n",
-                    fid+1, (unsigned long long)w->face_gnum[fid]);
-            _dump_face_builder(block_id, builder, cs_glob_join_log);
-          }
+    }
 
-        } /* End if n_current_face_problems >= n_face_vertices */
+    /* Gather results in face order */
 
-        _n_problems = 0;
+    for (int t_id = 0; t_id < n_t; t_id++) {
 
-      } /* End of error managing */
+      cs_lnum_t  s_id = ((cs_gnum_t)n_block_faces * t_id) / n_t;
 
-      /* Ready to treat the next face in the block of the current rank */
+      _append_face_builder(builder, s_id, t_builder[t_id]);
+      _append_rset(&open_cycle, t_errors[t_id*3]);
+      _append_rset(&edge_traversed_twice, t_errors[t_id*3 + 1]);
+      _append_rset(&loop_limit, t_errors[t_id*3 + 2]);
+      n_face_problems += t_n_problems[t_id];
 
-      block_id++;
+      t_builder[t_id] = _destroy_face_builder(t_builder[t_id]);
+      for (int k = 0; k < 3; k++)
+        cs_join_rset_destroy(t_errors + t_id*3 + k);
 
-    } /* End if current face is in rank block */
+    }
 
-  } /* End of loop on faces */
+    BFT_FREE(t_errors);
+    BFT_FREE(t_builder);
+    BFT_FREE(t_n_problems);
 
-  /* Delete lists */
+  }
 
-  cs_join_rset_destroy(&head_edges);
-  cs_join_rset_destroy(&subface_edges);
-  cs_join_rset_destroy(&ext_edges);
-  cs_join_rset_destroy(&int_edges);
+  BFT_FREE(block_face_ids);
 
   /* Display information in case of problem during the face splitting */
 
@@ -0,0 +1,718 @@
+/*============================================================================
+ * Bounding box search index for mesh elements.
+ *===========================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+#include <float.h>
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *---------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+
+#include "fvm_morton.h"
+
+#include "cs_mesh.h"
+#include "cs_mesh_location.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *---------------------------------------------------------------------------*/
+
+#include "cs_mesh_box_index.h"
+
+/*---------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_mesh_box_index.c
+        Bounding box search index for mesh elements.
+
+  The index is a bounding volume hierarchy built on element extents:
+  elements are ordered along a Morton curve (based on their extents'
+  centers), and the tree is obtained by recursive bisection of that
+  ordering, so that leaves group neighboring elements. Each node also
+  keeps the maximum element widths in its subtree, so that the relative
+  search tolerance may be chosen at query time.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Local macro definitions
+ *============================================================================*/
+
+#define _LEAF_SIZE        8    /* Maximum number of elements per leaf */
+#define _MAX_DEPTH       64    /* Maximum tree depth (traversal stack size) */
+#define _MORTON_LEVEL    10    /* Level used for element ordering */
+
+/*=============================================================================
+ * Local Structure Definitions
+ *===========================================================================*/
+
+/* Tree node */
+
+typedef struct {
+
+  cs_lnum_t  start;          /* Start of element range (ordered elements) */
+  cs_lnum_t  end;            /* Past-the-end of element range */
+  cs_lnum_t  child[2];       /* Children node ids, or -1 for leaves */
+
+  double     extents[6];     /* Union of element extents */
+  double     width[3];       /* Maximum element tolerance widths */
+
+} _box_node_t;
+
+/* Bounding box index */
+
+struct _cs_mesh_box_index_t {
+
+  cs_lnum_t     n_elts;      /* Number of indexed elements */
+  int           elt_dim;     /* Indexed elements dimension */
+
+  cs_lnum_t    *elt_id;      /* Element ids, in tree order */
+  double       *elt_extents; /* Element extents, in tree order (size: 6*n) */
+  double       *elt_width;   /* Element tolerance widths, in tree order
+                                (size: 3*n) */
+
+  cs_lnum_t     n_nodes;     /* Number of tree nodes */
+  int           depth;       /* Tree depth */
+  _box_node_t  *nodes;       /* Tree nodes (root is node 0) */
+
+};
+
+/*============================================================================
+ * Static global variables
+ *===========================================================================*/
+
+/* Indexes for cells and boundary faces of the main mesh */
+
+static cs_mesh_box_index_t  *_box_index[2] = {NULL, NULL};
+
+/*============================================================================
+ * Private function definitions
+ *===========================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Update element extents with the vertices of a face.
+ *
+ * parameters:
+ *   vtx_coord  <-- vertex coordinates
+ *   n_vtx      <-- number of face vertices
+ *   vtx_ids    <-- face vertex ids
+ *   extents    <-> element extents
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_update_extents(const cs_real_t   vtx_coord[][3],
+                cs_lnum_t         n_vtx,
+                const cs_lnum_t   vtx_ids[],
+                double            extents[6])
+{
+  for (cs_lnum_t i = 0; i < n_vtx; i++) {
+    const cs_real_t *c = vtx_coord[vtx_ids[i]];
+    for (int j = 0; j < 3; j++) {
+      if (c[j] < extents[j])
+        extents[j] = c[j];
+      if (c[j] > extents[j+3])
+        extents[j+3] = c[j];
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Compute element extents for cells or boundary faces of a mesh.
+ *
+ * parameters:
+ *   m           <-- pointer to mesh
+ *   on_boundary <-- true for boundary faces, false for cells
+ *   n_elts      <-- number of elements
+ *   extents     --> element extents (size: n_elts*6)
+ *----------------------------------------------------------------------------*/
+
+static void
+_compute_elt_extents(const cs_mesh_t  *m,
+                     bool              on_boundary,
+                     cs_lnum_t         n_elts,
+                     double            extents[])
+{
+  const cs_real_3_t *vtx_coord = (const cs_real_3_t *)m->vtx_coord;
+
+# pragma omp parallel for if (n_elts > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_elts; i++) {
+    for (int j = 0; j < 3; j++) {
+      extents[i*6 + j] = HUGE_VAL;
+      extents[i*6 + j + 3] = -HUGE_VAL;
+    }
+  }
+
+  if (on_boundary) {
+
+#   pragma omp parallel for if (n_elts > CS_THR_MIN)
+    for (cs_lnum_t f_id = 0; f_id < n_elts; f_id++) {
+      cs_lnum_t s_id = m->b_face_vtx_idx[f_id];
+      cs_lnum_t e_id = m->b_face_vtx_idx[f_id+1];
+      _update_extents(vtx_coord,
+                      e_id - s_id,
+                      m->b_face_vtx_lst + s_id,
+                      extents + f_id*6);
+    }
+
+  }
+  else {
+
+    /* Cells are updated through their faces; this loop is kept
+       serial as faces are not grouped by threads here */
+
+    for (cs_lnum_t f_id = 0; f_id < m->n_i_faces; f_id++) {
+      cs_lnum_t s_id = m->i_face_vtx_idx[f_id];
+      cs_lnum_t e_id = m->i_face_vtx_idx[f_id+1];
+      for (int k = 0; k < 2; k++) {
+        cs_lnum_t c_id = m->i_face_cells[f_id][k];
+        if (c_id < n_elts)
+          _update_extents(vtx_coord,
+                          e_id - s_id,
+                          m->i_face_vtx_lst + s_id,
+                          extents + c_id*6);
+      }
+    }
+
+    for (cs_lnum_t f_id = 0; f_id < m->n_b_faces; f_id++) {
+      cs_lnum_t s_id = m->b_face_vtx_idx[f_id];
+      cs_lnum_t e_id = m->b_face_vtx_idx[f_id+1];
+      cs_lnum_t c_id = m->b_face_cells[f_id];
+      _update_extents(vtx_coord,
+                      e_id - s_id,
+                      m->b_face_vtx_lst + s_id,
+                      extents + c_id*6);
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Recursively build tree nodes for a range of ordered elements.
+ *
+ * parameters:
+ *   bi    <-> pointer to bounding box index
+ *   start <-- start of element range
+ *   end   <-- past-the-end of element range
+ *   depth <-- depth of current node
+ *
+ * returns:
+ *   id of created node
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_build_node(cs_mesh_box_index_t  *bi,
+            cs_lnum_t             start,
+            cs_lnum_t             end,
+            int                   depth)
+{
+  cs_lnum_t node_id = bi->n_nodes;
+  bi->n_nodes += 1;
+
+  if (depth + 1 > bi->depth)
+    bi->depth = depth + 1;
+
+  _box_node_t *node = bi->nodes + node_id;
+
+  node->start = start;
+  node->end = end;
+
+  if (end - start > _LEAF_SIZE && depth + 1 < _MAX_DEPTH) {
+
+    cs_lnum_t mid = start + (end - start)/2;
+
+    cs_lnum_t c0 = _build_node(bi, start, mid, depth + 1);
+    cs_lnum_t c1 = _build_node(bi, mid, end, depth + 1);
+
+    node->child[0] = c0;
+    node->child[1] = c1;
+
+    const _box_node_t *n0 = bi->nodes + c0;
+    const _box_node_t *n1 = bi->nodes + c1;
+
+    for (int j = 0; j < 3; j++) {
+      node->extents[j] = CS_MIN(n0->extents[j], n1->extents[j]);
+      node->extents[j+3] = CS_MAX(n0->extents[j+3], n1->extents[j+3]);
+      node->width[j] = CS_MAX(n0->width[j], n1->width[j]);
+    }
+
+  }
+  else {
+
+    node->child[0] = -1;
+    node->child[1] = -1;
+
+    for (int j = 0; j < 3; j++) {
+      node->extents[j] = HUGE_VAL;
+      node->extents[j+3] = -HUGE_VAL;
+      node->width[j] = 0;
+    }
+
+    for (cs_lnum_t i = start; i < end; i++) {
+      const double *e = bi->elt_extents + i*6;
+      const double *w = bi->elt_width + i*3;
+      for (int j = 0; j < 3; j++) {
+        node->extents[j] = CS_MIN(node->extents[j], e[j]);
+        node->extents[j+3] = CS_MAX(node->extents[j+3], e[j+3]);
+        node->width[j] = CS_MAX(node->width[j], w[j]);
+      }
+    }
+
+  }
+
+  return node_id;
+}
+
+/*----------------------------------------------------------------------------
+ * Build a bounding box index for cells or boundary faces of a mesh.
+ *
+ * parameters:
+ *   m           <-- pointer to mesh
+ *   on_boundary <-- true for boundary faces, false for cells
+ *
+ * returns:
+ *   pointer to new bounding box index
+ *----------------------------------------------------------------------------*/
+
+static cs_mesh_box_index_t *
+_box_index_create(const cs_mesh_t  *m,
+                  bool              on_boundary)
+{
+  cs_mesh_box_index_t *bi = NULL;
+
+  BFT_MALLOC(bi, 1, cs_mesh_box_index_t);
+
+  const cs_lnum_t n_elts = (on_boundary) ? m->n_b_faces : m->n_cells;
+
+  bi->n_elts = n_elts;
+  bi->elt_dim = (on_boundary) ? 2 : 3;
+
+  /* Element extents and centers */
+
+  double *extents, *centers;
+  BFT_MALLOC(extents, n_elts*6, double);
+  BFT_MALLOC(centers, n_elts*3, double);
+
+  _compute_elt_extents(m, on_boundary, n_elts, extents);
+
+  double g_extents[6] = {HUGE_VAL, HUGE_VAL, HUGE_VAL,
+                         -HUGE_VAL, -HUGE_VAL, -HUGE_VAL};
+
+  for (cs_lnum_t i = 0; i < n_elts; i++) {
+    for (int j = 0; j < 3; j++) {
+      centers[i*3 + j] = 0.5*(extents[i*6 + j] + extents[i*6 + j + 3]);
+      if (extents[i*6 + j] < g_extents[j])
+        g_extents[j] = extents[i*6 + j];
+      if (extents[i*6 + j + 3] > g_extents[j+3])
+        g_extents[j+3] = extents[i*6 + j + 3];
+    }
+  }
+
+  /* Order elements along a Morton curve */
+
+  BFT_MALLOC(bi->elt_id, n_elts, cs_lnum_t);
+
+  if (n_elts > 0) {
+    fvm_morton_code_t *m_code;
+    BFT_MALLOC(m_code, n_elts, fvm_morton_code_t);
+    fvm_morton_encode_coords(3,
+                             _MORTON_LEVEL,
+                             g_extents,
+                             n_elts,
+                             centers,
+                             m_code);
+    fvm_morton_local_order(n_elts, m_code, bi->elt_id);
+    BFT_FREE(m_code);
+  }
+
+  BFT_FREE(centers);
+
+  /* Copy extents in tree order, and define tolerance widths;
+     as in fvm_point_location, faces use the maximum width in
+     all directions to ensure a search "thickness" */
+
+  BFT_MALLOC(bi->elt_extents, n_elts*6, double);
+  BFT_MALLOC(bi->elt_width, n_elts*3, double);
+
+# pragma omp parallel for if (n_elts > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_elts; i++) {
+    const double *e = extents + bi->elt_id[i]*6;
+    double *_e = bi->elt_extents + i*6;
+    double *w = bi->elt_width + i*3;
+    for (int j = 0; j < 6; j++)
+      _e[j] = e[j];
+    for (int j = 0; j < 3; j++)
+      w[j] = e[j+3] - e[j];
+    if (on_boundary) {
+      double w_max = CS_MAX(CS_MAX(w[0], w[1]), w[2]);
+      for (int j = 0; j < 3; j++)
+        w[j] = w_max;
+    }
+  }
+
+  BFT_FREE(extents);
+
+  /* Build tree */
+
+  cs_lnum_t n_nodes_max = 1;
+  {
+    cs_lnum_t n_leaves = 1;
+    while (n_leaves*_LEAF_SIZE < n_elts)
+      n_leaves *= 2;
+    n_nodes_max = 2*n_leaves;
+  }
+
+  bi->n_nodes = 0;
+  bi->depth = 0;
+  BFT_MALLOC(bi->nodes, n_nodes_max, _box_node_t);
+
+  _build_node(bi, 0, n_elts, 0);
+
+  assert(bi->n_nodes <= n_nodes_max);
+
+  BFT_REALLOC(bi->nodes, bi->n_nodes, _box_node_t);
+
+  return bi;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy a bounding box index.
+ *
+ * parameters:
+ *   bi <-> pointer to bounding box index pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_box_index_destroy(cs_mesh_box_index_t  **bi)
+{
+  cs_mesh_box_index_t *_bi = *bi;
+
+  if (_bi != NULL) {
+    BFT_FREE(_bi->elt_id);
+    BFT_FREE(_bi->elt_extents);
+    BFT_FREE(_bi->elt_width);
+    BFT_FREE(_bi->nodes);
+    BFT_FREE(*bi);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Check if a point is inside tolerance-enlarged extents.
+ *
+ * parameters:
+ *   extents   <-- base extents
+ *   width     <-- tolerance widths
+ *   tolerance <-- absolute and relative search tolerance
+ *   p         <-- point coordinates
+ *
+ * returns:
+ *   true if point is inside extents, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static inline bool
+_in_extents(const double     extents[6],
+            const double     width[3],
+            const double     tolerance[2],
+            const cs_real_t  p[3])
+{
+  for (int j = 0; j < 3; j++) {
+    double delta = width[j]*tolerance[1] + tolerance[0];
+    if (   p[j] < extents[j] - delta
+        || p[j] > extents[j+3] + delta)
+      return false;
+  }
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Find elements whose extents contain a given point.
+ *
+ * parameters:
+ *   bi        <-- pointer to bounding box index
+ *   tolerance <-- absolute and relative search tolerance
+ *   p         <-- point coordinates
+ *   elt_ids   --> ids of matching elements, or NULL to count only
+ *
+ * returns:
+ *   number of matching elements
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_query_point(const cs_mesh_box_index_t  *bi,
+             const double                tolerance[2],
+             const cs_real_t             p[3],
+             cs_lnum_t                   elt_ids[])
+{
+  cs_lnum_t n_found = 0;
+
+  if (bi->n_nodes == 0 || bi->n_elts == 0)
+    return n_found;
+
+  cs_lnum_t stack[_MAX_DEPTH + 1];
+  int stack_size = 1;
+  stack[0] = 0;
+
+  while (stack_size > 0) {
+
+    const _box_node_t *node = bi->nodes + stack[--stack_size];
+
+    if (_in_extents(node->extents, node->width, tolerance, p) == false)
+      continue;
+
+    if (node->child[0] > -1) {
+      stack[stack_size++] = node->child[1];
+      stack[stack_size++] = node->child[0];
+    }
+    else {
+      for (cs_lnum_t i = node->start; i < node->end; i++) {
+        if (_in_extents(bi->elt_extents + i*6,
+                        bi->elt_width + i*3,
+                        tolerance,
+                        p)) {
+          if (elt_ids != NULL)
+            elt_ids[n_found] = bi->elt_id[i];
+          n_found++;
+        }
+      }
+    }
+
+  }
+
+  return n_found;
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the bounding box index associated with cells or boundary
+ *        faces of the main mesh.
+ *
+ * The index is built on the first call, and kept for subsequent calls,
+ * until \ref cs_mesh_box_index_free is called (which must be done when
+ * the mesh or its vertex coordinates are modified).
+ *
+ * \param[in]  location_type  CS_MESH_LOCATION_CELLS or
+ *                            CS_MESH_LOCATION_BOUNDARY_FACES
+ *
+ * \return  pointer to associated bounding box index
+ */
+/*----------------------------------------------------------------------------*/
+
+const cs_mesh_box_index_t *
+cs_mesh_box_index_get(cs_mesh_location_type_t  location_type)
+{
+  int i = -1;
+
+  if (location_type == CS_MESH_LOCATION_CELLS)
+    i = 0;
+  else if (location_type == CS_MESH_LOCATION_BOUNDARY_FACES)
+    i = 1;
+  else
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: location type %d is not handled."),
+              __func__, (int)location_type);
+
+  if (_box_index[i] == NULL)
+    _box_index[i] = _box_index_create(cs_glob_mesh, (i == 1));
+
+  return _box_index[i];
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free bounding box indexes associated with the main mesh.
+ *
+ * This will force subsequent calls to rebuild those indexes if needed.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_box_index_free(void)
+{
+  for (int i = 0; i < 2; i++)
+    _box_index_destroy(_box_index + i);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the number of elements in a bounding box index.
+ *
+ * \param[in]  bi  pointer to bounding box index
+ *
+ * \return  number of indexed elements
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_mesh_box_index_get_n_elts(const cs_mesh_box_index_t  *bi)
+{
+  cs_lnum_t retval = 0;
+
+  if (bi != NULL)
+    retval = bi->n_elts;
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Find elements whose bounding box contains given points.
+ *
+ * Element extents are enlarged using the same tolerance definition
+ * as \ref fvm_point_location_nodal, that is:
+ * extent = base_extent * (1 + tolerance[1]) + tolerance[0],
+ * so the elements returned for a point are a superset of those
+ * which could be selected by that function.
+ *
+ * Queries are multithreaded over points.
+ *
+ * The caller is responsible for freeing the returned arrays.
+ *
+ * \param[in]   bi            pointer to bounding box index
+ * \param[in]   tolerance     absolute and relative search tolerance
+ * \param[in]   n_points      number of points
+ * \param[in]   point_coords  point coordinates
+ * \param[out]  pt_elt_idx    point -> elements index (size: n_points + 1)
+ * \param[out]  pt_elt_ids    point -> element ids (0 to n-1)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_box_index_query_points(const cs_mesh_box_index_t   *bi,
+                               const double                 tolerance[2],
+                               cs_lnum_t                    n_points,
+                               const cs_real_t              point_coords[][3],
+                               cs_lnum_t                  **pt_elt_idx,
+                               cs_lnum_t                  **pt_elt_ids)
+{
+  cs_lnum_t *_pt_elt_idx = NULL, *_pt_elt_ids = NULL;
+
+  BFT_MALLOC(_pt_elt_idx, n_points + 1, cs_lnum_t);
+
+  _pt_elt_idx[0] = 0;
+
+  /* First pass: count */
+
+# pragma omp parallel for if (n_points > CS_THR_MIN) schedule(dynamic, 64)
+  for (cs_lnum_t i = 0; i < n_points; i++)
+    _pt_elt_idx[i+1] = _query_point(bi, tolerance, point_coords[i], NULL);
+
+  for (cs_lnum_t i = 0; i < n_points; i++)
+    _pt_elt_idx[i+1] += _pt_elt_idx[i];
+
+  /* Second pass: fill */
+
+  BFT_MALLOC(_pt_elt_ids, _pt_elt_idx[n_points], cs_lnum_t);
+
+# pragma omp parallel for if (n_points > CS_THR_MIN) schedule(dynamic, 64)
+  for (cs_lnum_t i = 0; i < n_points; i++)
+    _query_point(bi, tolerance, point_coords[i],
+                 _pt_elt_ids + _pt_elt_idx[i]);
+
+  *pt_elt_idx = _pt_elt_idx;
+  *pt_elt_ids = _pt_elt_ids;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Mark elements whose bounding box contains at least one of a set
+ *        of points.
+ *
+ * \param[in]   bi            pointer to bounding box index
+ * \param[in]   tolerance     absolute and relative search tolerance
+ *                            (see \ref cs_mesh_box_index_query_points)
+ * \param[in]   n_points      number of points
+ * \param[in]   point_coords  point coordinates
+ * \param[out]  elt_flag      1 for marked elements, 0 for others
+ *                            (size: number of indexed elements)
+ *
+ * \return  number of marked elements
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_mesh_box_index_mark_elts(const cs_mesh_box_index_t  *bi,
+                            const double                tolerance[2],
+                            cs_lnum_t                   n_points,
+                            const cs_real_t             point_coords[][3],
+                            char                        elt_flag[])
+{
+  cs_lnum_t n_marked = 0;
+
+  const cs_lnum_t n_elts = cs_mesh_box_index_get_n_elts(bi);
+
+  for (cs_lnum_t i = 0; i < n_elts; i++)
+    elt_flag[i] = 0;
+
+  cs_lnum_t *pt_elt_idx = NULL, *pt_elt_ids = NULL;
+
+  cs_mesh_box_index_query_points(bi,
+                                 tolerance,
+                                 n_points,
+                                 point_coords,
+                                 &pt_elt_idx,
+                                 &pt_elt_ids);
+
+  for (cs_lnum_t i = 0; i < pt_elt_idx[n_points]; i++) {
+    cs_lnum_t elt_id = pt_elt_ids[i];
+    if (elt_flag[elt_id] == 0) {
+      elt_flag[elt_id] = 1;
+      n_marked++;
+    }
+  }
+
+  BFT_FREE(pt_elt_ids);
+  BFT_FREE(pt_elt_idx);
+
+  return n_marked;
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
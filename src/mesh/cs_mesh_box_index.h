@@ -0,0 +1,165 @@
+#ifndef __CS_MESH_BOX_INDEX_H__
+#define __CS_MESH_BOX_INDEX_H__
+
+/*============================================================================
+ * Bounding box search index for mesh elements.
+ *===========================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *---------------------------------------------------------------------------*/
+
+#include "cs_mesh.h"
+#include "cs_mesh_location.h"
+
+/*---------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Local Macro definitions
+ *===========================================================================*/
+
+/*============================================================================
+ * Type definition
+ *===========================================================================*/
+
+/* Opaque bounding box index structure */
+
+typedef struct _cs_mesh_box_index_t  cs_mesh_box_index_t;
+
+/*=============================================================================
+ * Global variables
+ *===========================================================================*/
+
+/*=============================================================================
+ * Public function prototypes
+ *===========================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the bounding box index associated with cells or boundary
+ *        faces of the main mesh.
+ *
+ * The index is built on the first call, and kept for subsequent calls,
+ * until \ref cs_mesh_box_index_free is called (which must be done when
+ * the mesh or its vertex coordinates are modified).
+ *
+ * \param[in]  location_type  CS_MESH_LOCATION_CELLS or
+ *                            CS_MESH_LOCATION_BOUNDARY_FACES
+ *
+ * \return  pointer to associated bounding box index
+ */
+/*----------------------------------------------------------------------------*/
+
+const cs_mesh_box_index_t *
+cs_mesh_box_index_get(cs_mesh_location_type_t  location_type);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free bounding box indexes associated with the main mesh.
+ *
+ * This will force subsequent calls to rebuild those indexes if needed.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_box_index_free(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the number of elements in a bounding box index.
+ *
+ * \param[in]  bi  pointer to bounding box index
+ *
+ * \return  number of indexed elements
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_mesh_box_index_get_n_elts(const cs_mesh_box_index_t  *bi);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Find elements whose bounding box contains given points.
+ *
+ * Element extents are enlarged using the same tolerance definition
+ * as \ref fvm_point_location_nodal, that is:
+ * extent = base_extent * (1 + tolerance[1]) + tolerance[0],
+ * so the elements returned for a point are a superset of those
+ * which could be selected by that function.
+ *
+ * Queries are multithreaded over points.
+ *
+ * The caller is responsible for freeing the returned arrays.
+ *
+ * \param[in]   bi            pointer to bounding box index
+ * \param[in]   tolerance     absolute and relative search tolerance
+ * \param[in]   n_points      number of points
+ * \param[in]   point_coords  point coordinates
+ * \param[out]  pt_elt_idx    point -> elements index (size: n_points + 1)
+ * \param[out]  pt_elt_ids    point -> element ids (0 to n-1)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_box_index_query_points(const cs_mesh_box_index_t   *bi,
+                               const double                 tolerance[2],
+                               cs_lnum_t                    n_points,
+                               const cs_real_t              point_coords[][3],
+                               cs_lnum_t                  **pt_elt_idx,
+                               cs_lnum_t                  **pt_elt_ids);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Mark elements whose bounding box contains at least one of a set
+ *        of points.
+ *
+ * \param[in]   bi            pointer to bounding box index
+ * \param[in]   tolerance     absolute and relative search tolerance
+ *                            (see \ref cs_mesh_box_index_query_points)
+ * \param[in]   n_points      number of points
+ * \param[in]   point_coords  point coordinates
+ * \param[out]  elt_flag      1 for marked elements, 0 for others
+ *                            (size: number of indexed elements)
+ *
+ * \return  number of marked elements
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_mesh_box_index_mark_elts(const cs_mesh_box_index_t  *bi,
+                            const double                tolerance[2],
+                            cs_lnum_t                   n_points,
+                            const cs_real_t             point_coords[][3],
+                            char                        elt_flag[]);
+
+/*---------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_MESH_BOX_INDEX_H__ */
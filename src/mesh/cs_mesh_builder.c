@@ -51,6 +51,7 @@
 
 #include "cs_base.h"
 #include "cs_interface.h"
+#include "cs_io.h"
 
 /*----------------------------------------------------------------------------
  *  Header for the current file
@@ -162,6 +163,8 @@ cs_mesh_builder_create(void)
   mb->face_gc_id = NULL;
   mb->vertex_coords = NULL;
 
+  mb->vertex_input = NULL;
+
   /* Refinement features */
 
   mb->face_r_gen = NULL;
@@ -204,6 +207,8 @@ cs_mesh_builder_destroy(cs_mesh_builder_t  **mb)
 
     cs_mesh_builder_t  *_mb = *mb;
 
+    cs_mesh_builder_complete_input(_mb);
+
     /* Temporary mesh data */
 
     BFT_FREE(_mb->face_cells);
@@ -240,6 +245,26 @@ cs_mesh_builder_destroy(cs_mesh_builder_t  **mb)
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Complete pending reads of face -> vertices connectivity and
+ *        vertex coordinates for a mesh builder, if present.
+ *
+ * The associated input is closed once its reads are complete.
+ *
+ * \param[in, out]  mb  pointer to mesh builder structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_builder_complete_input(cs_mesh_builder_t  *mb)
+{
+  if (mb->vertex_input != NULL) {
+    cs_io_wait(mb->vertex_input);
+    cs_io_finalize(&(mb->vertex_input));
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Define block distribution sizes for mesh builder.
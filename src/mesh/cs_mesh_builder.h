@@ -38,6 +38,7 @@
 #include "cs_base.h"
 #include "cs_block_dist.h"
 #include "cs_interface.h"
+#include "cs_io.h"
 
 /*----------------------------------------------------------------------------*/
 
@@ -75,6 +76,11 @@ typedef struct {
   int          *face_gc_id;
   cs_real_t    *vertex_coords;
 
+  cs_io_t      *vertex_input;          /* Input with pending reads of
+                                          face_vertices and vertex_coords
+                                          (see cs_io_iread_block),
+                                          or NULL */
+
   /* Refinement features */
 
   char         *face_r_gen;
@@ -133,6 +139,19 @@ cs_mesh_builder_create(void);
 void
 cs_mesh_builder_destroy(cs_mesh_builder_t  **mb);
 
+/*----------------------------------------------------------------------------
+ * Complete pending reads of face -> vertices connectivity and vertex
+ * coordinates for a mesh builder, if present.
+ *
+ * The associated input is closed once its reads are complete.
+ *
+ * parameters:
+ *   mb <-> pointer to mesh builder structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_mesh_builder_complete_input(cs_mesh_builder_t  *mb);
+
 /*----------------------------------------------------------------------------
  * Define block distribution sizes for mesh builder.
  *
@@ -924,7 +924,7 @@ _precompute_free_face_center(const cs_mesh_builder_t  *mb,
  * Compute default face destination rank array in case of isolated faces.
  *
  * parameters:
- *   mb           <-- pointer to mesh builder helper structure
+ *   mb           <-> pointer to mesh builder helper structure
  *   comm         <-- associated MPI communicator
  *
  * returns:
@@ -932,8 +932,8 @@ _precompute_free_face_center(const cs_mesh_builder_t  *mb,
  *----------------------------------------------------------------------------*/
 
 static int *
-_default_face_rank(const cs_mesh_builder_t  *mb,
-                   MPI_Comm                  comm)
+_default_face_rank(cs_mesh_builder_t  *mb,
+                   MPI_Comm            comm)
 {
   cs_lnum_t i;
   cs_block_dist_info_t free_face_bi;
@@ -1002,6 +1002,8 @@ _default_face_rank(const cs_mesh_builder_t  *mb,
       free_face_ids[n_free_faces++] = i;
   }
 
+  cs_mesh_builder_complete_input(mb);
+
   _precompute_free_face_center(mb,
                                n_free_faces,
                                free_face_ids,
@@ -1089,33 +1091,48 @@ _decompose_data_g(cs_mesh_t          *mesh,
 
     mesh->n_cells = cs_all_to_all_n_elts_dest(d);
 
-    cs_gnum_t *b_global_num;
-    BFT_MALLOC(b_global_num, n_block_ents, cs_gnum_t);
+    /* Global numbers and group classes are packed in a single record
+       per cell, so as to be distributed in a single exchange */
 
-    mesh->cell_family = cs_all_to_all_copy_array(d,
-                                                 CS_LNUM_TYPE,
-                                                 1,
-                                                 false, /* reverse */
-                                                 mb->cell_gc_id,
-                                                 NULL);
+    const size_t rec_size = sizeof(cs_gnum_t) + sizeof(cs_lnum_t);
 
-    BFT_FREE(mb->cell_gc_id);
+    unsigned char *b_rec, *p_rec;
+    BFT_MALLOC(b_rec, n_block_ents*rec_size, unsigned char);
 
     cs_gnum_t  gnum_shift = mb->cell_bi.gnum_range[0];
-    for (cs_lnum_t i = 0; i < n_block_ents; i++)
-      b_global_num[i] = (cs_gnum_t)i + gnum_shift;
+    for (cs_lnum_t i = 0; i < n_block_ents; i++) {
+      cs_gnum_t g_num = (cs_gnum_t)i + gnum_shift;
+      memcpy(b_rec + i*rec_size, &g_num, sizeof(cs_gnum_t));
+      memcpy(b_rec + i*rec_size + sizeof(cs_gnum_t),
+             mb->cell_gc_id + i,
+             sizeof(cs_lnum_t));
+    }
+
+    BFT_FREE(mb->cell_gc_id);
 
-    mesh->global_cell_num = cs_all_to_all_copy_array(d,
-                                                     CS_GNUM_TYPE,
-                                                     1,
-                                                     false, /* reverse */
-                                                     b_global_num,
-                                                     NULL);
+    p_rec = cs_all_to_all_copy_array(d,
+                                     CS_CHAR,
+                                     rec_size,
+                                     false, /* reverse */
+                                     b_rec,
+                                     NULL);
 
-    BFT_FREE(b_global_num);
+    BFT_FREE(b_rec);
 
     cs_all_to_all_destroy(&d);
 
+    BFT_MALLOC(mesh->global_cell_num, mesh->n_cells, cs_gnum_t);
+    BFT_MALLOC(mesh->cell_family, mesh->n_cells, cs_lnum_t);
+
+    for (cs_lnum_t i = 0; i < mesh->n_cells; i++) {
+      memcpy(mesh->global_cell_num + i, p_rec + i*rec_size,
+             sizeof(cs_gnum_t));
+      memcpy(mesh->cell_family + i, p_rec + i*rec_size + sizeof(cs_gnum_t),
+             sizeof(cs_lnum_t));
+    }
+
+    BFT_FREE(p_rec);
+
   }
   else {
 
@@ -1159,18 +1176,60 @@ _decompose_data_g(cs_mesh_t          *mesh,
 
   BFT_FREE(mb->cell_rank); /* Not needed anymore */
 
-  BFT_MALLOC(_face_gcells, _n_faces*2, cs_gnum_t);
+  /* Face -> cell connectivity, group classes and refinement generation
+     are packed in a single record per face, so as to be distributed
+     in a single exchange */
 
-  /* Face -> cell connectivity */
+  {
+    const size_t fc_size = 2*sizeof(cs_gnum_t);
+    const size_t rec_size =   fc_size + sizeof(cs_lnum_t)
+                            + ((mb->have_face_r_gen) ? 1 : 0);
+
+    cs_lnum_t n_block_faces = 0;
+    if (mb->face_bi.gnum_range[1] > mb->face_bi.gnum_range[0])
+      n_block_faces = mb->face_bi.gnum_range[1] - mb->face_bi.gnum_range[0];
+
+    unsigned char *b_rec, *p_rec;
+    BFT_MALLOC(b_rec, n_block_faces*rec_size, unsigned char);
+    BFT_MALLOC(p_rec, _n_faces*rec_size, unsigned char);
+
+    for (cs_lnum_t i = 0; i < n_block_faces; i++) {
+      unsigned char *r = b_rec + i*rec_size;
+      memcpy(r, mb->face_cells + i*2, fc_size);
+      memcpy(r + fc_size, mb->face_gc_id + i, sizeof(cs_lnum_t));
+      if (mb->have_face_r_gen)
+        r[fc_size + sizeof(cs_lnum_t)] = mb->face_r_gen[i];
+    }
 
-  cs_all_to_all_copy_array(d,
-                           CS_GNUM_TYPE,
-                           2,
-                           true,  /* reverse */
-                           mb->face_cells,
-                           _face_gcells);
+    BFT_FREE(mb->face_cells);
+    BFT_FREE(mb->face_gc_id);
+    BFT_FREE(mb->face_r_gen);
 
-  BFT_FREE(mb->face_cells);
+    cs_all_to_all_copy_array(d,
+                             CS_CHAR,
+                             rec_size,
+                             true,  /* reverse */
+                             b_rec,
+                             p_rec);
+
+    BFT_FREE(b_rec);
+
+    BFT_MALLOC(_face_gcells, _n_faces*2, cs_gnum_t);
+    BFT_MALLOC(_face_gc_id, _n_faces, cs_lnum_t);
+    BFT_MALLOC(_face_r_gen, _n_faces, char);
+
+    for (cs_lnum_t i = 0; i < _n_faces; i++) {
+      const unsigned char *r = p_rec + i*rec_size;
+      memcpy(_face_gcells + i*2, r, fc_size);
+      memcpy(_face_gc_id + i, r + fc_size, sizeof(cs_lnum_t));
+      if (mb->have_face_r_gen)
+        _face_r_gen[i] = r[fc_size + sizeof(cs_lnum_t)];
+      else
+        _face_r_gen[i] = 0;
+    }
+
+    BFT_FREE(p_rec);
+  }
 
   /* Now convert face -> cell connectivity to local cell numbers */
 
@@ -1186,38 +1245,11 @@ _decompose_data_g(cs_mesh_t          *mesh,
 
   BFT_FREE(_face_gcells);
 
-  /* Face family */
-
-  BFT_MALLOC(_face_gc_id, _n_faces, cs_lnum_t);
-
-  cs_all_to_all_copy_array(d,
-                           CS_LNUM_TYPE,
-                           1,
-                           true,  /* reverse */
-                           mb->face_gc_id,
-                           _face_gc_id);
-
-  BFT_FREE(mb->face_gc_id);
-
-  /* Face level */
-
-  BFT_MALLOC(_face_r_gen, _n_faces, char);
+  /* Face connectivity; reads of face -> vertices connectivity and vertex
+     coordinates may have been in progress while the data above was
+     distributed, so they must be completed first */
 
-  if (mb->have_face_r_gen)
-    cs_all_to_all_copy_array(d,
-                             CS_CHAR,
-                             1,
-                             true,  /* reverse */
-                             mb->face_r_gen,
-                             _face_r_gen);
-  else {
-    for (cs_lnum_t i = 0; i < _n_faces; i++)
-      _face_r_gen[i] = 0;
-  }
-
-  BFT_FREE(mb->face_r_gen);
-
-  /* Face connectivity */
+  cs_mesh_builder_complete_input(mb);
 
   BFT_MALLOC(_face_vertices_idx, _n_faces + 1, cs_lnum_t);
 
@@ -1411,6 +1443,8 @@ _decompose_data_l(cs_mesh_t          *mesh,
 
   assert((sizeof(cs_lnum_t) == 4) || (sizeof(cs_lnum_t) == 8));
 
+  cs_mesh_builder_complete_input(mb);
+
   mesh->n_cells = mb->cell_bi.gnum_range[1] - 1;
   mesh->n_cells_with_ghosts = mesh->n_cells; /* may be increased later */
 
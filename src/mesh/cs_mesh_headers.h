@@ -45,6 +45,7 @@
 #include "cs_mesh_bad_cells.h"
 #include "cs_mesh_boundary.h"
 #include "cs_mesh_boundary_layer.h"
+#include "cs_mesh_box_index.h"
 #include "cs_mesh_builder.h"
 #include "cs_mesh_coarsen.h"
 #include "cs_mesh_coherency.h"
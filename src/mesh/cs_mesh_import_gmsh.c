@@ -0,0 +1,1884 @@
+/*============================================================================
+ * Direct parallel import of Gmsh meshes to a mesh builder.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_all_to_all.h"
+#include "cs_block_dist.h"
+#include "cs_file.h"
+#include "cs_order.h"
+#include "cs_parall.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_mesh_import_gmsh.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
+
+/* Size of buffer used for the (replicated) parsing of file headers */
+
+#define _GMSH_BUF_SIZE 65536
+
+/* Maximum line length for ASCII parts of files */
+
+#define _GMSH_LINE_SIZE 512
+
+/* Stride of face description records used for face matching:
+   cell number, group class id, and 4 vertex numbers (0 for triangles) */
+
+#define _FACE_REC_STRIDE 6
+
+/*============================================================================
+ * Local Type Definitions
+ *============================================================================*/
+
+/* Buffered reader for the file sections parsed identically on all ranks */
+
+typedef struct {
+
+  cs_file_t       *f;          /* Associated file */
+  cs_file_off_t    size;       /* File size */
+  cs_file_off_t    buf_start;  /* File offset matching start of buffer */
+  size_t           buf_pos;    /* Current position in buffer */
+  size_t           buf_len;    /* Number of valid bytes in buffer */
+  unsigned char   *buf;        /* Buffer */
+  bool             swap;       /* Swap bytes of binary data ? */
+
+} _gmsh_reader_t;
+
+/* Node or element block (one per Gmsh entity) */
+
+typedef struct {
+
+  int              type;       /* Gmsh element type, or 0 for nodes */
+  int              stride;     /* Number of 8-byte values per element
+                                  (tag included), or per node coordinate */
+  int              gc_id;      /* Group class id (0 if none) */
+  cs_gnum_t        n_ents;     /* Number of nodes or elements in block */
+  cs_gnum_t        shift;      /* Number of entities in preceding blocks
+                                  of the same category */
+  cs_file_off_t    offset;     /* Offset of block data in file */
+
+} _gmsh_block_t;
+
+/* Gmsh import structure */
+
+struct _cs_mesh_import_gmsh_t {
+
+  cs_gnum_t        n_g_cells;              /* Global number of cells */
+  cs_gnum_t        n_g_faces;              /* Global number of faces */
+  cs_gnum_t        n_g_vertices;           /* Global number of vertices */
+  cs_gnum_t        n_g_face_connect_size;  /* Global connectivity size */
+
+  cs_lnum_t        n_cells;        /* Local number of cells */
+  cs_gnum_t        cell_gnum_0;    /* Global number of first local cell */
+  int             *cell_gc_id;     /* Cell group class ids */
+
+  cs_lnum_t        n_faces;        /* Local number of faces */
+  cs_gnum_t       *face_gnum;      /* Face global numbers */
+  cs_gnum_t       *face_cells;     /* Face -> cells connectivity */
+  cs_lnum_t       *face_vtx_idx;   /* Face -> vertices index */
+  cs_gnum_t       *face_vtx;       /* Face -> vertices connectivity */
+  int             *face_gc_id;     /* Face group class ids */
+
+  cs_lnum_t        n_vertices;     /* Local number of vertices */
+  cs_gnum_t       *vertex_gnum;    /* Vertex global numbers */
+  cs_real_t       *vertex_coords;  /* Vertex coordinates */
+
+};
+
+/* Outward faces of cells in Gmsh local vertex numbering
+   (-1 marking the missing fourth vertex of triangles) */
+
+typedef struct {
+
+  int  n_vertices;
+  int  n_faces;
+  int  face_vtx[6][4];
+
+} _gmsh_cell_faces_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static const _gmsh_cell_faces_t _tetra_faces
+  = {4, 4, {{0, 2, 1, -1}, {0, 1, 3, -1}, {0, 3, 2, -1}, {1, 2, 3, -1}}};
+
+static const _gmsh_cell_faces_t _pyram_faces
+  = {5, 5, {{0, 3, 2, 1}, {0, 1, 4, -1}, {1, 2, 4, -1}, {2, 3, 4, -1},
+            {3, 0, 4, -1}}};
+
+static const _gmsh_cell_faces_t _prism_faces
+  = {6, 5, {{0, 2, 1, -1}, {3, 4, 5, -1}, {0, 1, 4, 3}, {1, 2, 5, 4},
+            {0, 3, 5, 2}}};
+
+static const _gmsh_cell_faces_t _hexa_faces
+  = {8, 6, {{0, 3, 2, 1}, {4, 5, 6, 7}, {0, 1, 5, 4}, {1, 2, 6, 5},
+            {2, 3, 7, 6}, {0, 4, 7, 3}}};
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Return number of nodes for a Gmsh element type.
+ *
+ * Only linear cells and faces, and element types which may be safely
+ * ignored (points and lines), are handled.
+ *
+ * parameters:
+ *   type <-- Gmsh element type
+ *   dim  --> element dimension
+ *
+ * returns:
+ *   number of element nodes, or -1 for unhandled types
+ *----------------------------------------------------------------------------*/
+
+static int
+_gmsh_type_n_nodes(int   type,
+                   int  *dim)
+{
+  int n_nodes = -1;
+
+  switch(type) {
+  case 15: *dim = 0; n_nodes = 1; break;  /* point */
+  case 1:  *dim = 1; n_nodes = 2; break;  /* line */
+  case 8:  *dim = 1; n_nodes = 3; break;  /* 2nd order line */
+  case 26: *dim = 1; n_nodes = 4; break;  /* 3rd order line */
+  case 27: *dim = 1; n_nodes = 5; break;  /* 4th order line */
+  case 28: *dim = 1; n_nodes = 6; break;  /* 5th order line */
+  case 2:  *dim = 2; n_nodes = 3; break;  /* triangle */
+  case 3:  *dim = 2; n_nodes = 4; break;  /* quadrangle */
+  case 4:  *dim = 3; n_nodes = 4; break;  /* tetrahedron */
+  case 5:  *dim = 3; n_nodes = 8; break;  /* hexahedron */
+  case 6:  *dim = 3; n_nodes = 6; break;  /* prism */
+  case 7:  *dim = 3; n_nodes = 5; break;  /* pyramid */
+  default:
+    *dim = -1;
+  }
+
+  return n_nodes;
+}
+
+/*----------------------------------------------------------------------------
+ * Return face definitions associated with a Gmsh cell type.
+ *
+ * parameters:
+ *   type <-- Gmsh element type
+ *
+ * returns:
+ *   pointer to cell faces definition
+ *----------------------------------------------------------------------------*/
+
+static const _gmsh_cell_faces_t *
+_gmsh_cell_faces(int  type)
+{
+  switch(type) {
+  case 4:
+    return &_tetra_faces;
+  case 5:
+    return &_hexa_faces;
+  case 6:
+    return &_prism_faces;
+  case 7:
+    return &_pyram_faces;
+  default:
+    assert(0);
+  }
+
+  return NULL;
+}
+
+/*----------------------------------------------------------------------------
+ * Swap bytes of an array of values.
+ *
+ * parameters:
+ *   buf  <-> buffer
+ *   size <-- size of each value
+ *   n    <-- number of values
+ *----------------------------------------------------------------------------*/
+
+static void
+_swap_bytes(void    *buf,
+            size_t   size,
+            size_t   n)
+{
+  unsigned char *_buf = buf;
+
+  for (size_t i = 0; i < n; i++) {
+    unsigned char *p = _buf + i*size;
+    for (size_t j = 0; j < size/2; j++) {
+      unsigned char tmp = p[j];
+      p[j] = p[size - 1 - j];
+      p[size - 1 - j] = tmp;
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Return current position of reader in file.
+ *
+ * parameters:
+ *   r <-- pointer to reader
+ *
+ * returns:
+ *   current offset
+ *----------------------------------------------------------------------------*/
+
+static inline cs_file_off_t
+_reader_tell(const _gmsh_reader_t  *r)
+{
+  return r->buf_start + (cs_file_off_t)(r->buf_pos);
+}
+
+/*----------------------------------------------------------------------------
+ * Refill a reader's buffer if all its contents have been consumed.
+ *
+ * parameters:
+ *   r <-> pointer to reader
+ *
+ * returns:
+ *   number of bytes available in buffer
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_reader_fill(_gmsh_reader_t  *r)
+{
+  if (r->buf_pos >= r->buf_len) {
+
+    r->buf_start += r->buf_len;
+    r->buf_pos = 0;
+    r->buf_len = 0;
+
+    if (r->buf_start < r->size) {
+      cs_file_off_t n = r->size - r->buf_start;
+      r->buf_len = (n > _GMSH_BUF_SIZE) ? _GMSH_BUF_SIZE : n;
+      cs_file_seek(r->f, r->buf_start, CS_FILE_SEEK_SET);
+      cs_file_read_global(r->f, r->buf, 1, r->buf_len);
+    }
+
+  }
+
+  return r->buf_len - r->buf_pos;
+}
+
+/*----------------------------------------------------------------------------
+ * Move a reader's position to a given file offset.
+ *
+ * parameters:
+ *   r      <-> pointer to reader
+ *   offset <-- new offset
+ *----------------------------------------------------------------------------*/
+
+static void
+_reader_seek(_gmsh_reader_t  *r,
+             cs_file_off_t    offset)
+{
+  if (   offset >= r->buf_start
+      && offset < r->buf_start + (cs_file_off_t)(r->buf_len))
+    r->buf_pos = offset - r->buf_start;
+  else {
+    r->buf_start = offset;
+    r->buf_pos = 0;
+    r->buf_len = 0;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Read binary values using a reader.
+ *
+ * parameters:
+ *   r    <-> pointer to reader
+ *   buf  --> buffer receiving values
+ *   size <-- size of each value
+ *   n    <-- number of values
+ *----------------------------------------------------------------------------*/
+
+static void
+_reader_read(_gmsh_reader_t  *r,
+             void            *buf,
+             size_t           size,
+             size_t           n)
+{
+  unsigned char *_buf = buf;
+  size_t n_bytes = size*n;
+
+  while (n_bytes > 0) {
+    size_t n_avail = _reader_fill(r);
+    if (n_avail == 0)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Premature end of file \"%s\""), cs_file_get_name(r->f));
+    size_t n_copy = (n_avail < n_bytes) ? n_avail : n_bytes;
+    memcpy(_buf, r->buf + r->buf_pos, n_copy);
+    r->buf_pos += n_copy;
+    _buf += n_copy;
+    n_bytes -= n_copy;
+  }
+
+  if (r->swap && size > 1)
+    _swap_bytes(buf, size, n);
+}
+
+/*----------------------------------------------------------------------------
+ * Read a size value (stored on 8 bytes) using a reader.
+ *
+ * parameters:
+ *   r <-> pointer to reader
+ *
+ * returns:
+ *   value read
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t
+_reader_read_size(_gmsh_reader_t  *r)
+{
+  uint64_t val;
+  _reader_read(r, &val, 8, 1);
+
+  return val;
+}
+
+/*----------------------------------------------------------------------------
+ * Read a line of text using a reader.
+ *
+ * The end of line character(s) are removed.
+ *
+ * parameters:
+ *   r    <-> pointer to reader
+ *   line --> buffer receiving line (size: _GMSH_LINE_SIZE)
+ *
+ * returns:
+ *   true if a line was read, false at end of file
+ *----------------------------------------------------------------------------*/
+
+static bool
+_reader_read_line(_gmsh_reader_t  *r,
+                  char             line[_GMSH_LINE_SIZE])
+{
+  size_t l = 0;
+
+  if (_reader_fill(r) == 0)
+    return false;
+
+  while (_reader_fill(r) > 0) {
+    char c = r->buf[r->buf_pos++];
+    if (c == '\n')
+      break;
+    if (l < _GMSH_LINE_SIZE - 1)
+      line[l++] = c;
+  }
+
+  while (l > 0 && (line[l-1] == '\r' || line[l-1] == ' '))
+    l--;
+  line[l] = '\0';
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Skip to the end of the current section.
+ *
+ * parameters:
+ *   r        <-> pointer to reader
+ *   sec_name <-- section name (without leading '$')
+ *----------------------------------------------------------------------------*/
+
+static void
+_reader_end_section(_gmsh_reader_t  *r,
+                    const char      *sec_name)
+{
+  char line[_GMSH_LINE_SIZE];
+
+  while (_reader_read_line(r, line)) {
+    if (strncmp(line, "$End", 4) == 0) {
+      if (strcmp(line + 4, sec_name) != 0)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("Gmsh file \"%s\":\n"
+                    "  \"%s\" found while \"$End%s\" was expected."),
+                  cs_file_get_name(r->f), line, sec_name);
+      return;
+    }
+  }
+
+  bft_error(__FILE__, __LINE__, 0,
+            _("Gmsh file \"%s\":\n"
+              "  premature end of file in section \"%s\"."),
+            cs_file_get_name(r->f), sec_name);
+}
+
+/*----------------------------------------------------------------------------
+ * Handle a periodic section, which is not supported.
+ *
+ * Ignoring it would silently build a non-periodic mesh, so this is an
+ * error.
+ *
+ * parameters:
+ *   path <-- file path
+ *----------------------------------------------------------------------------*/
+
+static void
+_periodic_error(const char  *path)
+{
+  bft_error(__FILE__, __LINE__, 0,
+            _("Gmsh file \"%s\":\n"
+              "  periodic node correspondences (\"$Periodic\" section)"
+              " are not handled.\n"
+              "  Export the mesh without periodicity, and define it"
+              " using face joining\n"
+              "  in the mesh preprocessing options instead."),
+            path);
+}
+
+/*----------------------------------------------------------------------------
+ * Return id of a group name, adding it if not already present.
+ *
+ * parameters:
+ *   name     <-- group name
+ *   n_groups <-> number of groups
+ *   groups   <-> group names
+ *
+ * returns:
+ *   group id
+ *----------------------------------------------------------------------------*/
+
+static int
+_group_id(const char    *name,
+          int           *n_groups,
+          char        ***groups)
+{
+  int g_id;
+
+  for (g_id = 0; g_id < *n_groups; g_id++) {
+    if (strcmp((*groups)[g_id], name) == 0)
+      return g_id;
+  }
+
+  BFT_REALLOC(*groups, g_id + 1, char *);
+  BFT_MALLOC((*groups)[g_id], strlen(name) + 1, char);
+  strcpy((*groups)[g_id], name);
+
+  *n_groups += 1;
+
+  return g_id;
+}
+
+/*----------------------------------------------------------------------------
+ * Read Gmsh physical names section.
+ *
+ * parameters:
+ *   r        <-> pointer to reader
+ *   n_names  --> number of physical names
+ *   pn_dim   --> physical name dimension
+ *   pn_tag   --> physical name tag
+ *   pn_name  --> physical name
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_physical_names(_gmsh_reader_t    *r,
+                     int               *n_names,
+                     int              **pn_dim,
+                     int              **pn_tag,
+                     char            ***pn_name)
+{
+  char line[_GMSH_LINE_SIZE];
+
+  int n = 0;
+
+  if (_reader_read_line(r, line))
+    n = atoi(line);
+
+  BFT_MALLOC(*pn_dim, n, int);
+  BFT_MALLOC(*pn_tag, n, int);
+  BFT_MALLOC(*pn_name, n, char *);
+
+  for (int i = 0; i < n; i++) {
+
+    int dim = -1, tag = -1;
+    char *s = NULL, *e = NULL;
+
+    if (_reader_read_line(r, line)) {
+      sscanf(line, "%d %d", &dim, &tag);
+      s = strchr(line, '"');
+      if (s != NULL)
+        e = strchr(s + 1, '"');
+    }
+    if (e == NULL)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Gmsh file \"%s\":\n"
+                  "  error reading physical names."),
+                cs_file_get_name(r->f));
+
+    *e = '\0';
+    (*pn_dim)[i] = dim;
+    (*pn_tag)[i] = tag;
+    BFT_MALLOC((*pn_name)[i], strlen(s + 1) + 1, char);
+    strcpy((*pn_name)[i], s + 1);
+
+  }
+
+  *n_names = n;
+
+  _reader_end_section(r, "PhysicalNames");
+}
+
+/*----------------------------------------------------------------------------
+ * Read Gmsh entities section, building groups and group classes.
+ *
+ * A group class is defined for each surface or volume entity
+ * belonging to at least one physical group.
+ *
+ * parameters:
+ *   r            <-> pointer to reader
+ *   n_names      <-- number of physical names
+ *   pn_dim       <-- physical name dimension
+ *   pn_tag       <-- physical name tag
+ *   pn_name      <-- physical name
+ *   gc_id_shift  <-- group class id shift
+ *   n_groups     <-> number of groups
+ *   groups       <-> group names
+ *   n_gc         <-> number of group classes
+ *   gc_idx       <-> group class -> groups index
+ *   gc_groups    <-> group class -> groups values
+ *   n_entities   --> number of surface and volume entities
+ *   entity_gc_id --> entity (dim - 2, tag, group class id) triplets
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_entities(_gmsh_reader_t    *r,
+               int                n_names,
+               const int          pn_dim[],
+               const int          pn_tag[],
+               char              *pn_name[],
+               int                gc_id_shift,
+               int               *n_groups,
+               char            ***groups,
+               int               *n_gc,
+               int              **gc_idx,
+               int              **gc_groups,
+               cs_lnum_t         *n_entities,
+               int              **entity_gc_id)
+{
+  cs_gnum_t n_ent[4];
+  int *phys = NULL;
+  size_t n_phys_max = 0;
+
+  for (int i = 0; i < 4; i++)
+    n_ent[i] = _reader_read_size(r);
+
+  *n_entities = n_ent[2] + n_ent[3];
+  BFT_MALLOC(*entity_gc_id, 3*(*n_entities), int);
+
+  BFT_MALLOC(*gc_idx, *n_entities + 1, int);
+  (*gc_idx)[0] = 0;
+  *gc_groups = NULL;
+  *n_gc = 0;
+
+  cs_lnum_t e_id = 0;
+
+  for (int dim = 0; dim < 4; dim++) {
+
+    for (cs_gnum_t i = 0; i < n_ent[dim]; i++) {
+
+      int tag;
+      double bbox[6];
+
+      _reader_read(r, &tag, sizeof(int), 1);
+      _reader_read(r, bbox, sizeof(double), (dim == 0) ? 3 : 6);
+
+      size_t n_phys = _reader_read_size(r);
+      if (n_phys > n_phys_max) {
+        n_phys_max = n_phys;
+        BFT_REALLOC(phys, n_phys_max, int);
+      }
+      _reader_read(r, phys, sizeof(int), n_phys);
+
+      if (dim > 0) {
+        size_t n_bound = _reader_read_size(r);
+        _reader_seek(r, _reader_tell(r) + n_bound*sizeof(int));
+      }
+
+      if (dim < 2)
+        continue;
+
+      /* Define group class based on physical groups */
+
+      int gc_id = 0;
+
+      if (n_phys > 0) {
+        int s_id = (*gc_idx)[*n_gc];
+        BFT_REALLOC(*gc_groups, s_id + n_phys, int);
+        for (size_t j = 0; j < n_phys; j++) {
+          char tag_name[32];
+          const char *name = NULL;
+          for (int k = 0; k < n_names && name == NULL; k++) {
+            if (pn_dim[k] == dim && pn_tag[k] == phys[j])
+              name = pn_name[k];
+          }
+          if (name == NULL) {
+            snprintf(tag_name, 31, "%d", phys[j]);
+            tag_name[31] = '\0';
+            name = tag_name;
+          }
+          (*gc_groups)[s_id + j] = _group_id(name, n_groups, groups);
+        }
+        (*gc_idx)[*n_gc + 1] = s_id + n_phys;
+        *n_gc += 1;
+        gc_id = gc_id_shift + *n_gc;
+      }
+
+      (*entity_gc_id)[e_id*3]     = dim - 2;
+      (*entity_gc_id)[e_id*3 + 1] = tag;
+      (*entity_gc_id)[e_id*3 + 2] = gc_id;
+      e_id++;
+
+    }
+
+  }
+
+  BFT_FREE(phys);
+
+  _reader_end_section(r, "Entities");
+}
+
+/*----------------------------------------------------------------------------
+ * Return group class id of a surface or volume entity.
+ *
+ * parameters:
+ *   dim          <-- entity dimension
+ *   tag          <-- entity tag
+ *   n_entities   <-- number of surface and volume entities
+ *   entity_gc_id <-- entity (dim - 2, tag, group class id) triplets
+ *
+ * returns:
+ *   group class id, or 0
+ *----------------------------------------------------------------------------*/
+
+static int
+_entity_gc_id(int         dim,
+              int         tag,
+              cs_lnum_t   n_entities,
+              const int   entity_gc_id[])
+{
+  for (cs_lnum_t i = 0; i < n_entities; i++) {
+    if (entity_gc_id[i*3] == dim - 2 && entity_gc_id[i*3 + 1] == tag)
+      return entity_gc_id[i*3 + 2];
+  }
+
+  return 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Append groups and group classes to mesh.
+ *
+ * parameters:
+ *   mesh      <-> pointer to mesh structure
+ *   n_groups  <-- number of groups to add
+ *   groups    <-- group names
+ *   n_gc      <-- number of group classes to add
+ *   gc_idx    <-- group class -> groups index
+ *   gc_groups <-- group class -> groups values
+ *----------------------------------------------------------------------------*/
+
+static void
+_append_group_classes(cs_mesh_t   *mesh,
+                      int          n_groups,
+                      char        *groups[],
+                      int          n_gc,
+                      const int    gc_idx[],
+                      const int    gc_groups[])
+{
+  int n_groups_prev = mesh->n_groups;
+
+  /* Groups */
+
+  if (n_groups > 0) {
+
+    size_t s_id = 0;
+    if (mesh->group_idx == NULL) {
+      BFT_MALLOC(mesh->group_idx, n_groups + 1, int);
+      mesh->group_idx[0] = 0;
+    }
+    else {
+      BFT_REALLOC(mesh->group_idx, mesh->n_groups + n_groups + 1, int);
+      s_id = mesh->group_idx[mesh->n_groups];
+    }
+
+    size_t l = 0;
+    for (int i = 0; i < n_groups; i++)
+      l += strlen(groups[i]) + 1;
+    BFT_REALLOC(mesh->group, s_id + l, char);
+
+    for (int i = 0; i < n_groups; i++) {
+      int j = mesh->n_groups + i;
+      strcpy(mesh->group + mesh->group_idx[j], groups[i]);
+      mesh->group_idx[j+1] = mesh->group_idx[j] + strlen(groups[i]) + 1;
+    }
+
+    mesh->n_groups += n_groups;
+
+  }
+
+  /* Group classes */
+
+  if (n_gc > 0) {
+
+    int n_fam_prev = mesh->n_families;
+    int n_fam = n_fam_prev + n_gc;
+    int n_items_max = mesh->n_max_family_items;
+
+    for (int i = 0; i < n_gc; i++) {
+      if (gc_idx[i+1] - gc_idx[i] > n_items_max)
+        n_items_max = gc_idx[i+1] - gc_idx[i];
+    }
+
+    int *family_item;
+    BFT_MALLOC(family_item, n_fam*n_items_max, int);
+
+    for (int j = 0; j < n_items_max; j++) {
+      for (int i = 0; i < n_fam_prev; i++) {
+        if (j < mesh->n_max_family_items)
+          family_item[n_fam*j + i] = mesh->family_item[n_fam_prev*j + i];
+        else
+          family_item[n_fam*j + i] = 0;
+      }
+      for (int i = 0; i < n_gc; i++) {
+        int k = gc_idx[i] + j;
+        if (k < gc_idx[i+1])
+          family_item[n_fam*j + n_fam_prev + i]
+            = -(n_groups_prev + gc_groups[k] + 1);
+        else
+          family_item[n_fam*j + n_fam_prev + i] = 0;
+      }
+    }
+
+    BFT_FREE(mesh->family_item);
+    mesh->family_item = family_item;
+    mesh->n_families = n_fam;
+    mesh->n_max_family_items = n_items_max;
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Compute the range of a block's entities read by the local rank.
+ *
+ * Ranges are based on the intersection of the block with the local part
+ * of a block distribution of all entities of the same category, so
+ * that they are contiguous across ranks, as required by cs_file_read_block.
+ *
+ * parameters:
+ *   b     <-- pointer to node or element block
+ *   range <-- local global number range for entity category
+ *   s     --> start number in block (1 to n)
+ *   e     --> past-the-end number in block (1 to n)
+ *----------------------------------------------------------------------------*/
+
+static void
+_block_range(const _gmsh_block_t  *b,
+             const cs_gnum_t       range[2],
+             cs_gnum_t            *s,
+             cs_gnum_t            *e)
+{
+  cs_gnum_t b_s = b->shift + 1, b_e = b->shift + b->n_ents + 1;
+
+  *s = CS_MIN(CS_MAX(range[0], b_s), b_e) - b->shift;
+  *e = CS_MIN(CS_MAX(range[1], b_s), b_e) - b->shift;
+}
+
+/*----------------------------------------------------------------------------
+ * Read nodes assigned to the local rank.
+ *
+ * parameters:
+ *   gi            <-> pointer to Gmsh import structure
+ *   f             <-> pointer to file
+ *   n_blocks      <-- number of node blocks
+ *   blocks        <-- node blocks
+ *   range         <-- local node range in node block distribution
+ *   min_tag       <-- minimum node tag
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_nodes(cs_mesh_import_gmsh_t  *gi,
+            cs_file_t              *f,
+            int                     n_blocks,
+            const _gmsh_block_t     blocks[],
+            const cs_gnum_t         range[2],
+            cs_gnum_t               min_tag)
+{
+  cs_lnum_t n_vertices = range[1] - range[0];
+
+  gi->n_vertices = n_vertices;
+  BFT_MALLOC(gi->vertex_gnum, n_vertices, cs_gnum_t);
+  BFT_MALLOC(gi->vertex_coords, n_vertices*3, cs_real_t);
+
+  cs_lnum_t v_id = 0;
+
+  for (int b_id = 0; b_id < n_blocks; b_id++) {
+
+    const _gmsh_block_t *b = blocks + b_id;
+    cs_gnum_t s, e;
+
+    if (b->n_ents == 0)
+      continue;
+
+    _block_range(b, range, &s, &e);
+
+    cs_lnum_t n = e - s;
+    uint64_t *tags;
+    double *coords;
+
+    BFT_MALLOC(tags, n, uint64_t);
+    BFT_MALLOC(coords, n*b->stride, double);
+
+    cs_file_seek(f, b->offset, CS_FILE_SEEK_SET);
+    cs_file_read_block(f, tags, 8, 1, s, e);
+
+    cs_file_seek(f,
+                 b->offset + (cs_file_off_t)(b->n_ents)*8,
+                 CS_FILE_SEEK_SET);
+    cs_file_read_block(f, coords, 8, b->stride, s, e);
+
+    for (cs_lnum_t i = 0; i < n; i++) {
+      cs_gnum_t g = tags[i] - min_tag + 1;
+      if (tags[i] < min_tag || g > gi->n_g_vertices)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("Gmsh file \"%s\":\n"
+                    "  node tag %llu out of range."),
+                  cs_file_get_name(f), (unsigned long long)tags[i]);
+      gi->vertex_gnum[v_id] = g;
+      for (int j = 0; j < 3; j++)
+        gi->vertex_coords[v_id*3 + j] = coords[i*b->stride + j];
+      v_id++;
+    }
+
+    BFT_FREE(coords);
+    BFT_FREE(tags);
+
+  }
+
+  assert(v_id == n_vertices);
+}
+
+/*----------------------------------------------------------------------------
+ * Read elements assigned to the local rank and build associated
+ * face description records.
+ *
+ * For cells, a record is built for each face, with vertices ordered
+ * so that the face is outward; for surface elements, a single record
+ * is built, with a zero cell number.
+ *
+ * parameters:
+ *   f            <-> pointer to file
+ *   n_blocks     <-- number of element blocks
+ *   blocks       <-- element blocks
+ *   range        <-- local element range in element block distribution
+ *   min_tag      <-- minimum node tag
+ *   n_g_vertices <-- global number of vertices
+ *   cell_gc_id   --> cell group class id, or NULL for surface elements
+ *   n_recs       <-> number of face records
+ *   recs         <-> face records
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_elements(cs_file_t            *f,
+               int                   n_blocks,
+               const _gmsh_block_t   blocks[],
+               const cs_gnum_t       range[2],
+               cs_gnum_t             min_tag,
+               cs_gnum_t             n_g_vertices,
+               int                  *cell_gc_id,
+               cs_lnum_t            *n_recs,
+               cs_gnum_t           **recs)
+{
+  cs_lnum_t c_id = 0;
+
+  for (int b_id = 0; b_id < n_blocks; b_id++) {
+
+    const _gmsh_block_t *b = blocks + b_id;
+    cs_gnum_t s, e;
+
+    if (b->n_ents == 0)
+      continue;
+
+    _block_range(b, range, &s, &e);
+
+    cs_lnum_t n = e - s;
+    uint64_t *elts;
+
+    BFT_MALLOC(elts, n*b->stride, uint64_t);
+
+    cs_file_seek(f, b->offset, CS_FILE_SEEK_SET);
+    cs_file_read_block(f, elts, 8, b->stride, s, e);
+
+    for (cs_lnum_t i = 0; i < n*b->stride; i++) {
+      if (i % b->stride == 0)
+        continue;
+      if (elts[i] < min_tag || elts[i] - min_tag + 1 > n_g_vertices)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("Gmsh file \"%s\":\n"
+                    "  node tag %llu out of range."),
+                  cs_file_get_name(f), (unsigned long long)elts[i]);
+      elts[i] = elts[i] - min_tag + 1;
+    }
+
+    if (cell_gc_id != NULL) {
+
+      const _gmsh_cell_faces_t *cf = _gmsh_cell_faces(b->type);
+
+      BFT_REALLOC(*recs, (*n_recs + n*cf->n_faces)*_FACE_REC_STRIDE,
+                  cs_gnum_t);
+
+      for (cs_lnum_t i = 0; i < n; i++) {
+        const uint64_t *e_vtx = elts + i*b->stride + 1;
+        cs_gnum_t c_num = range[0] + c_id;
+        for (int j = 0; j < cf->n_faces; j++) {
+          cs_gnum_t *r = *recs + (*n_recs)*_FACE_REC_STRIDE;
+          r[0] = c_num;
+          r[1] = 0;
+          for (int k = 0; k < 4; k++) {
+            int l = cf->face_vtx[j][k];
+            r[2+k] = (l > -1) ? e_vtx[l] : 0;
+          }
+          *n_recs += 1;
+        }
+        cell_gc_id[c_id++] = b->gc_id;
+      }
+
+    }
+    else {
+
+      int n_vtx = b->stride - 1;
+
+      BFT_REALLOC(*recs, (*n_recs + n)*_FACE_REC_STRIDE, cs_gnum_t);
+
+      for (cs_lnum_t i = 0; i < n; i++) {
+        const uint64_t *e_vtx = elts + i*b->stride + 1;
+        cs_gnum_t *r = *recs + (*n_recs)*_FACE_REC_STRIDE;
+        r[0] = 0;
+        r[1] = b->gc_id;
+        for (int k = 0; k < 4; k++)
+          r[2+k] = (k < n_vtx) ? e_vtx[k] : 0;
+        *n_recs += 1;
+      }
+
+    }
+
+    BFT_FREE(elts);
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Build sorted vertex key of a face record.
+ *
+ * parameters:
+ *   r   <-- face record
+ *   key --> sorted vertex numbers (0 first for triangles)
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_face_key(const cs_gnum_t  r[],
+          cs_gnum_t        key[4])
+{
+  for (int i = 0; i < 4; i++) {
+    cs_gnum_t v = r[2+i];
+    int j = i;
+    while (j > 0 && key[j-1] > v) {
+      key[j] = key[j-1];
+      j--;
+    }
+    key[j] = v;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Match face records and build faces.
+ *
+ * Records must have been distributed so that all records relative to
+ * a given face are on the same rank.
+ *
+ * parameters:
+ *   gi      <-> pointer to Gmsh import structure
+ *   n_recs  <-- number of face records
+ *   recs    <-- face records
+ *   name    <-- file name
+ *----------------------------------------------------------------------------*/
+
+static void
+_match_faces(cs_mesh_import_gmsh_t  *gi,
+             cs_lnum_t               n_recs,
+             const cs_gnum_t         recs[],
+             const char             *name)
+{
+  cs_gnum_t *keys;
+  BFT_MALLOC(keys, n_recs*4, cs_gnum_t);
+
+  for (cs_lnum_t i = 0; i < n_recs; i++)
+    _face_key(recs + i*_FACE_REC_STRIDE, keys + i*4);
+
+  cs_lnum_t *order = cs_order_gnum_s(NULL, keys, 4, n_recs);
+
+  cs_lnum_t n_faces = 0, n_connect = 0;
+
+  BFT_MALLOC(gi->face_cells, n_recs*2, cs_gnum_t);
+  BFT_MALLOC(gi->face_vtx_idx, n_recs + 1, cs_lnum_t);
+  BFT_MALLOC(gi->face_vtx, n_recs*4, cs_gnum_t);
+  BFT_MALLOC(gi->face_gc_id, n_recs, int);
+
+  gi->face_vtx_idx[0] = 0;
+
+  cs_lnum_t s_id = 0;
+
+  while (s_id < n_recs) {
+
+    const cs_gnum_t *k0 = keys + order[s_id]*4;
+    cs_lnum_t e_id = s_id + 1;
+    while (e_id < n_recs) {
+      const cs_gnum_t *k1 = keys + order[e_id]*4;
+      if (k1[0] != k0[0] || k1[1] != k0[1] || k1[2] != k0[2] || k1[3] != k0[3])
+        break;
+      e_id++;
+    }
+
+    const cs_gnum_t *c_r[2] = {NULL, NULL};
+    int n_c = 0, gc_id = 0;
+
+    for (cs_lnum_t i = s_id; i < e_id; i++) {
+      const cs_gnum_t *r = recs + order[i]*_FACE_REC_STRIDE;
+      if (r[0] != 0) {
+        if (n_c > 1)
+          bft_error(__FILE__, __LINE__, 0,
+                    _("Gmsh file \"%s\":\n"
+                      "  face shared by more than 2 cells (cells %llu,"
+                      " %llu and %llu); non-conforming meshes\n"
+                      "  are not handled."),
+                    name, (unsigned long long)c_r[0][0],
+                    (unsigned long long)c_r[1][0],
+                    (unsigned long long)r[0]);
+        c_r[n_c++] = r;
+      }
+      else if ((int)r[1] > gc_id)
+        gc_id = r[1];
+    }
+
+    if (n_c > 0) {
+
+      /* Orient face from the cell with the lowest number */
+
+      if (n_c == 2 && c_r[1][0] < c_r[0][0]) {
+        const cs_gnum_t *tmp = c_r[0];
+        c_r[0] = c_r[1];
+        c_r[1] = tmp;
+      }
+
+      gi->face_cells[n_faces*2] = c_r[0][0];
+      gi->face_cells[n_faces*2 + 1] = (n_c == 2) ? c_r[1][0] : 0;
+      for (int j = 0; j < 4; j++) {
+        if (c_r[0][2+j] != 0)
+          gi->face_vtx[n_connect++] = c_r[0][2+j];
+      }
+      gi->face_gc_id[n_faces] = gc_id;
+      n_faces++;
+      gi->face_vtx_idx[n_faces] = n_connect;
+
+    }
+
+    s_id = e_id;
+
+  }
+
+  BFT_FREE(order);
+  BFT_FREE(keys);
+
+  gi->n_faces = n_faces;
+  BFT_REALLOC(gi->face_cells, n_faces*2, cs_gnum_t);
+  BFT_REALLOC(gi->face_vtx_idx, n_faces + 1, cs_lnum_t);
+  BFT_REALLOC(gi->face_vtx, n_connect, cs_gnum_t);
+  BFT_REALLOC(gi->face_gc_id, n_faces, int);
+
+  /* Global numbering */
+
+  cs_gnum_t counts[2] = {n_faces, n_connect};
+  cs_gnum_t f_shift = 0;
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    cs_gnum_t _n_faces = n_faces;
+    MPI_Exscan(&_n_faces, &f_shift, 1, CS_MPI_GNUM, MPI_SUM,
+               cs_glob_mpi_comm);
+    if (cs_glob_rank_id == 0)
+      f_shift = 0;
+  }
+#endif
+
+  cs_parall_counter(counts, 2);
+
+  gi->n_g_faces = counts[0];
+  gi->n_g_face_connect_size = counts[1];
+
+  BFT_MALLOC(gi->face_gnum, n_faces, cs_gnum_t);
+  for (cs_lnum_t i = 0; i < n_faces; i++)
+    gi->face_gnum[i] = f_shift + i + 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute destination ranks and ids of entities in the builder's block
+ * distribution, for entities appended after those of preceding files.
+ *
+ * parameters:
+ *   n         <-- number of entities
+ *   gnum      <-- entity global numbers in file, or NULL if contiguous
+ *   gnum_0    <-- global number of first entity if gnum is NULL
+ *   g_shift   <-- global number of entities in preceding files
+ *   bi        <-- builder block distribution info
+ *   dest_rank --> destination rank
+ *   dest_id   --> destination id, relative to first entity of this
+ *                 file on destination rank
+ *----------------------------------------------------------------------------*/
+
+static void
+_block_dest(cs_lnum_t                n,
+            const cs_gnum_t          gnum[],
+            cs_gnum_t                gnum_0,
+            cs_gnum_t                g_shift,
+            cs_block_dist_info_t     bi,
+            int                      dest_rank[],
+            cs_lnum_t                dest_id[])
+{
+  for (cs_lnum_t i = 0; i < n; i++) {
+    cs_gnum_t g = ((gnum != NULL) ? gnum[i] : gnum_0 + i) + g_shift;
+    cs_gnum_t b_id = (g - 1) / bi.block_size;
+    cs_gnum_t r_s = b_id*bi.block_size + 1;
+    dest_rank[i] = b_id*bi.rank_step;
+    dest_id[i] = g - CS_MAX(r_s, g_shift + 1);
+  }
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Check if a mesh file should be read using the Gmsh importer.
+ *
+ * Files with a ".msh" extension are considered to be Gmsh files.
+ *
+ * parameters:
+ *   path <-- file path
+ *
+ * returns:
+ *   true if the file is a Gmsh file, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_mesh_import_gmsh_check_file(const char  *path)
+{
+  if (path == NULL)
+    return false;
+
+  return (cs_file_endswith(path, ".msh") != 0);
+}
+
+/*----------------------------------------------------------------------------
+ * Read a Gmsh mesh file and build the matching face-based description.
+ *
+ * Only the binary variant of the Gmsh 4.1 format is handled, as it allows
+ * reading node and element sections in parallel. Linear tetrahedra,
+ * pyramids, prisms and hexahedra define cells; triangles and quadrangles
+ * are only used to assign group classes to faces. Physical groups are
+ * converted to mesh groups. Periodic node correspondences are not
+ * handled, so files containing them are rejected.
+ *
+ * Faces are built from cells and matched in parallel, with data
+ * distributed in blocks based on the file's own element numbering.
+ *
+ * The mesh global dimensions, groups and group classes, and the builder's
+ * global face counts, are updated so as to account for this file.
+ *
+ * This is a collective operation.
+ *
+ * parameters:
+ *   path <-- file path
+ *   mesh <-> pointer to mesh structure
+ *   mb   <-> pointer to mesh builder structure
+ *
+ * returns:
+ *   pointer to Gmsh import structure
+ *----------------------------------------------------------------------------*/
+
+cs_mesh_import_gmsh_t *
+cs_mesh_import_gmsh_create(const char         *path,
+                           cs_mesh_t          *mesh,
+                           cs_mesh_builder_t  *mb)
+{
+  char line[_GMSH_LINE_SIZE];
+
+  int n_names = 0, n_groups = 0, n_gc = 0;
+  int *pn_dim = NULL, *pn_tag = NULL, *gc_idx = NULL, *gc_groups = NULL;
+  char **pn_name = NULL, **groups = NULL;
+
+  cs_lnum_t n_entities = 0;
+  int *entity_gc_id = NULL;
+
+  int n_blocks[3] = {0, 0, 0};  /* nodes, cells, surface elements */
+  _gmsh_block_t *blocks[3] = {NULL, NULL, NULL};
+  cs_gnum_t n_g_ents[3] = {0, 0, 0};
+  cs_gnum_t min_node_tag = 1;
+
+  bool nodes_read = false, elements_read = false;
+
+  const int gc_id_shift = mesh->n_families;
+
+  int rank_step = 1;
+  int min_block_size = 0;
+  cs_file_access_t method;
+  cs_file_t *f = NULL;
+
+  /* Open file */
+
+#if defined(HAVE_MPI)
+  {
+    MPI_Info  hints;
+    MPI_Comm  block_comm, comm;
+    cs_file_get_default_access(CS_FILE_MODE_READ, &method, &hints);
+    cs_file_get_default_comm(&rank_step, &min_block_size, &block_comm, &comm);
+    f = cs_file_open(path, CS_FILE_MODE_READ, method, hints, block_comm, comm);
+  }
+#else
+  cs_file_get_default_access(CS_FILE_MODE_READ, &method);
+  f = cs_file_open(path, CS_FILE_MODE_READ, method);
+#endif
+
+  rank_step = CS_MAX(rank_step, mb->min_rank_step);
+
+  _gmsh_reader_t r;
+  r.f = f;
+  r.size = 0;
+  r.buf_start = 0;
+  r.buf_pos = 0;
+  r.buf_len = 0;
+  r.swap = false;
+  BFT_MALLOC(r.buf, _GMSH_BUF_SIZE, unsigned char);
+
+  if (cs_glob_rank_id < 1)
+    r.size = cs_file_size(path);
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    long long _size = r.size;
+    MPI_Bcast(&_size, 1, MPI_LONG_LONG, 0, cs_glob_mpi_comm);
+    r.size = _size;
+  }
+#endif
+
+  /* Parse file sections (all ranks read the same header data) */
+
+  if (   _reader_read_line(&r, line) == false
+      || strcmp(line, "$MeshFormat") != 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("File \"%s\" is not a Gmsh mesh file."), path);
+
+  {
+    double version = 0;
+    int file_type = -1, data_size = 0, one = 0;
+
+    _reader_read_line(&r, line);
+    sscanf(line, "%lf %d %d", &version, &file_type, &data_size);
+
+    if (version < 4.1 || version >= 5.0 || file_type != 1 || data_size != 8)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Gmsh file \"%s\":\n"
+                  "  format \"%s\" is not handled for direct import;\n"
+                  "  only the binary Gmsh 4.1 format"
+                  " (with 8-byte sizes) is handled."),
+                path, line);
+
+    _reader_read(&r, &one, sizeof(int), 1);
+    if (one != 1) {
+      _swap_bytes(&one, sizeof(int), 1);
+      if (one != 1)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("Gmsh file \"%s\":\n"
+                    "  unable to determine binary data endianness."),
+                  path);
+      r.swap = true;
+      cs_file_set_swap_endian(f, 1);
+    }
+
+    _reader_end_section(&r, "MeshFormat");
+  }
+
+  while (elements_read == false && _reader_read_line(&r, line)) {
+
+    if (line[0] == '\0')
+      continue;
+
+    else if (strcmp(line, "$PhysicalNames") == 0)
+      _read_physical_names(&r, &n_names, &pn_dim, &pn_tag, &pn_name);
+
+    else if (strcmp(line, "$Entities") == 0)
+      _read_entities(&r, n_names, pn_dim, pn_tag, pn_name, gc_id_shift,
+                     &n_groups, &groups, &n_gc, &gc_idx, &gc_groups,
+                     &n_entities, &entity_gc_id);
+
+    else if (strcmp(line, "$PartitionedEntities") == 0)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Gmsh file \"%s\":\n"
+                  "  partitioned Gmsh files are not handled."),
+                path);
+
+    else if (strcmp(line, "$Periodic") == 0)
+      _periodic_error(path);
+
+    else if (strcmp(line, "$Nodes") == 0) {
+
+      cs_gnum_t n_ent_blocks = _reader_read_size(&r);
+      n_g_ents[0] = _reader_read_size(&r);
+      min_node_tag = _reader_read_size(&r);
+      cs_gnum_t max_node_tag = _reader_read_size(&r);
+
+      if (n_g_ents[0] > 0 && max_node_tag - min_node_tag + 1 != n_g_ents[0])
+        bft_error(__FILE__, __LINE__, 0,
+                  _("Gmsh file \"%s\":\n"
+                    "  node tags are not contiguous (%llu nodes with tags"
+                    " %llu to %llu);\n"
+                    "  renumber nodes before exporting the mesh."),
+                  path, (unsigned long long)n_g_ents[0],
+                  (unsigned long long)min_node_tag,
+                  (unsigned long long)max_node_tag);
+
+      BFT_MALLOC(blocks[0], n_ent_blocks, _gmsh_block_t);
+
+      cs_gnum_t shift = 0;
+      for (cs_gnum_t i = 0; i < n_ent_blocks; i++) {
+        int b_header[3];
+        _gmsh_block_t *b = blocks[0] + n_blocks[0];
+        _reader_read(&r, b_header, sizeof(int), 3);
+        b->type = 0;
+        b->stride = 3 + ((b_header[2] != 0) ? b_header[0] : 0);
+        b->gc_id = 0;
+        b->n_ents = _reader_read_size(&r);
+        b->shift = shift;
+        b->offset = _reader_tell(&r);
+        shift += b->n_ents;
+        _reader_seek(&r,
+                     b->offset + (cs_file_off_t)(b->n_ents)*(1 + b->stride)*8);
+        n_blocks[0] += 1;
+      }
+
+      _reader_end_section(&r, "Nodes");
+      nodes_read = true;
+
+    }
+
+    else if (strcmp(line, "$Elements") == 0) {
+
+      cs_gnum_t n_ent_blocks = _reader_read_size(&r);
+      for (int i = 0; i < 3; i++)
+        _reader_read_size(&r);
+
+      for (int i = 1; i < 3; i++)
+        BFT_MALLOC(blocks[i], n_ent_blocks, _gmsh_block_t);
+
+      for (cs_gnum_t i = 0; i < n_ent_blocks; i++) {
+        int b_header[3], dim;
+        _reader_read(&r, b_header, sizeof(int), 3);
+        cs_gnum_t n_elts = _reader_read_size(&r);
+        int n_nodes = _gmsh_type_n_nodes(b_header[2], &dim);
+        if (n_nodes < 0)
+          bft_error(__FILE__, __LINE__, 0,
+                    _("Gmsh file \"%s\":\n"
+                      "  element type %d is not handled (only linear"
+                      " elements are handled)."),
+                    path, b_header[2]);
+        cs_file_off_t offset = _reader_tell(&r);
+        int gc_id = (dim > 1) ?
+          _entity_gc_id(dim, b_header[1], n_entities, entity_gc_id) : 0;
+        int c_id = -1;
+        if (dim == 3)
+          c_id = 1;
+        else if (dim == 2 && gc_id > 0)
+          c_id = 2;
+        if (c_id > 0) {
+          _gmsh_block_t *b = blocks[c_id] + n_blocks[c_id];
+          b->type = b_header[2];
+          b->stride = 1 + n_nodes;
+          b->gc_id = gc_id;
+          b->n_ents = n_elts;
+          b->shift = n_g_ents[c_id];
+          b->offset = offset;
+          n_g_ents[c_id] += n_elts;
+          n_blocks[c_id] += 1;
+        }
+        _reader_seek(&r, offset + (cs_file_off_t)(n_elts)*(1 + n_nodes)*8);
+      }
+
+      _reader_end_section(&r, "Elements");
+      elements_read = true;
+
+    }
+
+    else if (line[0] == '$')
+      _reader_end_section(&r, line + 1);
+
+  }
+
+  /* Periodic node correspondences immediately follow elements */
+
+  while (elements_read && _reader_read_line(&r, line)) {
+    if (line[0] == '\0')
+      continue;
+    if (strcmp(line, "$Periodic") == 0)
+      _periodic_error(path);
+    break;
+  }
+
+  BFT_FREE(r.buf);
+
+  if (nodes_read == false || elements_read == false || n_g_ents[1] == 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Gmsh file \"%s\":\n"
+                "  no volume elements found."), path);
+
+  /* Elements not belonging to any physical group are assigned an
+     empty group class, as mesh families are numbered from 1 */
+
+  if (gc_idx == NULL) {
+    BFT_MALLOC(gc_idx, 2, int);
+    gc_idx[0] = 0;
+  }
+  else
+    BFT_REALLOC(gc_idx, n_gc + 2, int);
+
+  gc_idx[n_gc + 1] = gc_idx[n_gc];
+  n_gc += 1;
+
+  const int null_gc_id = gc_id_shift + n_gc;
+
+  /* Add groups and group classes to mesh */
+
+  _append_group_classes(mesh, n_groups, groups, n_gc, gc_idx, gc_groups);
+
+  for (int i = 0; i < n_names; i++)
+    BFT_FREE(pn_name[i]);
+  for (int i = 0; i < n_groups; i++)
+    BFT_FREE(groups[i]);
+  BFT_FREE(pn_name);
+  BFT_FREE(pn_dim);
+  BFT_FREE(pn_tag);
+  BFT_FREE(groups);
+  BFT_FREE(gc_idx);
+  BFT_FREE(gc_groups);
+  BFT_FREE(entity_gc_id);
+
+  /* Read nodes and elements by blocks */
+
+  cs_mesh_import_gmsh_t *gi;
+  BFT_MALLOC(gi, 1, cs_mesh_import_gmsh_t);
+
+  gi->n_g_cells = n_g_ents[1];
+  gi->n_g_vertices = n_g_ents[0];
+
+  cs_block_dist_info_t bi[3];
+
+  bi[0] = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                      cs_glob_n_ranks,
+                                      rank_step,
+                                      min_block_size/(sizeof(cs_real_t)*3),
+                                      n_g_ents[0]);
+  for (int i = 1; i < 3; i++)
+    bi[i] = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                        cs_glob_n_ranks,
+                                        rank_step,
+                                        min_block_size/sizeof(cs_gnum_t),
+                                        n_g_ents[i]);
+
+  _read_nodes(gi, f, n_blocks[0], blocks[0], bi[0].gnum_range, min_node_tag);
+
+  gi->n_cells = bi[1].gnum_range[1] - bi[1].gnum_range[0];
+  gi->cell_gnum_0 = bi[1].gnum_range[0];
+  BFT_MALLOC(gi->cell_gc_id, gi->n_cells, int);
+
+  cs_lnum_t n_recs = 0;
+  cs_gnum_t *recs = NULL;
+
+  _read_elements(f, n_blocks[1], blocks[1], bi[1].gnum_range, min_node_tag,
+                 gi->n_g_vertices, gi->cell_gc_id, &n_recs, &recs);
+  _read_elements(f, n_blocks[2], blocks[2], bi[2].gnum_range, min_node_tag,
+                 gi->n_g_vertices, NULL, &n_recs, &recs);
+
+  for (int i = 0; i < 3; i++)
+    BFT_FREE(blocks[i]);
+
+  cs_file_free(f);
+
+  /* Send face records to the rank owning their highest vertex
+     (in the node block distribution), then match them */
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    int *dest_rank;
+    BFT_MALLOC(dest_rank, n_recs, int);
+
+    for (cs_lnum_t i = 0; i < n_recs; i++) {
+      cs_gnum_t v_max = 0;
+      for (int j = 2; j < _FACE_REC_STRIDE; j++)
+        v_max = CS_MAX(v_max, recs[i*_FACE_REC_STRIDE + j]);
+      dest_rank[i] = ((v_max - 1) / bi[0].block_size) * bi[0].rank_step;
+    }
+
+    cs_all_to_all_t *d = cs_all_to_all_create(n_recs,
+                                              0,
+                                              NULL,
+                                              dest_rank,
+                                              cs_glob_mpi_comm);
+
+    cs_gnum_t *_recs = cs_all_to_all_copy_array(d,
+                                                CS_GNUM_TYPE,
+                                                _FACE_REC_STRIDE,
+                                                false,
+                                                recs,
+                                                NULL);
+
+    n_recs = cs_all_to_all_n_elts_dest(d);
+
+    cs_all_to_all_destroy(&d);
+
+    BFT_FREE(dest_rank);
+    BFT_FREE(recs);
+    recs = _recs;
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  _match_faces(gi, n_recs, recs, path);
+
+  BFT_FREE(recs);
+
+  for (cs_lnum_t i = 0; i < gi->n_cells; i++) {
+    if (gi->cell_gc_id[i] == 0)
+      gi->cell_gc_id[i] = null_gc_id;
+  }
+  for (cs_lnum_t i = 0; i < gi->n_faces; i++) {
+    if (gi->face_gc_id[i] == 0)
+      gi->face_gc_id[i] = null_gc_id;
+  }
+
+  /* Update global dimensions */
+
+  mesh->n_g_cells += gi->n_g_cells;
+  mesh->n_g_vertices += gi->n_g_vertices;
+  mb->n_g_faces += gi->n_g_faces;
+  mb->n_g_face_connect_size += gi->n_g_face_connect_size;
+
+  bft_printf(_("   %llu cells, %llu faces and %llu vertices"
+               " built from Gmsh file.\n"),
+             (unsigned long long)gi->n_g_cells,
+             (unsigned long long)gi->n_g_faces,
+             (unsigned long long)gi->n_g_vertices);
+
+  return gi;
+}
+
+/*----------------------------------------------------------------------------
+ * Transfer data read from a Gmsh file to the mesh builder.
+ *
+ * Data is moved from the file's block distribution to the builder's
+ * block distribution (which must be defined), and appended after
+ * data already read from preceding files.
+ *
+ * This is a collective operation.
+ *
+ * parameters:
+ *   gi      <-- pointer to Gmsh import structure
+ *   mb      <-> pointer to mesh builder structure
+ *   g_shift <-- global number of cells, faces and vertices already read
+ *   l_shift <-- local number of cells, faces, face connectivity values
+ *               and vertices already read
+ *   n_read  --> local number of cells, faces, face connectivity values
+ *               and vertices read
+ *----------------------------------------------------------------------------*/
+
+void
+cs_mesh_import_gmsh_transfer(const cs_mesh_import_gmsh_t  *gi,
+                             cs_mesh_builder_t            *mb,
+                             const cs_gnum_t               g_shift[3],
+                             const cs_lnum_t               l_shift[4],
+                             cs_lnum_t                     n_read[4])
+{
+  cs_lnum_t n_max = CS_MAX(CS_MAX(gi->n_cells, gi->n_faces), gi->n_vertices);
+
+  int *dest_rank;
+  cs_lnum_t *dest_id;
+
+  BFT_MALLOC(dest_rank, n_max, int);
+  BFT_MALLOC(dest_id, n_max, cs_lnum_t);
+
+  /* Allocate for first file read */
+
+  cs_lnum_t n_b_cells = mb->cell_bi.gnum_range[1] - mb->cell_bi.gnum_range[0];
+  cs_lnum_t n_b_faces = mb->face_bi.gnum_range[1] - mb->face_bi.gnum_range[0];
+  cs_lnum_t n_b_vertices = (  mb->vertex_bi.gnum_range[1]
+                            - mb->vertex_bi.gnum_range[0]);
+
+  if (mb->cell_gc_id == NULL)
+    BFT_MALLOC(mb->cell_gc_id, n_b_cells, int);
+  if (mb->face_cells == NULL)
+    BFT_MALLOC(mb->face_cells, n_b_faces*2, cs_gnum_t);
+  if (mb->face_gc_id == NULL)
+    BFT_MALLOC(mb->face_gc_id, n_b_faces, int);
+  if (mb->face_vertices_idx == NULL) {
+    BFT_MALLOC(mb->face_vertices_idx, n_b_faces + 1, cs_lnum_t);
+    mb->face_vertices_idx[0] = 0;
+  }
+  if (mb->vertex_coords == NULL)
+    BFT_MALLOC(mb->vertex_coords, n_b_vertices*3, cs_real_t);
+
+  cs_lnum_t n_cells = 0, n_faces = 0, n_connect = 0, n_vertices = 0;
+  cs_lnum_t *face_vtx_idx = NULL;
+
+  /* Cells */
+
+  _block_dest(gi->n_cells, NULL, gi->cell_gnum_0, g_shift[0], mb->cell_bi,
+              dest_rank, dest_id);
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    cs_all_to_all_t *d = cs_all_to_all_create(gi->n_cells,
+                                              CS_ALL_TO_ALL_USE_DEST_ID,
+                                              dest_id,
+                                              dest_rank,
+                                              cs_glob_mpi_comm);
+
+    n_cells = cs_all_to_all_n_elts_dest(d);
+
+    cs_all_to_all_copy_array(d, CS_INT_TYPE, 1, false,
+                             gi->cell_gc_id, mb->cell_gc_id + l_shift[0]);
+
+    cs_all_to_all_destroy(&d);
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  if (cs_glob_n_ranks == 1) {
+    n_cells = gi->n_cells;
+    for (cs_lnum_t i = 0; i < n_cells; i++)
+      mb->cell_gc_id[l_shift[0] + dest_id[i]] = gi->cell_gc_id[i];
+  }
+
+  /* Faces */
+
+  _block_dest(gi->n_faces, gi->face_gnum, 0, g_shift[1], mb->face_bi,
+              dest_rank, dest_id);
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    cs_all_to_all_t *d = cs_all_to_all_create(gi->n_faces,
+                                              CS_ALL_TO_ALL_USE_DEST_ID,
+                                              dest_id,
+                                              dest_rank,
+                                              cs_glob_mpi_comm);
+
+    n_faces = cs_all_to_all_n_elts_dest(d);
+
+    cs_all_to_all_copy_array(d, CS_GNUM_TYPE, 2, false,
+                             gi->face_cells, mb->face_cells + l_shift[1]*2);
+    cs_all_to_all_copy_array(d, CS_INT_TYPE, 1, false,
+                             gi->face_gc_id, mb->face_gc_id + l_shift[1]);
+
+    BFT_MALLOC(face_vtx_idx, n_faces + 1, cs_lnum_t);
+    cs_all_to_all_copy_index(d, false, gi->face_vtx_idx, face_vtx_idx);
+
+    n_connect = face_vtx_idx[n_faces];
+    BFT_REALLOC(mb->face_vertices, l_shift[2] + n_connect, cs_gnum_t);
+
+    cs_all_to_all_copy_indexed(d, CS_GNUM_TYPE, false,
+                               gi->face_vtx_idx, gi->face_vtx,
+                               face_vtx_idx, mb->face_vertices + l_shift[2]);
+
+    cs_all_to_all_destroy(&d);
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  if (cs_glob_n_ranks == 1) {
+
+    /* Faces are already numbered in local order */
+
+    n_faces = gi->n_faces;
+    n_connect = gi->face_vtx_idx[n_faces];
+
+    BFT_MALLOC(face_vtx_idx, n_faces + 1, cs_lnum_t);
+    memcpy(face_vtx_idx, gi->face_vtx_idx, (n_faces + 1)*sizeof(cs_lnum_t));
+    memcpy(mb->face_cells + l_shift[1]*2, gi->face_cells,
+           n_faces*2*sizeof(cs_gnum_t));
+    memcpy(mb->face_gc_id + l_shift[1], gi->face_gc_id, n_faces*sizeof(int));
+
+    BFT_REALLOC(mb->face_vertices, l_shift[2] + n_connect, cs_gnum_t);
+    memcpy(mb->face_vertices + l_shift[2], gi->face_vtx,
+           n_connect*sizeof(cs_gnum_t));
+
+  }
+
+  /* Shift referenced cell and vertex numbers in case of appended data */
+
+  for (cs_lnum_t i = 0; i < n_faces*2; i++) {
+    if (mb->face_cells[l_shift[1]*2 + i] != 0)
+      mb->face_cells[l_shift[1]*2 + i] += g_shift[0];
+  }
+
+  for (cs_lnum_t i = 0; i < n_connect; i++)
+    mb->face_vertices[l_shift[2] + i] += g_shift[2];
+
+  for (cs_lnum_t i = 0; i < n_faces; i++)
+    mb->face_vertices_idx[l_shift[1] + i + 1] = l_shift[2] + face_vtx_idx[i+1];
+
+  if (mb->face_r_gen != NULL) {
+    for (cs_lnum_t i = 0; i < n_faces; i++)
+      mb->face_r_gen[l_shift[1] + i] = 0;
+  }
+
+  BFT_FREE(face_vtx_idx);
+
+  /* Vertices */
+
+  _block_dest(gi->n_vertices, gi->vertex_gnum, 0, g_shift[2], mb->vertex_bi,
+              dest_rank, dest_id);
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    cs_all_to_all_t *d = cs_all_to_all_create(gi->n_vertices,
+                                              CS_ALL_TO_ALL_USE_DEST_ID,
+                                              dest_id,
+                                              dest_rank,
+                                              cs_glob_mpi_comm);
+
+    n_vertices = cs_all_to_all_n_elts_dest(d);
+
+    cs_all_to_all_copy_array(d, CS_REAL_TYPE, 3, false,
+                             gi->vertex_coords,
+                             mb->vertex_coords + l_shift[3]*3);
+
+    cs_all_to_all_destroy(&d);
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  if (cs_glob_n_ranks == 1) {
+    n_vertices = gi->n_vertices;
+    for (cs_lnum_t i = 0; i < n_vertices; i++) {
+      for (int j = 0; j < 3; j++)
+        mb->vertex_coords[(l_shift[3] + dest_id[i])*3 + j]
+          = gi->vertex_coords[i*3 + j];
+    }
+  }
+
+  BFT_FREE(dest_id);
+  BFT_FREE(dest_rank);
+
+  n_read[0] = n_cells;
+  n_read[1] = n_faces;
+  n_read[2] = n_connect;
+  n_read[3] = n_vertices;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy a Gmsh import structure.
+ *
+ * parameters:
+ *   gi <-> pointer to Gmsh import structure pointer
+ *----------------------------------------------------------------------------*/
+
+void
+cs_mesh_import_gmsh_destroy(cs_mesh_import_gmsh_t  **gi)
+{
+  cs_mesh_import_gmsh_t *_gi = *gi;
+
+  if (_gi == NULL)
+    return;
+
+  BFT_FREE(_gi->cell_gc_id);
+  BFT_FREE(_gi->face_gnum);
+  BFT_FREE(_gi->face_cells);
+  BFT_FREE(_gi->face_vtx_idx);
+  BFT_FREE(_gi->face_vtx);
+  BFT_FREE(_gi->face_gc_id);
+  BFT_FREE(_gi->vertex_gnum);
+  BFT_FREE(_gi->vertex_coords);
+
+  BFT_FREE(*gi);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,146 @@
+#ifndef __CS_MESH_IMPORT_GMSH_H__
+#define __CS_MESH_IMPORT_GMSH_H__
+
+/*============================================================================
+ * Direct parallel import of Gmsh meshes to a mesh builder.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include "cs_mesh.h"
+#include "cs_mesh_builder.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/* Opaque Gmsh import structure */
+
+typedef struct _cs_mesh_import_gmsh_t  cs_mesh_import_gmsh_t;
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Check if a mesh file should be read using the Gmsh importer.
+ *
+ * Files with a ".msh" extension are considered to be Gmsh files.
+ *
+ * parameters:
+ *   path <-- file path
+ *
+ * returns:
+ *   true if the file is a Gmsh file, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_mesh_import_gmsh_check_file(const char  *path);
+
+/*----------------------------------------------------------------------------
+ * Read a Gmsh mesh file and build the matching face-based description.
+ *
+ * Only the binary variant of the Gmsh 4.1 format is handled, as it allows
+ * reading node and element sections in parallel. Linear tetrahedra,
+ * pyramids, prisms and hexahedra define cells; triangles and quadrangles
+ * are only used to assign group classes to faces. Physical groups are
+ * converted to mesh groups. Periodic node correspondences are not
+ * handled, so files containing them are rejected.
+ *
+ * Faces are built from cells and matched in parallel, with data
+ * distributed in blocks based on the file's own element numbering.
+ *
+ * The mesh global dimensions, groups and group classes, and the builder's
+ * global face counts, are updated so as to account for this file.
+ *
+ * This is a collective operation.
+ *
+ * parameters:
+ *   path <-- file path
+ *   mesh <-> pointer to mesh structure
+ *   mb   <-> pointer to mesh builder structure
+ *
+ * returns:
+ *   pointer to Gmsh import structure
+ *----------------------------------------------------------------------------*/
+
+cs_mesh_import_gmsh_t *
+cs_mesh_import_gmsh_create(const char         *path,
+                           cs_mesh_t          *mesh,
+                           cs_mesh_builder_t  *mb);
+
+/*----------------------------------------------------------------------------
+ * Transfer data read from a Gmsh file to the mesh builder.
+ *
+ * Data is moved from the file's block distribution to the builder's
+ * block distribution (which must be defined), and appended after
+ * data already read from preceding files.
+ *
+ * This is a collective operation.
+ *
+ * parameters:
+ *   gi      <-- pointer to Gmsh import structure
+ *   mb      <-> pointer to mesh builder structure
+ *   g_shift <-- global number of cells, faces and vertices already read
+ *   l_shift <-- local number of cells, faces, face connectivity values
+ *               and vertices already read
+ *   n_read  --> local number of cells, faces, face connectivity values
+ *               and vertices read
+ *----------------------------------------------------------------------------*/
+
+void
+cs_mesh_import_gmsh_transfer(const cs_mesh_import_gmsh_t  *gi,
+                             cs_mesh_builder_t            *mb,
+                             const cs_gnum_t               g_shift[3],
+                             const cs_lnum_t               l_shift[4],
+                             cs_lnum_t                     n_read[4]);
+
+/*----------------------------------------------------------------------------
+ * Destroy a Gmsh import structure.
+ *
+ * parameters:
+ *   gi <-> pointer to Gmsh import structure pointer
+ *----------------------------------------------------------------------------*/
+
+void
+cs_mesh_import_gmsh_destroy(cs_mesh_import_gmsh_t  **gi);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_MESH_IMPORT_GMSH_H__ */
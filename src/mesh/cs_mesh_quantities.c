@@ -129,16 +129,111 @@ cs_f_mesh_quantities_fluid_vol_reductions(void);
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Return thread group index associated with a face numbering.
+ *
+ * If no numbering is available, or if it does not match the current number
+ * of faces (i.e. the mesh was modified since it was built), a single group
+ * handled by a single thread is used.
+ *
+ * Faces are numbered by group first, then thread, so looping on groups
+ * and handling threads in parallel for each group leads to the same
+ * summation order for each cell as a serial loop on faces.
+ *
+ * parameters:
+ *   numbering     <--  face numbering structure, or NULL
+ *   n_faces       <--  number of faces
+ *   n_threads     -->  number of threads
+ *   n_groups      -->  number of groups
+ *   default_index <->  index for the default (single group) case
+ *
+ * returns:
+ *   pointer to group index
+ *----------------------------------------------------------------------------*/
+
+static const cs_lnum_t *
+_face_group_index(const cs_numbering_t  *numbering,
+                  cs_lnum_t              n_faces,
+                  int                   *n_threads,
+                  int                   *n_groups,
+                  cs_lnum_t              default_index[2])
+{
+  if (numbering != NULL) {
+    cs_lnum_t n_max = 0;
+    const int n = numbering->n_threads * numbering->n_groups;
+    for (int i = 0; i < n; i++)
+      n_max = CS_MAX(n_max, numbering->group_index[i*2 + 1]);
+    if (n_max == n_faces) {
+      *n_threads = numbering->n_threads;
+      *n_groups = numbering->n_groups;
+      return numbering->group_index;
+    }
+  }
+
+  default_index[0] = 0;
+  default_index[1] = n_faces;
+  *n_threads = 1;
+  *n_groups = 1;
+
+  return default_index;
+}
+
+/*----------------------------------------------------------------------------
+ * Check if an element is selected.
+ *
+ * parameters:
+ *   sel  <--  selection flag for elements, or NULL for all
+ *   id   <--  element id
+ *----------------------------------------------------------------------------*/
+
+static inline bool
+_is_selected(const char  sel[],
+             cs_lnum_t   id)
+{
+  return (sel == NULL || sel[id] != 0);
+}
+
+/*----------------------------------------------------------------------------
+ * Allocate a mesh quantities array if not already allocated.
+ *
+ * On allocation, the array is initialized using the thread partition of
+ * loops on the associated elements, for better core/memory affinity.
+ *
+ * parameters:
+ *   numbering  <--  numbering of associated elements, or NULL
+ *   n_elts     <--  number of associated elements
+ *   stride     <--  number of values per element
+ *   a          <->  pointer to array
+ *----------------------------------------------------------------------------*/
+
+static void
+_alloc_real(const cs_numbering_t  *numbering,
+            cs_lnum_t              n_elts,
+            cs_lnum_t              stride,
+            cs_real_t            **a)
+{
+  if (*a == NULL) {
+    BFT_MALLOC(*a, n_elts*stride, cs_real_t);
+    cs_numbering_first_touch(numbering,
+                             n_elts,
+                             stride*sizeof(cs_real_t),
+                             NULL,
+                             *a);
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Build the geometrical matrix linear gradient correction
  *
  * parameters:
- *   m    <--  mesh
- *   fvq  <->  mesh quantities
+ *   m         <--  mesh
+ *   cell_sel  <--  optional selection flag for cells to update, or NULL
+ *   fvq       <->  mesh quantities
  *----------------------------------------------------------------------------*/
 
 static void
 _compute_corr_grad_lin(const cs_mesh_t       *m,
+                       const char             cell_sel[],
                        cs_mesh_quantities_t  *fvq)
 {
   /* Local variables */
@@ -170,8 +265,21 @@ _compute_corr_grad_lin(const cs_mesh_t       *m,
   cs_real_t    *restrict corr_grad_lin_det = fvq->corr_grad_lin_det;
   cs_real_33_t *restrict corr_grad_lin     = fvq->corr_grad_lin;
 
+  int n_i_threads, n_i_groups, n_b_threads, n_b_groups;
+  cs_lnum_t _i_group_index[2], _b_group_index[2];
+
+  const cs_lnum_t *i_group_index
+    = _face_group_index(m->i_face_numbering, n_i_faces,
+                        &n_i_threads, &n_i_groups, _i_group_index);
+  const cs_lnum_t *b_group_index
+    = _face_group_index(m->b_face_numbering, n_b_faces,
+                        &n_b_threads, &n_b_groups, _b_group_index);
+
   /* Initialization */
+# pragma omp parallel for  if (n_cells_with_ghosts > CS_THR_MIN)
   for (cs_lnum_t cell_id = 0; cell_id < n_cells_with_ghosts; cell_id++) {
+    if (! _is_selected(cell_sel, cell_id))
+      continue;
     for (cs_lnum_t i = 0; i < 3; i++) {
       for (cs_lnum_t j = 0; j < 3; j++)
         corr_grad_lin[cell_id][i][j] = 0.;
@@ -179,32 +287,71 @@ _compute_corr_grad_lin(const cs_mesh_t       *m,
   }
 
   /* Internal faces contribution */
-  for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
-    cs_lnum_t cell_id1 = i_face_cells[face_id][0];
-    cs_lnum_t cell_id2 = i_face_cells[face_id][1];
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+
+      for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           face_id++) {
+
+        cs_lnum_t cell_id1 = i_face_cells[face_id][0];
+        cs_lnum_t cell_id2 = i_face_cells[face_id][1];
+
+        bool sel1 = _is_selected(cell_sel, cell_id1);
+        bool sel2 = _is_selected(cell_sel, cell_id2);
+
+        for (cs_lnum_t i = 0; i < 3; i++) {
+          for (cs_lnum_t j = 0; j < 3; j++) {
+            cs_real_t flux = i_face_cog[face_id][i] * i_face_normal[face_id][j];
+            if (sel1)
+              corr_grad_lin[cell_id1][i][j] += flux;
+            if (sel2)
+              corr_grad_lin[cell_id2][i][j] -= flux;
+          }
+        }
 
-    for (cs_lnum_t i = 0; i < 3; i++) {
-      for (cs_lnum_t j = 0; j < 3; j++) {
-        cs_real_t flux = i_face_cog[face_id][i] * i_face_normal[face_id][j];
-        corr_grad_lin[cell_id1][i][j] += flux;
-        corr_grad_lin[cell_id2][i][j] -= flux;
       }
+
     }
+
   }
 
   /* Boundary faces contribution */
-  for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
-    cs_lnum_t cell_id = b_face_cells[face_id];
-    for (cs_lnum_t i = 0; i < 3; i++) {
-      for (cs_lnum_t j = 0; j < 3; j++) {
-        cs_real_t flux = b_face_cog[face_id][i] * b_face_normal[face_id][j];
-        corr_grad_lin[cell_id][i][j] += flux;
+  for (int g_id = 0; g_id < n_b_groups; g_id++) {
+
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_b_threads; t_id++) {
+
+      for (cs_lnum_t face_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+           face_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+           face_id++) {
+
+        cs_lnum_t cell_id = b_face_cells[face_id];
+        if (! _is_selected(cell_sel, cell_id))
+          continue;
+
+        for (cs_lnum_t i = 0; i < 3; i++) {
+          for (cs_lnum_t j = 0; j < 3; j++) {
+            cs_real_t flux = b_face_cog[face_id][i] * b_face_normal[face_id][j];
+            corr_grad_lin[cell_id][i][j] += flux;
+          }
+        }
+
       }
+
     }
+
   }
 
   /* Matrix inversion */
+# pragma omp parallel for  if (n_cells > CS_THR_MIN)
   for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+
+    if (! _is_selected(cell_sel, cell_id))
+      continue;
+
     double cocg11 = corr_grad_lin[cell_id][0][0] / cell_vol[cell_id];
     double cocg12 = corr_grad_lin[cell_id][1][0] / cell_vol[cell_id];
     double cocg13 = corr_grad_lin[cell_id][2][0] / cell_vol[cell_id];
@@ -396,8 +543,10 @@ _compute_face_normal(cs_lnum_t         n_faces,
  *   vtx_coord       <--  vertex coordinates
  *   face_vtx_idx    <--  "face -> vertices" connectivity index
  *   face_vtx        <--  "face -> vertices" connectivity
- *   face_cog        -->  coordinates of the center of gravity of the faces
- *   face_normal     -->  face surface normals
+ *   face_sel        <--  optional selection flag for faces to update,
+ *                        or NULL for all
+ *   face_cog        <->  coordinates of the center of gravity of the faces
+ *   face_normal     <->  face surface normals
  *
  *                          Pi+1
  *              *---------*                   B  : barycenter of the polygon
@@ -419,6 +568,7 @@ _compute_face_quantities(const cs_lnum_t    n_faces,
                          const cs_real_3_t  vtx_coord[],
                          const cs_lnum_t    face_vtx_idx[],
                          const cs_lnum_t    face_vtx[],
+                         const char         face_sel[],
                          cs_real_3_t        face_cog[],
                          cs_real_3_t        face_normal[])
 {
@@ -435,6 +585,9 @@ _compute_face_quantities(const cs_lnum_t    n_faces,
 # pragma omp parallel for  if (n_faces > CS_THR_MIN)
   for (cs_lnum_t f_id = 0; f_id < n_faces; f_id++) {
 
+    if (! _is_selected(face_sel, f_id))
+      continue;
+
     /* Define the polygon (P) according to the vertices (Pi) of the face */
 
     cs_lnum_t s_id = face_vtx_idx[f_id];
@@ -900,6 +1053,16 @@ _correct_cell_face_center(const cs_mesh_t  *mesh,
   cs_real_33_t *dxidxj;
   cs_real_t *determinant;
 
+  int n_i_threads, n_i_groups, n_b_threads, n_b_groups;
+  cs_lnum_t _i_group_index[2], _b_group_index[2];
+
+  const cs_lnum_t *i_group_index
+    = _face_group_index(mesh->i_face_numbering, n_i_faces,
+                        &n_i_threads, &n_i_groups, _i_group_index);
+  const cs_lnum_t *b_group_index
+    = _face_group_index(mesh->b_face_numbering, n_b_faces,
+                        &n_b_threads, &n_b_groups, _b_group_index);
+
   BFT_MALLOC(i_face_cog0, n_i_faces, cs_real_3_t);
   BFT_MALLOC(b_face_cog0, n_b_faces, cs_real_3_t);
   BFT_MALLOC(i_face_cen, n_i_faces, cs_real_3_t);
@@ -912,14 +1075,17 @@ _correct_cell_face_center(const cs_mesh_t  *mesh,
   /* Iterative process */
   for (int sweep = 0; sweep < 1; sweep++) {
 
+#   pragma omp parallel for  if (n_i_faces > CS_THR_MIN)
     for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++)
       for (int i = 0; i < 3; i++)
         i_face_cog0[face_id][i] = i_face_cog[face_id][i];
 
+#   pragma omp parallel for  if (n_b_faces > CS_THR_MIN)
     for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++)
       for (int i = 0; i < 3; i++)
         b_face_cog0[face_id][i] = b_face_cog[face_id][i];
 
+#   pragma omp parallel for  if (n_i_faces > CS_THR_MIN)
     for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
       cs_lnum_t cell_id1 = i_face_cells[face_id][0];
       cs_lnum_t cell_id2 = i_face_cells[face_id][1];
@@ -949,6 +1115,7 @@ _correct_cell_face_center(const cs_mesh_t  *mesh,
     }
 
     /* Compute the projection of I on the boundary face: b_face_cen */
+#   pragma omp parallel for  if (n_b_faces > CS_THR_MIN)
     for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
       cs_lnum_t cell_id = b_face_cells[face_id];
 
@@ -969,8 +1136,10 @@ _correct_cell_face_center(const cs_mesh_t  *mesh,
       }
     }
 
+#   pragma omp parallel for  if (n_i_faces > CS_THR_MIN)
     for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++)
       relaxf[face_id] = 1.;
+#   pragma omp parallel for  if (n_b_faces > CS_THR_MIN)
     for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++)
       relaxb[face_id] = 1.;
 
@@ -981,47 +1150,77 @@ _correct_cell_face_center(const cs_mesh_t  *mesh,
     {
       iiter +=1;
 
+#     pragma omp parallel for  if (n_i_faces > CS_THR_MIN)
       for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
         for (int i = 0; i < 3; i++)
           i_face_cog[face_id][i] = (1. - relaxf[face_id]) * i_face_cog0[face_id][i]
                                        + relaxf[face_id]  * i_face_cen[face_id][i];
       }
 
+#     pragma omp parallel for  if (n_b_faces > CS_THR_MIN)
       for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
         for (int i = 0; i < 3; i++)
           b_face_cog[face_id][i] = (1. - relaxb[face_id]) * b_face_cog0[face_id][i]
                                        + relaxb[face_id]  * b_face_cen[face_id][i];
       }
 
+#     pragma omp parallel for  if (n_cells_with_ghosts > CS_THR_MIN)
       for (cs_lnum_t cell_id = 0; cell_id <  n_cells_with_ghosts; cell_id++)
         for (int i = 0; i < 3; i++)
           for (int j = 0; j < 3; j++)
             dxidxj[cell_id][i][j] = 0.;
 
-      for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
-        cs_lnum_t cell_id1 = i_face_cells[face_id][0];
-        cs_lnum_t cell_id2 = i_face_cells[face_id][1];
+      for (int g_id = 0; g_id < n_i_groups; g_id++) {
 
-        for (int i = 0; i < 3; i++)
-          for (int j = 0; j < 3; j++) {
-            double fluxij = i_face_cog[face_id][i]//TODO minus celli
-              * i_face_normal[face_id][j];
-            dxidxj[cell_id1][i][j] += fluxij;
-            dxidxj[cell_id2][i][j] -= fluxij;
-          }
-      }
+#       pragma omp parallel for
+        for (int t_id = 0; t_id < n_i_threads; t_id++) {
 
-      for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
-        cs_lnum_t cell_id = b_face_cells[face_id];
+          for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+               face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+               face_id++) {
 
-        for (int i = 0; i < 3; i++)
-          for (int j = 0; j < 3; j++) {
-            double fluxij =  b_face_cog[face_id][i]
-                           * b_face_normal[face_id][j];
-            dxidxj[cell_id][i][j] += fluxij;
-          }
-      }
+            cs_lnum_t cell_id1 = i_face_cells[face_id][0];
+            cs_lnum_t cell_id2 = i_face_cells[face_id][1];
+
+            for (int i = 0; i < 3; i++)
+              for (int j = 0; j < 3; j++) {
+                double fluxij = i_face_cog[face_id][i]//TODO minus celli
+                  * i_face_normal[face_id][j];
+                dxidxj[cell_id1][i][j] += fluxij;
+                dxidxj[cell_id2][i][j] -= fluxij;
+              }
+
+          } /* loop on faces */
+
+        } /* loop on threads */
+
+      } /* loop on thread groups */
+
+      for (int g_id = 0; g_id < n_b_groups; g_id++) {
+
+#       pragma omp parallel for
+        for (int t_id = 0; t_id < n_b_threads; t_id++) {
+
+          for (cs_lnum_t face_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+               face_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+               face_id++) {
+
+            cs_lnum_t cell_id = b_face_cells[face_id];
 
+            for (int i = 0; i < 3; i++)
+              for (int j = 0; j < 3; j++) {
+                double fluxij =  b_face_cog[face_id][i]
+                               * b_face_normal[face_id][j];
+                dxidxj[cell_id][i][j] += fluxij;
+              }
+
+          } /* loop on faces */
+
+        } /* loop on threads */
+
+      } /* loop on thread groups */
+
+#     pragma omp parallel for  if (mesh->n_cells > CS_THR_MIN)
       for (cs_lnum_t cell_id = 0; cell_id <  mesh->n_cells; cell_id++) {
         double vol = (   dxidxj[cell_id][0][0]
                        + dxidxj[cell_id][1][1]
@@ -1070,6 +1269,7 @@ _correct_cell_face_center(const cs_mesh_t  *mesh,
 
       //FIXME test was 0.001
       cs_real_t threshold = 0.1;
+#     pragma omp parallel for reduction(+:irelax) if (n_i_faces > CS_THR_MIN)
       for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
         cs_lnum_t cell_id1 = i_face_cells[face_id][0];
         cs_lnum_t cell_id2 = i_face_cells[face_id][1];
@@ -1080,6 +1280,7 @@ _correct_cell_face_center(const cs_mesh_t  *mesh,
         }
       }
 
+#     pragma omp parallel for reduction(+:irelax) if (n_b_faces > CS_THR_MIN)
       for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
         cs_lnum_t cell_id = b_face_cells[face_id];
 
@@ -1104,17 +1305,181 @@ _correct_cell_face_center(const cs_mesh_t  *mesh,
   BFT_FREE(determinant);
 }
 
+/*----------------------------------------------------------------------------
+ * Compute approximate cells centers as the mean of the given face
+ * centers weighted by the associated surfaces.
+ *
+ * Only selected cells are updated if a selection is given.
+ *
+ * parameters:
+ *   mesh         <--  pointer to mesh structure
+ *   i_face_norm  <--  surface normal of internal faces
+ *   i_face_cog   <--  center of gravity of internal faces
+ *   b_face_norm  <--  surface normal of border faces
+ *   b_face_cog   <--  center of gravity of border faces
+ *   cell_sel     <--  optional selection flag for cells to update, or NULL
+ *   cell_cen     <->  cell centers
+ *----------------------------------------------------------------------------*/
+
+static void
+_cell_faces_cog(const cs_mesh_t  *mesh,
+                const cs_real_t   i_face_norm[],
+                const cs_real_t   i_face_cog[],
+                const cs_real_t   b_face_norm[],
+                const cs_real_t   b_face_cog[],
+                const char        cell_sel[],
+                cs_real_t         cell_cen[restrict])
+{
+  cs_real_t  *cell_area = NULL;
+
+  /* Mesh connectivity */
+
+  const  cs_lnum_t  n_i_faces = mesh->n_i_faces;
+  const  cs_lnum_t  n_b_faces = mesh->n_b_faces;
+  const  cs_lnum_t  n_cells = mesh->n_cells;
+  const  cs_lnum_t  n_cells_with_ghosts = mesh->n_cells_with_ghosts;
+  const  cs_lnum_2_t  *i_face_cells
+    = (const cs_lnum_2_t *)(mesh->i_face_cells);
+  const  cs_lnum_t  *b_face_cells = mesh->b_face_cells;
+
+  int n_i_threads, n_i_groups, n_b_threads, n_b_groups;
+  cs_lnum_t _i_group_index[2], _b_group_index[2];
+
+  const cs_lnum_t *i_group_index
+    = _face_group_index(mesh->i_face_numbering, n_i_faces,
+                        &n_i_threads, &n_i_groups, _i_group_index);
+  const cs_lnum_t *b_group_index
+    = _face_group_index(mesh->b_face_numbering, n_b_faces,
+                        &n_b_threads, &n_b_groups, _b_group_index);
+
+  /* Initialization */
+
+  BFT_MALLOC(cell_area, n_cells_with_ghosts, cs_real_t);
+
+# pragma omp parallel for  if (n_cells_with_ghosts > CS_THR_MIN)
+  for (cs_lnum_t j = 0; j < n_cells_with_ghosts; j++) {
+
+    cell_area[j] = 0.;
+
+    if (_is_selected(cell_sel, j)) {
+      for (cs_lnum_t i = 0; i < 3; i++)
+        cell_cen[3*j + i] = 0.;
+    }
+
+  }
+
+  /* Loop on interior faces
+     ---------------------- */
+
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+
+      for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           f_id++) {
+
+        /* For each cell sharing the internal face, we update
+         * cell_cen and cell_area */
+
+        cs_lnum_t c_id1 = i_face_cells[f_id][0];
+        cs_lnum_t c_id2 = i_face_cells[f_id][1];
+
+        /* Computation of the area of the face */
+
+        cs_real_t area = cs_math_3_norm(i_face_norm + 3*f_id);
+
+        if (c_id1 > -1 && _is_selected(cell_sel, c_id1)) {
+          cell_area[c_id1] += area;
+          for (cs_lnum_t i = 0; i < 3; i++)
+            cell_cen[3*c_id1 + i] += i_face_cog[3*f_id + i]*area;
+        }
+        if (c_id2 > -1 && _is_selected(cell_sel, c_id2)) {
+          cell_area[c_id2] += area;
+          for (cs_lnum_t i = 0; i < 3; i++)
+            cell_cen[3*c_id2 + i] += i_face_cog[3*f_id + i]*area;
+        }
+
+      } /* End of loop on interior faces */
+
+    } /* End of loop on threads */
+
+  } /* End of loop on thread groups */
+
+  /* Loop on boundary faces
+     --------------------- */
+
+  for (int g_id = 0; g_id < n_b_groups; g_id++) {
+
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_b_threads; t_id++) {
+
+      for (cs_lnum_t f_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+           f_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+           f_id++) {
+
+        /* For each cell sharing a border face, we update the numerator
+         * of cell_cen and cell_area */
+
+        cs_lnum_t c_id1 = b_face_cells[f_id];
+
+        /* Computation of the area of the face
+           (note that c_id1 == -1 may happen for isolated faces,
+           which are cleaned afterwards) */
+
+        if (c_id1 > -1 && _is_selected(cell_sel, c_id1)) {
+
+          cs_real_t area = cs_math_3_norm(b_face_norm + 3*f_id);
+
+          cell_area[c_id1] += area;
+
+          /* Computation of the numerator */
+
+          for (cs_lnum_t i = 0; i < 3; i++)
+            cell_cen[3*c_id1 + i] += b_face_cog[3*f_id + i]*area;
+
+        }
+
+      } /* End of loop on boundary faces */
+
+    } /* End of loop on threads */
+
+  } /* End of loop on thread groups */
+
+  /* Loop on cells to finalize the computation of center of gravity
+     -------------------------------------------------------------- */
+
+# pragma omp parallel for  if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+
+    if (_is_selected(cell_sel, c_id)) {
+      for (cs_lnum_t i = 0; i < 3; i++)
+        cell_cen[c_id*3 + i] /= cell_area[c_id];
+    }
+
+  }
+
+  /* Free memory */
+
+  BFT_FREE(cell_area);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute cell centers and volumes.
  *
- * \param[in]   mesh         pointer to mesh structure
- * \param[in]   i_face_norm  surface normal of internal faces
- * \param[in]   i_face_cog   center of gravity of internal faces
- * \param[in]   b_face_norm  surface normal of border faces
- * \param[in]   b_face_cog   center of gravity of border faces
- * \param[out]  cell_cen     cell centers
- * \param[out]  cell_vol     cell volumes
+ * Only selected cells are updated if a selection is given.
+ *
+ * \param[in]       mesh         pointer to mesh structure
+ * \param[in]       i_face_norm  surface normal of internal faces
+ * \param[in]       i_face_cog   center of gravity of internal faces
+ * \param[in]       b_face_norm  surface normal of border faces
+ * \param[in]       b_face_cog   center of gravity of border faces
+ * \param[in]       cell_sel     optional selection flag for cells to
+ *                               update, or NULL
+ * \param[in, out]  cell_cen     cell centers
+ * \param[in, out]  cell_vol     cell volumes
  */
 /*----------------------------------------------------------------------------*/
 
@@ -1124,6 +1489,7 @@ _compute_cell_quantities(const cs_mesh_t    *mesh,
                          const cs_real_3_t   i_face_cog[],
                          const cs_real_3_t   b_face_norm[],
                          const cs_real_3_t   b_face_cog[],
+                         const char          cell_sel[],
                          cs_real_3_t         cell_cen[restrict],
                          cs_real_t           cell_vol[restrict])
 {
@@ -1137,6 +1503,16 @@ _compute_cell_quantities(const cs_mesh_t    *mesh,
     = (const cs_lnum_2_t *)(mesh->i_face_cells);
   const  cs_lnum_t  *b_face_cells = mesh->b_face_cells;
 
+  int n_i_threads, n_i_groups, n_b_threads, n_b_groups;
+  cs_lnum_t _i_group_index[2], _b_group_index[2];
+
+  const cs_lnum_t *i_group_index
+    = _face_group_index(mesh->i_face_numbering, n_i_faces,
+                        &n_i_threads, &n_i_groups, _i_group_index);
+  const cs_lnum_t *b_group_index
+    = _face_group_index(mesh->b_face_numbering, n_b_faces,
+                        &n_b_threads, &n_b_groups, _b_group_index);
+
   /* Checking */
 
   assert(cell_cen != NULL);
@@ -1147,94 +1523,125 @@ _compute_cell_quantities(const cs_mesh_t    *mesh,
   cs_real_3_t *a_cell_cen;
   BFT_MALLOC(a_cell_cen, n_cells_ext, cs_real_3_t);
 
-  cs_mesh_quantities_cell_faces_cog(mesh,
-                                    (const cs_real_t *)i_face_norm,
-                                    (const cs_real_t *)i_face_cog,
-                                    (const cs_real_t *)b_face_norm,
-                                    (const cs_real_t *)b_face_cog,
-                                    (cs_real_t *)a_cell_cen);
+  _cell_faces_cog(mesh,
+                  (const cs_real_t *)i_face_norm,
+                  (const cs_real_t *)i_face_cog,
+                  (const cs_real_t *)b_face_norm,
+                  (const cs_real_t *)b_face_cog,
+                  cell_sel,
+                  (cs_real_t *)a_cell_cen);
 
   /* Initialization */
 
-  for (cs_lnum_t j = 0; j < n_cells_ext; j++)
-    cell_vol[j] = 0.;
-
+# pragma omp parallel for  if (n_cells_ext > CS_THR_MIN)
   for (cs_lnum_t j = 0; j < n_cells_ext; j++) {
-    for (cs_lnum_t i = 0; i < 3; i++)
-      cell_cen[j][i] = 0.;
+    if (_is_selected(cell_sel, j)) {
+      cell_vol[j] = 0.;
+      for (cs_lnum_t i = 0; i < 3; i++)
+        cell_cen[j][i] = 0.;
+    }
   }
 
   /* Loop on interior faces
      ---------------------- */
 
-  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
 
-    /* For each cell sharing the internal face, we update
-     * cell_cen and cell_area */
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
 
-    cs_lnum_t c_id1 = i_face_cells[f_id][0];
-    cs_lnum_t c_id2 = i_face_cells[f_id][1];
+      for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           f_id++) {
 
-    /* Implicit subdivision of cell into face vertices-cell-center pyramids */
+        /* For each cell sharing the internal face, we update
+         * cell_cen and cell_area */
 
-    if (c_id1 > -1) {
-      cs_real_t pyra_vol_3 = cs_math_3_distance_dot_product(a_cell_cen[c_id1],
-                                                            i_face_cog[f_id],
-                                                            i_face_norm[f_id]);
-      for (cs_lnum_t i = 0; i < 3; i++)
-        cell_cen[c_id1][i] += pyra_vol_3 *(  0.75*i_face_cog[f_id][i]
-                                           + 0.25*a_cell_cen[c_id1][i]);
-      cell_vol[c_id1] += pyra_vol_3;
-    }
-    if (c_id2 > -1) {
-      cs_real_t pyra_vol_3 = cs_math_3_distance_dot_product(i_face_cog[f_id],
-                                                            a_cell_cen[c_id2],
-                                                            i_face_norm[f_id]);
-      for (cs_lnum_t i = 0; i < 3; i++)
-        cell_cen[c_id2][i] += pyra_vol_3 *(  0.75*i_face_cog[f_id][i]
-                                           + 0.25*a_cell_cen[c_id2][i]);
-      cell_vol[c_id2] += pyra_vol_3;
-    }
+        cs_lnum_t c_id1 = i_face_cells[f_id][0];
+        cs_lnum_t c_id2 = i_face_cells[f_id][1];
+
+        /* Implicit subdivision of cell into face vertices-cell-center
+           pyramids */
 
-  } /* End of loop on interior faces */
+        if (c_id1 > -1 && _is_selected(cell_sel, c_id1)) {
+          cs_real_t pyra_vol_3
+            = cs_math_3_distance_dot_product(a_cell_cen[c_id1],
+                                             i_face_cog[f_id],
+                                             i_face_norm[f_id]);
+          for (cs_lnum_t i = 0; i < 3; i++)
+            cell_cen[c_id1][i] += pyra_vol_3 *(  0.75*i_face_cog[f_id][i]
+                                               + 0.25*a_cell_cen[c_id1][i]);
+          cell_vol[c_id1] += pyra_vol_3;
+        }
+        if (c_id2 > -1 && _is_selected(cell_sel, c_id2)) {
+          cs_real_t pyra_vol_3
+            = cs_math_3_distance_dot_product(i_face_cog[f_id],
+                                             a_cell_cen[c_id2],
+                                             i_face_norm[f_id]);
+          for (cs_lnum_t i = 0; i < 3; i++)
+            cell_cen[c_id2][i] += pyra_vol_3 *(  0.75*i_face_cog[f_id][i]
+                                               + 0.25*a_cell_cen[c_id2][i]);
+          cell_vol[c_id2] += pyra_vol_3;
+        }
+
+      } /* End of loop on interior faces */
+
+    } /* End of loop on threads */
+
+  } /* End of loop on thread groups */
 
   /* Loop on boundary faces
      --------------------- */
 
-  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+  for (int g_id = 0; g_id < n_b_groups; g_id++) {
 
-    /* For each cell sharing a border face, we update the numerator
-     * of cell_cen and cell_area */
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_b_threads; t_id++) {
 
-    cs_lnum_t c_id1 = b_face_cells[f_id];
+      for (cs_lnum_t f_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+           f_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+           f_id++) {
 
-    /* Computation of the area of the face
-       (note that c_id1 == -1 may happen for isolated faces,
-       which are cleaned afterwards) */
+        /* For each cell sharing a border face, we update the numerator
+         * of cell_cen and cell_area */
 
-    if (c_id1 > -1) {
-      cs_real_t pyra_vol_3 = cs_math_3_distance_dot_product(a_cell_cen[c_id1],
-                                                            b_face_cog[f_id],
-                                                            b_face_norm[f_id]);
-      for (cs_lnum_t i = 0; i < 3; i++)
-        cell_cen[c_id1][i] += pyra_vol_3 *(  0.75*b_face_cog[f_id][i]
-                                           + 0.25*a_cell_cen[c_id1][i]);
-      cell_vol[c_id1] += pyra_vol_3;
-    }
+        cs_lnum_t c_id1 = b_face_cells[f_id];
+
+        /* Computation of the area of the face
+           (note that c_id1 == -1 may happen for isolated faces,
+           which are cleaned afterwards) */
+
+        if (c_id1 > -1 && _is_selected(cell_sel, c_id1)) {
+          cs_real_t pyra_vol_3
+            = cs_math_3_distance_dot_product(a_cell_cen[c_id1],
+                                             b_face_cog[f_id],
+                                             b_face_norm[f_id]);
+          for (cs_lnum_t i = 0; i < 3; i++)
+            cell_cen[c_id1][i] += pyra_vol_3 *(  0.75*b_face_cog[f_id][i]
+                                               + 0.25*a_cell_cen[c_id1][i]);
+          cell_vol[c_id1] += pyra_vol_3;
+        }
+
+      } /* End of loop on boundary faces */
+
+    } /* End of loop on threads */
 
-  } /* End of loop on boundary faces */
+  } /* End of loop on thread groups */
 
   BFT_FREE(a_cell_cen);
 
   /* Loop on cells to finalize the computation
      ----------------------------------------- */
 
+# pragma omp parallel for  if (n_cells > CS_THR_MIN)
   for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
 
-    for (cs_lnum_t i = 0; i < 3; i++)
-      cell_cen[c_id][i] /= cell_vol[c_id];
+    if (_is_selected(cell_sel, c_id)) {
+      for (cs_lnum_t i = 0; i < 3; i++)
+        cell_cen[c_id][i] /= cell_vol[c_id];
 
-    cell_vol[c_id] /= 3.0;
+      cell_vol[c_id] /= 3.0;
+    }
 
   }
 }
@@ -1262,40 +1669,64 @@ _recompute_cell_cen_face(const cs_mesh_t     *mesh,
   const  cs_lnum_t  n_i_faces = mesh->n_i_faces;
   const  cs_lnum_t  n_b_faces = mesh->n_b_faces;
 
+  const  cs_lnum_t  n_cells = mesh->n_cells;
   const  cs_lnum_t  n_cells_with_ghosts = mesh->n_cells_with_ghosts;
 
   const  cs_lnum_2_t  *i_face_cells
     = (const cs_lnum_2_t *)(mesh->i_face_cells);
   const  cs_lnum_t  *b_face_cells = mesh->b_face_cells;
 
+  int n_i_threads, n_i_groups, n_b_threads, n_b_groups;
+  cs_lnum_t _i_group_index[2], _b_group_index[2];
+
+  const cs_lnum_t *i_group_index
+    = _face_group_index(mesh->i_face_numbering, n_i_faces,
+                        &n_i_threads, &n_i_groups, _i_group_index);
+  const cs_lnum_t *b_group_index
+    = _face_group_index(mesh->b_face_numbering, n_b_faces,
+                        &n_b_threads, &n_b_groups, _b_group_index);
+
   /* First pass of verification */
   int *pb1;
   BFT_MALLOC(pb1, n_cells_with_ghosts, int);
 
-  for (cs_lnum_t cell_id = 0; cell_id < mesh->n_cells_with_ghosts; cell_id++)
+# pragma omp parallel for  if (n_cells_with_ghosts > CS_THR_MIN)
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells_with_ghosts; cell_id++)
     pb1[cell_id] = 0;
 
-  for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
 
-    cs_lnum_t cell_id1 = i_face_cells[face_id][0];
-    cs_lnum_t cell_id2 = i_face_cells[face_id][1];
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+
+      for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           face_id++) {
+
+        cs_lnum_t cell_id1 = i_face_cells[face_id][0];
+        cs_lnum_t cell_id2 = i_face_cells[face_id][1];
+
+        /* IF . S */
+        double psi1 = cs_math_3_distance_dot_product(cell_cen[cell_id1],
+                                                     i_face_cog[face_id],
+                                                     i_face_normal[face_id]);
+        /* JF . S */
+        double psj1 = cs_math_3_distance_dot_product(cell_cen[cell_id2],
+                                                     i_face_cog[face_id],
+                                                     i_face_normal[face_id]);
+        if (psi1 < 0.)
+          pb1[cell_id1]++;
+        if (psj1 > 0.)
+          pb1[cell_id2]++;
+      }
+
+    }
 
-    /* IF . S */
-    double psi1 = cs_math_3_distance_dot_product(cell_cen[cell_id1],
-                                                 i_face_cog[face_id],
-                                                 i_face_normal[face_id]);
-    /* JF . S */
-    double psj1 = cs_math_3_distance_dot_product(cell_cen[cell_id2],
-                                                 i_face_cog[face_id],
-                                                 i_face_normal[face_id]);
-    if (psi1 < 0.)
-      pb1[cell_id1]++;
-    if (psj1 > 0.)
-      pb1[cell_id2]++;
   }
 
   cs_gnum_t cpt1 = 0;
-  for (cs_lnum_t cell_id = 0; cell_id < mesh->n_cells; cell_id++)
+# pragma omp parallel for reduction(+:cpt1) if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
     if (pb1[cell_id] > 0) cpt1++;
   cs_parall_counter(&cpt1, 1);
 
@@ -1313,7 +1744,8 @@ _recompute_cell_cen_face(const cs_mesh_t     *mesh,
     BFT_MALLOC(cdgbis, n_cells_with_ghosts, cs_real_3_t);
 
     /* init matrice et second membre */
-    for (cs_lnum_t cell_id = 0; cell_id < mesh->n_cells_with_ghosts; cell_id++) {
+#   pragma omp parallel for  if (n_cells_with_ghosts > CS_THR_MIN)
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells_with_ghosts; cell_id++) {
       for (int i = 0; i < 3; i++) {
         b[cell_id][i] = 0.;
         for (int j = 0; j < 3; j++)
@@ -1322,55 +1754,79 @@ _recompute_cell_cen_face(const cs_mesh_t     *mesh,
     }
 
     /* Contribution from interior faces */
-    for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
+    for (int g_id = 0; g_id < n_i_groups; g_id++) {
 
-      cs_lnum_t cell_id1 = i_face_cells[face_id][0];
-      cs_lnum_t cell_id2 = i_face_cells[face_id][1];
-      double surfn = cs_math_3_norm(i_face_normal[face_id]);
+#     pragma omp parallel for
+      for (int t_id = 0; t_id < n_i_threads; t_id++) {
 
-      for (int i = 0; i < 3; i++)
-        for (int j = 0; j < 3; j++) {
-          a[cell_id1][i][j] +=   i_face_normal[face_id][i]
-                               * i_face_normal[face_id][j] / surfn;
-          a[cell_id2][i][j] +=   i_face_normal[face_id][i]
-                               * i_face_normal[face_id][j] / surfn;
-        }
+        for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+             face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+             face_id++) {
 
-      double ps = cs_math_3_dot_product(i_face_normal[face_id],
-                                        i_face_cog[face_id]);
+          cs_lnum_t cell_id1 = i_face_cells[face_id][0];
+          cs_lnum_t cell_id2 = i_face_cells[face_id][1];
+          double surfn = cs_math_3_norm(i_face_normal[face_id]);
+
+          for (int i = 0; i < 3; i++)
+            for (int j = 0; j < 3; j++) {
+              a[cell_id1][i][j] +=   i_face_normal[face_id][i]
+                                   * i_face_normal[face_id][j] / surfn;
+              a[cell_id2][i][j] +=   i_face_normal[face_id][i]
+                                   * i_face_normal[face_id][j] / surfn;
+            }
+
+          double ps = cs_math_3_dot_product(i_face_normal[face_id],
+                                            i_face_cog[face_id]);
+
+          for (int i = 0; i < 3; i++) {
+            b[cell_id1][i] += ps * i_face_normal[face_id][i] / surfn;
+            b[cell_id2][i] += ps * i_face_normal[face_id][i] / surfn;
+          }
+
+        }
 
-      for (int i = 0; i < 3; i++) {
-        b[cell_id1][i] += ps * i_face_normal[face_id][i] / surfn;
-        b[cell_id2][i] += ps * i_face_normal[face_id][i] / surfn;
       }
 
     }
 
     /* Contribution from boundary faces */
-    for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
+    for (int g_id = 0; g_id < n_b_groups; g_id++) {
 
-      cs_lnum_t cell_id = b_face_cells[face_id];
-      double surfn = cs_math_3_norm(b_face_normal[face_id]);
+#     pragma omp parallel for
+      for (int t_id = 0; t_id < n_b_threads; t_id++) {
 
-      for (int i = 0; i < 3; i++)
-        for (int j = 0; j < 3; j++) {
-          a[cell_id][i][j] +=   b_face_normal[face_id][i]
-                              * b_face_normal[face_id][j] / surfn;
-        }
+        for (cs_lnum_t face_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+             face_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+             face_id++) {
 
-      double ps = cs_math_3_dot_product(b_face_normal[face_id],
-                                        b_face_cog[face_id]);
+          cs_lnum_t cell_id = b_face_cells[face_id];
+          double surfn = cs_math_3_norm(b_face_normal[face_id]);
+
+          for (int i = 0; i < 3; i++)
+            for (int j = 0; j < 3; j++) {
+              a[cell_id][i][j] +=   b_face_normal[face_id][i]
+                                  * b_face_normal[face_id][j] / surfn;
+            }
+
+          double ps = cs_math_3_dot_product(b_face_normal[face_id],
+                                            b_face_cog[face_id]);
+
+          for (int i = 0; i < 3; i++) {
+            b[cell_id][i] += ps * b_face_normal[face_id][i] / surfn;
+          }
+
+        }
 
-      for (int i = 0; i < 3; i++) {
-        b[cell_id][i] += ps * b_face_normal[face_id][i] / surfn;
       }
 
     }
 
     /* invert system */
-    double aainv[3][3];
-    double bb[3];
-    for (cs_lnum_t cell_id = 0; cell_id < mesh->n_cells; cell_id++) {
+#   pragma omp parallel for  if (n_cells > CS_THR_MIN)
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+
+      double aainv[3][3];
+      double bb[3];
 
       cdgbis[cell_id][0] = cell_cen[cell_id][0];
       cdgbis[cell_id][1] = cell_cen[cell_id][1];
@@ -1443,30 +1899,43 @@ _recompute_cell_cen_face(const cs_mesh_t     *mesh,
     int *pb2;
     BFT_MALLOC(pb2, n_cells_with_ghosts, int);
 
-    for (cs_lnum_t cell_id = 0; cell_id < mesh->n_cells_with_ghosts; cell_id++)
+#   pragma omp parallel for  if (n_cells_with_ghosts > CS_THR_MIN)
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells_with_ghosts; cell_id++)
       pb2[cell_id] = 0;
 
-    for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
+    for (int g_id = 0; g_id < n_i_groups; g_id++) {
+
+#     pragma omp parallel for
+      for (int t_id = 0; t_id < n_i_threads; t_id++) {
+
+        for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+             face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+             face_id++) {
+
+          cs_lnum_t cell_id1 = i_face_cells[face_id][0];
+          cs_lnum_t cell_id2 = i_face_cells[face_id][1];
+
+          /* IF . S */
+          double psi1 = cs_math_3_distance_dot_product(cdgbis[cell_id1],
+                                                       i_face_cog[face_id],
+                                                       i_face_normal[face_id]);
+          /* JF . S */
+          double psj1 = cs_math_3_distance_dot_product(cdgbis[cell_id2],
+                                                       i_face_cog[face_id],
+                                                       i_face_normal[face_id]);
+          if (psi1 < 0.)
+            pb2[cell_id1]++;
+          if (psj1 > 0.)
+            pb2[cell_id2]++;
+        }
 
-      cs_lnum_t cell_id1 = i_face_cells[face_id][0];
-      cs_lnum_t cell_id2 = i_face_cells[face_id][1];
+      }
 
-      /* IF . S */
-      double psi1 = cs_math_3_distance_dot_product(cdgbis[cell_id1],
-                                                   i_face_cog[face_id],
-                                                   i_face_normal[face_id]);
-      /* JF . S */
-      double psj1 = cs_math_3_distance_dot_product(cdgbis[cell_id2],
-                                                   i_face_cog[face_id],
-                                                   i_face_normal[face_id]);
-      if (psi1 < 0.)
-        pb2[cell_id1]++;
-      if (psj1 > 0.)
-        pb2[cell_id2]++;
     }
 
     cs_gnum_t cpt2 = 0;
-    for (cs_lnum_t cell_id = 0; cell_id < mesh->n_cells; cell_id++)
+#   pragma omp parallel for reduction(+:cpt2) if (n_cells > CS_THR_MIN)
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
       if (pb2[cell_id] > 0)
         cpt2++;
     cs_parall_counter(&cpt2, 1);
@@ -1474,7 +1943,8 @@ _recompute_cell_cen_face(const cs_mesh_t     *mesh,
     bft_printf("Total number of cell centers on the other side of a face "
                "(after correction) = %lu / %d\n", cpt2, mesh->n_cells);
 
-    for (cs_lnum_t cell_id = 0; cell_id < mesh->n_cells; cell_id++) {
+#   pragma omp parallel for  if (n_cells > CS_THR_MIN)
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
       if (pb1[cell_id] > 0 && pb2[cell_id] == 0) {
 
           cell_cen[cell_id][0] = cdgbis[cell_id][0];
@@ -1509,6 +1979,8 @@ _recompute_cell_cen_face(const cs_mesh_t     *mesh,
  *  G(C) = - .  Sum  Surf(Fi) G(Fi)
  *         3    i=0
  *
+ * Only selected cells are updated if a selection is given.
+ *
  * parameters:
  *   mesh           <--  pointer to mesh structure
  *   i_face_norm    <--  surface normal of internal faces
@@ -1516,7 +1988,8 @@ _recompute_cell_cen_face(const cs_mesh_t     *mesh,
  *   b_face_norm    <--  surface normal of border faces
  *   b_face_cog     <--  center of gravity of border faces
  *   cell_cen       <--  center of gravity of cells
- *   cell_vol       -->  cells volume
+ *   cell_sel       <--  optional selection flag for cells to update, or NULL
+ *   cell_vol       <->  cells volume
  *----------------------------------------------------------------------------*/
 
 static void
@@ -1526,45 +1999,93 @@ _compute_cell_volume(const cs_mesh_t   *mesh,
                      const cs_real_3_t  b_face_norm[],
                      const cs_real_3_t  b_face_cog[],
                      const cs_real_3_t  cell_cen[],
+                     const char         cell_sel[],
                      cs_real_t          cell_vol[])
 {
   const cs_real_t  a_third = 1.0/3.0;
 
+  const cs_lnum_t  n_cells = mesh->n_cells;
+  const cs_lnum_t  n_cells_with_ghosts = mesh->n_cells_with_ghosts;
+
+  int n_i_threads, n_i_groups, n_b_threads, n_b_groups;
+  cs_lnum_t _i_group_index[2], _b_group_index[2];
+
+  const cs_lnum_t *i_group_index
+    = _face_group_index(mesh->i_face_numbering, mesh->n_i_faces,
+                        &n_i_threads, &n_i_groups, _i_group_index);
+  const cs_lnum_t *b_group_index
+    = _face_group_index(mesh->b_face_numbering, mesh->n_b_faces,
+                        &n_b_threads, &n_b_groups, _b_group_index);
+
   /* Initialization */
 
-  for (cs_lnum_t cell_id = 0; cell_id < mesh->n_cells_with_ghosts; cell_id++)
-    cell_vol[cell_id] = 0;
+# pragma omp parallel for  if (n_cells_with_ghosts > CS_THR_MIN)
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells_with_ghosts; cell_id++) {
+    if (_is_selected(cell_sel, cell_id))
+      cell_vol[cell_id] = 0;
+  }
 
   /* Loop on internal faces */
 
-  for (cs_lnum_t fac_id = 0; fac_id < mesh->n_i_faces; fac_id++) {
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+
+      for (cs_lnum_t fac_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           fac_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           fac_id++) {
 
-    cs_lnum_t cell_id1 = mesh->i_face_cells[fac_id][0];
-    cs_lnum_t cell_id2 = mesh->i_face_cells[fac_id][1];
+        cs_lnum_t cell_id1 = mesh->i_face_cells[fac_id][0];
+        cs_lnum_t cell_id2 = mesh->i_face_cells[fac_id][1];
+
+        if (_is_selected(cell_sel, cell_id1))
+          cell_vol[cell_id1]
+            += cs_math_3_distance_dot_product(cell_cen[cell_id1],
+                                              i_face_cog[fac_id],
+                                              i_face_norm[fac_id]);
+        if (_is_selected(cell_sel, cell_id2))
+          cell_vol[cell_id2]
+            -= cs_math_3_distance_dot_product(cell_cen[cell_id2],
+                                              i_face_cog[fac_id],
+                                              i_face_norm[fac_id]);
+      }
+
+    }
 
-    cell_vol[cell_id1] += cs_math_3_distance_dot_product(cell_cen[cell_id1],
-                                                         i_face_cog[fac_id],
-                                                         i_face_norm[fac_id]);
-    cell_vol[cell_id2] -= cs_math_3_distance_dot_product(cell_cen[cell_id2],
-                                                         i_face_cog[fac_id],
-                                                         i_face_norm[fac_id]);
   }
 
   /* Loop on border faces */
 
-  for (cs_lnum_t fac_id = 0; fac_id < mesh->n_b_faces; fac_id++) {
+  for (int g_id = 0; g_id < n_b_groups; g_id++) {
+
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_b_threads; t_id++) {
+
+      for (cs_lnum_t fac_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+           fac_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+           fac_id++) {
+
+        cs_lnum_t cell_id1 = mesh->b_face_cells[fac_id];
 
-    cs_lnum_t cell_id1 = mesh->b_face_cells[fac_id];
+        if (_is_selected(cell_sel, cell_id1))
+          cell_vol[cell_id1]
+            += cs_math_3_distance_dot_product(cell_cen[cell_id1],
+                                              b_face_cog[fac_id],
+                                              b_face_norm[fac_id]);
+      }
+
+    }
 
-    cell_vol[cell_id1] += cs_math_3_distance_dot_product(cell_cen[cell_id1],
-                                                         b_face_cog[fac_id],
-                                                         b_face_norm[fac_id]);
   }
 
   /* First Computation of the volume */
 
-  for (cs_lnum_t cell_id = 0; cell_id < mesh->n_cells; cell_id++)
-    cell_vol[cell_id] *= a_third;
+# pragma omp parallel for  if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+    if (_is_selected(cell_sel, cell_id))
+      cell_vol[cell_id] *= a_third;
+  }
 }
 
 /*----------------------------------------------------------------------------
@@ -1662,9 +2183,12 @@ _cell_volume_reductions(const cs_mesh_t  *mesh,
  *   b_face_cog     <--  center of gravity of border faces
  *   cell_cen       <--  cell center
  *   cell_vol       <--  cell volume
- *   i_dist         -->  distance IJ.Nij for interior faces
- *   b_dist         -->  likewise for border faces
- *   weight         -->  weighting factor (Aij=pond Ai+(1-pond)Aj)
+ *   i_face_sel     <--  optional selection flag for interior faces
+ *                       to update, or NULL
+ *   b_face_sel     <--  likewise for border faces
+ *   i_dist         <->  distance IJ.Nij for interior faces
+ *   b_dist         <->  likewise for border faces
+ *   weight         <->  weighting factor (Aij=pond Ai+(1-pond)Aj)
  *----------------------------------------------------------------------------*/
 
 static void
@@ -1678,6 +2202,8 @@ _compute_face_distances(cs_lnum_t          n_i_faces,
                         const cs_real_t    b_face_cog[][3],
                         const cs_real_t    cell_cen[][3],
                         const cs_real_t    cell_vol[],
+                        const char         i_face_sel[],
+                        const char         b_face_sel[],
                         cs_real_t          i_dist[],
                         cs_real_t          b_dist[],
                         cs_real_t          weight[])
@@ -1686,8 +2212,12 @@ _compute_face_distances(cs_lnum_t          n_i_faces,
 
   /* Interior faces */
 
+# pragma omp parallel for reduction(+:w_count) if (n_i_faces > CS_THR_MIN)
   for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
 
+    if (! _is_selected(i_face_sel, face_id))
+      continue;
+
     const cs_real_t *face_nomal = i_face_normal[face_id];
     cs_real_t normal[3];
     cs_math_3_normalise(face_nomal, normal);
@@ -1751,8 +2281,12 @@ _compute_face_distances(cs_lnum_t          n_i_faces,
 
   w_count = 0;
 
+# pragma omp parallel for reduction(+:w_count) if (n_b_faces > CS_THR_MIN)
   for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
 
+    if (! _is_selected(b_face_sel, face_id))
+      continue;
+
     const cs_real_t *face_nomal = b_face_normal[face_id];
     cs_real_t normal[3];
     cs_math_3_normalise(face_nomal, normal);
@@ -1827,9 +2361,13 @@ _compute_face_distances(cs_lnum_t          n_i_faces,
  *   i_face_surf    <--  interior faces surface
  *   cell_cen       <--  cell center
  *   weight         <--  weighting factor (Aij=pond Ai+(1-pond)Aj)
- *   dijpf          -->  vector i'j' for interior faces
- *   diipb          -->  vector ii'  for border faces
- *   dofij          -->  vector OF   for interior faces
+ *   b_dist         <--  boundary face distance
+ *   i_face_sel     <--  optional selection flag for interior faces
+ *                       to update, or NULL
+ *   b_face_sel     <--  likewise for border faces
+ *   dijpf          <->  vector i'j' for interior faces
+ *   diipb          <->  vector ii'  for border faces
+ *   dofij          <->  vector OF   for interior faces
  *----------------------------------------------------------------------------*/
 
 static void
@@ -1846,43 +2384,42 @@ _compute_face_vectors(int                dim,
                       const cs_real_t    cell_cen[],
                       const cs_real_t    weight[],
                       const cs_real_t    b_dist[],
+                      const char         i_face_sel[],
+                      const char         b_face_sel[],
                       cs_real_t          dijpf[],
                       cs_real_t          diipb[],
                       cs_real_t          dofij[])
 {
-  cs_lnum_t face_id;
-  cs_lnum_t cell_id;
-
-  cs_real_t dipjp, pond;
-  cs_real_t surfnx, surfny, surfnz;
-  cs_real_t vecijx, vecijy, vecijz;
-
   /* Interior faces */
 
-  for (face_id = 0; face_id < n_i_faces; face_id++) {
+# pragma omp parallel for  if (n_i_faces > CS_THR_MIN)
+  for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
+
+    if (! _is_selected(i_face_sel, face_id))
+      continue;
 
     cs_lnum_t cell_id1 = i_face_cells[face_id][0];
     cs_lnum_t cell_id2 = i_face_cells[face_id][1];
 
     /* Normalized normal */
-    surfnx = i_face_normal[face_id*dim]     / i_face_surf[face_id];
-    surfny = i_face_normal[face_id*dim + 1] / i_face_surf[face_id];
-    surfnz = i_face_normal[face_id*dim + 2] / i_face_surf[face_id];
+    cs_real_t surfnx = i_face_normal[face_id*dim]     / i_face_surf[face_id];
+    cs_real_t surfny = i_face_normal[face_id*dim + 1] / i_face_surf[face_id];
+    cs_real_t surfnz = i_face_normal[face_id*dim + 2] / i_face_surf[face_id];
 
     /* ---> IJ */
-    vecijx = cell_cen[cell_id2*dim]     - cell_cen[cell_id1*dim];
-    vecijy = cell_cen[cell_id2*dim + 1] - cell_cen[cell_id1*dim + 1];
-    vecijz = cell_cen[cell_id2*dim + 2] - cell_cen[cell_id1*dim + 2];
+    cs_real_t vecijx = cell_cen[cell_id2*dim]     - cell_cen[cell_id1*dim];
+    cs_real_t vecijy = cell_cen[cell_id2*dim + 1] - cell_cen[cell_id1*dim + 1];
+    cs_real_t vecijz = cell_cen[cell_id2*dim + 2] - cell_cen[cell_id1*dim + 2];
 
     /* ---> DIJPP = IJ.NIJ */
-    dipjp = vecijx*surfnx + vecijy*surfny + vecijz*surfnz;
+    cs_real_t dipjp = vecijx*surfnx + vecijy*surfny + vecijz*surfnz;
 
     /* ---> DIJPF = (IJ.NIJ).NIJ */
     dijpf[face_id*dim]     = dipjp*surfnx;
     dijpf[face_id*dim + 1] = dipjp*surfny;
     dijpf[face_id*dim + 2] = dipjp*surfnz;
 
-    pond = weight[face_id];
+    cs_real_t pond = weight[face_id];
 
     /* ---> DOFIJ = OF */
     dofij[face_id*dim]     = i_face_cog[face_id*dim]
@@ -1901,9 +2438,13 @@ _compute_face_vectors(int                dim,
   /* Boundary faces */
   cs_gnum_t w_count = 0;
 
-  for (face_id = 0; face_id < n_b_faces; face_id++) {
+# pragma omp parallel for reduction(+:w_count) if (n_b_faces > CS_THR_MIN)
+  for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
 
-    cell_id = b_face_cells[face_id];
+    if (! _is_selected(b_face_sel, face_id))
+      continue;
+
+    cs_lnum_t cell_id = b_face_cells[face_id];
 
     cs_real_3_t normal;
     /* Normal is vector 0 if the b_face_normal norm is too small */
@@ -1981,8 +2522,10 @@ _compute_face_vectors(int                dim,
  *   cell_cen       <--  cell center
  *   cell_vol       <--  cell volume
  *   dist           <--  interior distance
- *   diipf          -->  vector ii' for interior faces
- *   djjpf          -->  vector jj' for interior faces
+ *   i_face_sel     <--  optional selection flag for interior faces
+ *                       to update, or NULL
+ *   diipf          <->  vector ii' for interior faces
+ *   djjpf          <->  vector jj' for interior faces
  *----------------------------------------------------------------------------*/
 
 static void
@@ -1994,6 +2537,7 @@ _compute_face_sup_vectors(const cs_lnum_t    n_cells,
                           const cs_real_t    cell_cen[][3],
                           const cs_real_t    cell_vol[],
                           const cs_real_t    dist[],
+                          const char         i_face_sel[],
                           cs_real_t          diipf[][3],
                           cs_real_t          djjpf[][3])
 {
@@ -2001,8 +2545,12 @@ _compute_face_sup_vectors(const cs_lnum_t    n_cells,
 
   /* Interior faces */
 
+# pragma omp parallel for reduction(+:w_count) if (n_i_faces > CS_THR_MIN)
   for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
 
+    if (! _is_selected(i_face_sel, face_id))
+      continue;
+
     cs_lnum_t cell_id1 = i_face_cells[face_id][0];
     cs_lnum_t cell_id2 = i_face_cells[face_id][1];
 
@@ -2100,6 +2648,154 @@ _compute_face_sup_vectors(const cs_lnum_t    n_cells,
 
 }
 
+/*----------------------------------------------------------------------------
+ * Compute face distances, weights, and vectors handling non-orthogonalities.
+ *
+ * parameters:
+ *   mesh            <--  pointer to a cs_mesh_t structure
+ *   mesh_quantities <->  pointer to a cs_mesh_quantities_t structure
+ *   i_face_sel      <--  optional selection flag for interior faces
+ *                        to update, or NULL
+ *   b_face_sel      <--  likewise for border faces
+ *----------------------------------------------------------------------------*/
+
+static void
+_compute_face_dependent_quantities(const cs_mesh_t       *mesh,
+                                   cs_mesh_quantities_t  *mesh_quantities,
+                                   const char             i_face_sel[],
+                                   const char             b_face_sel[])
+{
+  const cs_lnum_t  dim = mesh->dim;
+  const cs_lnum_t  n_cells = mesh->n_cells;
+  const cs_lnum_t  n_i_faces = mesh->n_i_faces;
+  const cs_lnum_t  n_b_faces = mesh->n_b_faces;
+
+  /* Compute some distances relative to faces and associated weighting */
+
+  _compute_face_distances(n_i_faces,
+                          n_b_faces,
+                          (const cs_lnum_2_t *)(mesh->i_face_cells),
+                          mesh->b_face_cells,
+                          (const cs_real_3_t *)(mesh_quantities->i_face_normal),
+                          (const cs_real_3_t *)(mesh_quantities->b_face_normal),
+                          (const cs_real_3_t *)(mesh_quantities->i_face_cog),
+                          (const cs_real_3_t *)(mesh_quantities->b_face_cog),
+                          (const cs_real_3_t *)(mesh_quantities->cell_cen),
+                          (const cs_real_t *)(mesh_quantities->cell_vol),
+                          i_face_sel,
+                          b_face_sel,
+                          mesh_quantities->i_dist,
+                          mesh_quantities->b_dist,
+                          mesh_quantities->weight);
+
+  /* Compute some vectors relative to faces to handle non-orthogonalities */
+
+  _compute_face_vectors(dim,
+                        n_i_faces,
+                        n_b_faces,
+                        (const cs_lnum_2_t *)(mesh->i_face_cells),
+                        mesh->b_face_cells,
+                        mesh_quantities->i_face_normal,
+                        mesh_quantities->b_face_normal,
+                        mesh_quantities->i_face_cog,
+                        mesh_quantities->b_face_cog,
+                        mesh_quantities->i_face_surf,
+                        mesh_quantities->cell_cen,
+                        mesh_quantities->weight,
+                        mesh_quantities->b_dist,
+                        i_face_sel,
+                        b_face_sel,
+                        mesh_quantities->dijpf,
+                        mesh_quantities->diipb,
+                        mesh_quantities->dofij);
+
+  /* Compute additional vectors relative to faces to handle non-orthogonalities */
+
+  _compute_face_sup_vectors
+    (n_cells,
+     n_i_faces,
+     (const cs_lnum_2_t *)(mesh->i_face_cells),
+     (const cs_real_3_t *)(mesh_quantities->i_face_normal),
+     (const cs_real_3_t *)(mesh_quantities->i_face_cog),
+     (const cs_real_3_t *)(mesh_quantities->cell_cen),
+     mesh_quantities->cell_vol,
+     mesh_quantities->i_dist,
+     i_face_sel,
+     (cs_real_3_t *)(mesh_quantities->diipf),
+     (cs_real_3_t *)(mesh_quantities->djjpf));
+}
+
+/*----------------------------------------------------------------------------
+ * Compute the total, min, and max volumes of cells over all ranks.
+ *
+ * parameters:
+ *   mesh            <--  pointer to mesh structure
+ *   mesh_quantities <->  pointer to a cs_mesh_quantities_t structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_parall_cell_volume_reductions(const cs_mesh_t       *mesh,
+                               cs_mesh_quantities_t  *mesh_quantities)
+{
+  _cell_volume_reductions(mesh,
+                          mesh_quantities->cell_vol,
+                          &(mesh_quantities->min_vol),
+                          &(mesh_quantities->max_vol),
+                          &(mesh_quantities->tot_vol));
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+
+    cs_real_t  _min_vol, _max_vol, _tot_vol;
+
+    MPI_Allreduce(&(mesh_quantities->min_vol), &_min_vol, 1, CS_MPI_REAL,
+                  MPI_MIN, cs_glob_mpi_comm);
+
+    MPI_Allreduce(&(mesh_quantities->max_vol), &_max_vol, 1, CS_MPI_REAL,
+                  MPI_MAX, cs_glob_mpi_comm);
+
+    MPI_Allreduce(&(mesh_quantities->tot_vol), &_tot_vol, 1, CS_MPI_REAL,
+                  MPI_SUM, cs_glob_mpi_comm);
+
+    mesh_quantities->min_vol = _min_vol;
+    mesh_quantities->max_vol = _max_vol;
+    mesh_quantities->tot_vol = _tot_vol;
+
+  }
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Print information on control volumes.
+ *
+ * parameters:
+ *   mesh_quantities <--  pointer to a cs_mesh_quantities_t structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_volume_info(const cs_mesh_quantities_t  *mesh_quantities)
+{
+  if (_n_computations == 1)
+    bft_printf(_(" --- Information on the volumes\n"
+                 "       Minimum control volume      = %14.7e\n"
+                 "       Maximum control volume      = %14.7e\n"
+                 "       Total volume for the domain = %14.7e\n"),
+               mesh_quantities->min_vol, mesh_quantities->max_vol,
+               mesh_quantities->tot_vol);
+  else {
+    if (mesh_quantities->min_vol <= 0.) {
+      bft_printf(_(" --- Information on the volumes\n"
+                   "       Minimum control volume      = %14.7e\n"
+                   "       Maximum control volume      = %14.7e\n"
+                   "       Total volume for the domain = %14.7e\n"),
+                 mesh_quantities->min_vol, mesh_quantities->max_vol,
+                 mesh_quantities->tot_vol);
+      bft_printf(_("\nAbort due to the detection of a negative control "
+                   "volume.\n"));
+    }
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Evaluate boundary thickness.
  *
@@ -2415,29 +3111,29 @@ cs_mesh_quantities_compute_preprocess(const cs_mesh_t       *mesh,
 
   /* If this is not an update, allocate members of the structure */
 
-  if (mesh_quantities->i_face_normal == NULL)
-    BFT_MALLOC(mesh_quantities->i_face_normal, n_i_faces*3, cs_real_t);
+  _alloc_real(mesh->i_face_numbering, n_i_faces, 3,
+              &(mesh_quantities->i_face_normal));
 
-  if (mesh_quantities->i_face_cog == NULL)
-    BFT_MALLOC(mesh_quantities->i_face_cog, n_i_faces*3, cs_real_t);
+  _alloc_real(mesh->i_face_numbering, n_i_faces, 3,
+              &(mesh_quantities->i_face_cog));
 
-  if (mesh_quantities->b_face_normal == NULL)
-    BFT_MALLOC(mesh_quantities->b_face_normal, n_b_faces*3, cs_real_t);
+  _alloc_real(mesh->b_face_numbering, n_b_faces, 3,
+              &(mesh_quantities->b_face_normal));
 
-  if (mesh_quantities->b_face_cog == NULL)
-    BFT_MALLOC(mesh_quantities->b_face_cog, n_b_faces*3, cs_real_t);
+  _alloc_real(mesh->b_face_numbering, n_b_faces, 3,
+              &(mesh_quantities->b_face_cog));
 
-  if (mesh_quantities->cell_cen == NULL)
-    BFT_MALLOC(mesh_quantities->cell_cen, n_cells_with_ghosts*3, cs_real_t);
+  _alloc_real(mesh->cell_numbering, n_cells_with_ghosts, 3,
+              &(mesh_quantities->cell_cen));
 
-  if (mesh_quantities->cell_vol == NULL)
-    BFT_MALLOC(mesh_quantities->cell_vol, n_cells_with_ghosts, cs_real_t);
+  _alloc_real(mesh->cell_numbering, n_cells_with_ghosts, 1,
+              &(mesh_quantities->cell_vol));
 
-  if (mesh_quantities->i_face_surf == NULL)
-    BFT_MALLOC(mesh_quantities->i_face_surf, n_i_faces, cs_real_t);
+  _alloc_real(mesh->i_face_numbering, n_i_faces, 1,
+              &(mesh_quantities->i_face_surf));
 
-  if (mesh_quantities->b_face_surf == NULL)
-    BFT_MALLOC(mesh_quantities->b_face_surf, n_b_faces, cs_real_t);
+  _alloc_real(mesh->b_face_numbering, n_b_faces, 1,
+              &(mesh_quantities->b_face_surf));
 
   /* Compute face centers of gravity, normals, and surfaces */
 
@@ -2445,6 +3141,7 @@ cs_mesh_quantities_compute_preprocess(const cs_mesh_t       *mesh,
                            (const cs_real_3_t *)mesh->vtx_coord,
                            mesh->i_face_vtx_idx,
                            mesh->i_face_vtx_lst,
+                           NULL,
                            (cs_real_3_t *)mesh_quantities->i_face_cog,
                            (cs_real_3_t *)mesh_quantities->i_face_normal);
 
@@ -2456,6 +3153,7 @@ cs_mesh_quantities_compute_preprocess(const cs_mesh_t       *mesh,
                            (const cs_real_3_t *)mesh->vtx_coord,
                            mesh->b_face_vtx_idx,
                            mesh->b_face_vtx_lst,
+                           NULL,
                            (cs_real_3_t *)mesh_quantities->b_face_cog,
                            (cs_real_3_t *)mesh_quantities->b_face_normal);
 
@@ -2520,6 +3218,7 @@ cs_mesh_quantities_compute_preprocess(const cs_mesh_t       *mesh,
                              (const cs_real_3_t *)mesh_quantities->i_face_cog,
                              (const cs_real_3_t *)mesh_quantities->b_face_normal,
                              (const cs_real_3_t *)mesh_quantities->b_face_cog,
+                             NULL,
                              (cs_real_3_t *)mesh_quantities->cell_cen,
                              mesh_quantities->cell_vol);
     volume_computed = true;
@@ -2578,6 +3277,7 @@ cs_mesh_quantities_compute_preprocess(const cs_mesh_t       *mesh,
        (const cs_real_3_t *)(mesh_quantities->b_face_normal),
        (const cs_real_3_t *)(mesh_quantities->b_face_cog),
        (const cs_real_3_t *)(mesh_quantities->cell_cen),
+       NULL,
        mesh_quantities->cell_vol);
 
 
@@ -2602,32 +3302,7 @@ cs_mesh_quantities_compute_preprocess(const cs_mesh_t       *mesh,
 
   }
 
-  _cell_volume_reductions(mesh,
-                          mesh_quantities->cell_vol,
-                          &(mesh_quantities->min_vol),
-                          &(mesh_quantities->max_vol),
-                          &(mesh_quantities->tot_vol));
-
-#if defined(HAVE_MPI)
-  if (cs_glob_n_ranks > 1) {
-
-    cs_real_t  _min_vol, _max_vol, _tot_vol;
-
-    MPI_Allreduce(&(mesh_quantities->min_vol), &_min_vol, 1, CS_MPI_REAL,
-                  MPI_MIN, cs_glob_mpi_comm);
-
-    MPI_Allreduce(&(mesh_quantities->max_vol), &_max_vol, 1, CS_MPI_REAL,
-                  MPI_MAX, cs_glob_mpi_comm);
-
-    MPI_Allreduce(&(mesh_quantities->tot_vol), &_tot_vol, 1, CS_MPI_REAL,
-                  MPI_SUM, cs_glob_mpi_comm);
-
-    mesh_quantities->min_vol = _min_vol;
-    mesh_quantities->max_vol = _max_vol;
-    mesh_quantities->tot_vol = _tot_vol;
-
-  }
-#endif
+  _parall_cell_volume_reductions(mesh, mesh_quantities);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2685,107 +3360,261 @@ cs_mesh_quantities_compute(const cs_mesh_t       *mesh,
     mesh_quantities->c_disable_flag[0] = 0;
   }
 
-  if (mesh_quantities->i_dist == NULL)
-    BFT_MALLOC(mesh_quantities->i_dist, n_i_faces, cs_real_t);
+  _alloc_real(mesh->i_face_numbering, n_i_faces, 1,
+              &(mesh_quantities->i_dist));
 
-  if (mesh_quantities->b_dist == NULL)
-    BFT_MALLOC(mesh_quantities->b_dist, n_b_faces, cs_real_t);
+  _alloc_real(mesh->b_face_numbering, n_b_faces, 1,
+              &(mesh_quantities->b_dist));
 
-  if (mesh_quantities->weight == NULL)
-    BFT_MALLOC(mesh_quantities->weight, n_i_faces, cs_real_t);
+  _alloc_real(mesh->i_face_numbering, n_i_faces, 1,
+              &(mesh_quantities->weight));
 
-  if (mesh_quantities->dijpf == NULL)
-    BFT_MALLOC(mesh_quantities->dijpf, n_i_faces*dim, cs_real_t);
+  _alloc_real(mesh->i_face_numbering, n_i_faces, dim,
+              &(mesh_quantities->dijpf));
 
-  if (mesh_quantities->diipb == NULL)
-    BFT_MALLOC(mesh_quantities->diipb, n_b_faces*dim, cs_real_t);
+  _alloc_real(mesh->b_face_numbering, n_b_faces, dim,
+              &(mesh_quantities->diipb));
 
-  if (mesh_quantities->dofij == NULL)
-    BFT_MALLOC(mesh_quantities->dofij, n_i_faces*dim, cs_real_t);
+  _alloc_real(mesh->i_face_numbering, n_i_faces, dim,
+              &(mesh_quantities->dofij));
 
-  if (mesh_quantities->diipf == NULL)
-    BFT_MALLOC(mesh_quantities->diipf, n_i_faces*dim, cs_real_t);
+  _alloc_real(mesh->i_face_numbering, n_i_faces, dim,
+              &(mesh_quantities->diipf));
 
-  if (mesh_quantities->djjpf == NULL)
-    BFT_MALLOC(mesh_quantities->djjpf, n_i_faces*dim, cs_real_t);
+  _alloc_real(mesh->i_face_numbering, n_i_faces, dim,
+              &(mesh_quantities->djjpf));
 
   if (mesh_quantities->b_sym_flag == NULL)
     BFT_MALLOC(mesh_quantities->b_sym_flag, n_b_faces, cs_int_t);
 
-  /* Compute some distances relative to faces and associated weighting */
+  /* Compute some distances relative to faces and associated weighting,
+     and vectors relative to faces to handle non-orthogonalities */
 
-  _compute_face_distances(mesh->n_i_faces,
-                          mesh->n_b_faces,
-                          (const cs_lnum_2_t *)(mesh->i_face_cells),
-                          mesh->b_face_cells,
-                          (const cs_real_3_t *)(mesh_quantities->i_face_normal),
-                          (const cs_real_3_t *)(mesh_quantities->b_face_normal),
-                          (const cs_real_3_t *)(mesh_quantities->i_face_cog),
-                          (const cs_real_3_t *)(mesh_quantities->b_face_cog),
-                          (const cs_real_3_t *)(mesh_quantities->cell_cen),
-                          (const cs_real_t *)(mesh_quantities->cell_vol),
-                          mesh_quantities->i_dist,
-                          mesh_quantities->b_dist,
-                          mesh_quantities->weight);
+  _compute_face_dependent_quantities(mesh, mesh_quantities, NULL, NULL);
 
-  /* Compute some vectors relative to faces to handle non-orthogonalities */
+  /* Build the geometrical matrix linear gradient correction */
+  if (cs_glob_mesh_quantities_flag & CS_BAD_CELLS_WARPED_CORRECTION)
+    _compute_corr_grad_lin(mesh, NULL, mesh_quantities);
 
-  _compute_face_vectors(dim,
-                        mesh->n_i_faces,
-                        mesh->n_b_faces,
-                        (const cs_lnum_2_t *)(mesh->i_face_cells),
-                        mesh->b_face_cells,
+  /* Print some information on the control volumes, and check min volume */
+
+  _volume_info(mesh_quantities);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Update mesh quantities after displacement of some vertices.
+ *
+ * Only quantities of faces containing a moved vertex, of cells adjacent
+ * to those faces, and of faces adjacent to those cells are recomputed;
+ * other quantities are reused. This is useful for ALE computations, in
+ * which only a small part of the mesh usually moves.
+ *
+ * Results are identical to those of \ref cs_mesh_quantities_compute.
+ * That function is called instead if no moved vertex flag is given,
+ * if quantities were not computed yet, or if options requiring a global
+ * update (cell or face center corrections, volume smoothing, porosity,
+ * disabled cells) are active.
+ *
+ * \param[in]       mesh             pointer to mesh structure
+ * \param[in]       vtx_moved        flag for moved vertices, or NULL
+ * \param[in, out]  mesh_quantities  pointer to mesh quantities structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_quantities_update_moved(const cs_mesh_t       *mesh,
+                                const bool             vtx_moved[],
+                                cs_mesh_quantities_t  *mesh_quantities)
+{
+  const unsigned global_flag_mask = (  CS_CELL_FACE_CENTER_CORRECTION
+                                     | CS_CELL_CENTER_CORRECTION
+                                     | CS_CELL_VOLUME_RATIO_CORRECTION
+                                     | CS_FACE_CENTER_REFINE);
+
+  if (   vtx_moved == NULL
+      || mesh_quantities->i_dist == NULL
+      || (cs_glob_mesh_quantities_flag & global_flag_mask)
+      || _ajust_face_cog_compat_v11_v52
+      || cs_glob_porous_model > 0
+      || mesh_quantities->has_disable_flag != 0) {
+    cs_mesh_quantities_compute(mesh, mesh_quantities);
+    return;
+  }
+
+  const cs_lnum_t  n_i_faces = mesh->n_i_faces;
+  const cs_lnum_t  n_b_faces = mesh->n_b_faces;
+  const cs_lnum_t  n_cells_with_ghosts = mesh->n_cells_with_ghosts;
+  const cs_lnum_2_t  *i_face_cells
+    = (const cs_lnum_2_t *)(mesh->i_face_cells);
+  const cs_lnum_t  *b_face_cells = mesh->b_face_cells;
+
+  /* Update the number of passes */
+
+  _n_computations++;
+
+  /* Mark moved faces and adjacent cells */
+
+  char *i_face_sel, *b_face_sel, *cell_sel;
+  BFT_MALLOC(i_face_sel, n_i_faces, char);
+  BFT_MALLOC(b_face_sel, n_b_faces, char);
+  BFT_MALLOC(cell_sel, n_cells_with_ghosts, char);
+
+# pragma omp parallel for  if (n_i_faces > CS_THR_MIN)
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    i_face_sel[f_id] = 0;
+    for (cs_lnum_t i = mesh->i_face_vtx_idx[f_id];
+         i < mesh->i_face_vtx_idx[f_id+1];
+         i++) {
+      if (vtx_moved[mesh->i_face_vtx_lst[i]]) {
+        i_face_sel[f_id] = 1;
+        break;
+      }
+    }
+  }
+
+# pragma omp parallel for  if (n_b_faces > CS_THR_MIN)
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+    b_face_sel[f_id] = 0;
+    for (cs_lnum_t i = mesh->b_face_vtx_idx[f_id];
+         i < mesh->b_face_vtx_idx[f_id+1];
+         i++) {
+      if (vtx_moved[mesh->b_face_vtx_lst[i]]) {
+        b_face_sel[f_id] = 1;
+        break;
+      }
+    }
+  }
+
+  memset(cell_sel, 0, n_cells_with_ghosts);
+
+  /* Concurrent writes of the same value are harmless here */
+
+# pragma omp parallel for  if (n_i_faces > CS_THR_MIN)
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    if (i_face_sel[f_id]) {
+      cell_sel[i_face_cells[f_id][0]] = 1;
+      cell_sel[i_face_cells[f_id][1]] = 1;
+    }
+  }
+
+# pragma omp parallel for  if (n_b_faces > CS_THR_MIN)
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+    if (b_face_sel[f_id] && b_face_cells[f_id] > -1)
+      cell_sel[b_face_cells[f_id]] = 1;
+  }
+
+  /* Update face centers of gravity, normals, and surfaces */
+
+  _compute_face_quantities(n_i_faces,
+                           (const cs_real_3_t *)mesh->vtx_coord,
+                           mesh->i_face_vtx_idx,
+                           mesh->i_face_vtx_lst,
+                           i_face_sel,
+                           (cs_real_3_t *)mesh_quantities->i_face_cog,
+                           (cs_real_3_t *)mesh_quantities->i_face_normal);
+
+  _compute_face_surface(n_i_faces,
                         mesh_quantities->i_face_normal,
+                        mesh_quantities->i_face_surf);
+
+  _compute_face_quantities(n_b_faces,
+                           (const cs_real_3_t *)mesh->vtx_coord,
+                           mesh->b_face_vtx_idx,
+                           mesh->b_face_vtx_lst,
+                           b_face_sel,
+                           (cs_real_3_t *)mesh_quantities->b_face_cog,
+                           (cs_real_3_t *)mesh_quantities->b_face_normal);
+
+  _compute_face_surface(n_b_faces,
                         mesh_quantities->b_face_normal,
-                        mesh_quantities->i_face_cog,
-                        mesh_quantities->b_face_cog,
-                        mesh_quantities->i_face_surf,
-                        mesh_quantities->cell_cen,
-                        mesh_quantities->weight,
-                        mesh_quantities->b_dist,
-                        mesh_quantities->dijpf,
-                        mesh_quantities->diipb,
-                        mesh_quantities->dofij);
+                        mesh_quantities->b_face_surf);
 
-  /* Compute additional vectors relative to faces to handle non-orthogonalities */
+  /* Update cell centers and volumes */
 
-  _compute_face_sup_vectors
-    (mesh->n_cells,
-     mesh->n_i_faces,
-     (const cs_lnum_2_t *)(mesh->i_face_cells),
-     (const cs_real_3_t *)(mesh_quantities->i_face_normal),
-     (const cs_real_3_t *)(mesh_quantities->i_face_cog),
-     (const cs_real_3_t *)(mesh_quantities->cell_cen),
-     mesh_quantities->cell_vol,
-     mesh_quantities->i_dist,
-     (cs_real_3_t *)(mesh_quantities->diipf),
-     (cs_real_3_t *)(mesh_quantities->djjpf));
+  if (_cell_cen_algorithm == 1)
+    _compute_cell_quantities(mesh,
+                             (const cs_real_3_t *)mesh_quantities->i_face_normal,
+                             (const cs_real_3_t *)mesh_quantities->i_face_cog,
+                             (const cs_real_3_t *)mesh_quantities->b_face_normal,
+                             (const cs_real_3_t *)mesh_quantities->b_face_cog,
+                             cell_sel,
+                             (cs_real_3_t *)mesh_quantities->cell_cen,
+                             mesh_quantities->cell_vol);
+
+  else {
+    _cell_faces_cog(mesh,
+                    mesh_quantities->i_face_normal,
+                    mesh_quantities->i_face_cog,
+                    mesh_quantities->b_face_normal,
+                    mesh_quantities->b_face_cog,
+                    cell_sel,
+                    mesh_quantities->cell_cen);
+
+    _compute_cell_volume
+      (mesh,
+       (const cs_real_3_t *)(mesh_quantities->i_face_normal),
+       (const cs_real_3_t *)(mesh_quantities->i_face_cog),
+       (const cs_real_3_t *)(mesh_quantities->b_face_normal),
+       (const cs_real_3_t *)(mesh_quantities->b_face_cog),
+       (const cs_real_3_t *)(mesh_quantities->cell_cen),
+       cell_sel,
+       mesh_quantities->cell_vol);
+  }
+
+  /* Synchronize geometric quantities and selection */
+
+  if (mesh->halo != NULL) {
+
+    cs_halo_sync_var_strided(mesh->halo, CS_HALO_EXTENDED,
+                             mesh_quantities->cell_cen, 3);
+    if (mesh->n_init_perio > 0)
+      cs_halo_perio_sync_coords(mesh->halo, CS_HALO_EXTENDED,
+                                mesh_quantities->cell_cen);
+
+    cs_halo_sync_var(mesh->halo, CS_HALO_EXTENDED, mesh_quantities->cell_vol);
+
+    cs_halo_sync_untyped(mesh->halo, CS_HALO_EXTENDED, 1, cell_sel);
+
+  }
+
+  _parall_cell_volume_reductions(mesh, mesh_quantities);
+
+  /* No porous model here, so fluid volumes are the cell volumes */
+
+  mesh_quantities->min_f_vol = mesh_quantities->min_vol;
+  mesh_quantities->max_f_vol = mesh_quantities->max_vol;
+  mesh_quantities->tot_f_vol = mesh_quantities->tot_vol;
+
+  /* Faces adjacent to updated cells have updated distances and vectors */
+
+# pragma omp parallel for  if (n_i_faces > CS_THR_MIN)
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    if (cell_sel[i_face_cells[f_id][0]] || cell_sel[i_face_cells[f_id][1]])
+      i_face_sel[f_id] = 1;
+  }
+
+# pragma omp parallel for  if (n_b_faces > CS_THR_MIN)
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+    if (b_face_cells[f_id] > -1 && cell_sel[b_face_cells[f_id]])
+      b_face_sel[f_id] = 1;
+  }
+
+  _compute_face_dependent_quantities(mesh, mesh_quantities,
+                                     i_face_sel, b_face_sel);
+
+  /* Update the geometrical matrix linear gradient correction */
 
-  /* Build the geometrical matrix linear gradient correction */
   if (cs_glob_mesh_quantities_flag & CS_BAD_CELLS_WARPED_CORRECTION)
-    _compute_corr_grad_lin(mesh, mesh_quantities);
+    _compute_corr_grad_lin(mesh, cell_sel, mesh_quantities);
+
+  BFT_FREE(cell_sel);
+  BFT_FREE(b_face_sel);
+  BFT_FREE(i_face_sel);
 
   /* Print some information on the control volumes, and check min volume */
 
-  if (_n_computations == 1)
-    bft_printf(_(" --- Information on the volumes\n"
-                 "       Minimum control volume      = %14.7e\n"
-                 "       Maximum control volume      = %14.7e\n"
-                 "       Total volume for the domain = %14.7e\n"),
-               mesh_quantities->min_vol, mesh_quantities->max_vol,
-               mesh_quantities->tot_vol);
-  else {
-    if (mesh_quantities->min_vol <= 0.) {
-      bft_printf(_(" --- Information on the volumes\n"
-                   "       Minimum control volume      = %14.7e\n"
-                   "       Maximum control volume      = %14.7e\n"
-                   "       Total volume for the domain = %14.7e\n"),
-                 mesh_quantities->min_vol, mesh_quantities->max_vol,
-                 mesh_quantities->tot_vol);
-      bft_printf(_("\nAbort due to the detection of a negative control "
-                   "volume.\n"));
-    }
-  }
+  _volume_info(mesh_quantities);
 }
 
 /*----------------------------------------------------------------------------
@@ -2905,11 +3734,11 @@ cs_mesh_quantities_sup_vectors(const cs_mesh_t       *mesh,
   cs_lnum_t  dim = mesh->dim;
   cs_lnum_t  n_i_faces = mesh->n_i_faces;
 
-  if (mesh_quantities->diipf == NULL)
-    BFT_MALLOC(mesh_quantities->diipf, n_i_faces*dim, cs_real_t);
+  _alloc_real(mesh->i_face_numbering, n_i_faces, dim,
+              &(mesh_quantities->diipf));
 
-  if (mesh_quantities->djjpf == NULL)
-    BFT_MALLOC(mesh_quantities->djjpf, n_i_faces*dim, cs_real_t);
+  _alloc_real(mesh->i_face_numbering, n_i_faces, dim,
+              &(mesh_quantities->djjpf));
 
   _compute_face_sup_vectors
     (mesh->n_cells,
@@ -2920,6 +3749,7 @@ cs_mesh_quantities_sup_vectors(const cs_mesh_t       *mesh,
      (const cs_real_3_t *)(mesh_quantities->cell_cen),
      mesh_quantities->cell_vol,
      mesh_quantities->i_dist,
+     NULL,
      (cs_real_3_t *)(mesh_quantities->diipf),
      (cs_real_3_t *)(mesh_quantities->djjpf));
 }
@@ -2994,6 +3824,7 @@ cs_mesh_quantities_i_faces(const cs_mesh_t   *mesh,
                            (const cs_real_3_t *)mesh->vtx_coord,
                            mesh->i_face_vtx_idx,
                            mesh->i_face_vtx_lst,
+                           NULL,
                            (cs_real_3_t *)i_face_cog,
                            (cs_real_3_t *)i_face_normal);
 
@@ -3027,6 +3858,7 @@ cs_mesh_quantities_b_faces(const cs_mesh_t   *mesh,
                            (const cs_real_3_t *)mesh->vtx_coord,
                            mesh->b_face_vtx_idx,
                            mesh->b_face_vtx_lst,
+                           NULL,
                            (cs_real_3_t *)b_face_cog,
                            (cs_real_3_t *)b_face_normal);
 
@@ -3064,18 +3896,6 @@ cs_mesh_quantities_cell_faces_cog(const cs_mesh_t  *mesh,
                                   const cs_real_t   b_face_cog[],
                                   cs_real_t         cell_cen[])
 {
-  cs_real_t  *cell_area = NULL;
-
-  /* Mesh connectivity */
-
-  const  cs_lnum_t  n_i_faces = mesh->n_i_faces;
-  const  cs_lnum_t  n_b_faces = mesh->n_b_faces;
-  const  cs_lnum_t  n_cells = mesh->n_cells;
-  const  cs_lnum_t  n_cells_with_ghosts = mesh->n_cells_with_ghosts;
-  const  cs_lnum_2_t  *i_face_cells
-    = (const cs_lnum_2_t *)(mesh->i_face_cells);
-  const  cs_lnum_t  *b_face_cells = mesh->b_face_cells;
-
   /* Return if ther is not enough data (Solcom case except rediative module
      or Pre-processor 1.2.d without option "-n") */
 
@@ -3086,89 +3906,13 @@ cs_mesh_quantities_cell_faces_cog(const cs_mesh_t  *mesh,
 
   assert(cell_cen != NULL);
 
-  /* Initialization */
-
-  BFT_MALLOC(cell_area, n_cells_with_ghosts, cs_real_t);
-
-  for (cs_lnum_t j = 0; j < n_cells_with_ghosts; j++) {
-
-    cell_area[j] = 0.;
-
-    for (cs_lnum_t i = 0; i < 3; i++)
-      cell_cen[3*j + i] = 0.;
-
-  }
-
-  /* Loop on interior faces
-     ---------------------- */
-
-  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
-
-    /* For each cell sharing the internal face, we update
-     * cell_cen and cell_area */
-
-    cs_lnum_t c_id1 = i_face_cells[f_id][0];
-    cs_lnum_t c_id2 = i_face_cells[f_id][1];
-
-    /* Computation of the area of the face */
-
-    cs_real_t area = cs_math_3_norm(i_face_norm + 3*f_id);
-
-    if (c_id1 > -1) {
-      cell_area[c_id1] += area;
-      for (cs_lnum_t i = 0; i < 3; i++)
-        cell_cen[3*c_id1 + i] += i_face_cog[3*f_id + i]*area;
-    }
-    if (c_id2 > -1) {
-      cell_area[c_id2] += area;
-      for (cs_lnum_t i = 0; i < 3; i++)
-        cell_cen[3*c_id2 + i] += i_face_cog[3*f_id + i]*area;
-    }
-
-  } /* End of loop on interior faces */
-
-  /* Loop on boundary faces
-     --------------------- */
-
-  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
-
-    /* For each cell sharing a border face, we update the numerator
-     * of cell_cen and cell_area */
-
-    cs_lnum_t c_id1 = b_face_cells[f_id];
-
-    /* Computation of the area of the face
-       (note that c_id1 == -1 may happen for isolated faces,
-       which are cleaned afterwards) */
-
-    if (c_id1 > -1) {
-
-      cs_real_t area = cs_math_3_norm(b_face_norm + 3*f_id);
-
-      cell_area[c_id1] += area;
-
-      /* Computation of the numerator */
-
-      for (cs_lnum_t i = 0; i < 3; i++)
-        cell_cen[3*c_id1 + i] += b_face_cog[3*f_id + i]*area;
-
-    }
-
-  } /* End of loop on boundary faces */
-
-  /* Loop on cells to finalize the computation of center of gravity
-     -------------------------------------------------------------- */
-
-  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-
-    for (cs_lnum_t i = 0; i < 3; i++)
-      cell_cen[c_id*3 + i] /= cell_area[c_id];
-
-  }
-
-  /* Free memory */
-
-  BFT_FREE(cell_area);
+  _cell_faces_cog(mesh,
+                  i_face_norm,
+                  i_face_cog,
+                  b_face_norm,
+                  b_face_cog,
+                  NULL,
+                  cell_cen);
 }
 
 /*----------------------------------------------------------------------------
@@ -3204,6 +3948,7 @@ cs_mesh_quantities_cell_volume(const cs_mesh_t  *mesh)
                            (const cs_real_3_t *)i_face_cog,
                            (const cs_real_3_t *)b_face_normal,
                            (const cs_real_3_t *)b_face_cog,
+                           NULL,
                            (cs_real_3_t *)cell_cen,
                            cell_vol);
 
@@ -281,6 +281,32 @@ void
 cs_mesh_quantities_compute(const cs_mesh_t       *mesh,
                            cs_mesh_quantities_t  *mesh_quantities);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Update mesh quantities after displacement of some vertices.
+ *
+ * Only quantities of faces containing a moved vertex, of cells adjacent
+ * to those faces, and of faces adjacent to those cells are recomputed;
+ * other quantities are reused. This is useful for ALE computations, in
+ * which only a small part of the mesh usually moves.
+ *
+ * Results are identical to those of \ref cs_mesh_quantities_compute.
+ * That function is called instead if no moved vertex flag is given,
+ * if quantities were not computed yet, or if options requiring a global
+ * update (cell or face center corrections, volume smoothing, porosity,
+ * disabled cells) are active.
+ *
+ * \param[in]       mesh             pointer to mesh structure
+ * \param[in]       vtx_moved        flag for moved vertices, or NULL
+ * \param[in, out]  mesh_quantities  pointer to mesh quantities structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_quantities_update_moved(const cs_mesh_t       *mesh,
+                                const bool             vtx_moved[],
+                                cs_mesh_quantities_t  *mesh_quantities);
+
 /*----------------------------------------------------------------------------
  * Compute fluid mesh quantities
  *
@@ -4197,6 +4197,36 @@ void
 cs_mesh_refine_simple(cs_mesh_t  *m,
                       bool        conforming,
                       const int   cell_flag[])
+{
+  cs_mesh_refine_simple_o2n(m, conforming, cell_flag, NULL, NULL);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Refine flagged mesh cells, returning old to new mappings.
+ *
+ * New cells (resp. boundary faces) built from old cell (resp. boundary
+ * face) i have ids cell_o2n_idx[i] to cell_o2n_idx[i+1] - 1
+ * (resp. b_f_o2n_idx[i] to b_f_o2n_idx[i+1] - 1).
+ *
+ * The caller is responsible for freeing the returned arrays.
+ *
+ * \param[in, out]  m               mesh
+ * \param[in]       conforming      if true, propagate refinement to ensure
+ *                                  subdivision is conforming
+ * \param[in]       cell_flag       subdivision type for each cell
+ *                                  (0: none; 1: isotropic)
+ * \param[out]      cell_o2n_idx    old to new cells index, or NULL
+ * \param[out]      b_f_o2n_idx     old to new boundary faces index, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_refine_simple_o2n(cs_mesh_t   *m,
+                          bool         conforming,
+                          const int    cell_flag[],
+                          cs_lnum_t   *cell_o2n_idx[],
+                          cs_lnum_t   *b_f_o2n_idx[])
 {
   /* Timers:
      0: total
@@ -4589,7 +4619,10 @@ cs_mesh_refine_simple(cs_mesh_t  *m,
 
   BFT_FREE(c2f2v_start);
 
-  BFT_FREE(c_o2n_idx);
+  if (cell_o2n_idx != NULL)
+    *cell_o2n_idx = c_o2n_idx;
+  else
+    BFT_FREE(c_o2n_idx);
   BFT_FREE(c_i_face_idx);
   BFT_FREE(c_i_face_connect_idx);
 
@@ -4602,7 +4635,10 @@ cs_mesh_refine_simple(cs_mesh_t  *m,
   cs_adjacency_destroy(&v2v);
 
   BFT_FREE(i_face_o2n_idx);
-  BFT_FREE(b_face_o2n_idx);
+  if (b_f_o2n_idx != NULL)
+    *b_f_o2n_idx = b_face_o2n_idx;
+  else
+    BFT_FREE(b_face_o2n_idx);
 
   BFT_FREE(c_r_level);
   BFT_FREE(c_r_flag);
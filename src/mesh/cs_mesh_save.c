@@ -55,10 +55,12 @@
 #include "cs_base.h"
 #include "cs_block_dist.h"
 #include "cs_io.h"
+#include "cs_log.h"
 #include "cs_mesh.h"
 #include "cs_mesh_builder.h"
 #include "cs_mesh_to_builder.h"
 #include "cs_part_to_block.h"
+#include "cs_timer.h"
 
 /*----------------------------------------------------------------------------
  *  Header for the current file
@@ -127,6 +129,8 @@ cs_mesh_save(cs_mesh_t          *mesh,
 
   bool transfer = false;
 
+  double t_start = cs_timer_wtime();
+
 #if defined(HAVE_MPI)
 
   MPI_Info  hints;
@@ -213,7 +217,19 @@ cs_mesh_save(cs_mesh_t          *mesh,
 
   /* Close file */
 
+  double data_size = (double)cs_io_get_offset(pp_out) / (1024.*1024.);
+
   cs_io_finalize(&pp_out);
+
+  /* Log throughput, including distribution of data to blocks */
+
+  double t_elapsed = cs_timer_wtime() - t_start;
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\nMesh output to \"%s\":\n"
+                  "  %12.3f MiB written in %12.5f s (%.3f MiB/s)\n"),
+                filename, data_size, t_elapsed,
+                (t_elapsed > 0) ? data_size / t_elapsed : 0.);
 }
 
 /*----------------------------------------------------------------------------*/
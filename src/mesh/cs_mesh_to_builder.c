@@ -179,15 +179,12 @@ _mesh_to_builder_face_vertices_g(const cs_mesh_t     *mesh,
  * parameters:
  *   mesh     <-- pointer to mesh structure
  *   mb       <-> mesh builder
- *   transfer <-- if true, mesh transferred to builder; if false, builder
- *                is a temporary copy
  *   pp_out   <-- pointer to output file
  *----------------------------------------------------------------------------*/
 
 static void
 _write_face_vertices_g(const cs_mesh_t    *mesh,
                        cs_mesh_builder_t  *mb,
-                       bool                transfer,
                        cs_io_t            *pp_out)
 {
   cs_lnum_t i;
@@ -240,43 +237,31 @@ _write_face_vertices_g(const cs_mesh_t    *mesh,
 
   /* Now write buffer */
 
-  cs_io_write_block_buffer("face_vertices_index",
-                           n_g_faces + 1,
-                           idx_range[0],
-                           idx_range[1],
-                           2, /* location_id, */
-                           1, /* index id */
-                           1, /* n_location_vals */
-                           gnum_type,
-                           face_vtx_idx_g,
-                           pp_out);
+  cs_io_iwrite_block("face_vertices_index",
+                     n_g_faces + 1,
+                     idx_range[0],
+                     idx_range[1],
+                     2, /* location_id, */
+                     1, /* index id */
+                     1, /* n_location_vals */
+                     gnum_type,
+                     face_vtx_idx_g,
+                     pp_out);
 
   BFT_FREE(face_vtx_idx_g);
 
   /* Build connectivity */
 
-  if (transfer == true)
-    cs_io_write_block("face_vertices",
-                      g_vtx_connect_size,
-                      idx_range[2],
-                      idx_range[3],
-                      2, /* location_id, */
-                      1, /* index id */
-                      1, /* n_location_vals */
-                      gnum_type,
-                      mb->face_vertices,
-                      pp_out);
-  else
-    cs_io_write_block_buffer("face_vertices",
-                             g_vtx_connect_size,
-                             idx_range[2],
-                             idx_range[3],
-                             2, /* location_id, */
-                             1, /* index id */
-                             1, /* n_location_vals */
-                             gnum_type,
-                             mb->face_vertices,
-                             pp_out);
+  cs_io_iwrite_block("face_vertices",
+                     g_vtx_connect_size,
+                     idx_range[2],
+                     idx_range[3],
+                     2, /* location_id, */
+                     1, /* index id */
+                     1, /* n_location_vals */
+                     gnum_type,
+                     mb->face_vertices,
+                     pp_out);
 }
 
 /*----------------------------------------------------------------------------
@@ -301,9 +286,7 @@ _mesh_to_builder_g(cs_mesh_t          *mesh,
 
   cs_part_to_block_t *d = NULL;
 
-  cs_lnum_t *face_gc_id = NULL;
   cs_gnum_t *cell_gnum = NULL, *face_gnum = NULL;
-  cs_gnum_t *face_cell_g = NULL;
 
   const cs_lnum_t n_i_faces = mesh->n_i_faces;
   const cs_lnum_t n_b_faces = mesh->n_b_faces;
@@ -361,219 +344,153 @@ _mesh_to_builder_g(cs_mesh_t          *mesh,
   cs_part_to_block_transfer_gnum(d, face_gnum);
   face_gnum = NULL;
 
-  /* Face -> cell connectivity */
-  /*---------------------------*/
-
-  /* Build global cell numbering including parallel halos,
-     except for periodic values */
+  /* Face -> cell connectivity, group classes and refinement generation */
+  /*--------------------------------------------------------------------*/
 
-  cell_gnum = cs_mesh_get_cell_gnum(mesh, 1);
-
-  BFT_MALLOC(face_cell_g, n_faces*2, cs_gnum_t);
-
-  for (i = 0; i < n_i_faces; i++) {
-    face_cell_g[i*2]     = cell_gnum[mesh->i_face_cells[i][0]];
-    face_cell_g[i*2 + 1] = cell_gnum[mesh->i_face_cells[i][1]];
-  }
-  for (i = 0, j = n_i_faces; i < n_b_faces; i++, j++) {
-    face_cell_g[j*2] = cell_gnum[mesh->b_face_cells[i]];
-    face_cell_g[j*2 + 1] = 0;
-  }
+  /* All face-based values are packed in a single record per face,
+     so as to distribute them to blocks in a single exchange */
 
-  BFT_FREE(cell_gnum);
+  {
+    const size_t fc_size = 2*sizeof(cs_gnum_t);
+    const size_t rec_size =   fc_size + sizeof(int)
+                            + ((mb->have_face_r_gen) ? 1 : 0);
+    const cs_lnum_t n_block_faces
+      = mb->face_bi.gnum_range[1] - mb->face_bi.gnum_range[0];
 
-  if (transfer == true) {
-    BFT_FREE(mesh->global_cell_num);
-    BFT_FREE(mesh->i_face_cells);
-    BFT_FREE(mesh->b_face_cells);
-  }
+    unsigned char *face_rec = NULL, *block_rec = NULL;
 
-  /* Distribute to blocks and write */
+    /* Build global cell numbering including parallel halos,
+       except for periodic values */
 
-  BFT_MALLOC(mb->face_cells,
-             (mb->face_bi.gnum_range[1] - mb->face_bi.gnum_range[0]) * 2,
-             cs_gnum_t);
+    cell_gnum = cs_mesh_get_cell_gnum(mesh, 1);
 
-  cs_part_to_block_copy_array(d,
-                              gnum_type,
-                              2,
-                              face_cell_g,
-                              mb->face_cells);
+    BFT_MALLOC(face_rec, n_faces*rec_size, unsigned char);
 
-  BFT_FREE(face_cell_g);
+    for (i = 0; i < n_i_faces; i++) {
+      unsigned char *r = face_rec + i*rec_size;
+      cs_gnum_t face_cell_g[2] = {cell_gnum[mesh->i_face_cells[i][0]],
+                                  cell_gnum[mesh->i_face_cells[i][1]]};
+      int gc_id = mesh->i_face_family[i];
+      memcpy(r, face_cell_g, fc_size);
+      memcpy(r + fc_size, &gc_id, sizeof(int));
+      if (mb->have_face_r_gen)
+        r[fc_size + sizeof(int)] = mesh->i_face_r_gen[i];
+    }
+    for (i = 0, j = n_i_faces; i < n_b_faces; i++, j++) {
+      unsigned char *r = face_rec + j*rec_size;
+      cs_gnum_t face_cell_g[2] = {cell_gnum[mesh->b_face_cells[i]], 0};
+      int gc_id = mesh->b_face_family[i];
+      memcpy(r, face_cell_g, fc_size);
+      memcpy(r + fc_size, &gc_id, sizeof(int));
+      if (mb->have_face_r_gen)
+        r[fc_size + sizeof(int)] = 0;
+    }
 
-  if (pp_out != NULL) {
-    if (transfer == true)
-      cs_io_write_block("face_cells",
-                        mb->n_g_faces,
-                        mb->face_bi.gnum_range[0],
-                        mb->face_bi.gnum_range[1],
-                        2, /* location_id, */
-                        0, /* index id */
-                        2, /* n_location_vals */
-                        gnum_type,
-                        mb->face_cells,
-                        pp_out);
-    else
-      cs_io_write_block_buffer("face_cells",
-                               mb->n_g_faces,
-                               mb->face_bi.gnum_range[0],
-                               mb->face_bi.gnum_range[1],
-                               2, /* location_id, */
-                               0, /* index id */
-                               2, /* n_location_vals */
-                               gnum_type,
-                               mb->face_cells,
-                               pp_out);
-  }
+    BFT_FREE(cell_gnum);
 
-  if (transfer == false)
-    BFT_FREE(mb->face_cells);
+    if (transfer == true) {
+      BFT_FREE(mesh->global_cell_num);
+      BFT_FREE(mesh->i_face_cells);
+      BFT_FREE(mesh->b_face_cells);
+      BFT_FREE(mesh->i_face_family);
+      BFT_FREE(mesh->b_face_family);
+      BFT_FREE(mesh->i_face_r_gen);
+    }
 
-  /* Now write pre-distributed blocks for cell group classes if required */
+    /* Distribute to blocks */
 
-  if (pp_out != NULL) {
-    if (transfer == true)
-      cs_io_write_block("cell_group_class_id",
-                        mesh->n_g_cells,
-                        mb->cell_bi.gnum_range[0],
-                        mb->cell_bi.gnum_range[1],
-                        1, /* location_id, */
-                        0, /* index id */
-                        1, /* n_location_vals */
-                        int_type,
-                        mb->cell_gc_id,
-                        pp_out);
-    else
-      cs_io_write_block_buffer("cell_group_class_id",
-                               mesh->n_g_cells,
-                               mb->cell_bi.gnum_range[0],
-                               mb->cell_bi.gnum_range[1],
-                               1, /* location_id, */
-                               0, /* index id */
-                               1, /* n_location_vals */
-                               int_type,
-                               mb->cell_gc_id,
-                               pp_out);
-  }
+    BFT_MALLOC(block_rec, n_block_faces*rec_size, unsigned char);
 
-  if (transfer == false)
-    BFT_FREE(mb->cell_gc_id);
+    cs_part_to_block_copy_array(d,
+                                CS_CHAR,
+                                rec_size,
+                                face_rec,
+                                block_rec);
 
-  /* Face group classes */
-  /*--------------------*/
+    BFT_FREE(face_rec);
 
-  BFT_MALLOC(mb->face_gc_id,
-             (mb->face_bi.gnum_range[1] - mb->face_bi.gnum_range[0]),
-             int);
+    /* Unpack block values */
 
-  BFT_MALLOC(face_gc_id, n_faces, int);
+    BFT_MALLOC(mb->face_cells, n_block_faces*2, cs_gnum_t);
+    BFT_MALLOC(mb->face_gc_id, n_block_faces, int);
+    if (mb->have_face_r_gen)
+      BFT_MALLOC(mb->face_r_gen, n_block_faces, char);
 
-  for (i = 0; i < n_i_faces; i++)
-    face_gc_id[i] = mesh->i_face_family[i];
-  for (i = 0, j = n_i_faces; i < n_b_faces; i++, j++)
-    face_gc_id[j] = mesh->b_face_family[i];
+    for (i = 0; i < n_block_faces; i++) {
+      const unsigned char *r = block_rec + i*rec_size;
+      memcpy(mb->face_cells + i*2, r, fc_size);
+      memcpy(mb->face_gc_id + i, r + fc_size, sizeof(int));
+      if (mb->have_face_r_gen)
+        mb->face_r_gen[i] = r[fc_size + sizeof(int)];
+    }
 
-  if (transfer == true) {
-    BFT_FREE(mesh->i_face_family);
-    BFT_FREE(mesh->b_face_family);
+    BFT_FREE(block_rec);
   }
 
-  /* Distribute to blocks, write if required */
-
-  cs_part_to_block_copy_array(d,
-                              int_type,
-                              1,
-                              face_gc_id,
-                              mb->face_gc_id);
+  /* Write face -> cell connectivity if required */
 
-  BFT_FREE(face_gc_id);
-
-  if (pp_out != NULL) {
-    if (transfer == true)
-      cs_io_write_block("face_group_class_id",
-                        mb->n_g_faces,
-                        mb->face_bi.gnum_range[0],
-                        mb->face_bi.gnum_range[1],
-                        2, /* location_id, */
-                        0, /* index id */
-                        1, /* n_location_vals */
-                        int_type,
-                        mb->face_gc_id,
-                        pp_out);
-    else
-      cs_io_write_block_buffer("face_group_class_id",
-                               mb->n_g_faces,
-                               mb->face_bi.gnum_range[0],
-                               mb->face_bi.gnum_range[1],
-                               2, /* location_id, */
-                               0, /* index id */
-                               1, /* n_location_vals */
-                               int_type,
-                               mb->face_gc_id,
-                               pp_out);
-  }
+  if (pp_out != NULL)
+    cs_io_iwrite_block("face_cells",
+                       mb->n_g_faces,
+                       mb->face_bi.gnum_range[0],
+                       mb->face_bi.gnum_range[1],
+                       2, /* location_id, */
+                       0, /* index id */
+                       2, /* n_location_vals */
+                       gnum_type,
+                       mb->face_cells,
+                       pp_out);
 
   if (transfer == false)
-    BFT_FREE(mb->face_gc_id);
-
-  /* Face refinement generation */
-  /*----------------------------*/
-
-  if (mb->have_face_r_gen) {
-
-    char *face_r_gen = NULL;
-
-    BFT_MALLOC(mb->face_r_gen,
-               (mb->face_bi.gnum_range[1] - mb->face_bi.gnum_range[0]),
-               char);
+    BFT_FREE(mb->face_cells);
 
-    BFT_MALLOC(face_r_gen, n_faces, char);
+  /* Now write pre-distributed blocks for cell group classes if required */
 
-    for (i = 0; i < n_i_faces; i++)
-      face_r_gen[i] = mesh->i_face_r_gen[i];
-    for (i = 0, j = n_i_faces; i < n_b_faces; i++, j++)
-      face_r_gen[j] = 0;
+  if (pp_out != NULL)
+    cs_io_iwrite_block("cell_group_class_id",
+                       mesh->n_g_cells,
+                       mb->cell_bi.gnum_range[0],
+                       mb->cell_bi.gnum_range[1],
+                       1, /* location_id, */
+                       0, /* index id */
+                       1, /* n_location_vals */
+                       int_type,
+                       mb->cell_gc_id,
+                       pp_out);
 
-    /* Distribute to blocks, write if required */
+  if (transfer == false)
+    BFT_FREE(mb->cell_gc_id);
 
-    cs_part_to_block_copy_array(d,
-                                CS_CHAR,
-                                1,
-                                face_r_gen,
-                                mb->face_r_gen);
+  /* Face group classes */
 
-    BFT_FREE(face_r_gen);
+  if (pp_out != NULL)
+    cs_io_iwrite_block("face_group_class_id",
+                       mb->n_g_faces,
+                       mb->face_bi.gnum_range[0],
+                       mb->face_bi.gnum_range[1],
+                       2, /* location_id, */
+                       0, /* index id */
+                       1, /* n_location_vals */
+                       int_type,
+                       mb->face_gc_id,
+                       pp_out);
 
-    if (pp_out != NULL) {
-      if (transfer == true)
-        cs_io_write_block("face_refinement_generation",
-                          mb->n_g_faces,
-                          mb->face_bi.gnum_range[0],
-                          mb->face_bi.gnum_range[1],
-                          2, /* location_id, */
-                          0, /* index id */
-                          1, /* n_location_vals */
-                          CS_CHAR,
-                          mb->face_r_gen,
-                          pp_out);
-      else
-        cs_io_write_block_buffer("face_refinement_generation",
-                                 mb->n_g_faces,
-                                 mb->face_bi.gnum_range[0],
-                                 mb->face_bi.gnum_range[1],
-                                 2, /* location_id, */
-                                 0, /* index id */
-                                 1, /* n_location_vals */
-                                 CS_CHAR,
-                                 mb->face_r_gen,
-                                 pp_out);
+  if (transfer == false)
+    BFT_FREE(mb->face_gc_id);
 
-    }
-  }
+  /* Face refinement generation */
 
-  if (transfer == true)
-    BFT_FREE(mesh->i_face_r_gen);
+  if (mb->have_face_r_gen && pp_out != NULL)
+    cs_io_iwrite_block("face_refinement_generation",
+                       mb->n_g_faces,
+                       mb->face_bi.gnum_range[0],
+                       mb->face_bi.gnum_range[1],
+                       2, /* location_id, */
+                       0, /* index id */
+                       1, /* n_location_vals */
+                       CS_CHAR,
+                       mb->face_r_gen,
+                       pp_out);
 
   if (transfer == false)
     BFT_FREE(mb->face_r_gen);
@@ -591,7 +508,7 @@ _mesh_to_builder_g(cs_mesh_t          *mesh,
   }
 
   if (pp_out != NULL)
-    _write_face_vertices_g(mesh, mb, transfer, pp_out);
+    _write_face_vertices_g(mesh, mb, pp_out);
 
   if (transfer == false) {
     BFT_FREE(mb->face_vertices_idx);
@@ -623,35 +540,17 @@ _mesh_to_builder_g(cs_mesh_t          *mesh,
   if (transfer == true)
     BFT_FREE(mesh->vtx_coord);
 
-  if (pp_out != NULL) {
-    if (transfer == true)
-      cs_io_write_block("vertex_coords",
-                        mesh->n_g_vertices,
-                        mb->vertex_bi.gnum_range[0],
-                        mb->vertex_bi.gnum_range[1],
-                        3, /* location_id, */
-                        0, /* index id */
-                        3, /* n_location_vals */
-                        real_type,
-                        mb->vertex_coords,
-                        pp_out);
-    else
-      cs_io_write_block_buffer("vertex_coords",
-                               mesh->n_g_vertices,
-                               mb->vertex_bi.gnum_range[0],
-                               mb->vertex_bi.gnum_range[1],
-                               3, /* location_id, */
-                               0, /* index id */
-                               3, /* n_location_vals */
-                               real_type,
-                               mb->vertex_coords,
-                               pp_out);
-  }
-
-  if (transfer == true)
-    BFT_FREE(mesh->global_vtx_num);
-  else
-    BFT_FREE(mb->vertex_coords);
+  if (pp_out != NULL)
+    cs_io_iwrite_block("vertex_coords",
+                       mesh->n_g_vertices,
+                       mb->vertex_bi.gnum_range[0],
+                       mb->vertex_bi.gnum_range[1],
+                       3, /* location_id, */
+                       0, /* index id */
+                       3, /* n_location_vals */
+                       real_type,
+                       mb->vertex_coords,
+                       pp_out);
 
   if (transfer == true)
     BFT_FREE(mesh->global_vtx_num);
@@ -1257,8 +1156,6 @@ _write_mesh_perio_metadata(const cs_mesh_t  *mesh,
  *   n_perio_couples <-- number of periodic face couples for this periodicity
  *   perio_couples   <-> periodic face couples for this periodicity
  *   min_rank_step   <-- minimum rank step between blocks
- *   transfer        <-- if true, mesh transferred to builder;
- *                       if false, builder is a temporary copy
  *   pp_out          <-> output file
  *----------------------------------------------------------------------------*/
 
@@ -1267,7 +1164,6 @@ _write_mesh_perio_data_g(int         perio_num,
                          cs_lnum_t   n_perio_couples,
                          cs_gnum_t   perio_couples[],
                          int         min_rank_step,
-                         bool        transfer,
                          cs_io_t    *pp_out)
 {
   char section_name[32];
@@ -1322,28 +1218,16 @@ _write_mesh_perio_data_g(int         perio_num,
 
   sprintf(section_name, "periodicity_faces_%02d", perio_num);
 
-  if (transfer == true)
-    cs_io_write_block(section_name,
-                      n_g_couples,
-                      bi.gnum_range[0],
-                      bi.gnum_range[1],
-                      0, /* location_id, */
-                      0, /* index id */
-                      2, /* n_location_vals */
-                      gnum_type,
-                      _perio_couples,
-                      pp_out);
-  else
-    cs_io_write_block_buffer(section_name,
-                             n_g_couples,
-                             bi.gnum_range[0],
-                             bi.gnum_range[1],
-                             0, /* location_id, */
-                             0, /* index id */
-                             2, /* n_location_vals */
-                             gnum_type,
-                             _perio_couples,
-                             pp_out);
+  cs_io_iwrite_block(section_name,
+                     n_g_couples,
+                     bi.gnum_range[0],
+                     bi.gnum_range[1],
+                     0, /* location_id, */
+                     0, /* index id */
+                     2, /* n_location_vals */
+                     gnum_type,
+                     _perio_couples,
+                     pp_out);
 
   BFT_FREE(_perio_couples);
 }
@@ -1416,6 +1300,11 @@ _write_mesh_perio_data_l(int         perio_num,
  * memory overhead, this function also handles a part of the output
  * to file needed to save a mesh file.
  *
+ * In parallel, section writes are only started (see \ref cs_io_iwrite_block),
+ * so that writing each section overlaps the redistribution of the
+ * following ones; they are completed before returning, and copies of
+ * the written blocks are kept until then.
+ *
  * \param[in, out]  mesh      pointer to mesh structure
  * \param[in, out]  mb        pointer to mesh builder structure
  * \param[in]       transfer  if true, data is transferred from mesh to builder;
@@ -1537,7 +1426,6 @@ cs_mesh_to_builder(cs_mesh_t          *mesh,
                                  mb->n_per_face_couples[i],
                                  mb->per_face_couples[i],
                                  mb->min_rank_step,
-                                 transfer,
                                  pp_out);
 #endif
 
@@ -1556,6 +1444,10 @@ cs_mesh_to_builder(cs_mesh_t          *mesh,
     cs_io_write_global("end_block:data", 0, 0, 0, 0, CS_DATATYPE_NULL,
                        NULL, pp_out);
 
+    /* Complete section writes which may still be in progress */
+
+    cs_io_wait(pp_out);
+
   }
 }
 
@@ -3025,6 +3025,35 @@ cs_partition_get_preprocess(void)
   return retval;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate if partitioning for a given stage requires mesh geometry.
+ *
+ * Space-filling curve partitionings are based on cell centers, so they
+ * need face -> vertex connectivity and vertex coordinates; graph-based
+ * and block partitionings only use face -> cell adjacency and
+ * periodicity information.
+ *
+ * \param[in]  stage  associated partitioning stage
+ *
+ * \return  true if mesh builder vertex data is used for partitioning,
+ *          false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_partition_uses_geometry(cs_partition_stage_t  stage)
+{
+  bool retval = false;
+
+  cs_partition_algorithm_t a = _select_algorithm(stage);
+
+  if (a >= CS_PARTITION_SFC_MORTON_BOX && a <= CS_PARTITION_SFC_HILBERT_CUBE)
+    retval = true;
+
+  return retval;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Define list of extra partitionings to build.
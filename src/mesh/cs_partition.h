@@ -204,6 +204,25 @@ cs_partition_set_preprocess(bool  active);
 bool
 cs_partition_get_preprocess(void);
 
+/*----------------------------------------------------------------------------
+ * Indicate if partitioning for a given stage requires mesh geometry.
+ *
+ * Space-filling curve partitionings are based on cell centers, so they
+ * need face -> vertex connectivity and vertex coordinates; graph-based
+ * and block partitionings only use face -> cell adjacency and
+ * periodicity information.
+ *
+ * parameters:
+ *   stage <-- associated partitioning stage
+ *
+ * returns:
+ *   true if mesh builder vertex data is used for partitioning,
+ *   false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_partition_uses_geometry(cs_partition_stage_t  stage);
+
 /*----------------------------------------------------------------------------
  * Define list of extra partitionings to build.
  *
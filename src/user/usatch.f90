@@ -28,6 +28,14 @@
 !> \remarks
 !>  These routines should be generated by SPACK
 !>  See CEREA: http://cerea.enpc.fr/polyphemus
+!>
+!>  The chemistry resolution is threaded over cells with OpenMP, so
+!>  \ref fexchem_4, \ref jacdchemdc, \ref lu_decompose and \ref lu_solve
+!>  may be called concurrently from several threads. They must be
+!>  thread-safe: they may only write to their arguments and to local
+!>  variables, and must not modify module variables or variables with
+!>  the \c save attribute (or initialized in a declaration, which
+!>  implies \c save).
 !------------------------------------------------------------------------------
 
 !===============================================================================
@@ -95,6 +103,9 @@ end subroutine kinetic_4
 !> \brief fexchem_4
 !>
 !> \brief Computes the chemical production terms
+!>
+!> This routine is called concurrently for different cells, so it must
+!> be thread-safe (see the remarks in the file header).
 !------------------------------------------------------------------------------
 
 !-------------------------------------------------------------------------------
@@ -691,6 +691,22 @@ cs_user_lagr_model(void)
     cs_glob_lagr_agglomeration_model->n_max_classes = 100000000;
   }
 
+  /*! [parcel_management] */
+
+  /* Parcel management (merging and splitting of particles)
+   * ====================================================== */
+
+  /* Keep the number of particles per cell between n_min_per_cell and
+     n_max_per_cell (default 0: off); particles are split only if their
+     resulting statistical weight is at least min_split_weight.
+     n_min_per_cell must not be greater than n_max_per_cell. */
+
+  cs_glob_lagr_parcel_model->n_min_per_cell = 20;
+  cs_glob_lagr_parcel_model->n_max_per_cell = 200;
+  cs_glob_lagr_parcel_model->min_split_weight = 1.;
+
+  /*! [parcel_management] */
+
   /*! [boundary_statistics] */
   /* Boundary statistics
    * =================== */
@@ -101,6 +101,15 @@ cs_user_mesh_input(void)
   }
   /*! [mesh_input_2] */
 
+  /*! [mesh_input_3] */
+  {
+    /* Add a Gmsh (4.1 binary) mesh, read directly in parallel
+       (without running the Preprocessor) */
+
+    cs_preprocessor_data_add_file("mesh_input/mesh_03.msh", 0, NULL, NULL);
+  }
+  /*! [mesh_input_3] */
+
 }
 
 /*----------------------------------------------------------------------------*/
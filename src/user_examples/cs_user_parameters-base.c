@@ -552,6 +552,26 @@ cs_user_parameters(cs_domain_t *domain)
 
   /*! [param_physical_constants] */
 
+  /* Example: tabulate the density of the thermal table (material and
+   * method defined in the GUI), so that values are interpolated instead
+   * of being computed by the method for each cell. Tables are saved to
+   * and reused from the given cache directory.
+   *------------------------------------*/
+
+  /*! [param_thermal_table_tabulate] */
+  {
+    const cs_real_t p_range[2] = {1.e5, 1.e7};  /* pressure (Pa) */
+    const cs_real_t h_range[2] = {1.e5, 1.e6};  /* enthalpy (J/kg) */
+
+    cs_thermal_table_tabulate(CS_PHYS_PROP_DENSITY,
+                              p_range,
+                              h_range,
+                              257,       /* maximum nodes per axis */
+                              1.e-6,     /* relative tolerance */
+                              "property_tables");
+  }
+  /*! [param_thermal_table_tabulate] */
+
   /* Example: Change options relative to the PISO-like sub-iterations
    * over prediction-correction.
    * - nterup: number of sub-iterations (default 1)
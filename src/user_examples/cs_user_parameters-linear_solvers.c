@@ -288,6 +288,11 @@ cs_user_linear_solvers(void)
    *  CS_SLES_P_GAUSS_SEIDEL      (process-local Gauss-Seidel)
    *  CS_SLES_P_SYM_GAUSS_SEIDEL  (process-local symmetric Gauss-Seidel)
    *  CS_SLES_PCR3                (3-layer conjugate residual)
+   *  CS_SLES_CA_GMRES            (communication-avoiding s-step GMRES)
+   *  CS_SLES_CA_BICGSTAB         (communication-avoiding s-step BiCGStab)
+   *
+   *  The number of steps per reduction of communication-avoiding variants
+   *  may be set with cs_sles_it_set_ca_s_step.
    *
    *  The multigrid solver uses the conjugate gradient as a smoother
    *  and coarse solver by default, but this behavior may be modified. */
@@ -313,6 +318,23 @@ cs_user_linear_solvers(void)
   }
   /*! [sles_user_1] */
 
+  /* Example: use BiCGStab with ILU(0) preconditioning for velocity */
+  /*----------------------------------------------------------------*/
+
+  /*! [sles_ilu0_1] */
+  {
+    cs_sles_it_t *c = cs_sles_it_define(CS_F_(vel)->id,
+                                        NULL,
+                                        CS_SLES_BICGSTAB,
+                                        -1,
+                                        10000);
+
+    /* cs_sles_pc_sgs_create() may be used for symmetric Gauss-Seidel */
+    cs_sles_pc_t *pc = cs_sles_pc_ilu0_create();
+    cs_sles_it_transfer_pc(c, &pc);
+  }
+  /*! [sles_ilu0_1] */
+
   /* Example: increase verbosity parameters for pressure */
   /*-----------------------------------------------------*/
 
@@ -911,6 +911,12 @@ iphotolysis = 1
 ! dtchemmax: maximal time step (s) for chemistry resolution
 dtchemmax = 10.0d0
 
+! rtolchem, atolchem: relative and absolute tolerances for adaptive
+! sub-stepping of chemistry resolution in each cell (sub-steps are
+! then bounded by dtchemmax); if rtolchem <= 0, fixed sub-steps are used
+rtolchem = -1.d0
+atolchem = 1.d-6
+
 !!! Aerosol chemistry
 
 ! iaerosol: flag to activate aerosol chemistry
@@ -97,6 +97,23 @@ cs_user_numbering(void)
      CS_RENUMBER_VERTICES_NONE);      /* vertices numbering */
 
   /*! [performance_tuning_numbering] */
+
+  /* Alternative to the cells and interior faces numbering selection
+     above (disabled here, as it would override it) */
+
+#if 0
+
+  /*! [performance_tuning_numbering_autotune] */
+
+  /* Select the cells and interior faces renumbering algorithms based on
+     measured performance of representative kernels (with a minimum
+     measure time of 0.05 s per kernel and algorithm) */
+
+  cs_renumber_set_autotune(true, 0.05);
+
+  /*! [performance_tuning_numbering_autotune] */
+
+#endif
 }
 
 /*----------------------------------------------------------------------------*/
@@ -0,0 +1,395 @@
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_log.h"
+#include "cs_math.h"
+
+#include "fvm_nodal.h"
+#include "fvm_nodal_append.h"
+#include "fvm_writer.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Local Macro definitions
+ *============================================================================*/
+
+#define _N_CELLS_X  500
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static FILE  *cz_log = NULL;
+
+static int  n_failures = 0;
+
+/*============================================================================
+ * Private function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Build a nodal mesh made of a row of n unit hexahedra
+ *          along the x axis
+ *
+ * \param[in]  n   number of cells
+ *
+ * \return  pointer to new nodal mesh
+ */
+/*----------------------------------------------------------------------------*/
+
+static fvm_nodal_t *
+_row_mesh(int  n)
+{
+  fvm_nodal_t *mesh = fvm_nodal_create("row", 3);
+
+  cs_coord_t *coords;
+  BFT_MALLOC(coords, 4*(n+1)*3, cs_coord_t);
+
+  for (int i = 0; i < n+1; i++) {
+    for (int k = 0; k < 4; k++) {
+      cs_coord_t *c = coords + (4*i + k)*3;
+      c[0] = i; c[1] = k%2; c[2] = k/2;
+    }
+  }
+
+  /* Vertex (i, j, k) has number 4*i + 2*k + j + 1 */
+
+  cs_lnum_t *vertex_num;
+  BFT_MALLOC(vertex_num, n*8, cs_lnum_t);
+
+  for (int i = 0; i < n; i++) {
+    const int v[8] = {4*i, 4*i+4, 4*i+5, 4*i+1,
+                      4*i+2, 4*i+6, 4*i+7, 4*i+3};
+    for (int j = 0; j < 8; j++)
+      vertex_num[i*8 + j] = v[j] + 1;
+  }
+
+  fvm_nodal_append_by_transfer(mesh, n, FVM_CELL_HEXA,
+                               NULL, NULL, NULL, vertex_num, NULL);
+  fvm_nodal_transfer_vertices(mesh, coords);
+
+  return mesh;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Read values of an EnSight Gold variable file with a single
+ *          part and section
+ *
+ * \param[in]  path       file path
+ * \param[in]  n          number of values
+ * \param[out] vals       values read
+ * \param[out] has_undef  true if the section has undefined values
+ * \param[out] undef      undefined value marker, if present
+ *
+ * \return  0 on success, 1 otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+static int
+_read_ensight_var(const char  *path,
+                  cs_lnum_t    n,
+                  float        vals[],
+                  bool        *has_undef,
+                  float       *undef)
+{
+  int retval = 1;
+
+  FILE *f = fopen(path, "rb");
+  if (f == NULL)
+    return retval;
+
+  /* Description, "part" line, part number, section type
+     (followed by the undefined value marker for "<type> undef") */
+
+  char buf[81];
+  int part_num;
+
+  buf[80] = '\0';
+  *has_undef = false;
+
+  if (   fread(buf, 1, 80, f) == 80
+      && fread(buf, 1, 80, f) == 80
+      && fread(&part_num, sizeof(int), 1, f) == 1
+      && fread(buf, 1, 80, f) == 80) {
+    if (strstr(buf, " undef") != NULL)
+      *has_undef = true;
+    if (   (*has_undef == false || fread(undef, sizeof(float), 1, f) == 1)
+        && fread(vals, sizeof(float), n, f) == (size_t)n)
+      retval = 0;
+  }
+
+  fclose(f);
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Return the error bound stored in a compressed variable file
+ *          with a single component, as printed by cs_compressed_to_ensight
+ *
+ * \param[in]  converter  path to cs_compressed_to_ensight
+ * \param[in]  cz_path    compressed file path
+ *
+ * \return  stored error bound, or -1 in case of error
+ */
+/*----------------------------------------------------------------------------*/
+
+static double
+_stored_bound(const char  *converter,
+              const char  *cz_path)
+{
+  double eps = -1.;
+
+  char cmd[512], line[256];
+  snprintf(cmd, 511, "%s -i %s", converter, cz_path);
+
+  FILE *p = popen(cmd, "r");
+  if (p == NULL)
+    return eps;
+
+  while (fgets(line, 256, p) != NULL) {
+    const char *s = strstr(line, "error bound");
+    if (s != NULL)
+      sscanf(s + strlen("error bound"), "%lg", &eps);
+  }
+
+  pclose(p);
+
+  return eps;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Write a field with the compressed writer, convert it with
+ *          cs_compressed_to_ensight, and compare the result with the
+ *          original values.
+ *
+ * Values at multiples of the stride must be within the error bound
+ * stored in the file, which may not exceed eps; other values must be
+ * undefined.
+ *
+ * \param[in]  out        output file
+ * \param[in]  converter  path to cs_compressed_to_ensight
+ * \param[in]  name       case name
+ * \param[in]  options    writer options
+ * \param[in]  n          number of values
+ * \param[in]  vals       field values
+ * \param[in]  eps        maximum expected absolute error bound
+ * \param[in]  stride     expected stride
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_test_round_trip(FILE          *out,
+                 const char    *converter,
+                 const char    *name,
+                 const char    *options,
+                 cs_lnum_t      n,
+                 const double   vals[],
+                 double         eps,
+                 int            stride)
+{
+  fprintf(out, "\n Round trip, options \"%s\"\n", options);
+
+  fvm_nodal_t *mesh = _row_mesh(n);
+
+  fvm_writer_t *w = fvm_writer_init(name, name, "compressed", options,
+                                    FVM_WRITER_FIXED_MESH);
+
+  const void *var_ptr[1] = {vals};
+
+  fvm_writer_export_nodal(w, mesh);
+  fvm_writer_export_field(w, mesh, "scalar", FVM_WRITER_PER_ELEMENT,
+                          1, CS_NO_INTERLACE, 0, NULL, CS_DOUBLE,
+                          -1, 0., var_ptr);
+
+  w = fvm_writer_finalize(w);
+  mesh = fvm_nodal_destroy(mesh);
+
+  /* Convert, then read back */
+
+  char cz_path[128], ens_path[128], cmd[512];
+  snprintf(cz_path, 127, "%s/%s.scalar.cz", name, name);
+  snprintf(ens_path, 127, "%s/%s.scalar", name, name);
+  snprintf(cmd, 511, "%s %s > /dev/null", converter, cz_path);
+
+  float *r_vals;
+  BFT_MALLOC(r_vals, n, float);
+
+  const double s_eps = _stored_bound(converter, cz_path);
+
+  bool has_undef = false;
+  float undef = 0;
+
+  if (   s_eps < 0 || system(cmd) != 0
+      || _read_ensight_var(ens_path, n, r_vals, &has_undef, &undef) != 0) {
+    fprintf(out, "  conversion of \"%s\" failed\n  --> FAILED\n", cz_path);
+    n_failures += 1;
+    BFT_FREE(r_vals);
+    return;
+  }
+
+  double d_max = 0.;
+  cs_lnum_t n_undef_err = 0;
+
+  if (has_undef != (stride > 1)) {
+    fprintf(out, "  undefined values marker %sexpected\n  --> FAILED\n",
+            (has_undef) ? "not " : "");
+    n_failures += 1;
+  }
+
+  for (cs_lnum_t i = 0; i < n; i++) {
+    if (i % stride == 0)
+      d_max = CS_MAX(d_max, fabs((double)r_vals[i] - vals[i]));
+    else if (memcmp(r_vals + i, &undef, sizeof(float)))
+      n_undef_err++;
+  }
+
+  fprintf(out, "  max. error: %12.5e (stored bound %12.5e, expected %12.5e)\n",
+          d_max, s_eps, eps);
+
+  /* The stored bound is printed with 5 significant digits */
+
+  if (!(d_max <= s_eps*(1. + 1e-4)) || !(s_eps <= eps*(1. + 1e-4))) {
+    fprintf(out, "  --> FAILED\n");
+    n_failures += 1;
+  }
+
+  if (n_undef_err > 0) {
+    fprintf(out, "  %d values between strides are not undefined\n"
+            "  --> FAILED\n", (int)n_undef_err);
+    n_failures += 1;
+  }
+
+  BFT_FREE(r_vals);
+
+  remove(cz_path);
+  remove(ens_path);
+}
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Main program to check compressed post-processing output
+ *
+ * The path to the cs_compressed_to_ensight utility may be given as
+ * first argument (default: ../src/apps/cs_compressed_to_ensight, relative
+ * to the tests build directory).
+ *
+ * \param[in]    argc
+ * \param[in]    argv
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+main(int    argc,
+     char  *argv[])
+{
+#if defined(HAVE_OPENMP) /* Determine default number of OpenMP threads */
+  {
+    int t_id;
+#pragma omp parallel private(t_id)
+    {
+      t_id = omp_get_thread_num();
+      if (t_id == 0)
+        cs_glob_n_threads = omp_get_max_threads();
+    }
+  }
+#endif
+
+  const char *converter = "../src/apps/cs_compressed_to_ensight";
+  if (argc > 1)
+    converter = argv[1];
+
+  cz_log = fopen("Compressed_writer_tests.log", "w");
+
+  /* Values spanning several orders of magnitude, with a few
+     non-smooth parts */
+
+  const cs_lnum_t n = _N_CELLS_X;
+
+  double *vals;
+  BFT_MALLOC(vals, n, double);
+
+  double v_min = HUGE_VAL, v_max = -HUGE_VAL;
+
+  for (cs_lnum_t i = 0; i < n; i++) {
+    vals[i] = 1e6*sin(0.37*i) + 3e5*cos(0.01*i*i);
+    if (i % 50 == 7)
+      vals[i] = 1e-3*i;
+    v_min = CS_MIN(v_min, vals[i]);
+    v_max = CS_MAX(v_max, vals[i]);
+  }
+
+  const double v_abs_max = CS_MAX(fabs(v_min), fabs(v_max));
+  const double eps_flt = FLT_EPSILON*v_abs_max;
+
+  /* ===============================================
+   * TEST of relative, tiny absolute bound, stride
+   * =============================================== */
+
+  _test_round_trip(cz_log, converter, "cz_rel", "error=1e-4",
+                   n, vals, CS_MAX(1e-4*(v_max - v_min), eps_flt), 1);
+
+  _test_round_trip(cz_log, converter, "cz_tiny", "abs_error=1e-12",
+                   n, vals, eps_flt, 1);
+
+  _test_round_trip(cz_log, converter, "cz_stride", "abs_error=10 stride=3",
+                   n, vals, CS_MAX(10., eps_flt), 3);
+
+  BFT_FREE(vals);
+
+  fclose(cz_log);
+
+  printf("\n\n -->> Compressed writer Tests (Done, %d failure(s))\n",
+         n_failures);
+
+  if (n_failures > 0)
+    exit(EXIT_FAILURE);
+
+  exit (EXIT_SUCCESS);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,393 @@
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_halo.h"
+#include "cs_log.h"
+#include "cs_math.h"
+#include "cs_mesh.h"
+#include "cs_mesh_builder.h"
+#include "cs_mesh_quantities.h"
+#include "cs_preprocessor_data.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Local Macro definitions
+ *============================================================================*/
+
+#define _N_CELLS_X  3
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static FILE  *gmsh_log = NULL;
+
+static int  n_failures = 0;
+
+/*============================================================================
+ * Private function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Write 8-byte size values to a binary Gmsh file
+ *
+ * \param[in]  f     file
+ * \param[in]  n     number of values
+ * \param[in]  vals  values
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_write_sizes(FILE            *f,
+             int              n,
+             const uint64_t   vals[])
+{
+  fwrite(vals, sizeof(uint64_t), n, f);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Write a binary Gmsh 4.1 file describing a row of n unit
+ *          hexahedra along the x axis
+ *
+ * Nodes are numbered from 101, so that tag shifting is exercised. The
+ * x = 0 boundary is described by a quadrangle in physical group "inlet",
+ * and cells belong to an unnamed physical group (tag 2).
+ *
+ * \param[in]  path   file path
+ * \param[in]  n      number of cells
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_write_gmsh_file(const char  *path,
+                 int          n)
+{
+  const uint64_t tag_0 = 101;
+  const uint64_t n_nodes = 4*(n+1);
+
+  FILE *f = fopen(path, "wb");
+
+  /* Header */
+
+  const int one = 1;
+
+  fprintf(f, "$MeshFormat\n4.1 1 8\n");
+  fwrite(&one, sizeof(int), 1, f);
+  fprintf(f, "\n$EndMeshFormat\n");
+
+  fprintf(f, "$PhysicalNames\n1\n2 1 \"inlet\"\n$EndPhysicalNames\n");
+
+  /* Entities: no points or curves, 1 surface and 1 volume */
+
+  {
+    const double bbox[6] = {0, 0, 0, n, 1, 1};
+    const uint64_t n_ents[4] = {0, 0, 1, 1};
+    const uint64_t n_phys = 1, n_bound = 0;
+
+    fprintf(f, "$Entities\n");
+    _write_sizes(f, 4, n_ents);
+    for (int dim = 2; dim < 4; dim++) {
+      const int tag = 1, phys = dim - 1;
+      fwrite(&tag, sizeof(int), 1, f);
+      fwrite(bbox, sizeof(double), 6, f);
+      _write_sizes(f, 1, &n_phys);
+      fwrite(&phys, sizeof(int), 1, f);
+      _write_sizes(f, 1, &n_bound);
+    }
+    fprintf(f, "\n$EndEntities\n");
+  }
+
+  /* Nodes: node (i, j, k) has tag tag_0 + i + (n+1)*(j + 2*k) */
+
+  {
+    const uint64_t sizes[4] = {1, n_nodes, tag_0, tag_0 + n_nodes - 1};
+    const int b_header[3] = {3, 1, 0};
+
+    fprintf(f, "$Nodes\n");
+    _write_sizes(f, 4, sizes);
+    fwrite(b_header, sizeof(int), 3, f);
+    _write_sizes(f, 1, &n_nodes);
+    for (uint64_t i = 0; i < n_nodes; i++) {
+      uint64_t tag = tag_0 + i;
+      _write_sizes(f, 1, &tag);
+    }
+    for (int k = 0; k < 2; k++) {
+      for (int j = 0; j < 2; j++) {
+        for (int i = 0; i < n+1; i++) {
+          double coo[3] = {i, j, k};
+          fwrite(coo, sizeof(double), 3, f);
+        }
+      }
+    }
+    fprintf(f, "\n$EndNodes\n");
+  }
+
+  /* Elements: 1 quadrangle block, 1 hexahedron block */
+
+  {
+#define _NODE(i, j, k) (tag_0 + (i) + (n+1)*((j) + 2*(k)))
+
+    const uint64_t n_quads = 1, n_hexas = n;
+    const uint64_t sizes[4] = {2, n_quads + n_hexas, 1, n_quads + n_hexas};
+
+    fprintf(f, "$Elements\n");
+    _write_sizes(f, 4, sizes);
+
+    const int q_header[3] = {2, 1, 3};
+    const uint64_t quad[5] = {1,
+                              _NODE(0, 0, 0), _NODE(0, 1, 0),
+                              _NODE(0, 1, 1), _NODE(0, 0, 1)};
+    fwrite(q_header, sizeof(int), 3, f);
+    _write_sizes(f, 1, &n_quads);
+    _write_sizes(f, 5, quad);
+
+    const int h_header[3] = {3, 1, 5};
+    fwrite(h_header, sizeof(int), 3, f);
+    _write_sizes(f, 1, &n_hexas);
+    for (int i = 0; i < n; i++) {
+      const uint64_t hexa[9] = {2 + i,
+                                _NODE(i, 0, 0), _NODE(i+1, 0, 0),
+                                _NODE(i+1, 1, 0), _NODE(i, 1, 0),
+                                _NODE(i, 0, 1), _NODE(i+1, 0, 1),
+                                _NODE(i+1, 1, 1), _NODE(i, 1, 1)};
+      _write_sizes(f, 9, hexa);
+    }
+    fprintf(f, "\n$EndElements\n");
+
+#undef _NODE
+  }
+
+  fclose(f);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Log and check an integer value
+ *
+ * \param[in]  out    output file
+ * \param[in]  name   value name
+ * \param[in]  val    value
+ * \param[in]  ref    reference value
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_check_count(FILE        *out,
+             const char  *name,
+             long long    val,
+             long long    ref)
+{
+  fprintf(out, "  %-24s %8lld (expected %lld)\n", name, val, ref);
+
+  if (val != ref) {
+    fprintf(out, "  --> FAILED\n");
+    n_failures += 1;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Log and check a real value
+ *
+ * \param[in]  out    output file
+ * \param[in]  name   value name
+ * \param[in]  val    value
+ * \param[in]  ref    reference value
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_check_real(FILE        *out,
+            const char  *name,
+            double       val,
+            double       ref)
+{
+  fprintf(out, "  %-24s %12.5e (expected %12.5e)\n", name, val, ref);
+
+  if (!(CS_ABS(val - ref) <= 1e-12)) {
+    fprintf(out, "  --> FAILED\n");
+    n_failures += 1;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Count boundary faces belonging to a given group
+ *
+ * \param[in]  m      pointer to mesh
+ * \param[in]  name   group name
+ *
+ * \return  number of boundary faces in group
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_n_b_faces_in_group(const cs_mesh_t  *m,
+                    const char       *name)
+{
+  cs_lnum_t n = 0;
+
+  for (cs_lnum_t f_id = 0; f_id < m->n_b_faces; f_id++) {
+    int fam = m->b_face_family[f_id];
+    if (fam < 1)
+      continue;
+    for (int j = 0; j < m->n_max_family_items; j++) {
+      int item = m->family_item[m->n_families*j + fam - 1];
+      if (item < 0 && strcmp(m->group + m->group_idx[-item-1], name) == 0)
+        n++;
+    }
+  }
+
+  return n;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Read a generated Gmsh file and check the resulting mesh
+ *
+ * \param[in]  out   output file
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_test_import(FILE  *out)
+{
+  const int n = _N_CELLS_X;
+  const char path[] = "gmsh_check.msh";
+
+  fprintf(out, "\n Binary Gmsh 4.1 import\n");
+
+  _write_gmsh_file(path, n);
+
+  cs_mesh_t *m = cs_mesh_create();
+  cs_mesh_builder_t *mb = cs_mesh_builder_create();
+
+  cs_preprocessor_data_add_file(path, 0, NULL, NULL);
+  cs_preprocessor_data_read_headers(m, mb);
+  cs_preprocessor_data_read_mesh(m, mb);
+
+  cs_mesh_init_halo(m, mb, CS_HALO_STANDARD);
+  cs_mesh_update_auxiliary(m);
+
+  cs_mesh_builder_destroy(&mb);
+
+  _check_count(out, "cells", m->n_cells, n);
+  _check_count(out, "interior faces", m->n_i_faces, n - 1);
+  _check_count(out, "boundary faces", m->n_b_faces, 4*n + 2);
+  _check_count(out, "vertices", m->n_vertices, 4*(n+1));
+  _check_count(out, "\"inlet\" boundary faces",
+               _n_b_faces_in_group(m, "inlet"), 1);
+
+  cs_mesh_quantities_t *mq = cs_mesh_quantities_create();
+  cs_mesh_quantities_compute(m, mq);
+
+  /* Outward boundary faces close the domain, and cells have the
+     expected (positive) volume */
+
+  cs_real_t b_sum[3] = {0, 0, 0};
+  for (cs_lnum_t f_id = 0; f_id < m->n_b_faces; f_id++) {
+    for (int j = 0; j < 3; j++)
+      b_sum[j] += mq->b_face_normal[f_id*3 + j];
+  }
+
+  _check_real(out, "min. cell volume", mq->min_vol, 1.);
+  _check_real(out, "total volume", mq->tot_vol, n);
+  _check_real(out, "boundary normals sum",
+              cs_math_3_norm(b_sum), 0.);
+
+  cs_mesh_quantities_destroy(mq);
+  cs_mesh_destroy(m);
+
+  remove(path);
+}
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Main program to check direct import of Gmsh files
+ *
+ * \param[in]    argc
+ * \param[in]    argv
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+main(int    argc,
+     char  *argv[])
+{
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+
+#if defined(HAVE_OPENMP) /* Determine default number of OpenMP threads */
+  {
+    int t_id;
+#pragma omp parallel private(t_id)
+    {
+      t_id = omp_get_thread_num();
+      if (t_id == 0)
+        cs_glob_n_threads = omp_get_max_threads();
+    }
+  }
+#endif
+
+  gmsh_log = fopen("Gmsh_import_tests.log", "w");
+
+  /* ======================
+   * TEST of binary import
+   * ====================== */
+
+  _test_import(gmsh_log);
+
+  fclose(gmsh_log);
+
+  printf("\n\n -->> Gmsh import Tests (Done, %d failure(s))\n",
+         n_failures);
+
+  if (n_failures > 0)
+    exit(EXIT_FAILURE);
+
+  exit (EXIT_SUCCESS);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,298 @@
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_log.h"
+#include "cs_math.h"
+#include "cs_mesh.h"
+
+#include "cs_lagr_particle.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Local Macro definitions
+ *============================================================================*/
+
+#define _N_CELLS      200
+#define _N_PARTICLES  5000
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static FILE  *ci_log = NULL;
+
+static int  n_failures = 0;
+
+/*============================================================================
+ * Private function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Check the cell -> particles index of a particle set.
+ *
+ * Particles must be grouped by increasing cell id, in their relative
+ * order before sorting (as identified by their random value, set to
+ * their position before sorting), particles not located in a cell being
+ * placed last.
+ *
+ * \param[in]  out        output file
+ * \param[in]  stage      name of checked stage
+ * \param[in]  p_set      particle set
+ * \param[in]  n_cells    number of cells
+ * \param[in]  n_located  expected number of particles located in a cell
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_check_index(FILE                          *out,
+             const char                    *stage,
+             const cs_lagr_particle_set_t  *p_set,
+             cs_lnum_t                      n_cells,
+             cs_lnum_t                      n_located)
+{
+  const cs_lnum_t *c_p_idx = p_set->cell_particle_idx;
+
+  cs_lnum_t n_bad_idx = 0, n_bad_cell = 0, n_bad_order = 0;
+
+  if (c_p_idx[0] != 0 || c_p_idx[n_cells] != n_located)
+    n_bad_idx++;
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    if (c_p_idx[c_id+1] < c_p_idx[c_id])
+      n_bad_idx++;
+    for (cs_lnum_t i = c_p_idx[c_id]; i < c_p_idx[c_id+1]; i++) {
+      if (cs_lagr_particles_get_lnum(p_set, i, CS_LAGR_CELL_ID) != c_id)
+        n_bad_cell++;
+      if (   i > c_p_idx[c_id]
+          && !(  cs_lagr_particles_get_real(p_set, i-1,
+                                            CS_LAGR_RANDOM_VALUE)
+               < cs_lagr_particles_get_real(p_set, i,
+                                            CS_LAGR_RANDOM_VALUE)))
+        n_bad_order++;
+    }
+  }
+
+  for (cs_lnum_t i = n_located; i < p_set->n_particles; i++) {
+    if (cs_lagr_particles_get_lnum(p_set, i, CS_LAGR_CELL_ID) > -1)
+      n_bad_cell++;
+  }
+
+  fprintf(out, "  %s: %d particles, %d located\n",
+          stage, (int)p_set->n_particles, (int)n_located);
+
+  if (n_bad_idx + n_bad_cell + n_bad_order > 0) {
+    fprintf(out, "    inconsistent index bounds:  %d\n"
+            "    particles in wrong cell:    %d\n"
+            "    particles out of order:     %d\n"
+            "  --> FAILED\n",
+            (int)n_bad_idx, (int)n_bad_cell, (int)n_bad_order);
+    n_failures += 1;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Sort a particle set by cell, saving the position of each particle
+ *          before sorting as its random value.
+ *
+ * \param[in, out]  p_set  particle set
+ *
+ * \return  1 if particles were reordered, 0 otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+static int
+_sort(cs_lagr_particle_set_t  *p_set)
+{
+  for (cs_lnum_t i = 0; i < p_set->n_particles; i++)
+    cs_lagr_particles_set_real(p_set, i, CS_LAGR_RANDOM_VALUE, i);
+
+  return cs_lagr_particle_set_sort_by_cell(p_set);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Check that the cell -> particles index of the main particle set
+ *          is consistent after injection and after tracking steps.
+ *
+ * Tracking is emulated by moving particles to neighboring cells, some
+ * of them leaving the domain, and injection by appending particles
+ * to the set.
+ *
+ * \param[in]  out   output file
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_test_cell_index(FILE  *out)
+{
+  const cs_lnum_t n_cells = _N_CELLS;
+
+  cs_glob_mesh = cs_mesh_create();
+  cs_glob_mesh->n_cells = n_cells;
+  cs_glob_mesh->n_cells_with_ghosts = n_cells;
+
+  cs_lagr_particle_attr_initialize();
+  cs_lagr_particle_set_create();
+
+  cs_lagr_particle_set_t *p_set = cs_lagr_get_particle_set();
+
+  /* Injection: particles in pseudo-random cells */
+
+  cs_lnum_t n_p = _N_PARTICLES;
+
+  cs_lagr_particle_set_resize(2*n_p);
+
+  for (cs_lnum_t i = 0; i < n_p; i++) {
+    cs_lagr_particles_set_lnum(p_set, i, CS_LAGR_CELL_ID,
+                               (i*7919) % n_cells);
+    cs_lagr_particles_set_real(p_set, i, CS_LAGR_MASS, i);
+  }
+  p_set->n_particles = n_p;
+
+  int reordered = _sort(p_set);
+  _check_index(out, "injection", p_set, n_cells, n_p);
+  if (reordered != 1) {
+    fprintf(out, "  unsorted set not reordered\n  --> FAILED\n");
+    n_failures += 1;
+  }
+
+  /* Sorting an already sorted set must not reorder it */
+
+  reordered = _sort(p_set);
+  _check_index(out, "second sort", p_set, n_cells, n_p);
+  if (reordered != 0) {
+    fprintf(out, "  sorted set reordered\n  --> FAILED\n");
+    n_failures += 1;
+  }
+
+  /* Tracking steps: particles move to neighboring cells,
+     some leave the domain */
+
+  for (int step = 0; step < 3; step++) {
+
+    cs_lnum_t n_located = 0;
+
+    for (cs_lnum_t i = 0; i < p_set->n_particles; i++) {
+      cs_lnum_t c_id = cs_lagr_particles_get_lnum(p_set, i, CS_LAGR_CELL_ID);
+      cs_lnum_t p_num = cs_lagr_particles_get_real(p_set, i, CS_LAGR_MASS);
+      if (c_id < 0)
+        continue;
+      if ((p_num + step) % 97 == 0)
+        c_id = -1;
+      else if ((p_num + step) % 3 == 1)
+        c_id = (c_id + 1) % n_cells;
+      else if ((p_num + step) % 3 == 2)
+        c_id = (c_id + n_cells - 1) % n_cells;
+      cs_lagr_particles_set_lnum(p_set, i, CS_LAGR_CELL_ID, c_id);
+      if (c_id > -1)
+        n_located++;
+    }
+
+    _sort(p_set);
+    _check_index(out, "tracking", p_set, n_cells, n_located);
+
+  }
+
+  /* Injection of new particles, appended to the set */
+
+  cs_lnum_t n_located = 0;
+  for (cs_lnum_t i = 0; i < p_set->n_particles; i++) {
+    if (cs_lagr_particles_get_lnum(p_set, i, CS_LAGR_CELL_ID) > -1)
+      n_located++;
+  }
+
+  for (cs_lnum_t i = 0; i < n_p; i++) {
+    cs_lnum_t j = p_set->n_particles + i;
+    cs_lagr_particles_set_lnum(p_set, j, CS_LAGR_CELL_ID,
+                               (i*104729) % n_cells);
+    cs_lagr_particles_set_real(p_set, j, CS_LAGR_MASS, n_p + i);
+  }
+  p_set->n_particles += n_p;
+  n_located += n_p;
+
+  _sort(p_set);
+  _check_index(out, "new injection", p_set, n_cells, n_located);
+
+  cs_lagr_particle_finalize();
+
+  cs_mesh_destroy(cs_glob_mesh);
+  cs_glob_mesh = NULL;
+}
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Main program to check the Lagrangian cell -> particles index
+ *
+ * \param[in]    argc
+ * \param[in]    argv
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+main(int    argc,
+     char  *argv[])
+{
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+
+  ci_log = fopen("Lagr_cell_index_tests.log", "w");
+
+  /* ============================================
+   * TEST of index after injection and tracking
+   * ============================================ */
+
+  _test_cell_index(ci_log);
+
+  fclose(ci_log);
+
+  printf("\n\n -->> Lagrangian cell index Tests (Done, %d failure(s))\n",
+         n_failures);
+
+  if (n_failures > 0)
+    exit(EXIT_FAILURE);
+
+  exit (EXIT_SUCCESS);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,418 @@
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_block_dist.h"
+#include "cs_halo.h"
+#include "cs_log.h"
+#include "cs_math.h"
+#include "cs_mesh.h"
+#include "cs_mesh_builder.h"
+#include "cs_mesh_from_builder.h"
+#include "cs_mesh_quantities.h"
+#include "cs_mesh_refine.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Local Macro definitions
+ *============================================================================*/
+
+#define _N_CELLS_DIR  3
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static FILE  *ma_log = NULL;
+
+static int  n_failures = 0;
+
+/*============================================================================
+ * Private function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Build a box mesh of n*n*n unit-sized hexahedra (serial only)
+ *
+ * \param[in]  n   number of cells in each direction
+ *
+ * \return  pointer to new mesh
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_mesh_t *
+_box_mesh(int  n)
+{
+  const int nv = n + 1;
+  const cs_gnum_t n_g_cells = n*n*n;
+  const cs_gnum_t n_g_vertices = nv*nv*nv;
+  const cs_gnum_t n_g_faces = 3*nv*n*n;
+
+  cs_mesh_t *m = cs_mesh_create();
+  cs_mesh_builder_t *mb = cs_mesh_builder_create();
+
+  m->n_g_cells = n_g_cells;
+  m->n_g_vertices = n_g_vertices;
+
+  m->n_families = 1;
+  m->n_max_family_items = 1;
+  BFT_MALLOC(m->family_item, 1, int);
+  m->family_item[0] = 0;
+
+  mb->n_g_faces = n_g_faces;
+  mb->n_g_face_connect_size = 4*n_g_faces;
+
+  cs_mesh_builder_define_block_dist(mb, 0, 1, 1, 0,
+                                    n_g_cells, n_g_faces, n_g_vertices);
+
+  BFT_MALLOC(mb->vertex_coords, n_g_vertices*3, cs_real_t);
+  for (int k = 0; k < nv; k++) {
+    for (int j = 0; j < nv; j++) {
+      for (int i = 0; i < nv; i++) {
+        cs_real_t *c = mb->vertex_coords + ((k*nv + j)*nv + i)*3;
+        c[0] = i; c[1] = j; c[2] = k;
+      }
+    }
+  }
+
+  BFT_MALLOC(mb->cell_gc_id, n_g_cells, int);
+  for (cs_gnum_t i = 0; i < n_g_cells; i++)
+    mb->cell_gc_id[i] = 1;
+
+  BFT_MALLOC(mb->face_cells, n_g_faces*2, cs_gnum_t);
+  BFT_MALLOC(mb->face_vertices_idx, n_g_faces + 1, cs_lnum_t);
+  BFT_MALLOC(mb->face_vertices, n_g_faces*4, cs_gnum_t);
+  BFT_MALLOC(mb->face_gc_id, n_g_faces, int);
+
+  /* Faces normal to direction d, oriented from the cell with lower
+     index in that direction to the next one (0 for the boundary) */
+
+  cs_lnum_t f_id = 0;
+  mb->face_vertices_idx[0] = 0;
+
+  for (int d = 0; d < 3; d++) {
+
+    const int d1 = (d+1)%3, d2 = (d+2)%3;
+
+    for (int l = 0; l < nv; l++) {
+      for (int b = 0; b < n; b++) {
+        for (int a = 0; a < n; a++) {
+
+          int ijk[3];
+          ijk[d] = l; ijk[d1] = a; ijk[d2] = b;
+
+          const int sh[4][2] = {{0, 0}, {1, 0}, {1, 1}, {0, 1}};
+          for (int v = 0; v < 4; v++) {
+            int vijk[3];
+            vijk[d] = l; vijk[d1] = a + sh[v][0]; vijk[d2] = b + sh[v][1];
+            mb->face_vertices[f_id*4 + v]
+              = (vijk[2]*nv + vijk[1])*nv + vijk[0] + 1;
+          }
+
+          for (int s = 0; s < 2; s++) {
+            int cijk[3] = {ijk[0], ijk[1], ijk[2]};
+            cijk[d] = l - 1 + s;
+            mb->face_cells[f_id*2 + s]
+              = (cijk[d] < 0 || cijk[d] >= n) ?
+                0 : (cijk[2]*n + cijk[1])*n + cijk[0] + 1;
+          }
+
+          mb->face_gc_id[f_id] = 1;
+          mb->face_vertices_idx[f_id+1] = (f_id+1)*4;
+          f_id++;
+
+        }
+      }
+    }
+
+  }
+
+  assert((cs_gnum_t)f_id == n_g_faces);
+
+  cs_mesh_from_builder(m, mb);
+  cs_mesh_init_halo(m, mb, CS_HALO_STANDARD);
+  cs_mesh_update_auxiliary(m);
+
+  cs_mesh_builder_destroy(&mb);
+
+  return m;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Log and check a value
+ *
+ * \param[in]  out    output file
+ * \param[in]  name   value name
+ * \param[in]  val    value
+ * \param[in]  ref    reference value
+ * \param[in]  tol    absolute tolerance
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_check(FILE        *out,
+       const char  *name,
+       double       val,
+       double       ref,
+       double       tol)
+{
+  fprintf(out, "  %-32s %12.5e (expected %12.5e)\n", name, val, ref);
+
+  if (!(CS_ABS(val - ref) <= tol)) {
+    fprintf(out, "  --> FAILED (tolerance %g)\n", tol);
+    n_failures += 1;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Check volume conservation and the rebuilt extended neighborhood
+ *          of a mesh
+ *
+ * Cells sharing a vertex but not a face with a given cell must be its
+ * extended neighbors.
+ *
+ * \param[in]  out      output file
+ * \param[in]  m        pointer to mesh
+ * \param[in]  tot_vol  expected total volume
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_check_mesh(FILE              *out,
+            const cs_mesh_t   *m,
+            double             tot_vol)
+{
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_vtx = m->n_vertices;
+
+  cs_mesh_quantities_t *mq = cs_mesh_quantities_create();
+  cs_mesh_quantities_compute(m, mq);
+
+  _check(out, "total volume", mq->tot_vol, tot_vol, 1e-12);
+  _check(out, "min. volume > 0", (mq->min_vol > 0) ? 1 : 0, 1, 0);
+  _check(out, "cells with ghosts",
+         m->n_cells_with_ghosts, n_cells, 0);
+
+  cs_mesh_quantities_destroy(mq);
+
+  /* Cell -> vertices and cell -> cells adjacency (dense, small meshes) */
+
+  char *c_v, *c_c;
+  BFT_MALLOC(c_v, n_cells*n_vtx, char);
+  BFT_MALLOC(c_c, n_cells*n_cells, char);
+  memset(c_v, 0, n_cells*n_vtx);
+  memset(c_c, 0, n_cells*n_cells);
+
+  for (cs_lnum_t f_id = 0; f_id < m->n_i_faces; f_id++) {
+    cs_lnum_t c0 = m->i_face_cells[f_id][0], c1 = m->i_face_cells[f_id][1];
+    for (cs_lnum_t i = m->i_face_vtx_idx[f_id];
+         i < m->i_face_vtx_idx[f_id+1];
+         i++) {
+      c_v[c0*n_vtx + m->i_face_vtx_lst[i]] = 1;
+      c_v[c1*n_vtx + m->i_face_vtx_lst[i]] = 1;
+    }
+    c_c[c0*n_cells + c1] = 1;
+    c_c[c1*n_cells + c0] = 1;
+  }
+  for (cs_lnum_t f_id = 0; f_id < m->n_b_faces; f_id++) {
+    cs_lnum_t c0 = m->b_face_cells[f_id];
+    for (cs_lnum_t i = m->b_face_vtx_idx[f_id];
+         i < m->b_face_vtx_idx[f_id+1];
+         i++)
+      c_v[c0*n_vtx + m->b_face_vtx_lst[i]] = 1;
+  }
+
+  cs_lnum_t n_missing = 0, n_extra = 0;
+
+  if (m->cell_cells_idx == NULL)
+    n_missing = 1;
+
+  else {
+
+    for (cs_lnum_t c0 = 0; c0 < n_cells; c0++) {
+      cs_lnum_t n_ext = 0;
+      for (cs_lnum_t c1 = 0; c1 < n_cells; c1++) {
+        if (c1 == c0 || c_c[c0*n_cells + c1])
+          continue;
+        bool shared = false;
+        for (cs_lnum_t v = 0; v < n_vtx && !shared; v++) {
+          if (c_v[c0*n_vtx + v] && c_v[c1*n_vtx + v])
+            shared = true;
+        }
+        if (shared == false)
+          continue;
+        n_ext++;
+        bool found = false;
+        for (cs_lnum_t i = m->cell_cells_idx[c0];
+             i < m->cell_cells_idx[c0+1];
+             i++) {
+          if (m->cell_cells_lst[i] == c1)
+            found = true;
+        }
+        if (found == false)
+          n_missing++;
+      }
+      cs_lnum_t n_lst = m->cell_cells_idx[c0+1] - m->cell_cells_idx[c0];
+      if (n_lst > n_ext)
+        n_extra += n_lst - n_ext;
+    }
+
+  }
+
+  _check(out, "missing extended neighbors", n_missing, 0, 0);
+  _check(out, "extra extended neighbors", n_extra, 0, 0);
+
+  BFT_FREE(c_c);
+  BFT_FREE(c_v);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Refine part of a box mesh, checking old to new mappings,
+ *          face generations, volumes and the rebuilt halo
+ *
+ * \param[in]  out   output file
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_test_refine(FILE  *out)
+{
+  const int n = _N_CELLS_DIR;
+  const double tot_vol = n*n*n;
+
+  cs_mesh_t *m = _box_mesh(n);
+
+  /* Refinement operates on the global mesh, and rebuilds
+     the halo in serial only when it is extended */
+
+  cs_glob_mesh = m;
+  m->verbosity = -1;
+  m->halo_type = CS_HALO_EXTENDED;
+  cs_mesh_init_halo(m, NULL, m->halo_type);
+  cs_mesh_update_auxiliary(m);
+
+  fprintf(out, "\n Initial mesh (%d cells)\n", (int)m->n_cells);
+  _check_mesh(out, m, tot_vol);
+
+  /* Refine the first cell */
+
+  const cs_lnum_t n_c_ini = m->n_cells;
+
+  int *flag;
+  BFT_MALLOC(flag, n_c_ini, int);
+  for (cs_lnum_t i = 0; i < n_c_ini; i++)
+    flag[i] = (i == 0) ? 1 : 0;
+
+  cs_lnum_t *c_o2n_idx = NULL;
+  cs_mesh_refine_simple_o2n(m, true, flag, &c_o2n_idx, NULL);
+
+  fprintf(out, "\n Refined mesh (%d cells)\n", (int)m->n_cells);
+  _check(out, "old to new index end",
+         c_o2n_idx[n_c_ini], m->n_cells, 0);
+  _check(out, "children of refined cell",
+         c_o2n_idx[1] - c_o2n_idx[0], 8, 0);
+  _check_mesh(out, m, tot_vol);
+
+  char r_gen_max = 0;
+  for (cs_lnum_t f_id = 0; f_id < m->n_i_faces; f_id++)
+    r_gen_max = CS_MAX(r_gen_max, m->i_face_r_gen[f_id]);
+  _check(out, "max. face generation", r_gen_max, 1, 0);
+
+  BFT_FREE(c_o2n_idx);
+  BFT_FREE(flag);
+
+  cs_glob_mesh = NULL;
+  cs_mesh_destroy(m);
+}
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Main program to check the mesh operations used by runtime
+ *         mesh adaptation
+ *
+ * \param[in]    argc
+ * \param[in]    argv
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+main(int    argc,
+     char  *argv[])
+{
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+
+#if defined(HAVE_OPENMP) /* Determine default number of OpenMP threads */
+  {
+    int t_id;
+#pragma omp parallel private(t_id)
+    {
+      t_id = omp_get_thread_num();
+      if (t_id == 0)
+        cs_glob_n_threads = omp_get_max_threads();
+    }
+  }
+#endif
+
+  ma_log = fopen("Mesh_adapt_tests.log", "w");
+
+  /* ============================================
+   * TEST of refinement and ghosts
+   * ============================================ */
+
+  _test_refine(ma_log);
+
+  fclose(ma_log);
+
+  printf("\n\n -->> Mesh adaptation Tests (Done, %d failure(s))\n",
+         n_failures);
+
+  if (n_failures > 0)
+    exit(EXIT_FAILURE);
+
+  exit (EXIT_SUCCESS);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,346 @@
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_block_dist.h"
+#include "cs_log.h"
+#include "cs_math.h"
+#include "cs_mesh.h"
+#include "cs_mesh_builder.h"
+#include "cs_mesh_from_builder.h"
+#include "cs_mesh_quantities.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Local Macro definitions
+ *============================================================================*/
+
+#define _N_CELLS_DIR  4
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static FILE  *mq_log = NULL;
+
+static int  n_failures = 0;
+
+/*============================================================================
+ * Private function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Build a box mesh of n*n*n unit-sized hexahedra (serial only)
+ *
+ * \param[in]  n   number of cells in each direction
+ *
+ * \return  pointer to new mesh
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_mesh_t *
+_box_mesh(int  n)
+{
+  const int nv = n + 1;
+  const cs_gnum_t n_g_cells = n*n*n;
+  const cs_gnum_t n_g_vertices = nv*nv*nv;
+  const cs_gnum_t n_g_faces = 3*nv*n*n;
+
+  cs_mesh_t *m = cs_mesh_create();
+  cs_mesh_builder_t *mb = cs_mesh_builder_create();
+
+  m->n_g_cells = n_g_cells;
+  m->n_g_vertices = n_g_vertices;
+
+  m->n_families = 1;
+  m->n_max_family_items = 1;
+  BFT_MALLOC(m->family_item, 1, int);
+  m->family_item[0] = 0;
+
+  mb->n_g_faces = n_g_faces;
+  mb->n_g_face_connect_size = 4*n_g_faces;
+
+  cs_mesh_builder_define_block_dist(mb, 0, 1, 1, 0,
+                                    n_g_cells, n_g_faces, n_g_vertices);
+
+  BFT_MALLOC(mb->vertex_coords, n_g_vertices*3, cs_real_t);
+  for (int k = 0; k < nv; k++) {
+    for (int j = 0; j < nv; j++) {
+      for (int i = 0; i < nv; i++) {
+        cs_real_t *c = mb->vertex_coords + ((k*nv + j)*nv + i)*3;
+        c[0] = i; c[1] = j; c[2] = k;
+      }
+    }
+  }
+
+  BFT_MALLOC(mb->cell_gc_id, n_g_cells, int);
+  for (cs_gnum_t i = 0; i < n_g_cells; i++)
+    mb->cell_gc_id[i] = 1;
+
+  BFT_MALLOC(mb->face_cells, n_g_faces*2, cs_gnum_t);
+  BFT_MALLOC(mb->face_vertices_idx, n_g_faces + 1, cs_lnum_t);
+  BFT_MALLOC(mb->face_vertices, n_g_faces*4, cs_gnum_t);
+  BFT_MALLOC(mb->face_gc_id, n_g_faces, int);
+
+  /* Faces normal to direction d, oriented from the cell with lower
+     index in that direction to the next one (0 for the boundary) */
+
+  cs_lnum_t f_id = 0;
+  mb->face_vertices_idx[0] = 0;
+
+  for (int d = 0; d < 3; d++) {
+
+    const int d1 = (d+1)%3, d2 = (d+2)%3;
+
+    for (int l = 0; l < nv; l++) {
+      for (int b = 0; b < n; b++) {
+        for (int a = 0; a < n; a++) {
+
+          int ijk[3];
+          ijk[d] = l; ijk[d1] = a; ijk[d2] = b;
+
+          const int sh[4][2] = {{0, 0}, {1, 0}, {1, 1}, {0, 1}};
+          for (int v = 0; v < 4; v++) {
+            int vijk[3];
+            vijk[d] = l; vijk[d1] = a + sh[v][0]; vijk[d2] = b + sh[v][1];
+            mb->face_vertices[f_id*4 + v]
+              = (vijk[2]*nv + vijk[1])*nv + vijk[0] + 1;
+          }
+
+          for (int s = 0; s < 2; s++) {
+            int cijk[3] = {ijk[0], ijk[1], ijk[2]};
+            cijk[d] = l - 1 + s;
+            mb->face_cells[f_id*2 + s]
+              = (cijk[d] < 0 || cijk[d] >= n) ?
+                0 : (cijk[2]*n + cijk[1])*n + cijk[0] + 1;
+          }
+
+          mb->face_gc_id[f_id] = 1;
+          mb->face_vertices_idx[f_id+1] = (f_id+1)*4;
+          f_id++;
+
+        }
+      }
+    }
+
+  }
+
+  assert((cs_gnum_t)f_id == n_g_faces);
+
+  cs_mesh_from_builder(m, mb);
+  cs_mesh_init_halo(m, mb, CS_HALO_STANDARD);
+  cs_mesh_update_auxiliary(m);
+
+  cs_mesh_builder_destroy(&mb);
+
+  return m;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Compare two arrays, logging the maximum difference
+ *
+ * \param[in]  out    output file
+ * \param[in]  name   array name
+ * \param[in]  n      number of values
+ * \param[in]  a      first array
+ * \param[in]  b      second array
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_compare(FILE             *out,
+         const char       *name,
+         cs_lnum_t         n,
+         const cs_real_t  *a,
+         const cs_real_t  *b)
+{
+  const cs_real_t tol = 1e-12;
+  cs_real_t d_max = 0.;
+
+  for (cs_lnum_t i = 0; i < n; i++) {
+    cs_real_t d = CS_ABS(a[i] - b[i]);
+    if (d > d_max)
+      d_max = d;
+  }
+
+  fprintf(out, "  %-16s max. difference: %12.5e\n", name, d_max);
+
+  if (d_max > tol) {
+    fprintf(out, "  --> FAILED (tolerance %g)\n", tol);
+    n_failures += 1;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Move some vertices of a mesh and compare incrementally updated
+ *          quantities with a full computation
+ *
+ * \param[in]  out        output file
+ * \param[in]  algo       cell center algorithm
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_test_update_moved(FILE  *out,
+                   int    algo)
+{
+  const int n = _N_CELLS_DIR, nv = _N_CELLS_DIR + 1;
+
+  fprintf(out, "\n Incremental update, cell center algorithm %d\n", algo);
+
+  cs_mesh_quantities_cell_cen_choice(algo);
+
+  cs_mesh_t *m = _box_mesh(n);
+
+  cs_mesh_quantities_t *mq = cs_mesh_quantities_create();
+  cs_mesh_quantities_t *mq_ref = cs_mesh_quantities_create();
+
+  cs_mesh_quantities_compute(m, mq);
+
+  /* Move an interior vertex and a boundary corner region, leaving
+     most of the mesh unchanged */
+
+  bool *vtx_moved;
+  BFT_MALLOC(vtx_moved, m->n_vertices, bool);
+  for (cs_lnum_t i = 0; i < m->n_vertices; i++)
+    vtx_moved[i] = false;
+
+  const int moved[3][3] = {{2, 2, 2}, {n, n, n}, {n, n-1, n}};
+  const cs_real_t disp[3][3] = {{0.1, -0.05, 0.2},
+                                {0.3, 0.2, 0.25},
+                                {0.15, 0., -0.1}};
+
+  for (int i = 0; i < 3; i++) {
+    cs_lnum_t v_id = (moved[i][2]*nv + moved[i][1])*nv + moved[i][0];
+    for (int j = 0; j < 3; j++)
+      m->vtx_coord[v_id*3 + j] += disp[i][j];
+    vtx_moved[v_id] = true;
+  }
+
+  cs_mesh_quantities_update_moved(m, vtx_moved, mq);
+  cs_mesh_quantities_compute(m, mq_ref);
+
+  _compare(out, "cell_cen", m->n_cells*3, mq->cell_cen, mq_ref->cell_cen);
+  _compare(out, "cell_vol", m->n_cells, mq->cell_vol, mq_ref->cell_vol);
+  _compare(out, "i_face_normal", m->n_i_faces*3,
+           mq->i_face_normal, mq_ref->i_face_normal);
+  _compare(out, "i_face_cog", m->n_i_faces*3,
+           mq->i_face_cog, mq_ref->i_face_cog);
+  _compare(out, "b_face_normal", m->n_b_faces*3,
+           mq->b_face_normal, mq_ref->b_face_normal);
+  _compare(out, "b_face_cog", m->n_b_faces*3,
+           mq->b_face_cog, mq_ref->b_face_cog);
+  _compare(out, "i_dist", m->n_i_faces, mq->i_dist, mq_ref->i_dist);
+  _compare(out, "b_dist", m->n_b_faces, mq->b_dist, mq_ref->b_dist);
+  _compare(out, "weight", m->n_i_faces, mq->weight, mq_ref->weight);
+  _compare(out, "dijpf", m->n_i_faces*3, mq->dijpf, mq_ref->dijpf);
+  _compare(out, "diipb", m->n_b_faces*3, mq->diipb, mq_ref->diipb);
+  _compare(out, "dofij", m->n_i_faces*3, mq->dofij, mq_ref->dofij);
+
+  cs_real_t vol[6] = {mq->min_vol, mq->max_vol, mq->tot_vol,
+                      mq->min_f_vol, mq->max_f_vol, mq->tot_f_vol};
+  cs_real_t vol_ref[6] = {mq_ref->min_vol, mq_ref->max_vol, mq_ref->tot_vol,
+                          mq_ref->min_f_vol, mq_ref->max_f_vol,
+                          mq_ref->tot_f_vol};
+
+  _compare(out, "volume bounds", 6, vol, vol_ref);
+
+  BFT_FREE(vtx_moved);
+
+  cs_mesh_quantities_destroy(mq_ref);
+  cs_mesh_quantities_destroy(mq);
+  cs_mesh_destroy(m);
+
+  cs_mesh_quantities_cell_cen_choice(0);
+}
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Main program to check incremental mesh quantities updates
+ *
+ * \param[in]    argc
+ * \param[in]    argv
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+main(int    argc,
+     char  *argv[])
+{
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+
+#if defined(HAVE_OPENMP) /* Determine default number of OpenMP threads */
+  {
+    int t_id;
+#pragma omp parallel private(t_id)
+    {
+      t_id = omp_get_thread_num();
+      if (t_id == 0)
+        cs_glob_n_threads = omp_get_max_threads();
+    }
+  }
+#endif
+
+  mq_log = fopen("Mesh_quantities_tests.log", "w");
+
+  /* ==============================================
+   * TEST of incremental updates for moving meshes
+   * ============================================== */
+
+  _test_update_moved(mq_log, 0);
+  _test_update_moved(mq_log, 1);
+
+  fclose(mq_log);
+
+  printf("\n\n -->> Mesh quantities Tests (Done, %d failure(s))\n",
+         n_failures);
+
+  if (n_failures > 0)
+    exit(EXIT_FAILURE);
+
+  exit (EXIT_SUCCESS);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,702 @@
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_log.h"
+#include "cs_math.h"
+#include "cs_matrix.h"
+#include "cs_sles.h"
+#include "cs_sles_it.h"
+#include "cs_sles_pc.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Local Macro definitions
+ *============================================================================*/
+
+#define _NX  7
+#define _NY  6
+
+/*============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+/* Small linear system based on a 2D grid, with its dense equivalent */
+
+typedef struct {
+
+  cs_lnum_t               n_rows;
+  cs_lnum_t               n_edges;
+  cs_lnum_2_t            *edges;
+  cs_real_t              *da;
+  cs_real_t              *xa;
+
+  cs_real_t              *dense;      /* row-major dense matrix */
+
+  cs_matrix_structure_t  *ms;
+  cs_matrix_t            *a;
+
+} _system_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static FILE  *sles_log = NULL;
+
+static int  n_failures = 0;
+
+/*============================================================================
+ * Private function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Build a non-symmetric, diagonally dominant MSR system based
+ *          on a nx*ny grid with 5-point connectivity
+ *
+ * \param[in]  nx   number of grid points in x direction
+ * \param[in]  ny   number of grid points in y direction
+ *
+ * \return  pointer to system
+ */
+/*----------------------------------------------------------------------------*/
+
+static _system_t *
+_system_create(int  nx,
+               int  ny)
+{
+  _system_t *s;
+  BFT_MALLOC(s, 1, _system_t);
+
+  const cs_lnum_t n_rows = nx*ny;
+  const cs_lnum_t n_edges = (nx-1)*ny + nx*(ny-1);
+
+  s->n_rows = n_rows;
+  s->n_edges = n_edges;
+
+  BFT_MALLOC(s->edges, n_edges, cs_lnum_2_t);
+  BFT_MALLOC(s->da, n_rows, cs_real_t);
+  BFT_MALLOC(s->xa, n_edges*2, cs_real_t);
+
+  cs_lnum_t e_id = 0;
+  for (int j = 0; j < ny; j++) {
+    for (int i = 0; i < nx; i++) {
+      if (i < nx-1) {
+        s->edges[e_id][0] = j*nx + i;
+        s->edges[e_id][1] = j*nx + i + 1;
+        e_id++;
+      }
+      if (j < ny-1) {
+        s->edges[e_id][0] = j*nx + i;
+        s->edges[e_id][1] = (j+1)*nx + i;
+        e_id++;
+      }
+    }
+  }
+  assert(e_id == n_edges);
+
+  /* Convection-diffusion like coefficients (upwind on one side) */
+
+  for (cs_lnum_t i = 0; i < n_rows; i++)
+    s->da[i] = 0.5 + 0.01*(i%5);
+
+  for (e_id = 0; e_id < n_edges; e_id++) {
+    cs_real_t d = 1. + 0.1*(e_id%3);
+    s->xa[e_id*2] = -d - 0.3;
+    s->xa[e_id*2 + 1] = -d;
+    s->da[s->edges[e_id][0]] += d + 0.3;
+    s->da[s->edges[e_id][1]] += d;
+  }
+
+  /* Dense equivalent */
+
+  BFT_MALLOC(s->dense, n_rows*n_rows, cs_real_t);
+  for (cs_lnum_t i = 0; i < n_rows*n_rows; i++)
+    s->dense[i] = 0.;
+  for (cs_lnum_t i = 0; i < n_rows; i++)
+    s->dense[i*n_rows + i] = s->da[i];
+  for (e_id = 0; e_id < n_edges; e_id++) {
+    cs_lnum_t i = s->edges[e_id][0], j = s->edges[e_id][1];
+    s->dense[i*n_rows + j] = s->xa[e_id*2];
+    s->dense[j*n_rows + i] = s->xa[e_id*2 + 1];
+  }
+
+  /* MSR matrix */
+
+  s->ms = cs_matrix_structure_create(CS_MATRIX_MSR,
+                                     true,
+                                     n_rows,
+                                     n_rows,
+                                     n_edges,
+                                     (const cs_lnum_2_t *)s->edges,
+                                     NULL,
+                                     NULL);
+
+  s->a = cs_matrix_create(s->ms);
+
+  cs_matrix_set_coefficients(s->a,
+                             false,
+                             NULL,
+                             NULL,
+                             n_edges,
+                             (const cs_lnum_2_t *)s->edges,
+                             s->da,
+                             s->xa);
+
+  return s;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Destroy a test system
+ *
+ * \param[in, out]  s   pointer to system pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_system_destroy(_system_t  **s)
+{
+  _system_t *_s = *s;
+
+  cs_matrix_release_coefficients(_s->a);
+  cs_matrix_destroy(&(_s->a));
+  cs_matrix_structure_destroy(&(_s->ms));
+
+  BFT_FREE(_s->dense);
+  BFT_FREE(_s->xa);
+  BFT_FREE(_s->da);
+  BFT_FREE(_s->edges);
+
+  BFT_FREE(*s);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Solve a dense system using Gaussian elimination
+ *          with partial pivoting
+ *
+ * \param[in]   n     number of rows
+ * \param[in]   a     row-major dense matrix
+ * \param[in]   b     right-hand side
+ * \param[out]  x     solution
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_dense_solve(cs_lnum_t         n,
+             const cs_real_t  *a,
+             const cs_real_t  *b,
+             cs_real_t        *x)
+{
+  cs_real_t *lu;
+  BFT_MALLOC(lu, n*n, cs_real_t);
+  memcpy(lu, a, n*n*sizeof(cs_real_t));
+  memcpy(x, b, n*sizeof(cs_real_t));
+
+  for (cs_lnum_t k = 0; k < n; k++) {
+    cs_lnum_t p = k;
+    for (cs_lnum_t i = k+1; i < n; i++) {
+      if (CS_ABS(lu[i*n + k]) > CS_ABS(lu[p*n + k]))
+        p = i;
+    }
+    if (p != k) {
+      for (cs_lnum_t j = 0; j < n; j++) {
+        cs_real_t t = lu[k*n + j];
+        lu[k*n + j] = lu[p*n + j];
+        lu[p*n + j] = t;
+      }
+      cs_real_t t = x[k]; x[k] = x[p]; x[p] = t;
+    }
+    for (cs_lnum_t i = k+1; i < n; i++) {
+      cs_real_t f = lu[i*n + k] / lu[k*n + k];
+      for (cs_lnum_t j = k; j < n; j++)
+        lu[i*n + j] -= f*lu[k*n + j];
+      x[i] -= f*x[k];
+    }
+  }
+
+  for (cs_lnum_t i = n-1; i > -1; i--) {
+    cs_real_t s = x[i];
+    for (cs_lnum_t j = i+1; j < n; j++)
+      s -= lu[i*n + j]*x[j];
+    x[i] = s / lu[i*n + i];
+  }
+
+  BFT_FREE(lu);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Apply a reference dense ILU(0) or symmetric Gauss-Seidel
+ *          preconditioner
+ *
+ * For ILU(0), the incomplete factorization is computed on the sparsity
+ * pattern of the dense matrix; for symmetric Gauss-Seidel, the
+ * preconditioner is (D+L) D^-1 (D+U).
+ *
+ * \param[in]   n     number of rows
+ * \param[in]   a     row-major dense matrix
+ * \param[in]   ilu   true for ILU(0), false for symmetric Gauss-Seidel
+ * \param[in]   b     input vector
+ * \param[out]  x     preconditioned vector
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_dense_pc_apply(cs_lnum_t         n,
+                const cs_real_t  *a,
+                bool              ilu,
+                const cs_real_t  *b,
+                cs_real_t        *x)
+{
+  cs_real_t *f;
+  BFT_MALLOC(f, n*n, cs_real_t);
+  memcpy(f, a, n*n*sizeof(cs_real_t));
+
+  if (ilu) {
+    for (cs_lnum_t i = 1; i < n; i++) {
+      for (cs_lnum_t k = 0; k < i; k++) {
+        if (CS_ABS(a[i*n + k]) <= 0)
+          continue;
+        f[i*n + k] /= f[k*n + k];
+        for (cs_lnum_t j = k+1; j < n; j++) {
+          if (CS_ABS(a[i*n + j]) > 0)
+            f[i*n + j] -= f[i*n + k]*f[k*n + j];
+        }
+      }
+    }
+  }
+  else {
+    for (cs_lnum_t i = 0; i < n; i++) {
+      for (cs_lnum_t k = 0; k < i; k++)
+        f[i*n + k] /= a[k*n + k];
+    }
+  }
+
+  /* Unit lower then upper triangular solves */
+
+  for (cs_lnum_t i = 0; i < n; i++) {
+    cs_real_t s = b[i];
+    for (cs_lnum_t j = 0; j < i; j++)
+      s -= f[i*n + j]*x[j];
+    x[i] = s;
+  }
+
+  for (cs_lnum_t i = n-1; i > -1; i--) {
+    cs_real_t s = x[i];
+    for (cs_lnum_t j = i+1; j < n; j++)
+      s -= f[i*n + j]*x[j];
+    x[i] = s / f[i*n + i];
+  }
+
+  BFT_FREE(f);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Compare two arrays, logging the maximum relative difference
+ *
+ * \param[in]  out    output file
+ * \param[in]  name   comparison name
+ * \param[in]  n      number of values
+ * \param[in]  a      first array
+ * \param[in]  b      reference array
+ * \param[in]  tol    relative tolerance
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_compare(FILE             *out,
+         const char       *name,
+         cs_lnum_t         n,
+         const cs_real_t  *a,
+         const cs_real_t  *b,
+         double            tol)
+{
+  cs_real_t d_max = 0., b_max = 0.;
+
+  for (cs_lnum_t i = 0; i < n; i++) {
+    d_max = CS_MAX(d_max, CS_ABS(a[i] - b[i]));
+    b_max = CS_MAX(b_max, CS_ABS(b[i]));
+  }
+
+  if (b_max > 0)
+    d_max /= b_max;
+
+  fprintf(out, "  %-40s max. rel. difference: %12.5e\n", name, d_max);
+
+  if (!(d_max <= tol)) {
+    fprintf(out, "  --> FAILED (tolerance %g)\n", tol);
+    n_failures += 1;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Compute a right-hand side for a test system
+ *
+ * \param[in]   n     number of values
+ * \param[in]   k     variant id
+ * \param[out]  b     right-hand side
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_rhs(cs_lnum_t   n,
+     int         k,
+     cs_real_t  *b)
+{
+  for (cs_lnum_t i = 0; i < n; i++)
+    b[i] = sin(0.3*(i+1)*(k+1)) + 0.1*k;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Check ILU(0) and symmetric Gauss-Seidel preconditioners
+ *          against dense reference implementations, both out of place
+ *          and in place
+ *
+ * \param[in]  out   output file
+ * \param[in]  s     test system
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_test_pc_apply(FILE       *out,
+               _system_t  *s)
+{
+  const cs_lnum_t n = s->n_rows;
+
+  fprintf(out, "\n Preconditioner application\n");
+
+  cs_real_t *b, *x, *x_ref;
+  BFT_MALLOC(b, n, cs_real_t);
+  BFT_MALLOC(x, n, cs_real_t);
+  BFT_MALLOC(x_ref, n, cs_real_t);
+
+  _rhs(n, 0, b);
+
+  for (int pc_id = 0; pc_id < 2; pc_id++) {
+
+    bool ilu = (pc_id == 0) ? true : false;
+
+    cs_sles_pc_t *pc = (ilu) ?
+      cs_sles_pc_ilu0_create() : cs_sles_pc_sgs_create();
+
+    cs_sles_pc_setup(pc, "pc_test", s->a, 0);
+
+    _dense_pc_apply(n, s->dense, ilu, b, x_ref);
+
+    char name[64];
+
+    cs_sles_pc_apply(pc, CS_HALO_ROTATION_COPY, b, x);
+    snprintf(name, 63, "%s (out of place)", cs_sles_pc_get_type(pc));
+    _compare(out, name, n, x, x_ref, 1e-12);
+
+    memcpy(x, b, n*sizeof(cs_real_t));
+    cs_sles_pc_apply(pc, CS_HALO_ROTATION_COPY, NULL, x);
+    snprintf(name, 63, "%s (in place)", cs_sles_pc_get_type(pc));
+    _compare(out, name, n, x, x_ref, 1e-12);
+
+    cs_sles_pc_free(pc);
+    cs_sles_pc_destroy(&pc);
+
+  }
+
+  BFT_FREE(x_ref);
+  BFT_FREE(x);
+  BFT_FREE(b);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Solve a test system with a given solver and preconditioner
+ *
+ * \param[in]   s         test system
+ * \param[in]   type      solver type
+ * \param[in]   pc_type   0: Jacobi, 1: ILU(0), 2: symmetric Gauss-Seidel
+ * \param[in]   b         right-hand side
+ * \param[out]  x         solution
+ *
+ * \return  convergence state
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_solve(_system_t          *s,
+       cs_sles_it_type_t   type,
+       int                 pc_type,
+       const cs_real_t    *b,
+       cs_real_t          *x)
+{
+  const cs_lnum_t n = s->n_rows;
+
+  cs_sles_it_t *c = cs_sles_it_create(type, 0, 1000, false);
+
+  if (pc_type > 0) {
+    cs_sles_pc_t *pc = (pc_type == 1) ?
+      cs_sles_pc_ilu0_create() : cs_sles_pc_sgs_create();
+    cs_sles_it_transfer_pc(c, &pc);
+  }
+
+  double r_norm = 0.;
+  for (cs_lnum_t i = 0; i < n; i++)
+    r_norm += b[i]*b[i];
+  r_norm = sqrt(r_norm);
+
+  for (cs_lnum_t i = 0; i < n; i++)
+    x[i] = 0.;
+
+  int n_iter = 0;
+  double residue = 0.;
+
+  cs_sles_it_setup(c, "sles_test", s->a, 0);
+
+  cs_sles_convergence_state_t cvg
+    = cs_sles_it_solve(c, "sles_test", s->a, 0, CS_HALO_ROTATION_COPY,
+                       1e-12, r_norm, &n_iter, &residue,
+                       b, x, 0, NULL);
+
+  cs_sles_it_free(c);
+
+  void *_c = c;
+  cs_sles_it_destroy(&_c);
+
+  return cvg;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Check solves preconditioned by ILU(0) and symmetric Gauss-Seidel
+ *          against a direct dense solve
+ *
+ * \param[in]  out   output file
+ * \param[in]  s     test system
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_test_pc_solve(FILE       *out,
+               _system_t  *s)
+{
+  const cs_lnum_t n = s->n_rows;
+
+  fprintf(out, "\n Preconditioned solves\n");
+
+  cs_real_t *b, *x, *x_ref;
+  BFT_MALLOC(b, n, cs_real_t);
+  BFT_MALLOC(x, n, cs_real_t);
+  BFT_MALLOC(x_ref, n, cs_real_t);
+
+  _rhs(n, 1, b);
+  _dense_solve(n, s->dense, b, x_ref);
+
+  const char *pc_name[] = {"ILU(0)", "symmetric Gauss-Seidel"};
+
+  for (int pc_type = 1; pc_type < 3; pc_type++) {
+
+    const cs_sles_it_type_t types[] = {CS_SLES_BICGSTAB, CS_SLES_GMRES};
+
+    for (int t_id = 0; t_id < 2; t_id++) {
+
+      char name[64];
+      snprintf(name, 63, "%s, %s", cs_sles_it_type_name[types[t_id]],
+               pc_name[pc_type-1]);
+
+      cs_sles_convergence_state_t cvg
+        = _solve(s, types[t_id], pc_type, b, x);
+
+      if (cvg != CS_SLES_CONVERGED) {
+        fprintf(out, "  %-40s --> FAILED (not converged)\n", name);
+        n_failures += 1;
+      }
+      else
+        _compare(out, name, n, x, x_ref, 1e-9);
+
+    }
+
+  }
+
+  BFT_FREE(x_ref);
+  BFT_FREE(x);
+  BFT_FREE(b);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Check communication-avoiding GMRES and BiCGstab against their
+ *          classical counterparts and a direct dense solve, for several
+ *          block sizes
+ *
+ * \param[in]  out   output file
+ * \param[in]  s     test system
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_test_ca_solvers(FILE       *out,
+                 _system_t  *s)
+{
+  const cs_lnum_t n = s->n_rows;
+
+  fprintf(out, "\n Communication-avoiding solvers\n");
+
+  cs_real_t *b, *x, *x_cl, *x_ref;
+  BFT_MALLOC(b, n, cs_real_t);
+  BFT_MALLOC(x, n, cs_real_t);
+  BFT_MALLOC(x_cl, n, cs_real_t);
+  BFT_MALLOC(x_ref, n, cs_real_t);
+
+  _rhs(n, 2, b);
+  _dense_solve(n, s->dense, b, x_ref);
+
+  const cs_sles_it_type_t cl_types[] = {CS_SLES_GMRES, CS_SLES_BICGSTAB};
+  const cs_sles_it_type_t ca_types[] = {CS_SLES_CA_GMRES,
+                                        CS_SLES_CA_BICGSTAB};
+  const int s_steps[] = {1, 2, 3, 5, 8};
+
+  const int s_step_ini = cs_sles_it_get_ca_s_step();
+
+  for (int t_id = 0; t_id < 2; t_id++) {
+
+    char name[64];
+
+    cs_sles_convergence_state_t cvg
+      = _solve(s, cl_types[t_id], 0, b, x_cl);
+
+    if (cvg != CS_SLES_CONVERGED) {
+      fprintf(out, "  %-40s --> FAILED (not converged)\n",
+              cs_sles_it_type_name[cl_types[t_id]]);
+      n_failures += 1;
+      continue;
+    }
+
+    for (int s_id = 0; s_id < 5; s_id++) {
+
+      cs_sles_it_set_ca_s_step(s_steps[s_id]);
+
+      cvg = _solve(s, ca_types[t_id], 0, b, x);
+
+      if (cvg != CS_SLES_CONVERGED) {
+        snprintf(name, 63, "%s, s = %d",
+                 cs_sles_it_type_name[ca_types[t_id]], s_steps[s_id]);
+        fprintf(out, "  %-40s --> FAILED (not converged)\n", name);
+        n_failures += 1;
+        continue;
+      }
+
+      snprintf(name, 63, "%s, s = %d (vs. %s)",
+               cs_sles_it_type_name[ca_types[t_id]], s_steps[s_id],
+               cs_sles_it_type_name[cl_types[t_id]]);
+      _compare(out, name, n, x, x_cl, 1e-9);
+
+      snprintf(name, 63, "%s, s = %d (vs. direct)",
+               cs_sles_it_type_name[ca_types[t_id]], s_steps[s_id]);
+      _compare(out, name, n, x, x_ref, 1e-9);
+
+    }
+
+  }
+
+  cs_sles_it_set_ca_s_step(s_step_ini);
+
+  BFT_FREE(x_ref);
+  BFT_FREE(x_cl);
+  BFT_FREE(x);
+  BFT_FREE(b);
+}
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Main program to check iterative linear solvers
+ *         and preconditioners
+ *
+ * \param[in]    argc
+ * \param[in]    argv
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+main(int    argc,
+     char  *argv[])
+{
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+
+#if defined(HAVE_OPENMP) /* Determine default number of OpenMP threads */
+  {
+    int t_id;
+#pragma omp parallel private(t_id)
+    {
+      t_id = omp_get_thread_num();
+      if (t_id == 0)
+        cs_glob_n_threads = omp_get_max_threads();
+    }
+  }
+#endif
+
+  sles_log = fopen("SLES_tests.log", "w");
+
+  _system_t *s = _system_create(_NX, _NY);
+
+  /* ==================================
+   * TEST of preconditioners and solves
+   * ================================== */
+
+  _test_pc_apply(sles_log, s);
+  _test_pc_solve(sles_log, s);
+  _test_ca_solvers(sles_log, s);
+
+  _system_destroy(&s);
+
+  fclose(sles_log);
+
+  printf("\n\n -->> SLES Tests (Done, %d failure(s))\n", n_failures);
+
+  if (n_failures > 0)
+    exit(EXIT_FAILURE);
+
+  exit (EXIT_SUCCESS);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -302,6 +302,38 @@ main (int argc, char *argv[])
       for (i = block_start; i < block_end; i++)
         bft_printf("  dval[%d] = %f\n", (int)i, (dbuf[i-block_start]));
 
+#if defined(HAVE_MPI)
+      if (rank < size - 1)
+        MPI_Send(&sync, 1, MPI_INT, rank + 1, 9876, MPI_COMM_WORLD);
+#endif
+
+      /* Test non-blocking read at saved offset */
+
+      cs_file_seek(f, off1, CS_FILE_SEEK_SET);
+
+      memset(dbuf, 0, (block_end_2 - block_start_2)*2*sizeof(double));
+      retval = cs_file_iread_block(f, dbuf, sizeof(double), 2,
+                                   block_start_2, block_end_2);
+
+      bft_printf("rank %d, offset after started read: %ld\n",
+                 rank, (long)cs_file_tell(f));
+
+      cs_file_wait(f);
+
+#if defined(HAVE_MPI) /* Serialize dump */
+      if (rank > 0)
+        MPI_Recv(&sync, 1, MPI_INT, rank - 1, 9876, MPI_COMM_WORLD, &status);
+#endif
+
+      bft_printf("\nNon-blocking read by rank %d (returned %d):\n\n",
+                 rank, (int)retval);
+      for (i = block_start_2; i < block_end_2; i++) {
+        bft_printf("  dval[%d] = %f\n", (int)(i*2 - 1),
+                   (dbuf[(i-block_start_2)*2]));
+        bft_printf("  dval[%d] = %f\n", (int)(i*2),
+                   (dbuf[(i-block_start_2)*2+1]));
+      }
+
 #if defined(HAVE_MPI)
       if (rank < size - 1)
         MPI_Send(&sync, 1, MPI_INT, rank + 1, 9876, MPI_COMM_WORLD);
@@ -366,6 +398,12 @@ main (int argc, char *argv[])
       bft_printf("rank %d, wrote %d block (buffer) values.\n",
                  rank, (int)retval);
 
+      retval = cs_file_iwrite_block(f, ibuf, sizeof(int), 2,
+                                    block_start_2, block_end_2);
+
+      bft_printf("rank %d, started writing %d block values.\n",
+                 rank, (int)retval);
+
       sprintf(buf, "fvm test file end");
       for (i = strlen(buf); i < 80; i++)
         buf[i] = '\0';
@@ -375,6 +413,8 @@ main (int argc, char *argv[])
       if (rank == 0)
         bft_printf("rank %d, wrote %d global values.\n", rank, (int)retval);
 
+      cs_file_wait(f);
+
       f = cs_file_free(f);
 
       if (access[a_id] < CS_FILE_MPI_INDEPENDENT)